@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+"""Measures the throughput of every MCODE lexer on a synthetic corpus.
+
+Generates a corpus with mcodegen, the same for the same seed and size,
+and lexes it with
+
+  mcodetok      the hand-written tokenizer (mcodetok -s)
+  mcodetok-dfa  the tokenizer generated from the grammar (mcodetok -d -s)
+  pygments      the Pygments lexer in grammars/mcodeLexer.py
+  textmate      the TextMate grammar in grammars/mcode.tmLanguage on
+                Oniguruma, scanned like TextMate: of all patterns of the
+                current context the one that matches first wins
+
+It prints MB/s and tokens/s per lexer and writes them with the corpus
+and the commit as JSON, so runs of different commits can be compared.
+Tokens are the spans mcodetok finds, the same number for every lexer;
+"spans" is the number a lexer emits itself. With --baseline, the run is
+compared to an earlier JSON file and fails if a lexer got slower by more
+than --max-slowdown.
+"""
+
+import argparse
+import ctypes
+import ctypes.util
+import json
+import os
+import plistlib
+import subprocess
+import sys
+import tempfile
+import time
+
+from regexbench import Oniguruma, OnigRegion
+
+LEXERS = ('mcodetok', 'mcodetok-dfa', 'pygments', 'textmate')
+ONIG_REGSET_POSITION_LEAD = 0
+
+
+def best_time(run, repeat):
+    best = None
+    result = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        result = run()
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best, result
+
+
+def mcodetok_spans(mcodetok, corpus, dfa):
+    args = [mcodetok, '-s'] + (['-d'] if dfa else []) + [corpus]
+    output = subprocess.run(args, check=True, capture_output=True, text=True).stdout
+    return sum(int(line.split()[1]) for line in output.splitlines())
+
+
+def pygments_spans(path, text):
+    from pygments.lexers import load_lexer_from_file
+    lexer = load_lexer_from_file(path, 'Hp41mcodeLexer')
+    return lambda: sum(1 for _ in lexer.get_tokens_unprocessed(text))
+
+
+class TextMate:
+    """Just enough of the TextMate tokenizer to time its regex work."""
+
+    def __init__(self, onig, path):
+        with open(path, 'rb') as f:
+            grammar = plistlib.load(f)
+        self.onig = onig
+        self.repository = grammar.get('repository', {})
+        self.scanners = {}
+        lib = onig.lib
+        lib.onig_regset_new.argtypes = [ctypes.POINTER(ctypes.c_void_p), ctypes.c_int,
+                                        ctypes.POINTER(ctypes.c_void_p)]
+        lib.onig_regset_search.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_char_p,
+                                           ctypes.c_char_p, ctypes.c_char_p, ctypes.c_int,
+                                           ctypes.c_uint, ctypes.POINTER(ctypes.c_int)]
+        lib.onig_regset_get_region.restype = ctypes.POINTER(OnigRegion)
+        lib.onig_regset_get_region.argtypes = [ctypes.c_void_p, ctypes.c_int]
+        self.main = self.scanner('main', grammar['patterns'], None)
+
+    def flatten(self, patterns, seen):
+        rules = []
+        for pattern in patterns:
+            if 'include' in pattern:
+                name = pattern['include'].lstrip('#')
+                if name not in seen:
+                    rules += self.flatten(self.repository[name].get('patterns', []), seen | {name})
+            else:
+                rules.append(pattern)
+        return rules
+
+    def scanner(self, key, patterns, end):
+        """Compiles the patterns of a context into one Oniguruma regset."""
+        if key in self.scanners:
+            return self.scanners[key]
+        entries = [(end, None)] if end is not None else []
+        entries += [(rule.get('match', rule.get('begin')), rule) for rule in self.flatten(patterns, frozenset())]
+        regs = (ctypes.c_void_p * len(entries))(*[self.onig.compile(regex) for regex, _ in entries])
+        regset = ctypes.c_void_p()
+        if self.onig.lib.onig_regset_new(ctypes.byref(regset), len(entries), regs) != 0:
+            raise ValueError('cannot build the scanner of ' + key)
+        self.scanners[key] = (regset, [rule for _, rule in entries])
+        return self.scanners[key]
+
+    def tokenize(self, data):
+        lib = self.onig.lib
+        match_pos = ctypes.c_int()
+        stack = [self.main]
+        spans = 0
+        for line in data.splitlines(True):
+            buf = ctypes.create_string_buffer(line, len(line))
+            base = ctypes.addressof(buf)
+            end = ctypes.c_char_p(base + len(line))
+            pos = 0
+            while pos < len(line):
+                regset, rules = stack[-1]
+                index = lib.onig_regset_search(regset, ctypes.c_char_p(base), end, ctypes.c_char_p(base + pos),
+                                               end, ONIG_REGSET_POSITION_LEAD, 0, ctypes.byref(match_pos))
+                if index < 0:
+                    break
+                match_end = lib.onig_regset_get_region(regset, index).contents.end[0]
+                rule = rules[index]
+                if rule is None:
+                    stack.pop()
+                elif 'begin' in rule:
+                    stack.append(self.scanner(rule['begin'], rule.get('patterns', []), rule['end']))
+                if match_end > match_pos.value:
+                    spans += rule is not None
+                    pos = match_end
+                elif rule is None or 'begin' in rule:
+                    pos = match_end
+                else:
+                    pos = match_pos.value + 1
+        return spans
+
+
+def git_commit(directory):
+    try:
+        return subprocess.run(['git', 'rev-parse', 'HEAD'], cwd=directory, check=True,
+                              capture_output=True, text=True).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def compare(results, baseline_path, max_slowdown):
+    with open(baseline_path) as f:
+        baseline = json.load(f)
+    failed = False
+    for name, result in results.items():
+        old = baseline.get('results', {}).get(name)
+        if not old:
+            continue
+        change = result['mb_per_s'] / old['mb_per_s'] - 1
+        slower = change < -max_slowdown
+        print('%-14s %+7.1f%% against %s%s' % (name, 100 * change, baseline.get('commit') or baseline_path,
+                                               ', too slow' if slower else ''))
+        failed |= slower
+    return failed
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description='Measure the throughput of the MCODE lexers.')
+    parser.add_argument('--mcodegen', required=True, help='path of the mcodegen executable')
+    parser.add_argument('--mcodetok', required=True, help='path of the mcodetok executable')
+    parser.add_argument('--grammars', default=os.path.join(root, 'grammars'),
+                        help='directory of the generated grammars (default: %(default)s)')
+    parser.add_argument('--onig', default=ctypes.util.find_library('onig') or 'libonig.so.5',
+                        help='Oniguruma library (default: %(default)s)')
+    parser.add_argument('--size', default='1M', help='corpus size, K, M or G may follow (default: %(default)s)')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--lexers', default=','.join(LEXERS), help='lexers to measure (default: %(default)s)')
+    parser.add_argument('--repeat', type=int, default=3, help='runs per lexer, the fastest counts')
+    parser.add_argument('--json', help='write the results to this file')
+    parser.add_argument('--baseline', help='results of an earlier run to compare with')
+    parser.add_argument('--max-slowdown', type=float, default=0.2,
+                        help='largest accepted loss of MB/s against the baseline (default: %(default)s)')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        corpus = os.path.join(tmp, 'corpus.src')
+        subprocess.run([args.mcodegen, '-s', str(args.seed), '-n', args.size, '-o', corpus], check=True)
+        with open(corpus, 'rb') as f:
+            data = f.read()
+        size = len(data)
+        tokens = mcodetok_spans(args.mcodetok, corpus, False)
+
+        runs = {}
+        for name in args.lexers.split(','):
+            if name in ('mcodetok', 'mcodetok-dfa'):
+                runs[name] = lambda dfa=name.endswith('dfa'): mcodetok_spans(args.mcodetok, corpus, dfa)
+            elif name == 'pygments':
+                try:
+                    runs[name] = pygments_spans(os.path.join(args.grammars, 'mcodeLexer.py'),
+                                                data.decode('latin-1'))
+                except ImportError as e:
+                    print('pygments not available: %s' % e, file=sys.stderr)
+            elif name == 'textmate':
+                try:
+                    textmate = TextMate(Oniguruma(args.onig), os.path.join(args.grammars, 'mcode.tmLanguage'))
+                    runs[name] = lambda: textmate.tokenize(data)
+                except (OSError, ValueError) as e:
+                    print('oniguruma not available: %s' % e, file=sys.stderr)
+            else:
+                parser.error('unknown lexer ' + name)
+
+        results = {}
+        print('%-14s %10s %12s %10s %10s' % ('lexer', 'seconds', 'tokens/s', 'MB/s', 'spans'))
+        for name, run in runs.items():
+            seconds, spans = best_time(run, args.repeat)
+            results[name] = {
+                'seconds': round(seconds, 6),
+                'mb_per_s': round(size / seconds / 1e6, 3),
+                'tokens_per_s': round(tokens / seconds),
+                'spans': spans,
+            }
+            print('%-14s %10.3f %12.0f %10.2f %10d' % (name, seconds, tokens / seconds, size / seconds / 1e6, spans))
+
+    report = {
+        'commit': git_commit(root),
+        'corpus': {'seed': args.seed, 'size': args.size, 'bytes': size, 'lines': data.count(b'\n'),
+                   'tokens': tokens},
+        'results': results,
+    }
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(report, f, indent=2)
+            f.write('\n')
+    if args.baseline and compare(results, args.baseline, args.max_slowdown):
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Profiles the Pygments lexer per grammar context.
+
+Wraps every rule of the lexer in grammars/mcodeLexer.py and counts its
+match attempts, its matches and the time spent matching, attributed to
+the grammar context the rule was generated from (the contexts attribute
+of the lexer). Characters that fall through to the '.' rule are counted
+as <fallback>, line ends as <newline> and the end of a pushed context
+as <pop>.
+
+Writes the same JSON and folded stacks as mcodetok -p and -f, so the
+Pygments lexer and the native lexers can be compared context by context,
+and so can two versions of the grammar: the context names are stable,
+the rules are not. Lexes the given files, or a corpus from mcodegen.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+FALLBACK = '<fallback>'
+
+
+def lexer_context(state):
+    return 'main' if state == 'root' else state.rsplit('__', 1)[0]
+
+
+class Profile:
+    def __init__(self, lexer):
+        names = getattr(lexer, 'contexts', None)
+        if names is None:
+            raise ValueError('the lexer has no contexts, regenerate it with mcodeiro')
+        self.entries = {}
+        tokens = {}
+        for state, rules in lexer._tokens.items():
+            if len(names.get(state, ())) != len(rules):
+                raise ValueError('the contexts of state %s do not match its rules' % state)
+            tokens[state] = [(self.counted(rexmatch, [lexer_context(state), name]), action, new_state)
+                             for (rexmatch, action, new_state), name in zip(rules, names[state])]
+        lexer._tokens = tokens
+        self.lexer = lexer
+
+    def counted(self, rexmatch, key):
+        entry = self.entries.setdefault(tuple(key), [0, 0, 0])
+        clock = time.perf_counter_ns
+
+        def match(text, pos):
+            start = clock()
+            m = rexmatch(text, pos)
+            entry[2] += clock() - start
+            entry[0] += 1
+            if m:
+                entry[1] += 1
+            return m
+        return match
+
+    def run(self, text):
+        for _ in self.lexer.get_tokens_unprocessed(text):
+            pass
+
+    def totals(self):
+        contexts = {}
+        for (_, name), entry in self.entries.items():
+            total = contexts.setdefault(name, [0, 0, 0])
+            for i in range(3):
+                total[i] += entry[i]
+        return contexts
+
+    def json(self, lines):
+        contexts = self.totals()
+        fallback = contexts.pop(FALLBACK, [0, 0, 0])
+        report = {'lexer': 'pygments', 'lines': lines, 'contexts': {}}
+        for name, (attempts, matches, nanoseconds) in contexts.items():
+            if attempts:
+                report['contexts'][name] = {'attempts': attempts, 'matches': matches, 'nanoseconds': nanoseconds}
+        report['contexts'][FALLBACK] = dict(zip(('attempts', 'matches', 'nanoseconds'), fallback))
+        report['fallback_characters'] = fallback[1]
+        return report
+
+    def folded(self):
+        lines = []
+        for (current, name), (_, _, nanoseconds) in self.entries.items():
+            if nanoseconds:
+                stack = 'main' if current == 'main' else 'main;' + current
+                lines.append('%s;%s %d\n' % (stack, name, nanoseconds))
+        return ''.join(lines)
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description='Profile the Pygments lexer per grammar context.')
+    parser.add_argument('files', nargs='*', help='MCODE sources to lex')
+    parser.add_argument('--lexer', default=os.path.join(root, 'grammars', 'mcodeLexer.py'),
+                        help='generated Pygments lexer (default: %(default)s)')
+    parser.add_argument('--mcodegen', help='without files, lex a corpus of this mcodegen executable')
+    parser.add_argument('--size', default='1M', help='corpus size, K, M or G may follow (default: %(default)s)')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--json', help='write the profile as JSON to this file')
+    parser.add_argument('--folded', help='write the time per context as folded stacks to this file')
+    args = parser.parse_args()
+    if not args.files and not args.mcodegen:
+        parser.error('give files or --mcodegen')
+
+    from pygments.lexers import load_lexer_from_file
+    profile = Profile(load_lexer_from_file(args.lexer, 'Hp41mcodeLexer'))
+    lines = 0
+    with tempfile.TemporaryDirectory() as tmp:
+        files = args.files
+        if not files:
+            files = [os.path.join(tmp, 'corpus.src')]
+            subprocess.run([args.mcodegen, '-s', str(args.seed), '-n', args.size, '-o', files[0]], check=True)
+        for path in files:
+            with open(path, 'rb') as f:
+                text = f.read().decode('latin-1')
+            lines += text.count('\n')
+            profile.run(text)
+
+    report = profile.json(lines)
+    total = sum(c['nanoseconds'] for c in report['contexts'].values()) or 1
+    print('%-24s %10s %10s %10s %6s' % ('context', 'attempts', 'matches', 'ms', '%'))
+    for name, c in sorted(report['contexts'].items(), key=lambda item: -item[1]['nanoseconds']):
+        print('%-24s %10d %10d %10.1f %6.1f' % (name, c['attempts'], c['matches'], c['nanoseconds'] / 1e6,
+                                                100.0 * c['nanoseconds'] / total))
+    print('%d fallback characters in %d lines' % (report['fallback_characters'], lines))
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(report, f, indent=2)
+            f.write('\n')
+    if args.folded:
+        with open(args.folded, 'w') as f:
+            f.write(profile.folded())
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""Measures the keystroke latency of the MCODE language server.
+
+Opens a corpus from mcodegen, cut to --lines lines, in mcodelsp and
+types into it like an editor: every keystroke inserts a character,
+deletes one, or breaks or joins a line at a random place, sends it as an
+incremental didChange and asks for the semantic tokens delta right
+away. The latency of a keystroke is the time from sending the change to
+receiving the delta, the diagnostics the server publishes in between
+included. It prints the percentiles and fails if the p99 is above
+--max-p99 milliseconds.
+
+The deltas are applied to the tokens of the first full response, and at
+the end the result must equal a new full response and the spans
+mcodetok finds in the edited text, so the run also checks that
+re-lexing only the edited lines gives the tokens of the whole document.
+"""
+
+import argparse
+import json
+import os
+import random
+import subprocess
+import sys
+import tempfile
+import time
+
+STYLES = ('comment', 'annotation', 'error', 'directive', 'label', 'mnemonic', 'operand', 'string', 'decimal',
+          'hexadecimal', 'code')
+TYPED = 'ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789=?-+ ;(.'
+
+
+class Server:
+    def __init__(self, path):
+        self.process = subprocess.Popen([path], stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+        self.next_id = 0
+
+    def send(self, message):
+        body = json.dumps(dict(message, jsonrpc='2.0')).encode()
+        self.process.stdin.write(b'Content-Length: %d\r\n\r\n%s' % (len(body), body))
+        self.process.stdin.flush()
+
+    def receive(self):
+        """Returns the body of the next message, unparsed."""
+        length = None
+        while True:
+            line = self.process.stdout.readline()
+            if not line:
+                raise EOFError('mcodelsp ended')
+            if line in (b'\r\n', b'\n'):
+                break
+            if line.lower().startswith(b'content-length:'):
+                length = int(line.split(b':')[1])
+        return self.process.stdout.read(length)
+
+    def request(self, method, params):
+        self.next_id += 1
+        self.send({'id': self.next_id, 'method': method, 'params': params})
+        tag = b'"id":%d,' % self.next_id
+        while True:
+            # leaves the diagnostics unparsed, an editor handles them
+            # apart from the tokens
+            body = self.receive()
+            if tag in body[:64]:
+                message = json.loads(body)
+                if 'error' in message:
+                    raise RuntimeError('%s: %s' % (method, message['error']['message']))
+                return message['result']
+
+    def notify(self, method, params):
+        self.send({'method': method, 'params': params})
+
+    def close(self):
+        self.request('shutdown', None)
+        self.notify('exit', None)
+        return self.process.wait()
+
+
+def apply_delta(data, result):
+    for edit in sorted(result['edits'], key=lambda e: -e['start']):
+        data[edit['start']:edit['start'] + edit['deleteCount']] = edit.get('data', [])
+    return data
+
+
+def keystroke(lines, rng):
+    """Edits lines in place and returns the change as LSP sends it."""
+    line = rng.randrange(len(lines))
+    column = rng.randint(0, len(lines[line]))
+    kind = rng.random()
+    if kind < 0.8:
+        ch = rng.choice(TYPED)
+        lines[line] = lines[line][:column] + ch + lines[line][column:]
+        return {'range': span(line, column, line, column), 'text': ch}
+    if kind < 0.9 and column > 0:
+        lines[line] = lines[line][:column - 1] + lines[line][column:]
+        return {'range': span(line, column - 1, line, column), 'text': ''}
+    if kind < 0.95 or line + 1 == len(lines):
+        lines[line:line + 1] = [lines[line][:column], lines[line][column:]]
+        return {'range': span(line, column, line, column), 'text': '\n'}
+    end = len(lines[line])
+    lines[line:line + 2] = [lines[line] + lines[line + 1]]
+    return {'range': span(line, end, line + 1, 0), 'text': ''}
+
+
+def span(line, column, end_line, end_column):
+    return {'start': {'line': line, 'character': column}, 'end': {'line': end_line, 'character': end_column}}
+
+
+def mcodetok_tokens(mcodetok, text, tmp):
+    path = os.path.join(tmp, 'edited.src')
+    with open(path, 'w', encoding='latin-1', newline='\n') as f:
+        f.write(text)
+    starts = [0]
+    for line in text.split('\n'):
+        starts.append(starts[-1] + len(line) + 1)
+    output = subprocess.run([mcodetok, path], check=True, capture_output=True, text=True).stdout
+    data = []
+    previous_line = previous_start = 0
+    line = 0
+    for row in output.splitlines():
+        offset, length, style = row.split()[:3]
+        offset = int(offset)
+        while starts[line + 1] <= offset:
+            line += 1
+        start = offset - starts[line]
+        delta_start = start - previous_start if line == previous_line else start
+        data += [line - previous_line, delta_start, int(length), STYLES.index(style), 0]
+        previous_line, previous_start = line, start
+    return data
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(p / 100.0 * len(values)))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Measure the keystroke latency of mcodelsp.')
+    parser.add_argument('mcodelsp', help='mcodelsp executable')
+    parser.add_argument('--mcodegen', required=True, help='mcodegen executable for the corpus')
+    parser.add_argument('--mcodetok', help='check the final tokens against this mcodetok executable')
+    parser.add_argument('--lines', type=int, default=50000, help='lines of the document (default: %(default)s)')
+    parser.add_argument('--keystrokes', type=int, default=2000, help='(default: %(default)s)')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--max-p99', type=float, default=5.0, help='milliseconds (default: %(default)s)')
+    parser.add_argument('--json', help='write the latencies as JSON to this file')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        corpus = os.path.join(tmp, 'corpus.src')
+        size = 1 << 20
+        while True:
+            subprocess.run([args.mcodegen, '-s', str(args.seed), '-n', str(size), '-o', corpus], check=True)
+            with open(corpus, 'rb') as f:
+                lines = f.read().decode('latin-1').split('\n')
+            if len(lines) > args.lines:
+                break
+            size *= 2
+        lines = lines[:args.lines]
+        uri = 'file://' + corpus
+
+        server = Server(args.mcodelsp)
+        server.request('initialize', {'processId': None, 'rootUri': None, 'capabilities': {}})
+        server.notify('initialized', {})
+        start = time.perf_counter()
+        server.notify('textDocument/didOpen', {'textDocument': {
+            'uri': uri, 'languageId': 'hp41mcode', 'version': 1, 'text': '\n'.join(lines)}})
+        result = server.request('textDocument/semanticTokens/full', {'textDocument': {'uri': uri}})
+        opened = time.perf_counter() - start
+        data = result['data']
+        result_id = result['resultId']
+
+        rng = random.Random(args.seed)
+        latencies = []
+        for version in range(2, args.keystrokes + 2):
+            change = keystroke(lines, rng)
+            start = time.perf_counter()
+            server.notify('textDocument/didChange', {'textDocument': {'uri': uri, 'version': version},
+                                                     'contentChanges': [change]})
+            result = server.request('textDocument/semanticTokens/full/delta',
+                                    {'textDocument': {'uri': uri}, 'previousResultId': result_id})
+            latencies.append((time.perf_counter() - start) * 1000)
+            data = apply_delta(data, result) if 'edits' in result else result['data']
+            result_id = result['resultId']
+
+        full = server.request('textDocument/semanticTokens/full', {'textDocument': {'uri': uri}})['data']
+        if server.close() != 0:
+            print('mcodelsp did not exit cleanly', file=sys.stderr)
+            return 1
+        if full != data:
+            print('the deltas do not add up to the full tokens', file=sys.stderr)
+            return 1
+        if args.mcodetok and mcodetok_tokens(args.mcodetok, '\n'.join(lines), tmp) != full:
+            print('the tokens differ from those of mcodetok', file=sys.stderr)
+            return 1
+
+    report = {'lines': args.lines, 'keystrokes': args.keystrokes, 'open_ms': opened * 1000,
+              'p50_ms': percentile(latencies, 50), 'p90_ms': percentile(latencies, 90),
+              'p99_ms': percentile(latencies, 99), 'max_ms': max(latencies)}
+    print('open and full tokens of %d lines: %.1f ms' % (args.lines, report['open_ms']))
+    print('keystroke latency: p50 %.2f ms, p90 %.2f ms, p99 %.2f ms, max %.2f ms' %
+          (report['p50_ms'], report['p90_ms'], report['p99_ms'], report['max_ms']))
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(report, f, indent=2)
+            f.write('\n')
+    if report['p99_ms'] > args.max_p99:
+        print('p99 above %.1f ms' % args.max_p99, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""Times the worst-case lines of the grammar patterns on real engines.
+
+Runs mcodeiro -b to get a worst-case line per loop of a pattern, a
+prefix, a pump repeated n times and a suffix, and lexes it at growing n
+the way the editors do:
+
+  re    Python's re with the grammar pattern, matched at every position
+        like Pygments
+  onig  Oniguruma with the pattern of the TextMate grammar, searched from
+        the end of the last match like TextMate
+
+and prints the time and its growth exponent per engine. Exits with 1 if
+an exponent is above --max-degree or mcodeiro fails its own check.
+"""
+
+import argparse
+import ctypes
+import ctypes.util
+import json
+import math
+import os
+import plistlib
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+SIZES = (1000, 2000, 4000)
+
+
+class OnigErrorInfo(ctypes.Structure):
+    _fields_ = [('enc', ctypes.c_void_p),
+                ('par', ctypes.c_char_p),
+                ('par_end', ctypes.c_char_p)]
+
+
+class OnigRegion(ctypes.Structure):
+    _fields_ = [('allocated', ctypes.c_int),
+                ('num_regs', ctypes.c_int),
+                ('beg', ctypes.POINTER(ctypes.c_int)),
+                ('end', ctypes.POINTER(ctypes.c_int))]
+
+
+class Oniguruma:
+    def __init__(self, path):
+        lib = ctypes.CDLL(path)
+        self.lib = lib
+        self.utf8 = ctypes.addressof(ctypes.c_int.in_dll(lib, 'OnigEncodingUTF8'))
+        self.ruby = ctypes.addressof(ctypes.c_int.in_dll(lib, 'OnigSyntaxRuby'))
+        lib.onig_new.argtypes = [ctypes.POINTER(ctypes.c_void_p), ctypes.c_char_p, ctypes.c_char_p,
+                                 ctypes.c_uint, ctypes.c_void_p, ctypes.c_void_p,
+                                 ctypes.POINTER(OnigErrorInfo)]
+        lib.onig_search.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_char_p,
+                                    ctypes.c_char_p, ctypes.c_char_p,
+                                    ctypes.POINTER(OnigRegion), ctypes.c_uint]
+        lib.onig_region_new.restype = ctypes.POINTER(OnigRegion)
+        lib.onig_free.argtypes = [ctypes.c_void_p]
+        encodings = (ctypes.c_void_p * 1)(self.utf8)
+        lib.onig_initialize(encodings, 1)
+        self.region = lib.onig_region_new()
+
+    def compile(self, pattern):
+        # onig_new takes the end of the pattern, so it must stay in a buffer
+        reg = ctypes.c_void_p()
+        data = pattern.encode('utf-8')
+        buf = ctypes.create_string_buffer(data, len(data))
+        base = ctypes.addressof(buf)
+        if self.lib.onig_new(ctypes.byref(reg), ctypes.c_char_p(base), ctypes.c_char_p(base + len(data)),
+                             0, self.utf8, self.ruby, ctypes.byref(OnigErrorInfo())) != 0:
+            raise ValueError('cannot compile ' + pattern)
+        return reg
+
+    def scan(self, reg, line):
+        """Lexes line like TextMate: search, continue after the match."""
+        data = line.encode('utf-8')
+        buf = ctypes.create_string_buffer(data, len(data))
+        base = ctypes.addressof(buf)
+        end = ctypes.c_char_p(base + len(data))
+        pos = 0
+        while pos < len(data):
+            start = ctypes.c_char_p(base + pos)
+            found = self.lib.onig_search(reg, ctypes.c_char_p(base), end, start, end, self.region, 0)
+            if found < 0:
+                break
+            pos = max(self.region.contents.end[0], found + 1)
+
+
+def python_scan(regex, line):
+    """Lexes line like Pygments: match at every position."""
+    pos = 0
+    while pos < len(line):
+        m = regex.match(line, pos)
+        pos = m.end() if m and m.end() > pos else pos + 1
+
+
+def seconds(scan, line, repeat):
+    best = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        scan(line)
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def exponent(times):
+    if times[0] <= 0 or times[-1] <= 0:
+        return 0.0
+    return math.log(times[-1] / times[0], 2) / (len(times) - 1)
+
+
+def textmate_patterns(path):
+    with open(path, 'rb') as f:
+        grammar = plistlib.load(f)
+    patterns = {}
+    for name, context in grammar.get('repository', {}).items():
+        for pattern in context.get('patterns', []):
+            if 'match' in pattern or 'begin' in pattern:
+                patterns[name] = pattern.get('match', pattern.get('begin'))
+                break
+    return patterns
+
+
+def degree_name(degree):
+    return 'exp' if degree < 0 else 'n^%d' % degree
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Time worst-case grammar lines on regex engines.')
+    parser.add_argument('mcodeiro', help='path of the mcodeiro executable')
+    parser.add_argument('--grammar', help='TextMate grammar for the Oniguruma patterns')
+    parser.add_argument('--onig', default=ctypes.util.find_library('onig') or 'libonig.so.5',
+                        help='Oniguruma library (default: %(default)s)')
+    parser.add_argument('--max-degree', type=float, default=2.5,
+                        help='largest growth exponent accepted (default: %(default)s)')
+    parser.add_argument('--repeat', type=int, default=3)
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, 'attacks.json')
+        checked = subprocess.run([args.mcodeiro, '-b', path], stdout=subprocess.DEVNULL)
+        with open(path) as f:
+            attacks = json.load(f)
+
+    engines = ['re']
+    onig = None
+    tm_patterns = textmate_patterns(args.grammar) if args.grammar else {}
+    try:
+        onig = Oniguruma(args.onig)
+        engines.append('onig')
+    except (OSError, ValueError) as e:
+        print('oniguruma not available: %s' % e, file=sys.stderr)
+
+    failed = checked.returncode != 0
+    print('%-24s %-8s %-6s %-6s %s' % ('context', 'engine', 'check', 'exp', 'seconds at n = ' +
+                                        ', '.join(str(n) for n in SIZES)))
+    for attack in attacks:
+        name = attack['context']
+        check = degree_name(attack['line'])
+        if attack['attempt'] < 0 or attack['line'] < 0:
+            print('%-24s %-8s %-6s skipped, exponential' % (name, '-', check))
+            failed = True
+            continue
+        lines = [attack['prefix'] + attack['pump'] * n + attack['suffix'] for n in SIZES]
+        for engine in engines:
+            if engine == 're':
+                regex = re.compile(attack['regex'])
+                scan = lambda line: python_scan(regex, line)
+            else:
+                reg = onig.compile(tm_patterns.get(name, attack['regex']))
+                scan = lambda line: onig.scan(reg, line)
+            times = [seconds(scan, line, args.repeat) for line in lines]
+            growth = exponent(times)
+            print('%-24s %-8s %-6s %-6.2f %s' % (name, engine, check, growth,
+                                                ', '.join('%.4f' % t for t in times)))
+            if growth > args.max_degree:
+                failed = True
+            if engine == 'onig':
+                onig.lib.onig_free(reg)
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -1,4 +1,6 @@
-from pygments.lexer import RegexLexer, bygroups
+# Generated by mcodeiro, do not edit.
+
+from pygments.lexer import RegexLexer, bygroups, words
 from pygments.token import *
 
 import re
@@ -11,135 +13,242 @@ class Hp41mcodeLexer(RegexLexer):
     filenames = ['*.src']
     flags = re.MULTILINE | re.UNICODE
 
+    def analyse_text(text):
+        if re.match(u'^\\.(?:HP|JDA|ZENCODE|TITLE)\\b', text):
+            return 0.5
+        return 0.0
+
+    # grammar context of each rule in tokens, '<pop>' for the end of a
+    # pushed context, '<newline>' and '<fallback>' for what no rule matches
+    contexts = {
+        'root' : [
+                'comment', 'annotation', 'data', 'simple_directive', 'string_directive',
+                'number_directive', 'address_directive', 'symbol_directive', 'code_literal',
+                'instruction_none', 'instruction_number', 'instruction_address',
+                'instruction_register', 'instruction_class2', 'instruction_class3',
+                'instruction_special1', 'instruction_special2', 'local_label', 'global_label',
+                '<newline>', '<fallback>'],
+        'simple_directive__1' : [
+                '<pop>', 'comment', '<newline>', '<fallback>'],
+        'string_directive__1' : [
+                '<pop>', 'string', 'comment', '<newline>', '<fallback>'],
+        'number_directive__1' : [
+                '<pop>', 'dec_number', 'comment', '<newline>', '<fallback>'],
+        'address_directive__1' : [
+                '<pop>', 'address', 'comment', '<newline>', '<fallback>'],
+        'symbol_directive__1' : [
+                '<pop>', 'local_label', 'global_label', 'address', 'comment', '<newline>',
+                '<fallback>'],
+        'code_literal__1' : [
+                '<pop>', 'code', 'comment', '<newline>', '<fallback>'],
+        'instruction_none__1' : [
+                '<pop>', 'comment', '<newline>', '<fallback>'],
+        'instruction_number__1' : [
+                '<pop>', 'dec_number', 'comment', '<newline>', '<fallback>'],
+        'instruction_address__1' : [
+                '<pop>', 'address', 'local_label', 'global_label', 'comment', '<newline>',
+                '<fallback>'],
+        'instruction_class2__1' : [
+                '<pop>', 'tef', 'comment', '<newline>', '<fallback>'],
+        'instruction_class3__1' : [
+                '<pop>', 'positive_displacement', 'negative_displacement', 'local_label',
+                'global_label', 'address', 'comment', '<newline>', '<fallback>'],
+        'instruction_register__1' : [
+                '<pop>', 'register', 'comment', '<newline>', '<fallback>'],
+        'instruction_special1__1' : [
+                '<pop>', 'hex_number', 'comment', '<newline>', '<fallback>'],
+        'instruction_special2__1' : [
+                '<pop>', 'code', 'local_label', 'global_label', 'comment', '<newline>',
+                '<fallback>'],
+    }
+
     tokens = {
         'root' : [
             (u'(;.*)', bygroups(Comment)),
             (u'(\\*\\*\\* ERROR.*)|(\\*.*)', bygroups(Generic.Error, Comment.Preproc)),
-            (u'([0-9A-F]{4}\\s+)((?:[0-3][0-9A-F]{2}){1,3})', bygroups(Number.Hex, Number.Bin)),
-            (u'(\\.(HP|JDA|ZENCODE))', bygroups(Name.Builtin), 'simple_directive__1'),
-            (u'(\\.(TITLE|TEXT|NAME|MESSL))', bygroups(Name.Builtin), 'string_directive__1'),
+            (u'([0-9A-F]{4}[ \\t]+)((?:[0-3][0-9A-F]{2}){1,3})', bygroups(Number.Hex, Number.Bin)),
+            (words((
+                u'HP', u'JDA', u'ZENCODE'), prefix=u'\\.'), Name.Builtin, 'simple_directive__1'),
+            (words((
+                u'TITLE', u'TEXT', u'NAME', u'MESSL'), prefix=u'\\.'), Name.Builtin, 'string_directive__1'),
             (u'(\\.BSS)', bygroups(Name.Builtin), 'number_directive__1'),
-            (u'(\\.(FILLTO|ORG))', bygroups(Name.Builtin), 'address_directive__1'),
+            (words((
+                u'FILLTO', u'ORG'), prefix=u'\\.'), Name.Builtin, 'address_directive__1'),
             (u'(\\.EQU)', bygroups(Name.Builtin), 'symbol_directive__1'),
             (u'(#)', bygroups(Name.Builtin), 'code_literal__1'),
-            (u'(FETCHS&X|PRPHSLCT|READDATA|WRITDATA|\\?LOWBAT|A=B=C=0|C=CANDA|ENBANK1|ENBANK2|ENBANK3|ENBANK4|ENDREAD|ENDWRIT|GOTOADR|PERSLCT|PUSHADR|RAMSLCT|RDABC1L|RDABC1R|RDABC4L|RTIMEST|TIMER=A|TIMER=B|WKUPOFF|WRABC1L|WRABC1R|WRABC4L|WRABC4R|\\?F10=1|\\?F11=1|\\?F12=1|\\?F13=1|\\?NCRTN|\\?S10=1|\\?S11=1|\\?S12=1|\\?S13=1|\\?TFAIL|ALARM\\?|ALMOFF|C=CORA|C=DATA|C=KEYS|CLRABC|CLRKEY|CLRRTN|CRDEXF|CRDFLG|CRDINF|CRDOHF|CRDWPF|DADD=C|DATA=C|DISOFF|DISTOG|DSPOFF|DSPTOG|DSWKUP|ENREAD|ENROM1|ENROM2|ENROM3|ENROM4|ENWKUP|ENWRIT|ERROR\\?|FLLABC|FLLDAB|FLSDAB|FRSABC|FRSDAB|GOKEYS|GTOKEY|PFAD=C|POPADR|POWOFF|POWON\\?|RCTIME|RDA12L|RDAB1L|RDAB1R|RDAB6L|RDB12L|RDC12L|RDTIME|READAN|READEN|RTNCPU|SETCTF|SETDEC|SETHEX|SLLABC|SLLDAB|SLSABC|SLSDAB|SPOPND|SRLABC|SRLDAB|SRSABC|SRSDAB|STARTC|STATUS|STPINT|STREAD|STWRIT|TCLCRD|TCLCTF|TRPCRD|TSTBUF|WDTIME|WINTST|WKUPON|WRA12L|WRAB1L|WRAB1R|WRAB6L|WRAB6R|WRB12L|WRC12L|WRITAN|WRTIME|WTIME\\-|\\?CRDR|\\?CRTN|\\?EDAV|\\?F0=1|\\?F1=1|\\?F2=1|\\?F3=1|\\?F4=1|\\?F5=1|\\?F6=1|\\?F7=1|\\?F8=1|\\?F9=1|\\?FRAV|\\?FRNS|\\?IFCR|\\?ORAV|\\?PBSY|\\?S0=1|\\?S1=1|\\?S2=1|\\?S3=1|\\?S4=1|\\?S5=1|\\?S6=1|\\?S7=1|\\?S8=1|\\?S9=1|\\?SERV|\\?SRQR|\\?WNDB|ABC=0|ALMON|BUSY\\?|C<>ST|C=C!A|C=C&A|C=C\\.A|C=KEY|C=STK|CHKKB|CLRST|CSTEX|CXISA|DECPT|DSALM|ENALM|FEXSB|FLLDA|FLLDB|FLLDC|FLSDA|FLSDB|FLSDC|FRAV\\?|FRNS\\?|FRSDA|FRSDB|FRSDC|GOTOC|IFCR\\?|INCPT|NCRTN|ORAV\\?|PRINT|R=R\\+1|R=R\\-1|RABCL|RABCR|RDA1L|RDA1R|RDALM|RDATA|RDB1L|RDB1R|RDC1L|RDC1R|RDINT|RDROM|RDSCR|RDSTS|RSTKB|RTIME|RTNNC|SLCTP|SLCTQ|SLSDA|SLSDB|SRLDA|SRLDB|SRLDC|SRQR\\?|SRSDA|SRSDB|SRSDC|ST<>F|ST<>T|STK=C|STOPC|WDATA|WMLDL|WRA1L|WRA1R|WRALM|WRB1L|WRB1R|WRC1L|WRSCR|WRSTS|WRTEN|WSINT|WTIME|XQ>GO|\\?ALM|\\?BAT|\\?KEY|\\?LLD|\\?P=Q|C<>G|C<>M|C<>N|C=ST|CGEX|CMEX|CNEX|CRTN|F=SB|F=ST|GTOC|LLD\\?|M<>C|MCEX|N<>C|NCEX|P=Q\\?|PT=A|PT=B|PT=P|PT=Q|RALM|RINT|RSCR|RSTS|RTNC|S10=|S11=|S12=|S13=|SB=F|SELP|SELQ|ST=0|ST=C|ST=F|ST=T|T=ST|WALM|WROM|WSCR|WSTS|\\+PT|\\-PT|C=G|C=M|C=N|G=C|M=C|N=C|NOP|RTN|S0=|S1=|S2=|S3=|S4=|S5=|S6=|S7=|S8=|S9=)', bygroups(Keyword), 'instruction_none__1'),
-            (u'(FLG=1\\?|HPIL=C|\\?FSET|ST=1\\?|\\?FI=|\\?PT=|CLRF|FCNS|PT=\\?|SETF|ST=1|XROM|\\?FS|\\?PF|\\?R=|PT=|RCR|CF|R=|SF)', bygroups(Keyword), 'instruction_number__1'),
-            (u'(\\?NCGOREL|\\?NCXQREL|NCGOREL|NCXQREL|DEFP4K|DEFR4K|GOL41C|GOLONG|GSB41C|GSUBNC|U4KDEF|\\?NCGO|\\?NCXQ|GOLNC|GOSUB|GSUBC|\\?CGO|\\?CXQ|GOLC|NCGO|NCXQ|CGO|CXQ)', bygroups(Keyword), 'instruction_address__1'),
-            (u'(C=REGN|HPL=CH|PERTCT|REGN=C|C=REG|REG=C|SELPF|LD@R|READ|WRIT|LC)', bygroups(Keyword), 'instruction_register__1'),
-            (u'(C=\\-C\\-1|A=A\\+1|A=A\\+B|A=A\\+C|A=A\\-1|A=A\\-B|A=A\\-C|C=0\\-C|C=A\\+C|C=A\\-C|C=C\\+1|C=C\\+A|C=C\\+C|C=C\\-1|LSHFA|RSHFA|RSHFB|RSHFC|\\?A#0|\\?A#C|\\?A<B|\\?A<C|\\?B#0|\\?C#0|A#0\\?|A#C\\?|A<>B|A<>C|A<B\\?|A<C\\?|ABEX|ACEX|B#0\\?|B<>A|B<>C|BAEX|BCEX|C#0\\?|C<>A|C<>B|C=\\-C|CAEX|CBEX|A=0|A=B|A=C|ASL|ASR|B=0|B=A|B=C|BSR|C=0|C=A|C=B|CSR)', bygroups(Keyword), 'instruction_class2__1'),
-            (u'(GONC|GOTO|GOC|JNC|JC)', bygroups(Keyword), 'instruction_class3__1'),
-            (u'(LDIS&X|LD@R3|LC3|LDI)', bygroups(Keyword), 'instruction_special1__1'),
+            (words((
+                u'FETCHS&X', u'PRPHSLCT', u'READDATA', u'WRITDATA', u'?LOWBAT', u'A=B=C=0',
+                u'C=CANDA', u'ENBANK1', u'ENBANK2', u'ENBANK3', u'ENBANK4', u'ENDREAD', u'ENDWRIT',
+                u'GOTOADR', u'PERSLCT', u'PUSHADR', u'RAMSLCT', u'RDABC1L', u'RDABC1R', u'RDABC4L',
+                u'RTIMEST', u'TIMER=A', u'TIMER=B', u'WKUPOFF', u'WRABC1L', u'WRABC1R', u'WRABC4L',
+                u'WRABC4R', u'?F10=1', u'?F11=1', u'?F12=1', u'?F13=1', u'?NCRTN', u'?S10=1',
+                u'?S11=1', u'?S12=1', u'?S13=1', u'?TFAIL', u'ALARM?', u'ALMOFF', u'C=CORA',
+                u'C=DATA', u'C=KEYS', u'CLRABC', u'CLRKEY', u'CLRRTN', u'CRDEXF', u'CRDFLG',
+                u'CRDINF', u'CRDOHF', u'CRDWPF', u'DADD=C', u'DATA=C', u'DISOFF', u'DISTOG',
+                u'DSPOFF', u'DSPTOG', u'DSWKUP', u'ENREAD', u'ENROM1', u'ENROM2', u'ENROM3',
+                u'ENROM4', u'ENWKUP', u'ENWRIT', u'ERROR?', u'FLLABC', u'FLLDAB', u'FLSDAB',
+                u'FRSABC', u'FRSDAB', u'GOKEYS', u'GTOKEY', u'PFAD=C', u'POPADR', u'POWOFF',
+                u'POWON?', u'RCTIME', u'RDA12L', u'RDAB1L', u'RDAB1R', u'RDAB6L', u'RDB12L',
+                u'RDC12L', u'RDTIME', u'READAN', u'READEN', u'RTNCPU', u'SETCTF', u'SETDEC',
+                u'SETHEX', u'SLLABC', u'SLLDAB', u'SLSABC', u'SLSDAB', u'SPOPND', u'SRLABC',
+                u'SRLDAB', u'SRSABC', u'SRSDAB', u'STARTC', u'STATUS', u'STPINT', u'STREAD',
+                u'STWRIT', u'TCLCRD', u'TCLCTF', u'TRPCRD', u'TSTBUF', u'WDTIME', u'WINTST',
+                u'WKUPON', u'WRA12L', u'WRAB1L', u'WRAB1R', u'WRAB6L', u'WRAB6R', u'WRB12L',
+                u'WRC12L', u'WRITAN', u'WRTIME', u'WTIME-', u'?CRDR', u'?CRTN', u'?EDAV', u'?F0=1',
+                u'?F1=1', u'?F2=1', u'?F3=1', u'?F4=1', u'?F5=1', u'?F6=1', u'?F7=1', u'?F8=1',
+                u'?F9=1', u'?FRAV', u'?FRNS', u'?IFCR', u'?ORAV', u'?PBSY', u'?S0=1', u'?S1=1',
+                u'?S2=1', u'?S3=1', u'?S4=1', u'?S5=1', u'?S6=1', u'?S7=1', u'?S8=1', u'?S9=1',
+                u'?SERV', u'?SRQR', u'?WNDB', u'ABC=0', u'ALMON', u'BUSY?', u'C<>ST', u'C=C!A',
+                u'C=C&A', u'C=C.A', u'C=KEY', u'C=STK', u'CHKKB', u'CLRST', u'CSTEX', u'CXISA',
+                u'DECPT', u'DSALM', u'ENALM', u'FEXSB', u'FLLDA', u'FLLDB', u'FLLDC', u'FLSDA',
+                u'FLSDB', u'FLSDC', u'FRAV?', u'FRNS?', u'FRSDA', u'FRSDB', u'FRSDC', u'GOTOC',
+                u'IFCR?', u'INCPT', u'NCRTN', u'ORAV?', u'PRINT', u'R=R+1', u'R=R-1', u'RABCL',
+                u'RABCR', u'RDA1L', u'RDA1R', u'RDALM', u'RDATA', u'RDB1L', u'RDB1R', u'RDC1L',
+                u'RDC1R', u'RDINT', u'RDROM', u'RDSCR', u'RDSTS', u'RSTKB', u'RTIME', u'RTNNC',
+                u'SLCTP', u'SLCTQ', u'SLSDA', u'SLSDB', u'SRLDA', u'SRLDB', u'SRLDC', u'SRQR?',
+                u'SRSDA', u'SRSDB', u'SRSDC', u'ST<>F', u'ST<>T', u'STK=C', u'STOPC', u'WDATA',
+                u'WMLDL', u'WRA1L', u'WRA1R', u'WRALM', u'WRB1L', u'WRB1R', u'WRC1L', u'WRSCR',
+                u'WRSTS', u'WRTEN', u'WSINT', u'WTIME', u'XQ>GO', u'?ALM', u'?BAT', u'?KEY',
+                u'?LLD', u'?P=Q', u'C<>G', u'C<>M', u'C<>N', u'C=ST', u'CGEX', u'CMEX', u'CNEX',
+                u'CRTN', u'F=SB', u'F=ST', u'GTOC', u'LLD?', u'M<>C', u'MCEX', u'N<>C', u'NCEX',
+                u'P=Q?', u'PT=A', u'PT=B', u'PT=P', u'PT=Q', u'RALM', u'RINT', u'RSCR', u'RSTS',
+                u'RTNC', u'S10=', u'S11=', u'S12=', u'S13=', u'SB=F', u'SELP', u'SELQ', u'ST=0',
+                u'ST=C', u'ST=F', u'ST=T', u'T=ST', u'WALM', u'WROM', u'WSCR', u'WSTS', u'+PT',
+                u'-PT', u'C=G', u'C=M', u'C=N', u'G=C', u'M=C', u'N=C', u'NOP', u'RTN', u'S0=',
+                u'S1=', u'S2=', u'S3=', u'S4=', u'S5=', u'S6=', u'S7=', u'S8=', u'S9=')), Keyword, 'instruction_none__1'),
+            (words((
+                u'FLG=1?', u'HPIL=C', u'?FSET', u'ST=1?', u'?FI=', u'?PT=', u'CLRF', u'FCNS',
+                u'PT=?', u'SETF', u'ST=1', u'XROM', u'?FS', u'?PF', u'?R=', u'PT=', u'RCR', u'CF',
+                u'R=', u'SF')), Keyword, 'instruction_number__1'),
+            (words((
+                u'?NCGOREL', u'?NCXQREL', u'NCGOREL', u'NCXQREL', u'DEFP4K', u'DEFR4K', u'GOL41C',
+                u'GOLONG', u'GSB41C', u'GSUBNC', u'U4KDEF', u'?NCGO', u'?NCXQ', u'GOLNC', u'GOSUB',
+                u'GSUBC', u'?CGO', u'?CXQ', u'GOLC', u'NCGO', u'NCXQ', u'CGO', u'CXQ')), Keyword, 'instruction_address__1'),
+            (words((
+                u'C=REGN', u'HPL=CH', u'PERTCT', u'REGN=C', u'C=REG', u'REG=C', u'SELPF', u'LD@R',
+                u'READ', u'WRIT', u'LC')), Keyword, 'instruction_register__1'),
+            (words((
+                u'C=-C-1', u'A=A+1', u'A=A+B', u'A=A+C', u'A=A-1', u'A=A-B', u'A=A-C', u'C=0-C',
+                u'C=A+C', u'C=A-C', u'C=C+1', u'C=C+A', u'C=C+C', u'C=C-1', u'LSHFA', u'RSHFA',
+                u'RSHFB', u'RSHFC', u'?A#0', u'?A#C', u'?A<B', u'?A<C', u'?B#0', u'?C#0', u'A#0?',
+                u'A#C?', u'A<>B', u'A<>C', u'A<B?', u'A<C?', u'ABEX', u'ACEX', u'B#0?', u'B<>A',
+                u'B<>C', u'BAEX', u'BCEX', u'C#0?', u'C<>A', u'C<>B', u'C=-C', u'CAEX', u'CBEX',
+                u'A=0', u'A=B', u'A=C', u'ASL', u'ASR', u'B=0', u'B=A', u'B=C', u'BSR', u'C=0',
+                u'C=A', u'C=B', u'CSR')), Keyword, 'instruction_class2__1'),
+            (words((
+                u'GONC', u'GOTO', u'GOC', u'JNC', u'JC')), Keyword, 'instruction_class3__1'),
+            (words((
+                u'LDIS&X', u'LD@R3', u'LC3', u'LDI')), Keyword, 'instruction_special1__1'),
             (u'(CON)', bygroups(Keyword), 'instruction_special2__1'),
             (u'(\\([^\\)\\n\\r]+\\))', bygroups(Name.Label)),
             (u'(\\[[^\\]\\n\\r]+\\])', bygroups(Name.Label)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'address_directive__1' : [
+        ],
+        'simple_directive__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
-            (u'([0-9A-F]{4}\\b)', bygroups(Number.Hex)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'code_literal__1' : [
+        ],
+        'string_directive__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
-            (u'([0-3][0-9A-F]{2}\\b)', bygroups(Number.Bin)),
+            (u'(\\"[^\\"\\n\\r]*\\")', bygroups(String)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'instruction_address__1' : [
+        ],
+        'number_directive__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
-            (u'([0-9A-F]{4}\\b)', bygroups(Number.Hex)),
-            (u'(\\([^\\)\\n\\r]+\\))', bygroups(Name.Label)),
-            (u'(\\[[^\\]\\n\\r]+\\])', bygroups(Name.Label)),
+            (u'(\\d+\\b)', bygroups(Number.Integer)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'instruction_class2__1' : [
+        ],
+        'address_directive__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
-            (u'([P[QT]|XS?|W(PT)?|MS?|S(&X)?|ALL|@R|R<|P\\-Q)', bygroups(Keyword.Pseudo)),
+            (u'([0-9A-F]{4}\\b)', bygroups(Number.Hex)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'instruction_class3__1' : [
+        ],
+        'symbol_directive__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
-            (u'(\\+(?:(?:[1-5]\\d)|(?:6[0-3])|\\d))', bygroups(Keyword.Pseudo)),
-            (u'(\\-(?:(?:[1-5]\\d)|(?:6[0-4])|[1-9]))', bygroups(Keyword.Pseudo)),
             (u'(\\([^\\)\\n\\r]+\\))', bygroups(Name.Label)),
             (u'(\\[[^\\]\\n\\r]+\\])', bygroups(Name.Label)),
             (u'([0-9A-F]{4}\\b)', bygroups(Number.Hex)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
+        ],
+        'code_literal__1' : [
+            (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
+            (u'([0-3][0-9A-F]{2}\\b)', bygroups(Number.Bin)),
+            (u'(;.*)', bygroups(Comment)),
+            ('(\n|\r|\r\n)', String),
+            ('.', String),
+        ],
         'instruction_none__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
+        ],
         'instruction_number__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
             (u'(\\d+\\b)', bygroups(Number.Integer)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'instruction_register__1' : [
+        ],
+        'instruction_address__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
-            (u'((\\d{1,2}|[0-9A-F])(\\([TZYXLMNOPQabcde]\\))?(/[TZYXLMNOPQabcde])?)', bygroups(Keyword.Pseudo)),
+            (u'([0-9A-F]{4}\\b)', bygroups(Number.Hex)),
+            (u'(\\([^\\)\\n\\r]+\\))', bygroups(Name.Label)),
+            (u'(\\[[^\\]\\n\\r]+\\])', bygroups(Name.Label)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'instruction_special1__1' : [
+        ],
+        'instruction_class2__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
-            (u'([0-9A-F]+\\b)', bygroups(Number.Hex)),
+            (u'([P[QT^-]|XS?|W(PT)?|MS?|S(&X)?|ALL|@R|R<|P-Q)', bygroups(Keyword.Pseudo)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'instruction_special2__1' : [
+        ],
+        'instruction_class3__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
-            (u'([0-3][0-9A-F]{2}\\b)', bygroups(Number.Bin)),
+            (u'(\\+(?:(?:[1-5]\\d)|(?:6[0-3])|\\d))', bygroups(Keyword.Pseudo)),
+            (u'(\\-(?:(?:[1-5]\\d)|(?:6[0-4])|[1-9]))', bygroups(Keyword.Pseudo)),
             (u'(\\([^\\)\\n\\r]+\\))', bygroups(Name.Label)),
             (u'(\\[[^\\]\\n\\r]+\\])', bygroups(Name.Label)),
+            (u'([0-9A-F]{4}\\b)', bygroups(Number.Hex)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'number_directive__1' : [
-            (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
-            (u'(\\d+\\b)', bygroups(Number.Integer)),
-            (u'(;.*)', bygroups(Comment)),
-            ('(\n|\r|\r\n)', String),
-            ('.', String),
-        ], 
-        'simple_directive__1' : [
+        ],
+        'instruction_register__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
+            (u'((\\d{1,2}|[0-9A-F])(\\([TZYXLMNOPQabcde]\\))?(/[TZYXLMNOPQabcde])?)', bygroups(Keyword.Pseudo)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'string_directive__1' : [
+        ],
+        'instruction_special1__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
-            (u'(\\\"[^\\\"\\n\\r]*\\\")', bygroups(String)),
+            (u'([0-9A-F]+\\b)', bygroups(Number.Hex)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ], 
-        'symbol_directive__1' : [
+        ],
+        'instruction_special2__1' : [
             (u'(\n|\r|\r\n)', bygroups(Comment), '#pop'),
+            (u'([0-3][0-9A-F]{2}\\b)', bygroups(Number.Bin)),
             (u'(\\([^\\)\\n\\r]+\\))', bygroups(Name.Label)),
             (u'(\\[[^\\]\\n\\r]+\\])', bygroups(Name.Label)),
-            (u'([0-9A-F]{4}\\b)', bygroups(Number.Hex)),
             (u'(;.*)', bygroups(Comment)),
             ('(\n|\r|\r\n)', String),
             ('.', String),
-        ]
+        ],
     }
-
@@ -0,0 +1,417 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "mcinstr.h"
+#include "mcop.h"
+#include "mccheck.h"
+
+#define MAX_LABEL_SIZE  256     // of mcodeasm
+
+const char *const inst_check_messages[CHECK_COUNT] = {
+    "",
+    "unknown mnemonic",
+    "field expected",
+    "number expected",
+    "operand out of range",
+    "register expected",
+    "displacement expected",
+    "address expected",
+    "invalid label",
+    "3 digit hex number expected",
+    "code expected",
+    "unexpected text",
+    "label expected"
+};
+
+// digit value + 1, 0 for other characters
+static const unsigned char hex_digits[256] = {
+    ['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5, ['5'] = 6, ['6'] = 7, ['7'] = 8,
+    ['8'] = 9, ['9'] = 10, ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16
+};
+
+static const unsigned char dec_digits[256] = {
+    ['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5, ['5'] = 6, ['6'] = 7, ['7'] = 8,
+    ['8'] = 9, ['9'] = 10
+};
+
+static int is_space(char ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
+}
+
+// Length of the token at s: up to white space or a comment.
+static size_t token_length(const char *s, size_t len)
+{
+    size_t n = 0;
+    while (n < len && s[n] != ';' && !is_space(s[n])) {
+        n++;
+    }
+    return n;
+}
+
+static size_t skip_space(const char *s, size_t pos, size_t len)
+{
+    while (pos < len && is_space(s[pos])) {
+        pos++;
+    }
+    return pos;
+}
+
+// Value of 1 to 4 hex digits, -1 if one of them is no hex digit. The
+// digits are right-aligned in a buffer of '0's and looked up with a
+// fixed number of steps, so there is no branch per digit.
+static int hex_number(const char *s, size_t n)
+{
+    unsigned char b[4] = { '0', '0', '0', '0' };
+    unsigned bad = 0;
+    unsigned value = 0;
+    memcpy(b + 4 - n, s, n);
+    for (int i = 0; i < 4; i++) {
+        unsigned d = hex_digits[b[i]];
+        bad |= d == 0;
+        value = value << 4 | ((d - 1) & 0xF);
+    }
+    return (int) (value | -bad);
+}
+
+// Value of 1 to 6 decimal digits, -1 if one of them is no digit.
+static int dec_number(const char *s, size_t n)
+{
+    unsigned char b[6] = { '0', '0', '0', '0', '0', '0' };
+    unsigned bad = 0;
+    unsigned value = 0;
+    memcpy(b + 6 - n, s, n);
+    for (int i = 0; i < 6; i++) {
+        unsigned d = dec_digits[b[i]];
+        bad |= d == 0;
+        value = 10 * value + ((d - 1) & 0xF);
+    }
+    return (int) (value | -bad);
+}
+
+static int fail(inst_check *result, int code, size_t start, size_t length)
+{
+    result->code = code;
+    result->start = (int) start;
+    result->length = (int) length;
+    return code;
+}
+
+static int check_decimal(const char *s, size_t n, int min, int max, inst_check *result)
+{
+    int value = n >= 1 && n <= 6 ? dec_number(s, n) : -1;
+    if (value < 0) {
+        return fail(result, CHECK_NUMBER_EXPECTED, 0, n);
+    }
+    if (value < min || value > max) {
+        return fail(result, CHECK_OUT_OF_RANGE, 0, n);
+    }
+    return CHECK_OK;
+}
+
+// A label (name) or [name]. Returns its length or 0.
+static size_t label_length(const char *s, size_t len)
+{
+    const char *end = len > 1 && (*s == '(' || *s == '[') ? memchr(s + 1, *s == '(' ? ')' : ']', len - 1) : NULL;
+    if (!end || end == s + 1 || end - s > MAX_LABEL_SIZE) {
+        return 0;
+    }
+    return end - s + 1;
+}
+
+// Register operand: a hex digit or a decimal number up to 15, followed
+// by optional register names, e.g. 3(X) or 14/d.
+static int check_register(const char *s, size_t len, inst_check *result)
+{
+    size_t n = 0;
+    int value = -1;
+    if (len >= 2 && dec_digits[(unsigned char) s[0]] && dec_digits[(unsigned char) s[1]]) {
+        value = dec_number(s, 2);
+        n = 2;
+    } else if (len >= 1) {
+        value = hex_number(s, 1);
+        n = 1;
+    }
+    if (n + 2 < len && s[n] == '(' && s[n + 2] == ')') {
+        n += 3;
+    }
+    if (n + 1 < len && s[n] == '/') {
+        n += 2;
+    }
+    if (value < 0 || value > 15 || n != token_length(s, len)) {
+        return fail(result, CHECK_REGISTER_EXPECTED, 0, token_length(s, len));
+    }
+    return CHECK_OK;
+}
+
+static int check_address(const char *s, size_t len, size_t *n, inst_check *result)
+{
+    *n = token_length(s, len);
+    if (len > 0 && (*s == '(' || *s == '[')) {
+        *n = label_length(s, len);
+        if (!*n) {
+            return fail(result, CHECK_INVALID_LABEL, 0, token_length(s, len));
+        }
+        result->target_start = 0;
+        result->target_length = (int) *n;
+        return CHECK_OK;
+    }
+    if (*n != 4 || hex_number(s, 4) < 0) {
+        return fail(result, CHECK_ADDRESS_EXPECTED, 0, *n);
+    }
+    return CHECK_OK;
+}
+
+static int check_code(const char *s, size_t n, int max, int code, inst_check *result)
+{
+    if (n != 3 || hex_number(s, 3) < 0 || hex_number(s, 3) > max) {
+        return fail(result, code, 0, n);
+    }
+    return CHECK_OK;
+}
+
+int inst_check_operand(int typ, const char *text, size_t len, inst_check *result)
+{
+    size_t n = token_length(text, len);
+    int code = CHECK_OK;
+
+    result->code = CHECK_OK;
+    result->target_start = -1;
+    result->target_length = 0;
+    switch (typ) {
+        case MCODE_OP_NONE1:
+        case MCODE_OP_NONE2:
+        case MCODE_OP_NONE3:
+        case MCODE_OP_NONE4:
+            n = 0;
+            break;
+        case MCODE_OP_TEF1:
+        case MCODE_OP_TEF2:
+            // the field names of any set, like mcodeasm
+            code = CHECK_FIELD_EXPECTED;
+            for (int set = 0; set < INST_SET_COUNT && code; set++) {
+                for (int tef = 0; tef < 8 && code; tef++) {
+                    const char *name = inst_tef_names[set][tef];
+                    if (strlen(name) == n && memcmp(text, name, n) == 0) {
+                        code = CHECK_OK;
+                    }
+                }
+            }
+            if (code) {
+                return fail(result, code, 0, n);
+            }
+            break;
+        case MCODE_OP_0_TO_13_DEC:
+            code = check_decimal(text, n, 0, 13, result);
+            break;
+        case MCODE_OP_0_TO_F_HEX:
+            code = check_register(text, len, result);
+            break;
+        case MCODE_OP_0_TO_7:
+            code = check_decimal(text, n, 0, 7, result);
+            break;
+        case MCODE_OP_1_TO_31_DEC:
+            code = check_decimal(text, n, 1, 31, result);
+            break;
+        case MCODE_OP_0_TO_64_DEC:
+            code = check_decimal(text, n, 0, 64, result);
+            break;
+        case MCODE_OP_DISPLACEMENT:
+            if (n > 0 && (*text == '+' || *text == '-')) {
+                int value = n >= 2 && n <= 7 ? dec_number(text + 1, n - 1) : -1;
+                if (value < 0) {
+                    return fail(result, CHECK_DISPLACEMENT_EXPECTED, 0, n);
+                }
+                if (value > (*text == '-' ? 64 : 63)) {
+                    return fail(result, CHECK_OUT_OF_RANGE, 0, n);
+                }
+            } else {
+                code = check_address(text, len, &n, result);
+            }
+            break;
+        case MCODE_OP_ADDRESS1:
+        case MCODE_OP_ADDRESS2:
+        case MCODE_OP_ADDRESS3:
+        case MCODE_OP_ADDRESS4:
+        case MCODE_OP_ADDRESS5:
+            code = check_address(text, len, &n, result);
+            break;
+        case MCODE_OP_000_TO_FFF_HEX:
+            code = check_code(text, n, 0xFFF, CHECK_HEX3_EXPECTED, result);
+            break;
+        case MCODE_OP_000_TO_3FF_HEX:
+            code = check_code(text, n, 0x3FF, CHECK_CODE_EXPECTED, result);
+            break;
+        case MCODE_OP_UNKNOWN:
+            // CON: a code or a label
+            if (n > 0 && (*text == '(' || *text == '[')) {
+                code = check_address(text, len, &n, result);
+            } else {
+                code = check_code(text, n, 0x3FF, CHECK_CODE_EXPECTED, result);
+            }
+            break;
+        default:
+            break;
+    }
+    if (code) {
+        return code;
+    }
+    size_t rest = skip_space(text, n, len);
+    if (rest < len && text[rest] != ';') {
+        return fail(result, CHECK_UNEXPECTED_TEXT, rest, token_length(text + rest, len - rest));
+    }
+    return CHECK_OK;
+}
+
+// .EQU defines the label of the line, or the one after it, as an address.
+static int check_equ(const char *line, size_t pos, size_t len, inst_check *result)
+{
+    size_t n;
+    if (result->label_start < 0) {
+        n = label_length(line + pos, len - pos);
+        if (!n) {
+            return fail(result, CHECK_LABEL_EXPECTED, pos, token_length(line + pos, len - pos));
+        }
+        result->label_start = (int) pos;
+        result->label_length = (int) n;
+        pos = skip_space(line, pos + n, len);
+    }
+    if (check_address(line + pos, len - pos, &n, result)) {
+        result->start += (int) pos;
+        return result->code;
+    }
+    if (result->target_start >= 0) {
+        result->target_start += (int) pos;
+    }
+    pos = skip_space(line, pos + n, len);
+    if (pos < len && line[pos] != ';') {
+        return fail(result, CHECK_UNEXPECTED_TEXT, pos, token_length(line + pos, len - pos));
+    }
+    return CHECK_OK;
+}
+
+int inst_check_line(const char *line, size_t len, inst_check *result)
+{
+    static const struct {
+        const char *name;
+        int set;
+    } sets[] = {
+        { "HP", SET_HP },
+        { "JDA", SET_JDA },
+        { "ZENCODE", SET_ZENCODE }
+    };
+    size_t pos = skip_space(line, 0, len);
+    size_t n;
+
+    result->code = CHECK_OK;
+    result->inst = -1;
+    result->word_start = -1;
+    result->word_length = 0;
+    result->set = 0;
+    result->label_start = -1;
+    result->label_length = 0;
+    result->target_start = -1;
+    result->target_length = 0;
+    if (pos == len || line[pos] == '*' || line[pos] == ';') {
+        return CHECK_OK;
+    }
+    // a listing line starts with a 4 digit address and 1 to 3 codes
+    if (token_length(line + pos, len - pos) == 4 && hex_number(line + pos, 4) >= 0) {
+        size_t codes = skip_space(line, pos + 4, len);
+        n = token_length(line + codes, len - codes);
+        if (n >= 3 && n <= 9 && n % 3 == 0) {
+            int ok = 1;
+            for (size_t i = 0; i < n; i += 3) {
+                ok &= line[codes + i] >= '0' && line[codes + i] <= '3' && hex_number(line + codes + i + 1, 2) >= 0;
+            }
+            if (ok) {
+                pos = skip_space(line, codes + n, len);
+            }
+        }
+    }
+    if (pos < len && (line[pos] == '(' || line[pos] == '[')) {
+        n = label_length(line + pos, len - pos);
+        if (!n) {
+            return fail(result, CHECK_INVALID_LABEL, pos, token_length(line + pos, len - pos));
+        }
+        result->label_start = (int) pos;
+        result->label_length = (int) n;
+        pos = skip_space(line, pos + n, len);
+    }
+    if (pos == len || line[pos] == ';') {
+        return CHECK_OK;
+    }
+
+    if (line[pos] == '.') {
+        n = 0;
+        while (pos + 1 + n < len && line[pos + 1 + n] >= 'A' && line[pos + 1 + n] <= 'Z' && n < 7) {
+            n++;
+        }
+        for (size_t i = 0; i < sizeof(sets) / sizeof(sets[0]); i++) {
+            if (strlen(sets[i].name) == n && memcmp(line + pos + 1, sets[i].name, n) == 0) {
+                result->set = sets[i].set;
+            }
+        }
+        if (n == 3 && memcmp(line + pos + 1, "EQU", 3) == 0) {
+            return check_equ(line, skip_space(line, pos + 4, len), len, result);
+        }
+        return CHECK_OK;
+    }
+    if (line[pos] == '#') {
+        size_t code = skip_space(line, pos + 1, len);
+        n = token_length(line + code, len - code);
+        if (check_code(line + code, n, 0x3FF, CHECK_CODE_EXPECTED, result)) {
+            result->start += (int) code;
+            return result->code;
+        }
+        pos = skip_space(line, code + n, len);
+        if (pos < len && line[pos] != ';') {
+            return fail(result, CHECK_UNEXPECTED_TEXT, pos, token_length(line + pos, len - pos));
+        }
+        return CHECK_OK;
+    }
+
+    char name[INAME_SIZE + 1];
+    n = token_length(line + pos, len - pos);
+    result->word_start = (int) pos;
+    result->word_length = (int) n;
+    if (n <= INAME_SIZE) {
+        memcpy(name, line + pos, n);
+        name[n] = '\0';
+        result->inst = search_inst(name, SET_ALL);
+    }
+    if (result->inst < 0) {
+        return fail(result, CHECK_UNKNOWN_MNEMONIC, pos, n);
+    }
+    size_t operand = skip_space(line, pos + n, len);
+    if (inst_check_operand(inst[result->inst].typ, line + operand, len - operand, result)) {
+        result->start += (int) operand;
+    }
+    if (result->target_start >= 0) {
+        result->target_start += (int) operand;
+    }
+    return result->code;
+}
+
+int inst_check_format(const inst_check *result, const char *line, size_t len, char *buf, size_t size)
+{
+    size_t end = len;
+    int n;
+    switch (result->code) {
+        case CHECK_UNKNOWN_MNEMONIC:
+            n = result->length < 64 ? result->length : 64;
+            n = snprintf(buf, size, "unknown mnemonic %.*s", n, line + result->start);
+            break;
+        case CHECK_UNEXPECTED_TEXT:
+            while (end > (size_t) result->start && is_space(line[end - 1])) {
+                end--;
+            }
+            n = end - result->start < 64 ? (int) (end - result->start) : 64;
+            n = snprintf(buf, size, "unexpected text: %.*s", n, line + result->start);
+            break;
+        default:
+            n = snprintf(buf, size, "%s", inst_check_messages[result->code]);
+            break;
+    }
+    return n < (int) size ? n : (int) size - 1;
+}
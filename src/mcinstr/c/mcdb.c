@@ -0,0 +1,485 @@
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "mcinstr.h"
+#include "mcop.h"
+#include "mcdb.h"
+
+#define ALIGN(n)        (((n) + 3) & ~(size_t) 3)
+#define MAX_LISTS       (9 * IHT_SIZE)  // names, sets, types, types x sets, opcodes
+#define MAX_STRINGS     (IHT_SIZE * INAME_SIZE + 256)
+#define MAX_PATH_SIZE   4096
+
+#define FNV_OFFSET      2166136261u
+#define FNV_PRIME       16777619u
+
+// operand types in the order of the type table, with their description
+static const struct {
+    char typ;
+    const char *operand;
+} types[] = {
+    { MCODE_OP_NONE1, "none" },
+    { MCODE_OP_TEF1, "TEF" },
+    { MCODE_OP_0_TO_13_DEC, "0 to 13 (dec)" },
+    { MCODE_OP_0_TO_F_HEX, "0 to F (hex)" },
+    { MCODE_OP_DISPLACEMENT, "+0 to +63 and -1 to -64 (dec)" },
+    { MCODE_OP_ADDRESS1, "0000 to FFFF (hex)" },
+    { MCODE_OP_ADDRESS2, "0000 to FFFF (hex)" },
+    { MCODE_OP_1_TO_31_DEC, "1 to 31 (dec)" },
+    { MCODE_OP_NONE2, "none" },
+    { MCODE_OP_0_TO_7, "0 to 7" },
+    { MCODE_OP_000_TO_FFF_HEX, "000 to FFF (hex)" },
+    { MCODE_OP_TEF2, "TEF" },
+    { MCODE_OP_ADDRESS3, "0000 to FFFF (hex)" },
+    { MCODE_OP_0_TO_64_DEC, "0 to 64 (dec)" },
+    { MCODE_OP_000_TO_3FF_HEX, "000 to 3FF (hex)" },
+    { MCODE_OP_UNKNOWN, "???" },
+    { MCODE_OP_ADDRESS4, "0000 to FFFF (hex)" },
+    { MCODE_OP_ADDRESS5, "0000 to FFFF (hex)" },
+    { MCODE_OP_NONE3, "none" },
+    { MCODE_OP_NONE4, "none" }
+};
+
+#define TYPE_COUNT  ((int) (sizeof(types) / sizeof(types[0])))
+
+// tables of an image while it is built
+struct builder_t {
+    uint16_t lists[MAX_LISTS];
+    uint32_t list_size;
+    char strings[MAX_STRINGS];
+    uint32_t string_size;
+};
+
+typedef struct builder_t builder;
+
+static int compare_match_order(const void *a, const void *b)
+{
+    const char *s1 = inst[*(const uint16_t *) a].name;
+    const char *s2 = inst[*(const uint16_t *) b].name;
+    size_t len1 = strlen(s1);
+    size_t len2 = strlen(s2);
+    if (len1 != len2) {
+        return len1 > len2 ? -1 : 1;
+    }
+    return strcmp(s1, s2);
+}
+
+static int compare_names(const void *a, const void *b)
+{
+    return strcmp(inst[*(const uint16_t *) a].name, inst[*(const uint16_t *) b].name);
+}
+
+static uint32_t add_string(builder *b, const char *s, int intern)
+{
+    size_t len = strlen(s) + 1;
+    if (intern) {
+        for (uint32_t offset = 0; offset < b->string_size; offset += strlen(b->strings + offset) + 1) {
+            if (strcmp(b->strings + offset, s) == 0) {
+                return offset;
+            }
+        }
+    }
+    uint32_t offset = b->string_size;
+    memcpy(b->strings + offset, s, len);
+    b->string_size += len;
+    return offset;
+}
+
+// Adds the records of all named mnemonics with the given type (0 for
+// any) in one of the given sets as a list, sorted by compare.
+static mcdb_list add_list(builder *b, int typ, int set, int (*compare)(const void *, const void *))
+{
+    mcdb_list list;
+    list.offset = b->list_size;
+    for (int i = 0; i < IHT_SIZE; i++) {
+        if (inst[i].name[0] && (inst[i].set & set) && (!typ || inst[i].typ == typ)) {
+            b->lists[b->list_size++] = i;
+        }
+    }
+    list.count = b->list_size - list.offset;
+    qsort(b->lists + list.offset, list.count, sizeof(uint16_t), compare);
+    return list;
+}
+
+// Adds one list per first word, counting sort keeps inst[] order.
+static void add_opcode_lists(builder *b, mcdb_list *opcodes)
+{
+    memset(opcodes, 0, MCDB_OPCODE_COUNT * sizeof(mcdb_list));
+    for (int i = 0; i < IHT_SIZE; i++) {
+        if (inst[i].name[0] && inst[i].tyte1 < MCDB_OPCODE_COUNT) {
+            opcodes[inst[i].tyte1].count++;
+        }
+    }
+    for (int code = 0; code < MCDB_OPCODE_COUNT; code++) {
+        opcodes[code].offset = b->list_size;
+        b->list_size += opcodes[code].count;
+        opcodes[code].count = 0;
+    }
+    for (int i = 0; i < IHT_SIZE; i++) {
+        if (inst[i].name[0] && inst[i].tyte1 < MCDB_OPCODE_COUNT) {
+            mcdb_list *list = &opcodes[inst[i].tyte1];
+            b->lists[list->offset + list->count++] = i;
+        }
+    }
+}
+
+static uint32_t hash_bytes(uint32_t hash, const void *data, size_t len)
+{
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+uint32_t mcdb_inst_hash(void)
+{
+    uint32_t hash = FNV_OFFSET;
+    for (int i = 0; i < IHT_SIZE; i++) {
+        const struct inst_type *in = &inst[i];
+        unsigned char fields[8] = {
+            in->tyte1 & 0xFF, in->tyte1 >> 8, in->tyte2 & 0xFF, in->tyte2 >> 8,
+            in->tyte3 & 0xFF, in->tyte3 >> 8, in->set, (unsigned char) in->typ
+        };
+        hash = hash_bytes(hash, in->name, sizeof(in->name));
+        hash = hash_bytes(hash, fields, sizeof(fields));
+    }
+    for (int t = 0; t < TYPE_COUNT; t++) {
+        hash = hash_bytes(hash, &types[t].typ, 1);
+        hash = hash_bytes(hash, types[t].operand, strlen(types[t].operand) + 1);
+    }
+    return hash;
+}
+
+static unsigned char *build_image(size_t *image_size)
+{
+    static const int sets[MCDB_SET_COUNT] = { SET_HP, SET_JDA, SET_ZENCODE };
+    mcdb_inst insts[IHT_SIZE];
+    mcdb_type type_table[TYPE_COUNT];
+    mcdb_list opcodes[MCDB_OPCODE_COUNT];
+    mcdb_header h;
+    builder *b = malloc(sizeof(builder));
+    if (!b) {
+        return NULL;
+    }
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, MCDB_MAGIC, 4);
+    h.version = MCDB_VERSION;
+    h.byte_order = MCDB_BYTE_ORDER;
+    h.inst_hash = mcdb_inst_hash();
+    b->list_size = 0;
+    b->string_size = 0;
+    add_string(b, "", 0);
+    memset(insts, 0, sizeof(insts));
+    for (int i = 0; i < IHT_SIZE; i++) {
+        insts[i].name = inst[i].name[0] ? add_string(b, inst[i].name, 0) : 0;
+        insts[i].tyte[0] = inst[i].tyte1;
+        insts[i].tyte[1] = inst[i].tyte2;
+        insts[i].tyte[2] = inst[i].tyte3;
+        insts[i].set = inst[i].set;
+        insts[i].typ = inst[i].typ;
+    }
+    memset(type_table, 0, sizeof(type_table));
+    for (int t = 0; t < TYPE_COUNT; t++) {
+        type_table[t].typ = types[t].typ;
+        type_table[t].operand = add_string(b, types[t].operand, 1);
+        type_table[t].mnemonics = add_list(b, types[t].typ, SET_ALL, compare_match_order);
+        for (int s = 0; s < MCDB_SET_COUNT; s++) {
+            type_table[t].sets[s] = add_list(b, types[t].typ, sets[s], compare_match_order);
+        }
+    }
+    h.names = add_list(b, 0, SET_ALL, compare_names);
+    for (int s = 0; s < MCDB_SET_COUNT; s++) {
+        h.sets[s] = add_list(b, 0, sets[s], compare_match_order);
+    }
+    add_opcode_lists(b, opcodes);
+
+    size_t size = ALIGN(sizeof(h));
+    h.inst_count = IHT_SIZE;
+    h.insts = size;
+    size += ALIGN(sizeof(insts));
+    h.type_count = TYPE_COUNT;
+    h.types = size;
+    size += ALIGN(sizeof(type_table));
+    h.opcodes = size;
+    size += ALIGN(sizeof(opcodes));
+    h.lists = size;
+    h.list_size = b->list_size;
+    size += ALIGN(b->list_size * sizeof(uint16_t));
+    h.strings = size;
+    h.string_size = b->string_size;
+    size += ALIGN(b->string_size);
+    h.size = size;
+
+    unsigned char *image = calloc(1, size);
+    if (image) {
+        memcpy(image, &h, sizeof(h));
+        memcpy(image + h.insts, insts, sizeof(insts));
+        memcpy(image + h.types, type_table, sizeof(type_table));
+        memcpy(image + h.opcodes, opcodes, sizeof(opcodes));
+        memcpy(image + h.lists, b->lists, b->list_size * sizeof(uint16_t));
+        memcpy(image + h.strings, b->strings, b->string_size);
+        *image_size = size;
+    }
+    free(b);
+    return image;
+}
+
+int mcdb_write(FILE *out)
+{
+    size_t size;
+    unsigned char *image = build_image(&size);
+    int result = -1;
+    if (image) {
+        result = fwrite(image, 1, size, out) == size ? 0 : -1;
+        free(image);
+    }
+    return result;
+}
+
+static int table_fits(const mcdb *db, uint32_t offset, uint32_t count, size_t size)
+{
+    return offset % 4 == 0 && offset <= db->size && count <= (db->size - offset) / size;
+}
+
+static int list_fits(const mcdb *db, const mcdb_list *list)
+{
+    const mcdb_header *h = db->header;
+    if (list->offset > h->list_size || list->count > h->list_size - list->offset) {
+        return 0;
+    }
+    const uint16_t *items = mcdb_items(db, list);
+    for (uint32_t i = 0; i < list->count; i++) {
+        if (items[i] >= h->inst_count) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Only bounds are checked, every table is used as it is.
+static int check_image(const mcdb *db)
+{
+    const mcdb_header *h = db->header;
+    if (db->size < sizeof(mcdb_header) || memcmp(h->magic, MCDB_MAGIC, 4) != 0 ||
+        h->version != MCDB_VERSION || h->byte_order != MCDB_BYTE_ORDER || h->size != db->size ||
+        !table_fits(db, h->insts, h->inst_count, sizeof(mcdb_inst)) ||
+        !table_fits(db, h->types, h->type_count, sizeof(mcdb_type)) ||
+        !table_fits(db, h->opcodes, MCDB_OPCODE_COUNT, sizeof(mcdb_list)) ||
+        !table_fits(db, h->lists, h->list_size, sizeof(uint16_t)) ||
+        !table_fits(db, h->strings, h->string_size, 1) ||
+        h->string_size == 0 || db->base[h->strings + h->string_size - 1] != '\0') {
+        return -1;
+    }
+    for (uint32_t i = 0; i < h->inst_count; i++) {
+        if (mcdb_get(db, i)->name >= h->string_size) {
+            return -1;
+        }
+    }
+    int ok = list_fits(db, &h->names);
+    for (int s = 0; s < MCDB_SET_COUNT; s++) {
+        ok = ok && list_fits(db, &h->sets[s]);
+    }
+    for (uint32_t t = 0; t < h->type_count && ok; t++) {
+        const mcdb_type *type = (const mcdb_type *) (db->base + h->types) + t;
+        ok = type->operand < h->string_size && list_fits(db, &type->mnemonics);
+        for (int s = 0; s < MCDB_SET_COUNT; s++) {
+            ok = ok && list_fits(db, &type->sets[s]);
+        }
+    }
+    for (int code = 0; code < MCDB_OPCODE_COUNT && ok; code++) {
+        ok = list_fits(db, mcdb_opcode(db, code));
+    }
+    return ok ? 0 : -1;
+}
+
+static int open_image(mcdb *db, const char *path)
+{
+    db->base = NULL;
+    db->mapped = 0;
+#if !defined(_WIN32)
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size >= (off_t) sizeof(mcdb_header)) {
+        void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            db->base = data;
+            db->size = st.st_size;
+            db->mapped = 1;
+        }
+    }
+    close(fd);
+#else
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return -1;
+    }
+    if (fseek(file, 0, SEEK_END) == 0) {
+        long size = ftell(file);
+        unsigned char *data = size >= (long) sizeof(mcdb_header) ? malloc(size) : NULL;
+        rewind(file);
+        if (data && fread(data, 1, size, file) == (size_t) size) {
+            db->base = data;
+            db->size = size;
+        } else {
+            free(data);
+        }
+    }
+    fclose(file);
+#endif
+    if (!db->base) {
+        errno = EINVAL;
+        return -1;
+    }
+    db->header = (const mcdb_header *) db->base;
+    if (check_image(db) != 0) {
+        mcdb_close(db);
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
+// Whether the image was built from the inst[] the program is linked with
+static int is_current(const mcdb *db)
+{
+    return db->header->inst_hash == mcdb_inst_hash();
+}
+
+int mcdb_open(mcdb *db, const char *path)
+{
+    if (open_image(db, path) != 0) {
+        return -1;
+    }
+    if (!is_current(db)) {
+        mcdb_close(db);
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
+int mcdb_build(mcdb *db)
+{
+    size_t size;
+    db->base = build_image(&size);
+    db->size = size;
+    db->header = (const mcdb_header *) db->base;
+    db->mapped = 0;
+    return db->base ? 0 : -1;
+}
+
+int mcdb_load(mcdb *db, const char *path, const char *argv0)
+{
+    static const char *const places[] = { "", "../../" };
+    char file[MAX_PATH_SIZE];
+    size_t dir = 0;
+
+    if (path) {
+        return mcdb_open(db, path);
+    }
+    for (size_t i = 0; argv0 && argv0[i]; i++) {
+        if (argv0[i] == '/' || argv0[i] == '\\') {
+            dir = i + 1;
+        }
+    }
+    // a program found on the PATH has no directory to look in
+    for (int i = 0; i < 2 && dir && dir + sizeof("../../" MCDB_FILE_NAME) <= sizeof(file); i++) {
+        memcpy(file, argv0, dir);
+        strcpy(file + dir, places[i]);
+        strcat(file, MCDB_FILE_NAME);
+        if (open_image(db, file) == 0) {
+            if (is_current(db)) {
+                return 0;
+            }
+            // left over from a build of another inst[]
+            mcdb_close(db);
+            break;
+        }
+        if (errno != ENOENT) {
+            return -1;
+        }
+    }
+    if (mcdb_build(db) != 0) {
+        errno = ENOMEM;
+        return -1;
+    }
+    return 0;
+}
+
+void mcdb_close(mcdb *db)
+{
+#if !defined(_WIN32)
+    if (db->mapped) {
+        munmap((void *) db->base, db->size);
+    } else
+#endif
+    {
+        free((void *) db->base);
+    }
+    db->base = NULL;
+    db->header = NULL;
+}
+
+const mcdb_inst *mcdb_get(const mcdb *db, int record)
+{
+    return (const mcdb_inst *) (db->base + db->header->insts) + record;
+}
+
+const char *mcdb_string(const mcdb *db, uint32_t offset)
+{
+    return (const char *) db->base + db->header->strings + offset;
+}
+
+const uint16_t *mcdb_items(const mcdb *db, const mcdb_list *list)
+{
+    return (const uint16_t *) (db->base + db->header->lists) + list->offset;
+}
+
+int mcdb_find(const mcdb *db, const char *name, int set)
+{
+    const uint16_t *items = mcdb_items(db, &db->header->names);
+    size_t low = 0;
+    size_t high = db->header->names.count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        const mcdb_inst *in = mcdb_get(db, items[mid]);
+        int cmp = strcmp(mcdb_string(db, in->name), name);
+        if (cmp == 0) {
+            return (in->set & set) ? items[mid] : -1;
+        } else if (cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return -1;
+}
+
+const mcdb_type *mcdb_find_type(const mcdb *db, int typ)
+{
+    const mcdb_type *table = (const mcdb_type *) (db->base + db->header->types);
+    for (uint32_t t = 0; t < db->header->type_count; t++) {
+        if (table[t].typ == typ) {
+            return &table[t];
+        }
+    }
+    return NULL;
+}
+
+const mcdb_list *mcdb_opcode(const mcdb *db, int tyte1)
+{
+    return (const mcdb_list *) (db->base + db->header->opcodes) + tyte1;
+}
@@ -0,0 +1,106 @@
+#include "mcinstr.h"
+#include "mcop.h"
+#include "mcdecode.h"
+
+const unsigned char inst_digit_code[14] = {
+    0xE, 0xC, 0x8, 0x0, 0x1, 0x2, 0x5, 0xA, 0x4, 0x9, 0x3, 0x6, 0xD, 0xB
+};
+
+const char *const inst_tef_names[INST_SET_COUNT][8] = {
+    { "PT", "X",   "WPT", "W",   "PQ",  "XS", "M", "S"  },
+    { "@R", "S&X", "R<",  "ALL", "P-Q", "XS", "M", "MS" },
+    { "@R", "S&X", "R<",  "ALL", "P-Q", "XS", "M", "MS" }
+};
+
+// inverse of inst_digit_code, codes 7 and F are no digits
+static const signed char digit_value[16] = {
+    3, 4, 5, 10, 8, 6, 11, -1, 2, 9, 7, 13, 1, 12, 0, -1
+};
+
+int inst_set_index(int set)
+{
+    switch (set) {
+        case SET_HP:      return 0;
+        case SET_JDA:     return 1;
+        case SET_ZENCODE: return 2;
+        default:          return -1;
+    }
+}
+
+// Operand layout of the first word per operand type. Returns 0 for
+// pseudo instructions that have no encoding of their own.
+int inst_decode_field(int typ, unsigned short *mask, unsigned char *shift, unsigned char *words)
+{
+    *mask = 0;
+    *shift = 0;
+    *words = 1;
+    switch (typ) {
+        case MCODE_OP_NONE1:
+        case MCODE_OP_NONE2:
+        case MCODE_OP_NONE3:
+            return 1;
+        case MCODE_OP_TEF1:
+            *mask = 0x01C;
+            *shift = 2;
+            return 1;
+        case MCODE_OP_TEF2:
+            // two class 2 instructions on the same field
+            *mask = 0x01C;
+            *shift = 2;
+            *words = 2;
+            return 1;
+        case MCODE_OP_0_TO_13_DEC:
+        case MCODE_OP_0_TO_F_HEX:
+            *mask = 0x3C0;
+            *shift = 6;
+            return 1;
+        case MCODE_OP_0_TO_7:
+            *mask = 0x1C0;
+            *shift = 6;
+            return 1;
+        case MCODE_OP_DISPLACEMENT:
+            *mask = 0x3F8;
+            *shift = 3;
+            return 1;
+        case MCODE_OP_ADDRESS1:
+            // low address byte, the second word holds the high byte
+            *mask = 0x3FC;
+            *shift = 2;
+            *words = 2;
+            return 1;
+        case MCODE_OP_ADDRESS2:
+        case MCODE_OP_ADDRESS4:
+            // call into the 41C relative jump routines plus target word
+            *words = 3;
+            return 1;
+        case MCODE_OP_000_TO_FFF_HEX:
+            // three LC instructions, the first holds the top digit
+            *mask = 0x3C0;
+            *shift = 6;
+            *words = 3;
+            return 1;
+        case MCODE_OP_000_TO_3FF_HEX:
+            // the constant follows in the second word
+            *words = 2;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Stores the operand value encoded in the first word in *value.
+// Returns -1 if the field does not hold a valid operand.
+int inst_decode_operand(const inst_decode_entry *entry, int word, int *value)
+{
+    *value = (word & entry->mask) >> entry->shift;
+    switch (entry->typ) {
+        case MCODE_OP_0_TO_13_DEC:
+            *value = digit_value[*value];
+            return *value < 0 ? -1 : 0;
+        case MCODE_OP_DISPLACEMENT:
+            *value = (*value & 0x40) ? *value - 0x80 : *value;
+            return 0;
+        default:
+            return 0;
+    }
+}
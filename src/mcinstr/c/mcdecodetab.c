@@ -0,0 +1,1577 @@
+/* Generated by mcinstrgen decode, do not edit. */
+
+#include "mcinstr.h"
+#include "mcdecode.h"
+
+const inst_decode_entry inst_decode[INST_WORD_COUNT][INST_SET_COUNT] = {
+    { { 250, 0x000, 0, 1, 'A' }, { 250, 0x000, 0, 1, 'A' }, { 250, 0x000, 0, 1, 'A' } }, // 000
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 001
+    { {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' } }, // 002
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 003
+    { { 294, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 004
+    { {  12, 0x000, 0, 1, 'U' }, {  12, 0x000, 0, 1, 'U' }, {  12, 0x000, 0, 1, 'U' } }, // 005
+    { {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' } }, // 006
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 007
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 008
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 009
+    { {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' } }, // 00A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 00B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 00C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 00D
+    { {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' } }, // 00E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 00F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 010
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 011
+    { {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' } }, // 012
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 013
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 014
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 015
+    { {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' } }, // 016
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 017
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 018
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 019
+    { {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' } }, // 01A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 01B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 01C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 01D
+    { {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' }, {  11, 0x01C, 2, 1, 'D' } }, // 01E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 01F
+    { {  24, 0x000, 0, 1, 'A' }, { 255, 0x000, 0, 1, 'A' }, { 375, 0x000, 0, 1, 'A' } }, // 020
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 021
+    { {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' } }, // 022
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 023
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 024
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 025
+    { {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' } }, // 026
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 027
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 028
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 029
+    { {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' } }, // 02A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 02B
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 02C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 02D
+    { {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' } }, // 02E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 02F
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 030
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 031
+    { {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' } }, // 032
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 033
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 034
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 035
+    { {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' } }, // 036
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 037
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 038
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 039
+    { {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' } }, // 03A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 03B
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 03C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 03D
+    { {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' }, {  33, 0x01C, 2, 1, 'D' } }, // 03E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 03F
+    { { 373, 0x000, 0, 1, 'A' }, { 373, 0x000, 0, 1, 'A' }, { 393, 0x000, 0, 1, 'A' } }, // 040
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 041
+    { {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' } }, // 042
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 043
+    { { 296, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 044
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 045
+    { {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' } }, // 046
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 047
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 048
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 049
+    { {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' } }, // 04A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 04B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 04C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 04D
+    { {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' } }, // 04E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 04F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 050
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 051
+    { {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' } }, // 052
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 053
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 054
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 055
+    { {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' } }, // 056
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 057
+    { {  96, 0x000, 0, 1, 'A' }, {  96, 0x000, 0, 1, 'A' }, {  96, 0x000, 0, 1, 'A' } }, // 058
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 059
+    { {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' } }, // 05A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 05B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 05C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 05D
+    { {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' }, {  26, 0x01C, 2, 1, 'D' } }, // 05E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 05F
+    { { 317, 0x000, 0, 1, 'A' }, { 317, 0x000, 0, 1, 'A' }, { 317, 0x000, 0, 1, 'A' } }, // 060
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 061
+    { { 320, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' } }, // 062
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 063
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 064
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 065
+    { { 320, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' } }, // 066
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 067
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 068
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 069
+    { { 320, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' } }, // 06A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 06B
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 06C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 06D
+    { { 320, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' } }, // 06E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 06F
+    { { 157, 0x000, 0, 1, 'A' }, { 157, 0x000, 0, 1, 'A' }, { 157, 0x000, 0, 1, 'A' } }, // 070
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 071
+    { { 320, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' } }, // 072
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 073
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 074
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 075
+    { { 320, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' } }, // 076
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 077
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 078
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 079
+    { { 320, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' } }, // 07A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 07B
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 07C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 07D
+    { { 320, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' }, { 209, 0x01C, 2, 1, 'D' } }, // 07E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 07F
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 080
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 081
+    { {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' } }, // 082
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 083
+    { { 300, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 084
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 085
+    { {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' } }, // 086
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 087
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 088
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 089
+    { {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' } }, // 08A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 08B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 08C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 08D
+    { {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' } }, // 08E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 08F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 090
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 091
+    { {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' } }, // 092
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 093
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 094
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 095
+    { {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' } }, // 096
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 097
+    { {  72, 0x000, 0, 1, 'A' }, {  72, 0x000, 0, 1, 'A' }, {  72, 0x000, 0, 1, 'A' } }, // 098
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 099
+    { {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' } }, // 09A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 09B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 09C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 09D
+    { {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' }, {  52, 0x01C, 2, 1, 'D' } }, // 09E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 09F
+    { { 219, 0x000, 0, 1, 'A' }, { 234, 0x000, 0, 1, 'A' }, { 229, 0x000, 0, 1, 'A' } }, // 0A0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0A1
+    { { 328, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' } }, // 0A2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0A3
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 0A4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0A5
+    { { 328, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' } }, // 0A6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0A7
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 0A8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0A9
+    { { 328, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' } }, // 0AA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0AB
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 0AC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0AD
+    { { 328, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' } }, // 0AE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0AF
+    { {  86, 0x000, 0, 1, 'A' }, {  86, 0x000, 0, 1, 'A' }, {  86, 0x000, 0, 1, 'A' } }, // 0B0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0B1
+    { { 328, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' } }, // 0B2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0B3
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 0B4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0B5
+    { { 328, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' } }, // 0B6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0B7
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 0B8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0B9
+    { { 328, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' } }, // 0BA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0BB
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 0BC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0BD
+    { { 328, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' }, { 202, 0x01C, 2, 1, 'D' } }, // 0BE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0BF
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 0C0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0C1
+    { {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' } }, // 0C2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0C3
+    { { 334, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 0C4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0C5
+    { {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' } }, // 0C6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0C7
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 0C8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0C9
+    { {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' } }, // 0CA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0CB
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 0CC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0CD
+    { {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' } }, // 0CE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0CF
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 0D0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0D1
+    { {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' } }, // 0D2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0D3
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 0D4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0D5
+    { {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' } }, // 0D6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0D7
+    { { 392, 0x000, 0, 1, 'A' }, { 242, 0x000, 0, 1, 'A' }, { 242, 0x000, 0, 1, 'A' } }, // 0D8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0D9
+    { {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' } }, // 0DA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0DB
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 0DC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0DD
+    { {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' }, {  62, 0x01C, 2, 1, 'D' } }, // 0DE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0DF
+    { { 223, 0x000, 0, 1, 'A' }, { 233, 0x000, 0, 1, 'A' }, { 235, 0x000, 0, 1, 'A' } }, // 0E0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0E1
+    { { 344, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' } }, // 0E2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0E3
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 0E4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0E5
+    { { 344, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' } }, // 0E6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0E7
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 0E8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0E9
+    { { 344, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' } }, // 0EA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0EB
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 0EC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0ED
+    { { 344, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' } }, // 0EE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0EF
+    { {  30, 0x000, 0, 1, 'A' }, {  35, 0x000, 0, 1, 'A' }, {  35, 0x000, 0, 1, 'A' } }, // 0F0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0F1
+    { { 344, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' } }, // 0F2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0F3
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 0F4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0F5
+    { { 344, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' } }, // 0F6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0F7
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 0F8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0F9
+    { { 344, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' } }, // 0FA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 0FB
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 0FC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 0FD
+    { { 344, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' }, { 227, 0x01C, 2, 1, 'D' } }, // 0FE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 0FF
+    { { 337, 0x000, 0, 1, 'A' }, { 148, 0x000, 0, 1, 'A' }, { 337, 0x000, 0, 1, 'A' } }, // 100
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 101
+    { {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' } }, // 102
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 103
+    { { 160, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 104
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 105
+    { {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' } }, // 106
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 107
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 108
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 109
+    { {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' } }, // 10A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 10B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 10C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 10D
+    { {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' } }, // 10E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 10F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 110
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 111
+    { {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' } }, // 112
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 113
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 114
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 115
+    { {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' } }, // 116
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 117
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 118
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 119
+    { {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' } }, // 11A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 11B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 11C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 11D
+    { {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' }, {  48, 0x01C, 2, 1, 'D' } }, // 11E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 11F
+    { { 199, 0x000, 0, 1, 'A' }, { 354, 0x000, 0, 1, 'A' }, { 354, 0x000, 0, 1, 'A' } }, // 120
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 121
+    { {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' } }, // 122
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 123
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 124
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 125
+    { {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' } }, // 126
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 127
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 128
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 129
+    { {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' } }, // 12A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 12B
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 12C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 12D
+    { {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' } }, // 12E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 12F
+    { { 176, 0x000, 0, 2, 'Q' }, { 176, 0x000, 0, 2, 'Q' }, { 278, 0x000, 0, 2, 'Q' } }, // 130
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 131
+    { {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' } }, // 132
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 133
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 134
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 135
+    { {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' } }, // 136
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 137
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 138
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 139
+    { {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' } }, // 13A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 13B
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 13C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 13D
+    { {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' }, {  66, 0x01C, 2, 1, 'D' } }, // 13E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 13F
+    { { 341, 0x000, 0, 1, 'A' }, { 152, 0x000, 0, 1, 'A' }, { 341, 0x000, 0, 1, 'A' } }, // 140
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 141
+    { {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' } }, // 142
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 143
+    { { 302, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 144
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 145
+    { {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' } }, // 146
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 147
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 148
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 149
+    { {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' } }, // 14A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 14B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 14C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 14D
+    { {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' } }, // 14E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 14F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 150
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 151
+    { {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' } }, // 152
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 153
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 154
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 155
+    { {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' } }, // 156
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 157
+    { { 144, 0x000, 0, 1, 'A' }, { 144, 0x000, 0, 1, 'A' }, { 144, 0x000, 0, 1, 'A' } }, // 158
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 159
+    { {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' } }, // 15A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 15B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 15C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 15D
+    { {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' }, {  57, 0x01C, 2, 1, 'D' } }, // 15E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 15F
+    { {  97, 0x000, 0, 1, 'A' }, { 264, 0x000, 0, 1, 'A' }, { 379, 0x000, 0, 1, 'A' } }, // 160
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 161
+    { {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' } }, // 162
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 163
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 164
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 165
+    { {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' } }, // 166
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 167
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 168
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 169
+    { {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' } }, // 16A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 16B
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 16C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 16D
+    { {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' } }, // 16E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 16F
+    { { 311, 0x000, 0, 1, 'A' }, { 311, 0x000, 0, 1, 'A' }, {  50, 0x000, 0, 1, 'A' } }, // 170
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 171
+    { {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' } }, // 172
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 173
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 174
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 175
+    { {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' } }, // 176
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 177
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 178
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 179
+    { {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' } }, // 17A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 17B
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 17C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 17D
+    { {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' }, {  21, 0x01C, 2, 1, 'D' } }, // 17E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 17F
+    { { 339, 0x000, 0, 1, 'A' }, { 150, 0x000, 0, 1, 'A' }, { 339, 0x000, 0, 1, 'A' } }, // 180
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 181
+    { {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' } }, // 182
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 183
+    { { 314, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 184
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 185
+    { {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' } }, // 186
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 187
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 188
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 189
+    { {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' } }, // 18A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 18B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 18C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 18D
+    { {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' } }, // 18E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 18F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 190
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 191
+    { {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' } }, // 192
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 193
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 194
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 195
+    { {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' } }, // 196
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 197
+    { {  84, 0x000, 0, 1, 'A' }, {  84, 0x000, 0, 1, 'A' }, {  84, 0x000, 0, 1, 'A' } }, // 198
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 199
+    { {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' } }, // 19A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 19B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 19C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 19D
+    { {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' }, {  63, 0x01C, 2, 1, 'D' } }, // 19E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 19F
+    { {  27, 0x000, 0, 1, 'A' }, { 187, 0x000, 0, 1, 'A' }, {  38, 0x000, 0, 1, 'A' } }, // 1A0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1A1
+    { {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' } }, // 1A2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1A3
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 1A4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1A5
+    { {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' } }, // 1A6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1A7
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 1A8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1A9
+    { {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' } }, // 1AA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1AB
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 1AC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1AD
+    { {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' } }, // 1AE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1AF
+    { {  22, 0x000, 0, 1, 'A' }, {  22, 0x000, 0, 1, 'A' }, { 110, 0x000, 0, 1, 'A' } }, // 1B0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1B1
+    { {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' } }, // 1B2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1B3
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 1B4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1B5
+    { {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' } }, // 1B6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1B7
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 1B8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1B9
+    { {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' } }, // 1BA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1BB
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 1BC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1BD
+    { {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' }, {  29, 0x01C, 2, 1, 'D' } }, // 1BE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1BF
+    { { 343, 0x000, 0, 1, 'A' }, { 154, 0x000, 0, 1, 'A' }, { 343, 0x000, 0, 1, 'A' } }, // 1C0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1C1
+    { {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' } }, // 1C2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1C3
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 1C4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1C5
+    { {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' } }, // 1C6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1C7
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 1C8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1C9
+    { {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' } }, // 1CA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1CB
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 1CC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1CD
+    { {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' } }, // 1CE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1CF
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 1D0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1D1
+    { {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' } }, // 1D2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1D3
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 1D4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1D5
+    { {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' } }, // 1D6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1D7
+    { {  15, 0x000, 0, 1, 'A' }, { 254, 0x000, 0, 1, 'A' }, { 254, 0x000, 0, 1, 'A' } }, // 1D8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1D9
+    { {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' } }, // 1DA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1DB
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 1DC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1DD
+    { {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' }, {  65, 0x01C, 2, 1, 'D' } }, // 1DE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1DF
+    { { 413, 0x000, 0, 1, 'A' }, { 133, 0x000, 0, 1, 'A' }, { 352, 0x000, 0, 1, 'A' } }, // 1E0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1E1
+    { { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' } }, // 1E2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1E3
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 1E4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1E5
+    { { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' } }, // 1E6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1E7
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 1E8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1E9
+    { { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' } }, // 1EA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1EB
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 1EC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1ED
+    { { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' } }, // 1EE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1EF
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 1F0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1F1
+    { { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' } }, // 1F2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1F3
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 1F4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1F5
+    { { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' } }, // 1F6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1F7
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 1F8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1F9
+    { { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' } }, // 1FA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 1FB
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 1FC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 1FD
+    { { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' }, { 137, 0x01C, 2, 1, 'D' } }, // 1FE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 1FF
+    { { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' } }, // 200
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 201
+    { { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' } }, // 202
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 203
+    { { 136, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 204
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 205
+    { { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' } }, // 206
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 207
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 208
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 209
+    { { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' } }, // 20A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 20B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 20C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 20D
+    { { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' } }, // 20E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 20F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 210
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 211
+    { { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' } }, // 212
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 213
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 214
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 215
+    { { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' } }, // 216
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 217
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 218
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 219
+    { { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' } }, // 21A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 21B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 21C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 21D
+    { { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' }, { 126, 0x01C, 2, 1, 'D' } }, // 21E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 21F
+    { {  14, 0x000, 0, 1, 'A' }, { 349, 0x000, 0, 1, 'A' }, { 349, 0x000, 0, 1, 'A' } }, // 220
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 221
+    { { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' } }, // 222
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 223
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 224
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 225
+    { { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' } }, // 226
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 227
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 228
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 229
+    { { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' } }, // 22A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 22B
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 22C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 22D
+    { { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' } }, // 22E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 22F
+    { { 421, 0x000, 0, 1, 'A' }, { 200, 0x000, 0, 1, 'A' }, { 200, 0x000, 0, 1, 'A' } }, // 230
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 231
+    { { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' } }, // 232
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 233
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 234
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 235
+    { { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' } }, // 236
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 237
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 238
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 239
+    { { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' } }, // 23A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 23B
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 23C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 23D
+    { { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' }, { 130, 0x01C, 2, 1, 'D' } }, // 23E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 23F
+    { { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' } }, // 240
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 241
+    { { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' } }, // 242
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 243
+    { { 164, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 244
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 245
+    { { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' } }, // 246
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 247
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 248
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 249
+    { { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' } }, // 24A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 24B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 24C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 24D
+    { { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' } }, // 24E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 24F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 250
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 251
+    { { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' } }, // 252
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 253
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 254
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 255
+    { { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' } }, // 256
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 257
+    { { 372, 0x000, 0, 1, 'A' }, { 412, 0x000, 0, 1, 'A' }, { 207, 0x000, 0, 1, 'A' } }, // 258
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 259
+    { { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' } }, // 25A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 25B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 25C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 25D
+    { { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' }, { 129, 0x01C, 2, 1, 'D' } }, // 25E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 25F
+    { { 117, 0x000, 0, 1, 'A' }, { 117, 0x000, 0, 1, 'A' }, { 117, 0x000, 0, 1, 'A' } }, // 260
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 261
+    { { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' } }, // 262
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 263
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 264
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 265
+    { { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' } }, // 266
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 267
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 268
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 269
+    { { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' } }, // 26A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 26B
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 26C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 26D
+    { { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' } }, // 26E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 26F
+    { { 367, 0x000, 0, 1, 'A' }, { 371, 0x000, 0, 1, 'A' }, { 371, 0x000, 0, 1, 'A' } }, // 270
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 271
+    { { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' } }, // 272
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 273
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 274
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 275
+    { { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' } }, // 276
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 277
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 278
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 279
+    { { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' } }, // 27A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 27B
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 27C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 27D
+    { { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' }, { 171, 0x01C, 2, 1, 'D' } }, // 27E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 27F
+    { { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' } }, // 280
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 281
+    { { 175, 0x01C, 2, 1, 'D' }, { 175, 0x01C, 2, 1, 'D' }, { 418, 0x01C, 2, 1, 'D' } }, // 282
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 283
+    { { 312, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 284
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 285
+    { { 175, 0x01C, 2, 1, 'D' }, { 175, 0x01C, 2, 1, 'D' }, { 418, 0x01C, 2, 1, 'D' } }, // 286
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 287
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 288
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 289
+    { { 175, 0x01C, 2, 1, 'D' }, { 175, 0x01C, 2, 1, 'D' }, { 418, 0x01C, 2, 1, 'D' } }, // 28A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 28B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 28C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 28D
+    { { 175, 0x01C, 2, 1, 'D' }, { 175, 0x01C, 2, 1, 'D' }, { 418, 0x01C, 2, 1, 'D' } }, // 28E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 28F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 290
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 291
+    { { 175, 0x01C, 2, 1, 'D' }, { 175, 0x01C, 2, 1, 'D' }, { 418, 0x01C, 2, 1, 'D' } }, // 292
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 293
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 294
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 295
+    { { 175, 0x01C, 2, 1, 'D' }, { 175, 0x01C, 2, 1, 'D' }, { 418, 0x01C, 2, 1, 'D' } }, // 296
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 297
+    { { 115, 0x000, 0, 1, 'A' }, { 259, 0x000, 0, 1, 'A' }, { 287, 0x000, 0, 1, 'A' } }, // 298
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 299
+    { { 175, 0x01C, 2, 1, 'D' }, { 175, 0x01C, 2, 1, 'D' }, { 418, 0x01C, 2, 1, 'D' } }, // 29A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 29B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 29C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 29D
+    { { 175, 0x01C, 2, 1, 'D' }, { 175, 0x01C, 2, 1, 'D' }, { 418, 0x01C, 2, 1, 'D' } }, // 29E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 29F
+    { {  43, 0x000, 0, 1, 'A' }, {  43, 0x000, 0, 1, 'A' }, {  43, 0x000, 0, 1, 'A' } }, // 2A0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2A1
+    { { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' } }, // 2A2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2A3
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 2A4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2A5
+    { { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' } }, // 2A6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2A7
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 2A8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2A9
+    { { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' } }, // 2AA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2AB
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 2AC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2AD
+    { { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' } }, // 2AE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2AF
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 2B0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2B1
+    { { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' } }, // 2B2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2B3
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 2B4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2B5
+    { { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' } }, // 2B6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2B7
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 2B8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2B9
+    { { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' } }, // 2BA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2BB
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 2BC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2BD
+    { { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' }, { 172, 0x01C, 2, 1, 'D' } }, // 2BE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2BF
+    { { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' } }, // 2C0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2C1
+    { {  36, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' } }, // 2C2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2C3
+    { { 318, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 2C4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2C5
+    { {  36, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' } }, // 2C6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2C7
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 2C8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2C9
+    { {  36, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' } }, // 2CA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2CB
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 2CC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2CD
+    { {  36, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' } }, // 2CE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2CF
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 2D0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2D1
+    { {  36, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' } }, // 2D2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2D3
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 2D4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2D5
+    { {  36, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' } }, // 2D6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2D7
+    { { 262, 0x000, 0, 1, 'A' }, { 193, 0x000, 0, 1, 'A' }, { 221, 0x000, 0, 1, 'A' } }, // 2D8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2D9
+    { {  36, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' } }, // 2DA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2DB
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 2DC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2DD
+    { {  36, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' }, {  73, 0x01C, 2, 1, 'D' } }, // 2DE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2DF
+    { { 143, 0x000, 0, 1, 'A' }, { 143, 0x000, 0, 1, 'A' }, { 415, 0x000, 0, 1, 'A' } }, // 2E0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2E1
+    { {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' } }, // 2E2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2E3
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 2E4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2E5
+    { {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' } }, // 2E6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2E7
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 2E8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2E9
+    { {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' } }, // 2EA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2EB
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 2EC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2ED
+    { {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' } }, // 2EE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2EF
+    { { 105, 0x000, 0, 1, 'A' }, { 183, 0x000, 0, 1, 'A' }, { 105, 0x000, 0, 1, 'A' } }, // 2F0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2F1
+    { {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' } }, // 2F2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2F3
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 2F4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2F5
+    { {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' } }, // 2F6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2F7
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 2F8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2F9
+    { {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' } }, // 2FA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 2FB
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 2FC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 2FD
+    { {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' }, {  83, 0x01C, 2, 1, 'D' } }, // 2FE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 2FF
+    { { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' } }, // 300
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 301
+    { { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' } }, // 302
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 303
+    { { 281, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 304
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 305
+    { { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' } }, // 306
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 307
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 308
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 309
+    { { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' } }, // 30A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 30B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 30C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 30D
+    { { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' } }, // 30E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 30F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 310
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 311
+    { { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' } }, // 312
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 313
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 314
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 315
+    { { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' } }, // 316
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 317
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 318
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 319
+    { { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' } }, // 31A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 31B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 31C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 31D
+    { { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' }, { 211, 0x01C, 2, 1, 'D' } }, // 31E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 31F
+    { { 224, 0x000, 0, 1, 'A' }, { 224, 0x000, 0, 1, 'A' }, {  68, 0x000, 0, 1, 'A' } }, // 320
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 321
+    { { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' } }, // 322
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 323
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 324
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 325
+    { { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' } }, // 326
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 327
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 328
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 329
+    { { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' } }, // 32A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 32B
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 32C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 32D
+    { { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' } }, // 32E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 32F
+    { { 348, 0x000, 0, 1, 'A' }, { 163, 0x000, 0, 1, 'A' }, { 291, 0x000, 0, 1, 'A' } }, // 330
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 331
+    { { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' } }, // 332
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 333
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 334
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 335
+    { { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' } }, // 336
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 337
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 338
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 339
+    { { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' } }, // 33A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 33B
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 33C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 33D
+    { { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' }, { 213, 0x01C, 2, 1, 'D' } }, // 33E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 33F
+    { { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' } }, // 340
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 341
+    { {  39, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' } }, // 342
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 343
+    { { 316, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 344
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 345
+    { {  39, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' } }, // 346
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 347
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 348
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 349
+    { {  39, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' } }, // 34A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 34B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 34C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 34D
+    { {  39, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' } }, // 34E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 34F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 350
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 351
+    { {  39, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' } }, // 352
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 353
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 354
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 355
+    { {  39, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' } }, // 356
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 357
+    { { 253, 0x000, 0, 1, 'A' }, { 253, 0x000, 0, 1, 'A' }, { 253, 0x000, 0, 1, 'A' } }, // 358
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 359
+    { {  39, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' } }, // 35A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 35B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 35C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 35D
+    { {  39, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' }, {  67, 0x01C, 2, 1, 'D' } }, // 35E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 35F
+    { { 305, 0x000, 0, 1, 'A' }, {  95, 0x000, 0, 1, 'A' }, { 411, 0x000, 0, 1, 'A' } }, // 360
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 361
+    { {  40, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' } }, // 362
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 363
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 364
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 365
+    { {  40, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' } }, // 366
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 367
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 368
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 369
+    { {  40, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' } }, // 36A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 36B
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 36C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 36D
+    { {  40, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' } }, // 36E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 36F
+    { {  99, 0x000, 0, 1, 'A' }, { 327, 0x000, 0, 1, 'A' }, { 327, 0x000, 0, 1, 'A' } }, // 370
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 371
+    { {  40, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' } }, // 372
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 373
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 374
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 375
+    { {  40, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' } }, // 376
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 377
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 378
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 379
+    { {  40, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' } }, // 37A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 37B
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 37C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 37D
+    { {  40, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' }, { 177, 0x01C, 2, 1, 'D' } }, // 37E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 37F
+    { { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' } }, // 380
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 381
+    { { 166, 0x01C, 2, 1, 'D' }, { 166, 0x01C, 2, 1, 'D' }, { 268, 0x01C, 2, 1, 'D' } }, // 382
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 383
+    { { 280, 0x000, 0, 1, 'K' }, { 408, 0x3C0, 6, 1, 'E' }, {  23, 0x3C0, 6, 1, 'E' } }, // 384
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 385
+    { { 166, 0x01C, 2, 1, 'D' }, { 166, 0x01C, 2, 1, 'D' }, { 268, 0x01C, 2, 1, 'D' } }, // 386
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 387
+    { { 217, 0x3C0, 6, 1, 'E' }, {  47, 0x3C0, 6, 1, 'E' }, { 231, 0x3C0, 6, 1, 'E' } }, // 388
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 389
+    { { 166, 0x01C, 2, 1, 'D' }, { 166, 0x01C, 2, 1, 'D' }, { 268, 0x01C, 2, 1, 'D' } }, // 38A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 38B
+    { { 135, 0x3C0, 6, 1, 'E' }, { 100, 0x3C0, 6, 1, 'E' }, { 419, 0x3C0, 6, 1, 'E' } }, // 38C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 38D
+    { { 166, 0x01C, 2, 1, 'D' }, { 166, 0x01C, 2, 1, 'D' }, { 268, 0x01C, 2, 1, 'D' } }, // 38E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 38F
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 390
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 391
+    { { 166, 0x01C, 2, 1, 'D' }, { 166, 0x01C, 2, 1, 'D' }, { 268, 0x01C, 2, 1, 'D' } }, // 392
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 393
+    { { 197, 0x3C0, 6, 1, 'E' }, { 406, 0x3C0, 6, 1, 'E' }, { 104, 0x3C0, 6, 1, 'E' } }, // 394
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 395
+    { { 166, 0x01C, 2, 1, 'D' }, { 166, 0x01C, 2, 1, 'D' }, { 268, 0x01C, 2, 1, 'D' } }, // 396
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 397
+    { { 360, 0x000, 0, 1, 'A' }, { 360, 0x000, 0, 1, 'A' }, { 360, 0x000, 0, 1, 'A' } }, // 398
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 399
+    { { 166, 0x01C, 2, 1, 'D' }, { 166, 0x01C, 2, 1, 'D' }, { 268, 0x01C, 2, 1, 'D' } }, // 39A
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 39B
+    { { 248, 0x3C0, 6, 1, 'E' }, { 248, 0x3C0, 6, 1, 'E' }, {  25, 0x3C0, 6, 1, 'E' } }, // 39C
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 39D
+    { { 166, 0x01C, 2, 1, 'D' }, { 166, 0x01C, 2, 1, 'D' }, { 268, 0x01C, 2, 1, 'D' } }, // 39E
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 39F
+    { { 363, 0x000, 0, 1, 'A' }, {  41, 0x000, 0, 1, 'A' }, { 249, 0x000, 0, 1, 'A' } }, // 3A0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3A1
+    { { 179, 0x01C, 2, 1, 'D' }, { 179, 0x01C, 2, 1, 'D' }, { 270, 0x01C, 2, 1, 'D' } }, // 3A2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3A3
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 3A4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3A5
+    { { 179, 0x01C, 2, 1, 'D' }, { 179, 0x01C, 2, 1, 'D' }, { 270, 0x01C, 2, 1, 'D' } }, // 3A6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3A7
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 3A8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3A9
+    { { 179, 0x01C, 2, 1, 'D' }, { 179, 0x01C, 2, 1, 'D' }, { 270, 0x01C, 2, 1, 'D' } }, // 3AA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3AB
+    { { 358, 0x3C0, 6, 1, 'E' }, { 114, 0x3C0, 6, 1, 'E' }, { 282, 0x3C0, 6, 1, 'E' } }, // 3AC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3AD
+    { { 179, 0x01C, 2, 1, 'D' }, { 179, 0x01C, 2, 1, 'D' }, { 270, 0x01C, 2, 1, 'D' } }, // 3AE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3AF
+    { { 113, 0x000, 0, 1, 'A' }, { 116, 0x000, 0, 1, 'A' }, { 116, 0x000, 0, 1, 'A' } }, // 3B0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3B1
+    { { 179, 0x01C, 2, 1, 'D' }, { 179, 0x01C, 2, 1, 'D' }, { 270, 0x01C, 2, 1, 'D' } }, // 3B2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3B3
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 3B4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3B5
+    { { 179, 0x01C, 2, 1, 'D' }, { 179, 0x01C, 2, 1, 'D' }, { 270, 0x01C, 2, 1, 'D' } }, // 3B6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3B7
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 3B8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3B9
+    { { 179, 0x01C, 2, 1, 'D' }, { 179, 0x01C, 2, 1, 'D' }, { 270, 0x01C, 2, 1, 'D' } }, // 3BA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3BB
+    { { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' }, { 238, 0x3C0, 6, 1, 'E' } }, // 3BC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3BD
+    { { 179, 0x01C, 2, 1, 'D' }, { 179, 0x01C, 2, 1, 'D' }, { 270, 0x01C, 2, 1, 'D' } }, // 3BE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3BF
+    { { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' }, { 401, 0x1C0, 6, 1, 'L' } }, // 3C0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3C1
+    { { 182, 0x01C, 2, 1, 'D' }, { 182, 0x01C, 2, 1, 'D' }, { 267, 0x01C, 2, 1, 'D' } }, // 3C2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3C3
+    { { 266, 0x000, 0, 1, 'A' }, { 226, 0x000, 0, 1, 'A' }, { 226, 0x000, 0, 1, 'A' } }, // 3C4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3C5
+    { { 182, 0x01C, 2, 1, 'D' }, { 182, 0x01C, 2, 1, 'D' }, { 267, 0x01C, 2, 1, 'D' } }, // 3C6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3C7
+    { { 381, 0x000, 0, 1, 'A' }, { 161, 0x000, 0, 1, 'A' }, { 161, 0x000, 0, 1, 'A' } }, // 3C8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3C9
+    { { 182, 0x01C, 2, 1, 'D' }, { 182, 0x01C, 2, 1, 'D' }, { 267, 0x01C, 2, 1, 'D' } }, // 3CA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3CB
+    { {  78, 0x000, 0, 1, 'A' }, { 380, 0x000, 0, 1, 'A' }, { 380, 0x000, 0, 1, 'A' } }, // 3CC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3CD
+    { { 182, 0x01C, 2, 1, 'D' }, { 182, 0x01C, 2, 1, 'D' }, { 267, 0x01C, 2, 1, 'D' } }, // 3CE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3CF
+    { {  13, 0x3C0, 6, 1, 'F' }, {  13, 0x3C0, 6, 1, 'F' }, {  55, 0x3C0, 6, 1, 'F' } }, // 3D0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3D1
+    { { 182, 0x01C, 2, 1, 'D' }, { 182, 0x01C, 2, 1, 'D' }, { 267, 0x01C, 2, 1, 'D' } }, // 3D2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3D3
+    { {  54, 0x000, 0, 1, 'A' }, { 423, 0x000, 0, 1, 'A' }, { 284, 0x000, 0, 1, 'A' } }, // 3D4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3D5
+    { { 182, 0x01C, 2, 1, 'D' }, { 182, 0x01C, 2, 1, 'D' }, { 267, 0x01C, 2, 1, 'D' } }, // 3D6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3D7
+    { { 346, 0x000, 0, 1, 'A' }, { 275, 0x000, 0, 1, 'A' }, { 275, 0x000, 0, 1, 'A' } }, // 3D8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3D9
+    { { 182, 0x01C, 2, 1, 'D' }, { 182, 0x01C, 2, 1, 'D' }, { 267, 0x01C, 2, 1, 'D' } }, // 3DA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3DB
+    { { 382, 0x000, 0, 1, 'A' }, { 414, 0x000, 0, 1, 'A' }, { 279, 0x000, 0, 1, 'A' } }, // 3DC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3DD
+    { { 182, 0x01C, 2, 1, 'D' }, { 182, 0x01C, 2, 1, 'D' }, { 267, 0x01C, 2, 1, 'D' } }, // 3DE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3DF
+    { { 298, 0x000, 0, 1, 'A' }, { 298, 0x000, 0, 1, 'A' }, { 298, 0x000, 0, 1, 'A' } }, // 3E0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3E1
+    { { 190, 0x01C, 2, 1, 'D' }, { 190, 0x01C, 2, 1, 'D' }, {  71, 0x01C, 2, 1, 'D' } }, // 3E2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3E3
+    { {   7, 0x3C0, 6, 1, 'F' }, { 398, 0x3C0, 6, 1, 'F' }, { 153, 0x3C0, 6, 1, 'F' } }, // 3E4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3E5
+    { { 190, 0x01C, 2, 1, 'D' }, { 190, 0x01C, 2, 1, 'D' }, {  71, 0x01C, 2, 1, 'D' } }, // 3E6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3E7
+    { { 244, 0x3C0, 6, 1, 'F' }, { 424, 0x3C0, 6, 1, 'F' }, { 383, 0x3C0, 6, 1, 'F' } }, // 3E8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3E9
+    { { 190, 0x01C, 2, 1, 'D' }, { 190, 0x01C, 2, 1, 'D' }, {  71, 0x01C, 2, 1, 'D' } }, // 3EA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3EB
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 3EC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3ED
+    { { 190, 0x01C, 2, 1, 'D' }, { 190, 0x01C, 2, 1, 'D' }, {  71, 0x01C, 2, 1, 'D' } }, // 3EE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3EF
+    { { 397, 0x000, 0, 1, 'A' }, { 102, 0x000, 0, 1, 'A' }, { 400, 0x000, 0, 1, 'A' } }, // 3F0
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3F1
+    { { 190, 0x01C, 2, 1, 'D' }, { 190, 0x01C, 2, 1, 'D' }, {  71, 0x01C, 2, 1, 'D' } }, // 3F2
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3F3
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 3F4
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3F5
+    { { 190, 0x01C, 2, 1, 'D' }, { 190, 0x01C, 2, 1, 'D' }, {  71, 0x01C, 2, 1, 'D' } }, // 3F6
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }, // 3F7
+    { {  44, 0x3C0, 6, 1, 'F' }, { 369, 0x3C0, 6, 1, 'F' }, { 138, 0x3C0, 6, 1, 'F' } }, // 3F8
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3F9
+    { { 190, 0x01C, 2, 1, 'D' }, { 190, 0x01C, 2, 1, 'D' }, {  71, 0x01C, 2, 1, 'D' } }, // 3FA
+    { {  89, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' }, { 188, 0x3F8, 3, 1, 'G' } }, // 3FB
+    { {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   }, {  -1, 0x000, 0, 0, 0   } }, // 3FC
+    { {   3, 0x3FC, 2, 2, 'H' }, { 107, 0x3FC, 2, 2, 'H' }, {  64, 0x3FC, 2, 2, 'H' } }, // 3FD
+    { { 190, 0x01C, 2, 1, 'D' }, { 190, 0x01C, 2, 1, 'D' }, {  71, 0x01C, 2, 1, 'D' } }, // 3FE
+    { { 191, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' }, {   5, 0x3F8, 3, 1, 'G' } }  // 3FF
+};
+
+const short inst_decode_offset[INST_WORD_COUNT + 1] = {
+    0, 1, 15, 16, 20, 23, 38, 39, 42, 45, 59, 60,
+    63, 67, 81, 82, 84, 88, 102, 103, 106, 109, 123, 124,
+    126, 126, 140, 141, 144, 146, 160, 161, 163, 166, 180, 181,
+    184, 187, 201, 202, 204, 213, 227, 228, 231, 235, 249, 250,
+    252, 252, 266, 267, 270, 270, 284, 285, 287, 297, 311, 313,
+    316, 317, 331, 332, 334, 336, 350, 351, 355, 358, 372, 373,
+    375, 378, 392, 393, 396, 400, 414, 415, 417, 421, 435, 436,
+    439, 442, 456, 457, 459, 460, 474, 475, 478, 480, 494, 495,
+    497, 498, 512, 517, 520, 523, 537, 542, 544, 552, 566, 571,
+    574, 578, 592, 597, 599, 600, 614, 619, 622, 622, 636, 641,
+    643, 650, 664, 669, 672, 673, 687, 692, 694, 694, 708, 709,
+    713, 716, 730, 731, 733, 736, 750, 751, 754, 758, 772, 773,
+    775, 779, 793, 794, 797, 800, 814, 815, 817, 818, 832, 833,
+    836, 838, 852, 853, 855, 858, 872, 877, 880, 883, 897, 902,
+    904, 913, 927, 932, 935, 940, 954, 959, 961, 962, 976, 981,
+    984, 984, 998, 1003, 1005, 1012, 1026, 1031, 1034, 1035, 1049, 1054,
+    1056, 1056, 1070, 1071, 1074, 1077, 1091, 1092, 1094, 1097, 1111, 1112,
+    1115, 1119, 1133, 1134, 1136, 1140, 1154, 1155, 1158, 1161, 1175, 1176,
+    1178, 1180, 1194, 1195, 1198, 1200, 1214, 1215, 1217, 1220, 1234, 1239,
+    1242, 1245, 1259, 1264, 1266, 1274, 1288, 1293, 1296, 1302, 1316, 1321,
+    1323, 1327, 1341, 1346, 1349, 1349, 1363, 1368, 1370, 1377, 1391, 1396,
+    1399, 1400, 1414, 1419, 1421, 1423, 1437, 1438, 1441, 1444, 1458, 1459,
+    1461, 1464, 1478, 1479, 1482, 1486, 1500, 1501, 1503, 1507, 1521, 1522,
+    1525, 1528, 1542, 1543, 1545, 1545, 1559, 1560, 1563, 1565, 1579, 1580,
+    1582, 1584, 1598, 1599, 1602, 1605, 1619, 1620, 1622, 1629, 1643, 1644,
+    1647, 1653, 1667, 1668, 1670, 1672, 1686, 1687, 1690, 1690, 1704, 1705,
+    1707, 1714, 1728, 1729, 1732, 1733, 1747, 1748, 1750, 1752, 1766, 1767,
+    1770, 1773, 1787, 1788, 1790, 1793, 1807, 1808, 1811, 1815, 1829, 1830,
+    1832, 1836, 1850, 1851, 1854, 1857, 1871, 1872, 1874, 1875, 1889, 1890,
+    1893, 1895, 1909, 1910, 1912, 1916, 1930, 1931, 1934, 1937, 1951, 1952,
+    1954, 1962, 1976, 1977, 1980, 1986, 2000, 2001, 2003, 2005, 2019, 2020,
+    2023, 2023, 2037, 2038, 2040, 2047, 2061, 2062, 2065, 2066, 2080, 2081,
+    2083, 2085, 2099, 2100, 2103, 2106, 2120, 2121, 2123, 2126, 2140, 2141,
+    2144, 2148, 2162, 2163, 2165, 2169, 2183, 2184, 2187, 2190, 2204, 2205,
+    2207, 2208, 2222, 2223, 2226, 2228, 2242, 2243, 2245, 2248, 2262, 2263,
+    2266, 2269, 2283, 2284, 2286, 2291, 2305, 2306, 2309, 2314, 2328, 2329,
+    2331, 2333, 2347, 2348, 2351, 2351, 2365, 2366, 2368, 2373, 2387, 2388,
+    2391, 2392, 2406, 2407, 2409, 2411, 2425, 2426, 2429, 2429, 2443, 2444,
+    2446, 2446, 2460, 2461, 2464, 2464, 2478, 2479, 2481, 2485, 2499, 2500,
+    2503, 2503, 2517, 2518, 2520, 2524, 2538, 2539, 2542, 2542, 2556, 2557,
+    2559, 2562, 2576, 2577, 2580, 2583, 2597, 2598, 2600, 2607, 2621, 2622,
+    2625, 2625, 2639, 2640, 2642, 2642, 2656, 2657, 2660, 2660, 2674, 2675,
+    2677, 2682, 2696, 2697, 2700, 2700, 2714, 2715, 2717, 2718, 2732, 2734,
+    2737, 2740, 2754, 2756, 2758, 2761, 2775, 2777, 2780, 2784, 2798, 2800,
+    2802, 2806, 2820, 2822, 2825, 2828, 2842, 2844, 2846, 2846, 2860, 2862,
+    2865, 2867, 2881, 2883, 2885, 2887, 2901, 2902, 2905, 2908, 2922, 2923,
+    2925, 2932, 2946, 2947, 2950, 2955, 2969, 2970, 2972, 2974, 2988, 2989,
+    2992, 2992, 3006, 3007, 3009, 3014, 3028, 3029, 3032, 3033, 3047, 3048,
+    3050, 3051, 3065, 3066, 3069, 3072, 3086, 3087, 3089, 3092, 3106, 3107,
+    3110, 3114, 3128, 3129, 3131, 3135, 3149, 3150, 3153, 3156, 3170, 3171,
+    3173, 3176, 3190, 3191, 3194, 3196, 3210, 3211, 3213, 3214, 3228, 3229,
+    3232, 3235, 3249, 3250, 3252, 3260, 3274, 3275, 3278, 3284, 3298, 3299,
+    3301, 3303, 3317, 3318, 3321, 3321, 3335, 3336, 3338, 3343, 3357, 3358,
+    3361, 3362, 3376, 3377, 3379, 3380, 3394, 3396, 3399, 3402, 3416, 3418,
+    3420, 3423, 3437, 3439, 3442, 3446, 3460, 3462, 3464, 3468, 3482, 3484,
+    3487, 3490, 3504, 3506, 3508, 3511, 3525, 3527, 3530, 3532, 3546, 3548,
+    3550, 3551, 3565, 3566, 3569, 3572, 3586, 3587, 3589, 3596, 3610, 3611,
+    3614, 3620, 3634, 3635, 3637, 3637, 3651, 3652, 3655, 3655, 3669, 3670,
+    3672, 3677, 3691, 3692, 3695, 3696, 3710, 3711, 3713, 3714, 3728, 3730,
+    3733, 3736, 3750, 3752, 3754, 3757, 3771, 3773, 3776, 3780, 3794, 3796,
+    3798, 3802, 3816, 3818, 3821, 3824, 3838, 3840, 3842, 3845, 3859, 3861,
+    3864, 3866, 3880, 3882, 3884, 3886, 3900, 3902, 3905, 3908, 3922, 3924,
+    3926, 3934, 3948, 3950, 3953, 3958, 3972, 3974, 3976, 3981, 3995, 3997,
+    4000, 4000, 4014, 4016, 4018, 4023, 4037, 4039, 4042, 4043, 4057, 4059,
+    4061, 4062, 4076, 4078, 4081, 4084, 4098, 4100, 4102, 4105, 4119, 4121,
+    4124, 4128, 4142, 4144, 4146, 4150, 4164, 4166, 4169, 4172, 4186, 4188,
+    4190, 4190, 4204, 4206, 4209, 4211, 4225, 4227, 4229, 4231, 4245, 4247,
+    4250, 4253, 4267, 4269, 4271, 4279, 4293, 4295, 4298, 4303, 4317, 4319,
+    4321, 4324, 4338, 4340, 4343, 4343, 4357, 4359, 4361, 4366, 4380, 4382,
+    4385, 4386, 4400, 4402, 4404, 4405, 4422, 4424, 4427, 4430, 4444, 4446,
+    4448, 4451, 4468, 4470, 4473, 4477, 4491, 4493, 4495, 4499, 4513, 4515,
+    4518, 4521, 4535, 4537, 4539, 4540, 4554, 4556, 4559, 4561, 4575, 4577,
+    4579, 4582, 4596, 4598, 4601, 4604, 4618, 4620, 4622, 4630, 4644, 4646,
+    4649, 4655, 4669, 4671, 4673, 4675, 4689, 4691, 4694, 4694, 4708, 4710,
+    4712, 4717, 4731, 4733, 4736, 4737, 4751, 4753, 4755, 4756, 4770, 4772,
+    4775, 4778, 4792, 4794, 4796, 4799, 4813, 4815, 4818, 4822, 4836, 4838,
+    4840, 4844, 4858, 4860, 4863, 4866, 4880, 4882, 4884, 4885, 4899, 4901,
+    4904, 4906, 4920, 4922, 4924, 4927, 4941, 4943, 4946, 4949, 4963, 4965,
+    4967, 4974, 4988, 4990, 4993, 4998, 5012, 5014, 5016, 5019, 5033, 5035,
+    5038, 5038, 5052, 5054, 5056, 5062, 5076, 5078, 5081, 5082, 5096, 5098,
+    5100, 5101, 5115, 5117, 5120, 5122, 5136, 5138, 5140, 5142, 5156, 5158,
+    5161, 5163, 5177, 5179, 5181, 5185, 5199, 5201, 5204, 5207, 5221, 5223,
+    5225, 5227, 5241, 5243, 5246, 5249, 5263, 5265, 5267, 5268, 5282, 5284,
+    5287, 5290, 5304, 5306, 5308, 5317, 5331, 5333, 5336, 5336, 5350, 5352,
+    5354, 5357, 5371, 5373, 5376, 5376, 5390, 5392, 5394, 5399, 5413, 5415,
+    5418, 5418, 5432, 5434, 5436
+};
+
+const short inst_decode_candidates[] = {
+    250, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 11, 89, 188, 273, 396, 23, 408, 294, 12,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 11, 5, 191, 261, 47, 217, 231, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 11,
+    89, 188, 273, 100, 135, 419, 269, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 11, 5, 191,
+    13, 55, 195, 212, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 11, 89, 188, 273, 104, 197,
+    406, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 11, 5, 191, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 11, 89, 188, 273,
+    25, 248, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 11, 5, 191, 24, 255, 375, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    33, 89, 188, 273, 7, 153, 398, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 33, 5, 191,
+    244, 383, 424, 58, 70, 201, 243, 303, 366, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 33,
+    89, 188, 273, 114, 282, 358, 61, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 33, 5, 191,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 33, 89, 188, 273, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 33, 5, 191, 44,
+    138, 369, 31, 32, 216, 239, 283, 323, 409, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 33,
+    34, 89, 188, 273, 238, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 33, 5, 191, 373, 393,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 26, 89, 188, 273, 335, 23, 408, 296, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    26, 5, 191, 47, 217, 231, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 26, 89, 188, 273,
+    100, 135, 419, 277, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 26, 5, 191, 13, 55, 195,
+    212, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 26, 89, 188, 273, 104, 197, 406, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    26, 5, 191, 96, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 26, 89, 188, 273, 25, 248,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 26, 5, 191, 317, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 209, 214, 320, 329,
+    46, 89, 188, 273, 7, 153, 398, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 209, 214, 320,
+    329, 46, 5, 191, 244, 383, 424, 206, 225, 306, 308, 387,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 209, 214, 320, 329, 46, 89, 188, 273, 114, 282,
+    358, 69, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 209, 214, 320, 329, 46, 5, 191, 157,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 209, 214, 320, 329, 46, 89, 188, 273, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    209, 214, 320, 329, 46, 5, 191, 44, 138, 369, 94, 218,
+    299, 416, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 209, 214, 320, 329, 46, 89, 188, 273,
+    238, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 209, 214, 320, 329, 46, 5, 191, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    52, 89, 188, 273, 88, 23, 408, 300, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 52, 5,
+    191, 47, 217, 231, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 52, 89, 188, 273, 100, 135,
+    419, 285, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 52, 5, 191, 13, 55, 195, 212, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 52, 89, 188, 273, 104, 197, 406, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 52, 5,
+    191, 72, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 52, 89, 188, 273, 25, 248, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    52, 5, 191, 219, 229, 234, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 202, 230, 328, 404,
+    74, 89, 188, 273, 7, 153, 398, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 202, 230, 328,
+    404, 74, 5, 191, 244, 383, 424, 236, 245, 247, 307, 402,
+    410, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 202, 230, 328, 404, 74, 89, 188, 273, 114,
+    282, 358, 77, 271, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 202, 230, 328, 404, 74, 5,
+    191, 86, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 202, 230, 328, 404, 74, 89, 188, 273,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 202, 230, 328, 404, 74, 5, 191, 44, 138, 369,
+    19, 165, 220, 315, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 202, 230, 328, 404, 74, 89,
+    188, 273, 238, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 202, 230, 328, 404, 74, 5, 191,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 62, 89, 188, 273, 23, 408, 334, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 62,
+    5, 191, 47, 217, 231, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 62, 89, 188, 273, 100,
+    135, 419, 123, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 62, 5, 191, 13, 55, 195, 212,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 62, 89, 188, 273, 104, 197, 406, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 62,
+    5, 191, 242, 392, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 62, 89, 188, 273, 25, 248,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 62, 5, 191, 223, 233, 235, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 227, 258,
+    344, 405, 56, 89, 188, 273, 7, 153, 398, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 227,
+    258, 344, 405, 56, 5, 191, 244, 383, 424, 8, 60, 162,
+    313, 353, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 227, 258, 344, 405, 56, 89, 188, 273,
+    114, 282, 358, 118, 132, 155, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 227, 258, 344, 405,
+    56, 5, 191, 30, 35, 198, 256, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 227, 258, 344,
+    405, 56, 89, 188, 273, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 227, 258, 344, 405, 56,
+    5, 191, 44, 138, 369, 10, 139, 208, 389, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 227,
+    258, 344, 405, 56, 89, 188, 273, 238, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 227, 258,
+    344, 405, 56, 5, 191, 148, 337, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 48, 89, 188,
+    273, 23, 408, 160, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 48, 5, 191, 47, 217, 231,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 48, 89, 188, 273, 100, 135, 419, 331, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    48, 5, 191, 13, 55, 195, 212, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 48, 89, 188,
+    273, 104, 197, 406, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 48, 5, 191, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 48,
+    89, 188, 273, 25, 248, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 48, 5, 191, 199, 354,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 66, 89, 188, 273, 7, 153, 398, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 66,
+    5, 191, 244, 383, 424, 16, 92, 295, 388, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 66,
+    89, 188, 273, 114, 282, 358, 101, 292, 399, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 66,
+    5, 191, 176, 278, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 66, 89, 188, 273, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    66, 5, 191, 44, 138, 369, 125, 141, 180, 290, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    66, 89, 188, 273, 238, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 66, 5, 191, 152, 341,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 57, 89, 188, 273, 23, 408, 302, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 57,
+    5, 191, 47, 217, 231, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 57, 89, 188, 273, 100,
+    135, 419, 293, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 57, 5, 191, 13, 55, 195, 212,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 57, 89, 188, 273, 104, 197, 406, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 57,
+    5, 191, 144, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 57, 89, 188, 273, 25, 248, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 57, 5, 191, 97, 264, 356, 379, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 21, 89,
+    188, 273, 7, 153, 398, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 21, 5, 191, 244, 383,
+    424, 76, 121, 124, 246, 365, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 21, 89, 188, 273,
+    114, 282, 358, 85, 196, 351, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 21, 5, 191, 50,
+    311, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 21, 89, 188, 273, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 21, 5, 191,
+    44, 138, 369, 106, 108, 122, 257, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 21, 89, 188,
+    273, 238, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 21, 5, 191, 150, 339, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 63,
+    89, 188, 273, 23, 408, 314, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 63, 5, 191, 47,
+    217, 231, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 63, 89, 188, 273, 100, 135, 419, 131,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 63, 5, 191, 13, 55, 195, 212, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 63,
+    89, 188, 273, 104, 197, 406, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 63, 5, 191, 84,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 63, 89, 188, 273, 25, 248, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 63, 5,
+    191, 27, 38, 187, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 29, 89, 188, 273, 7, 153,
+    398, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 29, 5, 191, 244, 383, 424, 28, 103, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 29, 89, 188, 273, 114, 282, 358, 140, 304, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    29, 5, 191, 22, 110, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 29, 89, 188, 273, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 29, 5, 191, 44, 138, 369, 276, 347, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 29,
+    89, 188, 273, 238, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 29, 5, 191, 154, 343, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 65, 89, 188, 273, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 65, 5, 191, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    65, 89, 188, 273, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 65, 5, 191, 13, 55, 195,
+    212, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 65, 89, 188, 273, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 65, 5, 191,
+    15, 98, 254, 394, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 65, 89, 188, 273, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    65, 5, 191, 133, 352, 413, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 137, 89, 188, 273,
+    7, 153, 398, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 137, 5, 191, 244, 383, 424, 142,
+    151, 289, 359, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 137, 89, 188, 273, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 137,
+    5, 191, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 137, 89, 188, 273, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 137, 5,
+    191, 44, 138, 369, 342, 368, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 137, 89, 188, 273,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 137, 5, 191, 401, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 126, 169, 89, 188,
+    273, 23, 408, 136, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 126, 169, 5, 191, 47, 217,
+    231, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 126, 169, 89, 188, 273, 100, 135, 419, 325,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 126, 169, 5, 191, 13, 55, 195, 212, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    126, 169, 89, 188, 273, 104, 197, 406, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 126, 169,
+    5, 191, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 126, 169, 89, 188, 273, 25, 248, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 126, 169, 5, 191, 14, 349, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 130, 89, 188,
+    273, 7, 153, 398, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 130, 5, 191, 244, 383, 424,
+    159, 167, 297, 361, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 130, 89, 188, 273, 114, 282,
+    358, 53, 186, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 130, 5, 191, 200, 421, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    130, 89, 188, 273, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 130, 5, 191, 44, 138, 369,
+    350, 370, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 130, 89, 188, 273, 238, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 130,
+    5, 191, 401, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 129, 89, 188, 273, 23, 408, 164,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 129, 5, 191, 47, 217, 231, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 129, 89,
+    188, 273, 100, 135, 419, 332, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 129, 5, 191, 13,
+    55, 195, 212, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 129, 89, 188, 273, 104, 197, 406,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 129, 5, 191, 207, 372, 412, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 129, 89,
+    188, 273, 25, 248, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 129, 5, 191, 117, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    171, 89, 188, 273, 7, 153, 398, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 171, 5, 191,
+    244, 383, 424, 59, 111, 240, 310, 364, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 171, 89,
+    188, 273, 114, 282, 358, 20, 109, 384, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 171, 5,
+    191, 367, 371, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 171, 89, 188, 273, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 171,
+    5, 191, 44, 138, 369, 377, 378, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 171, 89, 188,
+    273, 238, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 171, 5, 191, 401, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 175, 418,
+    89, 188, 273, 23, 408, 312, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 175, 418, 5, 191,
+    47, 217, 231, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 175, 418, 89, 188, 273, 100, 135,
+    419, 326, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 175, 418, 5, 191, 13, 55, 195, 212,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 175, 418, 89, 188, 273, 104, 197, 406, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    175, 418, 5, 191, 115, 259, 287, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 175, 418, 89,
+    188, 273, 25, 248, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 175, 418, 5, 191, 43, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 172, 89, 188, 273, 7, 153, 398, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 172, 5,
+    191, 244, 383, 424, 232, 263, 301, 376, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 172, 89,
+    188, 273, 114, 282, 358, 90, 93, 241, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 172, 5,
+    191, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 172, 89, 188, 273, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 172, 5, 191,
+    44, 138, 369, 272, 330, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 172, 89, 188, 273, 238,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 172, 5, 191, 401, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 36, 73, 89, 188,
+    273, 23, 408, 318, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 36, 73, 5, 191, 47, 217,
+    231, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 36, 73, 89, 188, 273, 100, 135, 419, 147,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 36, 73, 5, 191, 13, 55, 195, 212, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    36, 73, 89, 188, 273, 104, 197, 406, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 36, 73,
+    5, 191, 193, 221, 262, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 36, 73, 89, 188, 273,
+    25, 248, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 36, 73, 5, 191, 143, 415, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    83, 395, 89, 188, 273, 7, 153, 398, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 83, 395,
+    5, 191, 244, 383, 424, 134, 185, 189, 265, 309, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    83, 395, 89, 188, 273, 114, 282, 358, 146, 156, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    83, 395, 5, 191, 105, 127, 174, 183, 252, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 83,
+    395, 89, 188, 273, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 83, 395, 5, 191, 44, 138,
+    369, 274, 338, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 83, 395, 89, 188, 273, 238, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 83, 395, 5, 191, 401, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 211, 228, 89, 188,
+    273, 23, 408, 281, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 211, 228, 5, 191, 47, 217,
+    231, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 211, 228, 89, 188, 273, 100, 135, 419, 324,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 211, 228, 5, 191, 13, 55, 195, 212, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    211, 228, 89, 188, 273, 104, 197, 406, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 211, 228,
+    5, 191, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 211, 228, 89, 188, 273, 25, 248, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 211, 228, 5, 191, 68, 224, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 213, 260, 89,
+    188, 273, 7, 153, 398, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 213, 260, 5, 191, 244,
+    383, 424, 0, 1, 80, 120, 333, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 213, 260, 89,
+    188, 273, 114, 282, 358, 45, 355, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 213, 260, 5,
+    191, 163, 291, 348, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 213, 260, 89, 188, 273, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 213, 260, 5, 191, 44, 138, 369, 2, 18, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    213, 260, 89, 188, 273, 238, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 213, 260, 5, 191,
+    401, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 112, 170, 192, 39, 67, 89, 188, 273, 23,
+    408, 316, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 39, 67, 5, 191, 47, 217, 231, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 79, 321, 357, 39, 67, 89, 188, 273, 100, 135, 419,
+    322, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 39, 67, 5, 191, 13, 55, 195, 212, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 39, 67, 89, 188, 273, 104, 197, 406, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 39,
+    67, 5, 191, 253, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 39, 67, 89, 188, 273, 25,
+    248, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 39, 67, 5, 191, 95, 305, 411, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    40, 177, 89, 188, 273, 7, 153, 398, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 40, 177,
+    5, 191, 244, 383, 424, 237, 345, 386, 391, 403, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    40, 177, 89, 188, 273, 114, 282, 358, 149, 222, 286, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 40, 177, 5, 191, 99, 327, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 40, 177, 89,
+    188, 273, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 40, 177, 5, 191, 44, 138, 369, 251,
+    420, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 40, 177, 89, 188, 273, 238, 3, 64, 81,
+    91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 40,
+    177, 5, 191, 401, 3, 64, 81, 91, 107, 128, 173, 184,
+    204, 288, 340, 385, 417, 422, 166, 268, 89, 188, 273, 23,
+    408, 280, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288,
+    340, 385, 417, 422, 166, 268, 5, 191, 47, 217, 231, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 166, 268, 89, 188, 273, 100, 135, 419, 319, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    166, 268, 5, 191, 13, 55, 195, 212, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 166, 268,
+    89, 188, 273, 104, 197, 406, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 166, 268, 5, 191,
+    360, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 166, 268, 89, 188, 273, 25, 248, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    166, 268, 5, 191, 41, 249, 363, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 179, 270, 89,
+    188, 273, 7, 153, 398, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 179, 270, 5, 191, 244,
+    383, 424, 4, 51, 203, 407, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 179, 270, 89, 188,
+    273, 114, 282, 358, 37, 87, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 179, 270, 5, 191,
+    113, 116, 145, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 179, 270, 89, 188, 273, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    179, 270, 5, 191, 44, 138, 369, 75, 181, 374, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    179, 270, 89, 188, 273, 238, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 179, 270, 5, 191,
+    401, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 182, 267, 89, 188, 273, 226, 266, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    182, 267, 5, 191, 161, 381, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 182, 267, 89, 188,
+    273, 78, 380, 3, 64, 81, 91, 107, 128, 173, 184, 204,
+    288, 340, 385, 417, 422, 182, 267, 5, 191, 13, 55, 195,
+    212, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 182, 267, 89, 188, 273, 54, 284, 423, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 182, 267, 5, 191, 275, 346, 3, 64, 81, 91, 107,
+    128, 173, 184, 204, 288, 340, 385, 417, 422, 182, 267, 89,
+    188, 273, 279, 382, 414, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 182, 267, 5, 191, 298,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 71, 190, 89, 188, 273, 7, 153, 398, 3, 64,
+    81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417, 422,
+    71, 190, 5, 191, 244, 383, 424, 17, 49, 82, 119, 205,
+    215, 3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340,
+    385, 417, 422, 71, 190, 89, 188, 273, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 71, 190,
+    5, 191, 102, 397, 400, 3, 64, 81, 91, 107, 128, 173,
+    184, 204, 288, 340, 385, 417, 422, 71, 190, 89, 188, 273,
+    3, 64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385,
+    417, 422, 71, 190, 5, 191, 44, 138, 369, 168, 362, 3,
+    64, 81, 91, 107, 128, 173, 184, 204, 288, 340, 385, 417,
+    422, 71, 190, 89, 188, 273, 3, 64, 81, 91, 107, 128,
+    173, 184, 204, 288, 340, 385, 417, 422, 71, 190, 5, 191
+};
+
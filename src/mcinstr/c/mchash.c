@@ -0,0 +1,69 @@
+/* Generated by mcinstrgen hash, do not edit. */
+
+#include "mcinstr.h"
+#include "mchash.h"
+
+const short inst_phash_displacement[INST_PHASH_BUCKETS] = {
+    1, 0, -2, 3, 2, -10, 0, -14, 0, 5, 1, 0,
+    0, -21, 7, 2, -49, -54, 0, -65, -73, 5, -77, 1,
+    2, 0, -79, -80, -85, -91, 4, -95, -102, 7, 0, 1,
+    15, 1, 2, 4, -109, -112, 0, -115, -117, -119, 5, 0,
+    7, 3, 2, 4, 2, 0, -123, 2, 1, -125, 4, 0,
+    -126, -131, 0, 1, -133, -136, -140, 1, 6, 6, -150, 2,
+    1, 1, 0, 3, -157, 4, 0, 4, 5, 2, 1, -159,
+    -162, -163, 1, 0, 12, -170, 3, 0, 11, 0, 2, -174,
+    -175, 2, 6, -183, 0, 21, 0, 28, 5, 1, -185, 3,
+    2, 1, -188, 3, 6, 8, 1, -194, 1, 1, 5, 1,
+    -198, 0, 1, 1, 14, -199, -208, 4, 0, 7, -210, 0,
+    1, -217, 18, 8, 1, 0, 13, -222, -225, 0, -226, 2,
+    -228, 3, 5, -230, 1, 0, 9, -239, 1, -242, -243, 0,
+    1, -249, -252, -253, 18, 22, -256, 21, 0, 0, 36, 0,
+    -257, 1, 5, -258, -259, 0, -260, 19, -267, -271, 2, 1,
+    13, -275, 7, -276, 0, -281, -284, 8, -285, -291, -295, -302,
+    1, 4, -304, -314, 0, 1, -317, 3, -318, 3, 0, 1,
+    18, -319, -324, 0, 0, 4, -329, 1, 5, 7, -334, -340,
+    16, 0, 1, 17, -342, 16, -352, 3, -358, -366, -370, -373,
+    1, -377, 4, 3, 1, 1, 0, -379, -392, 6, 24, 0,
+    -397, 5, -398, 9, 7, 4, -412, 4, -414, 0, -415, 0,
+    -422, 4, 0, 5
+};
+
+const short inst_phash_index[IHT_SIZE] = {
+    186, 333, 61, 335, 397, 141, 204, 325, 14, 138, 136, 339,
+    303, 172, 35, 40, 237, 162, 126, 252, 208, 248, 398, 198,
+    269, 206, 62, 49, 39, 45, 100, 165, 340, 115, 301, 201,
+    139, 209, 30, 183, 393, 118, 8, 416, 188, 365, 59, 264,
+    179, 423, 235, 412, 171, 174, 133, 200, 294, 123, 296, 357,
+    288, 358, 313, 286, 251, 168, 273, 343, 383, 3, 256, 312,
+    89, 32, 75, 148, 187, 132, 308, 330, 314, 352, 240, 305,
+    332, 329, 226, 111, 392, 178, 372, 58, 292, 29, 222, 112,
+    285, 218, 194, 379, 387, 15, 85, 110, 262, 260, 378, 374,
+    346, 156, 113, 160, 361, 309, 192, 277, 108, 26, 366, 93,
+    390, 153, 306, 197, 149, 155, 403, 16, 98, 227, 315, 409,
+    232, 137, 41, 424, 241, 324, 258, 203, 267, 254, 151, 131,
+    230, 400, 348, 371, 52, 64, 76, 140, 82, 347, 135, 266,
+    364, 377, 302, 103, 391, 351, 362, 289, 404, 191, 341, 7,
+    90, 4, 236, 263, 207, 320, 48, 19, 114, 142, 95, 246,
+    298, 261, 249, 31, 253, 71, 28, 72, 406, 67, 34, 295,
+    125, 331, 327, 74, 18, 419, 119, 279, 290, 147, 152, 10,
+    242, 46, 380, 170, 195, 245, 51, 210, 167, 375, 381, 66,
+    180, 410, 287, 328, 94, 283, 99, 224, 117, 291, 382, 0,
+    223, 190, 44, 417, 386, 360, 363, 304, 385, 238, 6, 25,
+    63, 43, 78, 388, 55, 355, 384, 199, 239, 368, 33, 193,
+    373, 124, 47, 101, 221, 275, 370, 356, 79, 229, 21, 144,
+    182, 317, 84, 185, 415, 176, 259, 161, 104, 280, 405, 54,
+    276, 394, 257, 316, 20, 70, 418, 214, 281, 145, 77, 408,
+    36, 271, 265, 307, 244, 310, 69, 293, 129, 102, 255, 414,
+    121, 231, 359, 395, 53, 86, 211, 376, 225, 88, 299, 157,
+    13, 272, 106, 233, 50, 27, 166, 158, 184, 334, 196, 116,
+    205, 17, 422, 92, 134, 322, 420, 73, 396, 38, 164, 12,
+    87, 413, 175, 297, 342, 350, 402, 24, 389, 56, 65, 57,
+    369, 23, 319, 146, 9, 130, 311, 97, 202, 128, 37, 353,
+    401, 96, 349, 284, 217, 109, 318, 159, 326, 181, 91, 282,
+    213, 212, 120, 421, 215, 60, 163, 247, 177, 1, 274, 169,
+    220, 344, 411, 337, 278, 11, 300, 234, 219, 150, 68, 250,
+    42, 243, 399, 268, 122, 80, 107, 173, 83, 338, 323, 81,
+    2, 407, 321, 367, 154, 345, 5, 228, 216, 270, 189, 143,
+    127, 354, 22, 105, -1
+};
+
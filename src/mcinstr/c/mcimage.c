@@ -0,0 +1,373 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define X86_KERNELS
+#include <immintrin.h>
+#define TARGET_SSE2     __attribute__((target("sse2")))
+#define TARGET_AVX2     __attribute__((target("avx2")))
+#endif
+
+#include "mcimage.h"
+
+struct kernels_t {
+    void (*unpack_rom)(const unsigned char *bytes, size_t groups, unsigned short *words);
+    void (*pack_rom)(const unsigned short *words, size_t groups, unsigned char *bytes);
+    void (*unpack_bin)(const unsigned char *bytes, size_t count, unsigned short *words);
+    void (*pack_bin)(const unsigned short *words, size_t count, unsigned char *bytes);
+};
+
+typedef struct kernels_t kernels;
+
+/*---------------------------------- scalar ---------------------------------*/
+
+static void unpack_rom_scalar(const unsigned char *bytes, size_t groups, unsigned short *words)
+{
+    for (size_t g = 0; g < groups; g++, bytes += 5, words += 4) {
+        words[0] = (bytes[0] << 2) | (bytes[1] >> 6);
+        words[1] = ((bytes[1] & 0x3F) << 4) | (bytes[2] >> 4);
+        words[2] = ((bytes[2] & 0x0F) << 6) | (bytes[3] >> 2);
+        words[3] = ((bytes[3] & 0x03) << 8) | bytes[4];
+    }
+}
+
+static void pack_rom_scalar(const unsigned short *words, size_t groups, unsigned char *bytes)
+{
+    for (size_t g = 0; g < groups; g++, bytes += 5, words += 4) {
+        unsigned int w0 = words[0] & 0x3FF;
+        unsigned int w1 = words[1] & 0x3FF;
+        unsigned int w2 = words[2] & 0x3FF;
+        unsigned int w3 = words[3] & 0x3FF;
+        bytes[0] = (unsigned char) (w0 >> 2);
+        bytes[1] = (unsigned char) ((w0 & 0x03) << 6 | w1 >> 4);
+        bytes[2] = (unsigned char) ((w1 & 0x0F) << 4 | w2 >> 6);
+        bytes[3] = (unsigned char) ((w2 & 0x3F) << 2 | w3 >> 8);
+        bytes[4] = (unsigned char) (w3 & 0xFF);
+    }
+}
+
+static void unpack_bin_scalar(const unsigned char *bytes, size_t count, unsigned short *words)
+{
+    for (size_t i = 0; i < count; i++, bytes += 2) {
+        words[i] = ((bytes[0] << 8) | bytes[1]) & 0x3FF;
+    }
+}
+
+static void pack_bin_scalar(const unsigned short *words, size_t count, unsigned char *bytes)
+{
+    for (size_t i = 0; i < count; i++, bytes += 2) {
+        bytes[0] = (unsigned char) ((words[i] >> 8) & 0x03);
+        bytes[1] = (unsigned char) (words[i] & 0xFF);
+    }
+}
+
+/*----------------------------------- x86 -----------------------------------*/
+
+#if defined(X86_KERNELS)
+
+TARGET_SSE2 static void unpack_bin_sse2(const unsigned char *bytes, size_t count, unsigned short *words)
+{
+    const __m128i mask = _mm_set1_epi16(0x3FF);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i *) (bytes + 2*i));
+        x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+        _mm_storeu_si128((__m128i *) (words + i), _mm_and_si128(x, mask));
+    }
+    unpack_bin_scalar(bytes + 2*i, count - i, words + i);
+}
+
+TARGET_SSE2 static void pack_bin_sse2(const unsigned short *words, size_t count, unsigned char *bytes)
+{
+    const __m128i mask = _mm_set1_epi16(0x3FF);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i x = _mm_and_si128(_mm_loadu_si128((const __m128i *) (words + i)), mask);
+        x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+        _mm_storeu_si128((__m128i *) (bytes + 2*i), x);
+    }
+    pack_bin_scalar(words + i, count - i, bytes + 2*i);
+}
+
+TARGET_AVX2 static void unpack_bin_avx2(const unsigned char *bytes, size_t count, unsigned short *words)
+{
+    const __m256i mask = _mm256_set1_epi16(0x3FF);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *) (bytes + 2*i));
+        x = _mm256_or_si256(_mm256_slli_epi16(x, 8), _mm256_srli_epi16(x, 8));
+        _mm256_storeu_si256((__m256i *) (words + i), _mm256_and_si256(x, mask));
+    }
+    unpack_bin_scalar(bytes + 2*i, count - i, words + i);
+}
+
+TARGET_AVX2 static void pack_bin_avx2(const unsigned short *words, size_t count, unsigned char *bytes)
+{
+    const __m256i mask = _mm256_set1_epi16(0x3FF);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i x = _mm256_and_si256(_mm256_loadu_si256((const __m256i *) (words + i)), mask);
+        x = _mm256_or_si256(_mm256_slli_epi16(x, 8), _mm256_srli_epi16(x, 8));
+        _mm256_storeu_si256((__m256i *) (bytes + 2*i), x);
+    }
+    pack_bin_scalar(words + i, count - i, bytes + 2*i);
+}
+
+// 4 groups per step, 2 per 128-bit lane. Every word is taken from the 2
+// bytes it spans as a big-endian 16-bit number, and shifted into place
+// by a multiply and one shift for all 16 words: word k of a group sits
+// 6 - 2k bits above bit 0.
+TARGET_AVX2 static void unpack_rom_avx2(const unsigned char *bytes, size_t groups, unsigned short *words)
+{
+    const __m256i shuffle = _mm256_setr_epi8(
+        1, 0, 2, 1, 3, 2, 4, 3, 6, 5, 7, 6, 8, 7, 9, 8,
+        1, 0, 2, 1, 3, 2, 4, 3, 6, 5, 7, 6, 8, 7, 9, 8);
+    const __m256i scale = _mm256_setr_epi16(1, 4, 16, 64, 1, 4, 16, 64, 1, 4, 16, 64, 1, 4, 16, 64);
+    size_t g = 0;
+    // the loads read 26 bytes of the 20 of a step
+    for (; g + 6 <= groups; g += 4) {
+        const unsigned char *p = bytes + 5*g;
+        __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) p)),
+            _mm_loadu_si128((const __m128i *) (p + 10)), 1);
+        x = _mm256_shuffle_epi8(x, shuffle);
+        x = _mm256_srli_epi16(_mm256_mullo_epi16(x, scale), 6);
+        _mm256_storeu_si256((__m256i *) (words + 4*g), x);
+    }
+    unpack_rom_scalar(bytes + 5*g, groups - g, words + 4*g);
+}
+
+// The inverse: pairs of words into 20 bits, pairs of those into the 40
+// bits of a group in a 64-bit element, whose 5 low bytes are written in
+// big-endian order.
+TARGET_AVX2 static void pack_rom_avx2(const unsigned short *words, size_t groups, unsigned char *bytes)
+{
+    const __m256i mask = _mm256_set1_epi16(0x3FF);
+    const __m256i pair = _mm256_setr_epi16(1024, 1, 1024, 1, 1024, 1, 1024, 1, 1024, 1, 1024, 1, 1024, 1, 1024, 1);
+    const __m256i low = _mm256_set1_epi64x(0xFFFFFFFF);
+    const __m256i shuffle = _mm256_setr_epi8(
+        4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1,
+        4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1);
+    size_t g = 0;
+    // the stores write 26 bytes of the 20 of a step
+    for (; g + 6 <= groups; g += 4) {
+        __m256i x = _mm256_and_si256(_mm256_loadu_si256((const __m256i *) (words + 4*g)), mask);
+        x = _mm256_madd_epi16(x, pair);
+        x = _mm256_or_si256(_mm256_slli_epi64(_mm256_and_si256(x, low), 20), _mm256_srli_epi64(x, 32));
+        x = _mm256_shuffle_epi8(x, shuffle);
+        _mm_storeu_si128((__m128i *) (bytes + 5*g), _mm256_castsi256_si128(x));
+        _mm_storeu_si128((__m128i *) (bytes + 5*g + 10), _mm256_extracti128_si256(x, 1));
+    }
+    pack_rom_scalar(words + 4*g, groups - g, bytes + 5*g);
+}
+
+#endif // defined(X86_KERNELS)
+
+/*--------------------------------- dispatch --------------------------------*/
+
+static const kernels kernel_table[] = {
+    { unpack_rom_scalar, pack_rom_scalar, unpack_bin_scalar, pack_bin_scalar },
+#if defined(X86_KERNELS)
+    { unpack_rom_scalar, pack_rom_scalar, unpack_bin_sse2, pack_bin_sse2 },
+    { unpack_rom_avx2, pack_rom_avx2, unpack_bin_avx2, pack_bin_avx2 },
+#endif
+};
+
+static int selected = -1;
+
+static int supported(int kernel)
+{
+#if defined(X86_KERNELS)
+    switch (kernel) {
+        case IMAGE_SCALAR:
+            return 1;
+        case IMAGE_SSE2:
+            return __builtin_cpu_supports("sse2");
+        case IMAGE_AVX2:
+            return __builtin_cpu_supports("avx2");
+        default:
+            return 0;
+    }
+#else
+    return kernel == IMAGE_SCALAR;
+#endif
+}
+
+static const kernels *current(void)
+{
+    if (selected < 0) {
+        int kernel = IMAGE_AVX2;
+        while (!supported(kernel)) {
+            kernel--;
+        }
+        selected = kernel;
+    }
+    return &kernel_table[selected];
+}
+
+int image_kernel(void)
+{
+    current();
+    return selected;
+}
+
+int image_set_kernel(int kernel)
+{
+    if (!supported(kernel)) {
+        return -1;
+    }
+    selected = kernel;
+    return 0;
+}
+
+/*---------------------------------- words ----------------------------------*/
+
+static int has_suffix(const char *path, const char *suffix)
+{
+    size_t len = strlen(path);
+    size_t n = strlen(suffix);
+    if (len < n) {
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        char ch = path[len - n + i];
+        if ((ch >= 'A' && ch <= 'Z' ? ch - 'A' + 'a' : ch) != suffix[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int image_format(const char *path)
+{
+    return has_suffix(path, ".bin") ? IMAGE_BIN : IMAGE_ROM;
+}
+
+size_t image_words(size_t size, int format)
+{
+    return format == IMAGE_BIN ? size / 2 : size / 5 * 4;
+}
+
+size_t image_bytes(size_t count, int format)
+{
+    return format == IMAGE_BIN ? 2 * count : (count + 3) / 4 * 5;
+}
+
+void image_unpack(const unsigned char *bytes, int format, size_t count, unsigned short *words)
+{
+    const kernels *k = current();
+    if (format == IMAGE_BIN) {
+        k->unpack_bin(bytes, count, words);
+        return;
+    }
+    size_t groups = count / 4;
+    k->unpack_rom(bytes, groups, words);
+    if (count % 4) {
+        // the bytes of the last words only
+        unsigned char last[5] = { 0 };
+        unsigned short rest[4];
+        memcpy(last, bytes + 5*groups, (10 * (count % 4) + 7) / 8);
+        unpack_rom_scalar(last, 1, rest);
+        memcpy(words + 4*groups, rest, (count % 4) * sizeof(unsigned short));
+    }
+}
+
+void image_pack(const unsigned short *words, size_t count, int format, unsigned char *bytes)
+{
+    const kernels *k = current();
+    if (format == IMAGE_BIN) {
+        k->pack_bin(words, count, bytes);
+        return;
+    }
+    size_t groups = count / 4;
+    k->pack_rom(words, groups, bytes);
+    if (count % 4) {
+        unsigned short last[4] = { 0 };
+        memcpy(last, words + 4*groups, (count % 4) * sizeof(unsigned short));
+        pack_rom_scalar(last, 1, bytes + 5*groups);
+    }
+}
+
+/*---------------------------------- files ----------------------------------*/
+
+int image_open(image_view *view, const char *path, int format)
+{
+    view->data = NULL;
+    view->size = 0;
+    view->mapped = 0;
+    view->format = format >= 0 ? format : image_format(path);
+#if !defined(_WIN32)
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            view->data = data;
+            view->size = st.st_size;
+            view->mapped = 1;
+        }
+    }
+    close(fd);
+#else
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return -1;
+    }
+    if (fseek(file, 0, SEEK_END) == 0) {
+        long size = ftell(file);
+        unsigned char *data = size > 0 ? malloc(size) : NULL;
+        rewind(file);
+        if (data && fread(data, 1, size, file) == (size_t) size) {
+            view->data = data;
+            view->size = size;
+        } else {
+            free(data);
+        }
+    }
+    fclose(file);
+#endif
+    if (!view->data) {
+        errno = EINVAL;
+        return -1;
+    }
+    view->words = image_words(view->size, view->format);
+    return 0;
+}
+
+void image_close(image_view *view)
+{
+#if !defined(_WIN32)
+    if (view->mapped) {
+        munmap((void *) view->data, view->size);
+    } else
+#endif
+    {
+        free((void *) view->data);
+    }
+    view->data = NULL;
+    view->size = 0;
+    view->words = 0;
+}
+
+size_t image_read(const image_view *view, size_t first, size_t count, unsigned short *words)
+{
+    if (first >= view->words) {
+        return 0;
+    }
+    if (count > view->words - first) {
+        count = view->words - first;
+    }
+    image_unpack(view->data + image_bytes(first, view->format), view->format, count, words);
+    return count;
+}
@@ -0,0 +1,541 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "mccheck.h"
+#include "mclabel.h"
+
+#define INITIAL_SLOTS   1024
+#define NAME_BLOCK_SIZE 0x10000
+#define MAX_PATH_SIZE   4096
+
+#define SAVE_MAGIC      "MCLI"
+#define SAVE_VERSION    1
+
+struct label_block_t {
+    struct label_block_t *next;
+    size_t used;
+    char data[NAME_BLOCK_SIZE];
+};
+
+typedef struct label_block_t label_block;
+
+static unsigned int hash_name(const char *name, size_t len, int scope)
+{
+    unsigned int h = 2166136261u ^ (unsigned int) scope;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ (unsigned char) name[i]) * 16777619u;
+    }
+    return h;
+}
+
+static const char *copy_name(label_index *index, const char *name, size_t len)
+{
+    if (len + 1 > NAME_BLOCK_SIZE) {
+        return NULL;
+    }
+    if (!index->blocks || index->blocks->used + len + 1 > NAME_BLOCK_SIZE) {
+        label_block *block = malloc(sizeof(label_block));
+        if (!block) {
+            return NULL;
+        }
+        block->next = index->blocks;
+        block->used = 0;
+        index->blocks = block;
+    }
+    char *copy = index->blocks->data + index->blocks->used;
+    memcpy(copy, name, len);
+    copy[len] = '\0';
+    index->blocks->used += len + 1;
+    return copy;
+}
+
+// Slot of the name, or the free slot where it belongs.
+static int *probe(const label_index *index, const char *name, size_t len, int scope, unsigned int hash)
+{
+    unsigned int mask = index->slot_count - 1;
+    for (unsigned int i = hash & mask;; i = (i + 1) & mask) {
+        int *slot = &index->slots[i];
+        const label_name *n = *slot ? &index->names[*slot - 1] : NULL;
+        if (!n || (n->hash == hash && n->scope == scope && strncmp(n->name, name, len) == 0 &&
+            !n->name[len])) {
+            return slot;
+        }
+    }
+}
+
+static int grow_slots(label_index *index)
+{
+    int count = index->slot_count ? 2 * index->slot_count : INITIAL_SLOTS;
+    int *slots = calloc(count, sizeof(int));
+    if (!slots) {
+        return -1;
+    }
+    free(index->slots);
+    index->slots = slots;
+    index->slot_count = count;
+    for (int i = 0; i < index->name_count; i++) {
+        const label_name *n = &index->names[i];
+        *probe(index, n->name, strlen(n->name), n->scope, n->hash) = i + 1;
+    }
+    return 0;
+}
+
+// Name and scope of a label with its brackets. Returns 0 or -1 if it is
+// no label.
+static int split_label(int file, const char **label, size_t *len, int *scope)
+{
+    if (*len < 3 || !(((*label)[0] == '(' && (*label)[*len - 1] == ')') ||
+        ((*label)[0] == '[' && (*label)[*len - 1] == ']'))) {
+        return -1;
+    }
+    *scope = (*label)[0] == '(' ? file : LABEL_GLOBAL;
+    (*label)++;
+    *len -= 2;
+    return 0;
+}
+
+void label_index_init(label_index *index)
+{
+    memset(index, 0, sizeof(*index));
+}
+
+void label_index_free(label_index *index)
+{
+    while (index->blocks) {
+        label_block *next = index->blocks->next;
+        free(index->blocks);
+        index->blocks = next;
+    }
+    for (int i = 0; i < index->file_count; i++) {
+        free(index->files[i].path);
+        free(index->files[i].sites);
+    }
+    free(index->files);
+    free(index->names);
+    free(index->slots);
+    label_index_init(index);
+}
+
+int label_index_find_file(const label_index *index, const char *path)
+{
+    for (int i = 0; i < index->file_count; i++) {
+        if (strcmp(index->files[i].path, path) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int label_index_file(label_index *index, const char *path)
+{
+    int file = label_index_find_file(index, path);
+    if (file >= 0) {
+        return file;
+    }
+    if (index->file_count == index->file_size) {
+        int size = index->file_size ? 2 * index->file_size : 64;
+        label_file *files = realloc(index->files, size * sizeof(label_file));
+        if (!files) {
+            return -1;
+        }
+        index->files = files;
+        index->file_size = size;
+    }
+    label_file *f = &index->files[index->file_count];
+    f->path = malloc(strlen(path) + 1);
+    if (!f->path) {
+        return -1;
+    }
+    strcpy(f->path, path);
+    f->sites = NULL;
+    f->count = 0;
+    f->size = 0;
+    f->stamp.size = 0;
+    f->stamp.time = -1;
+    f->state = 0;
+    return index->file_count++;
+}
+
+int label_index_lookup(const label_index *index, int file, const char *label, size_t len)
+{
+    int scope;
+    if (split_label(file, &label, &len, &scope) || !index->slot_count) {
+        return -1;
+    }
+    return *probe(index, label, len, scope, hash_name(label, len, scope)) - 1;
+}
+
+int label_index_intern(label_index *index, int file, const char *label, size_t len)
+{
+    int scope;
+    if (split_label(file, &label, &len, &scope)) {
+        return -1;
+    }
+    if (4 * (index->name_count + 1) > 3 * index->slot_count && grow_slots(index)) {
+        return -1;
+    }
+    unsigned int hash = hash_name(label, len, scope);
+    int *slot = probe(index, label, len, scope, hash);
+    if (*slot) {
+        return *slot - 1;
+    }
+    if (index->name_count == index->name_size) {
+        int size = index->name_size ? 2 * index->name_size : INITIAL_SLOTS;
+        label_name *names = realloc(index->names, size * sizeof(label_name));
+        if (!names) {
+            return -1;
+        }
+        index->names = names;
+        index->name_size = size;
+    }
+    label_name *n = &index->names[index->name_count];
+    n->name = copy_name(index, label, len);
+    if (!n->name) {
+        return -1;
+    }
+    n->hash = hash;
+    n->scope = scope;
+    n->definitions = 0;
+    n->references = 0;
+    n->before = -1;
+    *slot = ++index->name_count;
+    return *slot - 1;
+}
+
+static int same_site(const label_site *a, const label_site *b)
+{
+    return a->name == b->name && a->kind == b->kind;
+}
+
+// Adds delta to the count of a site and remembers the definitions the
+// name had before.
+static void count_site(label_index *index, const label_site *site, int delta, int *touched, int *touched_count)
+{
+    label_name *n = &index->names[site->name];
+    if (site->kind == LABEL_REFERENCE) {
+        n->references += delta;
+        return;
+    }
+    if (n->before < 0) {
+        n->before = n->definitions;
+        touched[(*touched_count)++] = site->name;
+    }
+    n->definitions += delta;
+}
+
+static int definition_state(int definitions)
+{
+    return definitions < 2 ? definitions : 2;
+}
+
+int label_index_set_sites(label_index *index, int file, const label_site *sites, int count)
+{
+    label_file *f = &index->files[file];
+    if (count > f->size) {
+        int size = f->size ? f->size : 16;
+        while (size < count) {
+            size *= 2;
+        }
+        label_site *copy = realloc(f->sites, size * sizeof(label_site));
+        if (!copy) {
+            return -1;
+        }
+        f->sites = copy;
+        f->size = size;
+    }
+
+    // counts only the sites between the unchanged ones at both ends
+    int first = 0;
+    int old_end = f->count;
+    int new_end = count;
+    while (first < old_end && first < new_end && same_site(&f->sites[first], &sites[first])) {
+        first++;
+    }
+    while (old_end > first && new_end > first && same_site(&f->sites[old_end - 1], &sites[new_end - 1])) {
+        old_end--;
+        new_end--;
+    }
+    int changed = old_end - first + new_end - first;
+    int stack[64];
+    int *touched = changed <= 64 ? stack : malloc(changed * sizeof(int));
+    int touched_count = 0;
+    if (!touched) {
+        return -1;
+    }
+    for (int i = first; i < old_end; i++) {
+        count_site(index, &f->sites[i], -1, touched, &touched_count);
+    }
+    for (int i = first; i < new_end; i++) {
+        count_site(index, &sites[i], 1, touched, &touched_count);
+    }
+    for (int i = 0; i < touched_count; i++) {
+        label_name *n = &index->names[touched[i]];
+        if (definition_state(n->before) != definition_state(n->definitions)) {
+            index->resolution++;
+        }
+        n->before = -1;
+    }
+    if (touched != stack) {
+        free(touched);
+    }
+
+    if (count) {
+        memmove(f->sites, sites, count * sizeof(label_site));
+    }
+    f->count = count;
+    return 0;
+}
+
+static int add_site(label_index *index, int file, label_site **sites, int *count, int *size,
+    const char *line, int line_number, int start, int length, int kind)
+{
+    if (*count == *size) {
+        int new_size = *size ? 2 * *size : 256;
+        label_site *copy = realloc(*sites, new_size * sizeof(label_site));
+        if (!copy) {
+            return -1;
+        }
+        *sites = copy;
+        *size = new_size;
+    }
+    label_site *s = &(*sites)[*count];
+    s->name = label_index_intern(index, file, line + start, length);
+    if (s->name < 0) {
+        return -1;
+    }
+    s->kind = kind;
+    s->line = line_number;
+    s->start = start;
+    s->length = length;
+    (*count)++;
+    return 0;
+}
+
+int label_index_scan(label_index *index, int file, const char *text, size_t len)
+{
+    label_site *sites = NULL;
+    int count = 0;
+    int size = 0;
+    int line_number = 0;
+    int rc = 0;
+    const char *end = text + len;
+    while (rc == 0 && text < end) {
+        const char *nl = memchr(text, '\n', end - text);
+        size_t n = (nl ? nl : end) - text;
+        // only lines with a bracket have labels
+        if (memchr(text, '(', n) || memchr(text, '[', n)) {
+            inst_check result;
+            inst_check_line(text, n, &result);
+            if (result.label_start >= 0) {
+                rc = add_site(index, file, &sites, &count, &size, text, line_number, result.label_start,
+                    result.label_length, LABEL_DEFINITION);
+            }
+            if (rc == 0 && result.target_start >= 0) {
+                rc = add_site(index, file, &sites, &count, &size, text, line_number, result.target_start,
+                    result.target_length, LABEL_REFERENCE);
+            }
+        }
+        text += n + 1;
+        line_number++;
+    }
+    if (rc == 0) {
+        rc = label_index_set_sites(index, file, sites, count);
+    }
+    free(sites);
+    return rc;
+}
+
+void label_index_sites(const label_index *index, int name, int kind, label_visit visit, void *user)
+{
+    for (int file = 0; file < index->file_count; file++) {
+        const label_file *f = &index->files[file];
+        for (int i = 0; i < f->count; i++) {
+            if (f->sites[i].name == name && (kind < 0 || f->sites[i].kind == kind)) {
+                visit(user, file, &f->sites[i]);
+            }
+        }
+    }
+}
+
+void label_index_problems(const label_index *index, label_visit visit, void *user)
+{
+    for (int file = 0; file < index->file_count; file++) {
+        const label_file *f = &index->files[file];
+        for (int i = 0; i < f->count; i++) {
+            const label_name *n = &index->names[f->sites[i].name];
+            if (f->sites[i].kind == LABEL_REFERENCE ? n->definitions == 0 : n->definitions > 1) {
+                visit(user, file, &f->sites[i]);
+            }
+        }
+    }
+}
+
+/*------------------------------ saved index -------------------------------*/
+
+int label_index_stamp(const char *path, label_stamp *stamp)
+{
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return -1;
+    }
+    stamp->size = (long long) st.st_size;
+    stamp->time = (long long) st.st_mtime;
+    if (stamp->time < 0 || stamp->time >= (long long) time(NULL)) {
+        stamp->time = -1;
+    }
+    return 0;
+}
+
+int label_index_current(const label_index *index, int file, const label_stamp *stamp)
+{
+    const label_stamp *s = &index->files[file].stamp;
+    return s->time >= 0 && s->time == stamp->time && s->size == stamp->size;
+}
+
+// The saved index is "MCLI", the version and the number of files, then
+// per file the path, the stamp, the state and the sites, every site
+// with its label as written. Numbers are in the byte order of the host,
+// strings have their length in front.
+
+static int put_int(FILE *f, int value)
+{
+    return fwrite(&value, sizeof(value), 1, f) == 1 ? 0 : -1;
+}
+
+static int put_string(FILE *f, const char *s, size_t len)
+{
+    return put_int(f, (int) len) || fwrite(s, 1, len, f) != len ? -1 : 0;
+}
+
+static int put_file(FILE *f, const label_index *index, const label_file *file)
+{
+    if (put_string(f, file->path, strlen(file->path)) ||
+        fwrite(&file->stamp, sizeof(file->stamp), 1, f) != 1 ||
+        put_int(f, file->state) || put_int(f, file->count)) {
+        return -1;
+    }
+    for (int i = 0; i < file->count; i++) {
+        const label_site *s = &file->sites[i];
+        const label_name *n = &index->names[s->name];
+        int global = n->scope == LABEL_GLOBAL;
+        size_t len = strlen(n->name);
+        if (put_int(f, s->kind) || put_int(f, s->line) || put_int(f, s->start) ||
+            put_int(f, s->length) || put_int(f, (int) len + 2) ||
+            fputc(global ? '[' : '(', f) == EOF || fwrite(n->name, 1, len, f) != len ||
+            fputc(global ? ']' : ')', f) == EOF) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int label_index_save(const label_index *index, const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        return -1;
+    }
+    int count = 0;
+    for (int i = 0; i < index->file_count; i++) {
+        count += index->files[i].stamp.time >= 0;
+    }
+    int rc = fwrite(SAVE_MAGIC, 1, 4, f) != 4 || put_int(f, SAVE_VERSION) || put_int(f, count) ? -1 : 0;
+    for (int i = 0; rc == 0 && i < index->file_count; i++) {
+        if (index->files[i].stamp.time >= 0) {
+            rc = put_file(f, index, &index->files[i]);
+        }
+    }
+    if (fclose(f) != 0) {
+        rc = -1;
+    }
+    if (rc) {
+        int error = errno;
+        remove(path);
+        errno = error;
+    }
+    return rc;
+}
+
+// Reads an int, which must be from 0 to max.
+static int get_int(FILE *f, int max, int *value)
+{
+    return fread(value, sizeof(*value), 1, f) == 1 && *value >= 0 && *value <= max ? 0 : -1;
+}
+
+static int get_file(FILE *f, label_index *index, char *buf, label_site **sites, int *size)
+{
+    int len;
+    int count;
+    label_stamp stamp;
+    int state;
+    if (get_int(f, MAX_PATH_SIZE - 1, &len) || fread(buf, 1, len, f) != (size_t) len) {
+        return -1;
+    }
+    buf[len] = '\0';
+    if (fread(&stamp, sizeof(stamp), 1, f) != 1 || fread(&state, sizeof(state), 1, f) != 1 ||
+        get_int(f, 0x7fffffff, &count)) {
+        return -1;
+    }
+    int file = label_index_file(index, buf);
+    if (file < 0 || index->files[file].count) {
+        return -1;
+    }
+    if (count > *size) {
+        label_site *copy = realloc(*sites, count * sizeof(label_site));
+        if (!copy) {
+            return -1;
+        }
+        *sites = copy;
+        *size = count;
+    }
+    for (int i = 0; i < count; i++) {
+        label_site *s = &(*sites)[i];
+        if (get_int(f, LABEL_REFERENCE, &s->kind) || get_int(f, 0x7fffffff, &s->line) ||
+            get_int(f, 0x7fffffff, &s->start) || get_int(f, 0x7fffffff, &s->length) ||
+            get_int(f, MAX_PATH_SIZE - 1, &len) || fread(buf, 1, len, f) != (size_t) len ||
+            (s->name = label_index_intern(index, file, buf, len)) < 0) {
+            return -1;
+        }
+    }
+    if (label_index_set_sites(index, file, *sites, count)) {
+        return -1;
+    }
+    index->files[file].stamp = stamp;
+    index->files[file].state = state;
+    return 0;
+}
+
+int label_index_load(label_index *index, const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return -1;
+    }
+    char buf[MAX_PATH_SIZE];
+    char magic[4];
+    int version;
+    int count;
+    label_site *sites = NULL;
+    int size = 0;
+    int rc = fread(magic, 1, 4, f) != 4 || memcmp(magic, SAVE_MAGIC, 4) != 0 ||
+        fread(&version, sizeof(version), 1, f) != 1 || version != SAVE_VERSION ||
+        get_int(f, 0x7fffffff, &count) ? -1 : 0;
+    for (int i = 0; rc == 0 && i < count; i++) {
+        rc = get_file(f, index, buf, &sites, &size);
+    }
+    // the whole file, nothing after it
+    if (rc == 0 && fgetc(f) != EOF) {
+        rc = -1;
+    }
+    fclose(f);
+    free(sites);
+    if (rc) {
+        label_index_free(index);
+        errno = EINVAL;
+    }
+    return rc;
+}
@@ -0,0 +1,229 @@
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mcmod.h"
+
+// Offsets of the header fields
+#define H_FORMAT            0
+#define H_TITLE             5
+#define H_VERSION           55
+#define H_PART_NUMBER       65
+#define H_AUTHOR            85
+#define H_COPYRIGHT         135
+#define H_LICENSE           235
+#define H_COMMENTS          435
+#define H_CATEGORY          690
+#define H_HARDWARE          691
+#define H_MEM_MODULES       692
+#define H_XMEM_MODULES      693
+#define H_ORIGINAL          694
+#define H_APP_AUTO_UPDATE   695
+#define H_PAGES             696
+
+// Offsets of the page record fields
+#define R_NAME              0
+#define R_ID                20
+#define R_PAGE              29
+#define R_PAGE_GROUP        30
+#define R_BANK              31
+#define R_BANK_GROUP        32
+#define R_RAM               33
+#define R_WRITE_PROTECT     34
+#define R_FAT               35
+#define R_IMAGE             36
+
+static void get_string(char *s, const unsigned char *field, size_t size)
+{
+    size_t n = 0;
+    while (n < size && field[n]) {
+        s[n] = (char) field[n];
+        n++;
+    }
+    s[n] = '\0';
+}
+
+static void put_string(unsigned char *field, const char *s, size_t size)
+{
+    size_t n = strlen(s);
+    memcpy(field, s, n < size ? n : size - 1);
+}
+
+static int valid_page(int page)
+{
+    return page <= 0xF || (page >= MOD_POSITION_ANY && page <= MOD_POSITION_ORDERED && (page & 0xF) == 0xF);
+}
+
+int mod_path(const char *path)
+{
+    size_t len = strlen(path);
+    if (len < 4 || path[len - 4] != '.') {
+        return 0;
+    }
+    for (size_t i = 1; i < 4; i++) {
+        char ch = path[len - 4 + i];
+        if ((ch >= 'A' && ch <= 'Z' ? ch - 'A' + 'a' : ch) != "mod"[i - 1]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int mod_open(mod_file *mod, const char *path)
+{
+    mod->pages = 0;
+    if (image_open(&mod->view, path, IMAGE_BIN)) {
+        return -1;
+    }
+    const unsigned char *data = mod->view.data;
+    if (mod->view.size < MOD_HEADER_SIZE || memcmp(data + H_FORMAT, MOD_SIGNATURE, 5) != 0 ||
+        mod->view.size != MOD_HEADER_SIZE + (size_t) data[H_PAGES] * MOD_RECORD_SIZE) {
+        image_close(&mod->view);
+        errno = EINVAL;
+        return -1;
+    }
+    mod->pages = data[H_PAGES];
+    return 0;
+}
+
+void mod_close(mod_file *mod)
+{
+    image_close(&mod->view);
+    mod->pages = 0;
+}
+
+void mod_header(const mod_file *mod, mod_info *info)
+{
+    const unsigned char *h = mod->view.data;
+    get_string(info->title, h + H_TITLE, sizeof(info->title) - 1);
+    get_string(info->version, h + H_VERSION, sizeof(info->version) - 1);
+    get_string(info->part_number, h + H_PART_NUMBER, sizeof(info->part_number) - 1);
+    get_string(info->author, h + H_AUTHOR, sizeof(info->author) - 1);
+    get_string(info->copyright, h + H_COPYRIGHT, sizeof(info->copyright) - 1);
+    get_string(info->license, h + H_LICENSE, sizeof(info->license) - 1);
+    get_string(info->comments, h + H_COMMENTS, sizeof(info->comments) - 1);
+    info->category = h[H_CATEGORY];
+    info->hardware = h[H_HARDWARE];
+    info->mem_modules = h[H_MEM_MODULES];
+    info->xmem_modules = h[H_XMEM_MODULES];
+    info->original = h[H_ORIGINAL];
+    info->app_auto_update = h[H_APP_AUTO_UPDATE];
+    info->pages = h[H_PAGES];
+}
+
+int mod_page_get(const mod_file *mod, int index, mod_page *page)
+{
+    if (index < 0 || index >= mod->pages) {
+        return -1;
+    }
+    const unsigned char *r = mod->view.data + MOD_HEADER_SIZE + (size_t) index * MOD_RECORD_SIZE;
+    get_string(page->name, r + R_NAME, sizeof(page->name) - 1);
+    get_string(page->id, r + R_ID, sizeof(page->id) - 1);
+    page->page = r[R_PAGE];
+    page->page_group = r[R_PAGE_GROUP];
+    page->bank = r[R_BANK];
+    page->bank_group = r[R_BANK_GROUP];
+    page->ram = r[R_RAM];
+    page->write_protect = r[R_WRITE_PROTECT];
+    page->fat = r[R_FAT];
+    page->port = page->page >= 8 && page->page <= 0xF ? (page->page - 8) / 2 + 1 : 0;
+    page->image = r + R_IMAGE;
+    if (!valid_page(page->page) || page->page_group > 8 || page->bank < 1 || page->bank > 4 ||
+        page->bank_group > 8 || page->ram > 1 || page->write_protect > 1 || page->fat > 1) {
+        return -1;
+    }
+    return 0;
+}
+
+void mod_read(const mod_page *page, unsigned short *words)
+{
+    const unsigned char *b = page->image;
+    for (int i = 0; i < MOD_PAGE_WORDS; i += 4, b += 5) {
+        words[i] = ((b[1] & 0x03) << 8) | b[0];
+        words[i + 1] = ((b[2] & 0x0F) << 6) | (b[1] >> 2);
+        words[i + 2] = ((b[3] & 0x3F) << 4) | (b[2] >> 4);
+        words[i + 3] = (b[4] << 2) | (b[3] >> 6);
+    }
+}
+
+int mod_create(mod_writer *writer, const char *path, const mod_info *info)
+{
+    unsigned char h[MOD_HEADER_SIZE] = { 0 };
+
+    memcpy(h + H_FORMAT, MOD_SIGNATURE, 5);
+    put_string(h + H_TITLE, info->title, H_VERSION - H_TITLE);
+    put_string(h + H_VERSION, info->version, H_PART_NUMBER - H_VERSION);
+    put_string(h + H_PART_NUMBER, info->part_number, H_AUTHOR - H_PART_NUMBER);
+    put_string(h + H_AUTHOR, info->author, H_COPYRIGHT - H_AUTHOR);
+    put_string(h + H_COPYRIGHT, info->copyright, H_LICENSE - H_COPYRIGHT);
+    put_string(h + H_LICENSE, info->license, H_COMMENTS - H_LICENSE);
+    put_string(h + H_COMMENTS, info->comments, H_CATEGORY - H_COMMENTS);
+    h[H_CATEGORY] = (unsigned char) info->category;
+    h[H_HARDWARE] = (unsigned char) info->hardware;
+    h[H_MEM_MODULES] = (unsigned char) info->mem_modules;
+    h[H_XMEM_MODULES] = (unsigned char) info->xmem_modules;
+    h[H_ORIGINAL] = (unsigned char) info->original;
+    h[H_APP_AUTO_UPDATE] = (unsigned char) info->app_auto_update;
+
+    writer->pages = 0;
+    writer->file = fopen(path, "wb");
+    if (!writer->file) {
+        return -1;
+    }
+    if (fwrite(h, 1, sizeof(h), writer->file) != sizeof(h)) {
+        fclose(writer->file);
+        writer->file = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+int mod_write(mod_writer *writer, const mod_page *page, const unsigned short *words)
+{
+    unsigned char r[MOD_RECORD_SIZE] = { 0 };
+
+    if (writer->pages == MOD_MAX_PAGES) {
+        errno = EFBIG;
+        return -1;
+    }
+    put_string(r + R_NAME, page->name, R_ID - R_NAME);
+    put_string(r + R_ID, page->id, R_PAGE - R_ID);
+    r[R_PAGE] = (unsigned char) page->page;
+    r[R_PAGE_GROUP] = (unsigned char) page->page_group;
+    r[R_BANK] = (unsigned char) page->bank;
+    r[R_BANK_GROUP] = (unsigned char) page->bank_group;
+    r[R_RAM] = (unsigned char) page->ram;
+    r[R_WRITE_PROTECT] = (unsigned char) page->write_protect;
+    r[R_FAT] = (unsigned char) page->fat;
+
+    unsigned char *b = r + R_IMAGE;
+    for (int i = 0; i < MOD_PAGE_WORDS; i += 4, b += 5) {
+        unsigned int w0 = words[i] & 0x3FF;
+        unsigned int w1 = words[i + 1] & 0x3FF;
+        unsigned int w2 = words[i + 2] & 0x3FF;
+        unsigned int w3 = words[i + 3] & 0x3FF;
+        b[0] = (unsigned char) (w0 & 0xFF);
+        b[1] = (unsigned char) (w0 >> 8 | (w1 & 0x3F) << 2);
+        b[2] = (unsigned char) (w1 >> 6 | (w2 & 0x0F) << 4);
+        b[3] = (unsigned char) (w2 >> 4 | (w3 & 0x03) << 6);
+        b[4] = (unsigned char) (w3 >> 2);
+    }
+    if (fwrite(r, 1, sizeof(r), writer->file) != sizeof(r)) {
+        return -1;
+    }
+    writer->pages++;
+    return 0;
+}
+
+int mod_finish(mod_writer *writer)
+{
+    int rc = 0;
+    if (fseek(writer->file, H_PAGES, SEEK_SET) || fputc(writer->pages, writer->file) == EOF) {
+        rc = -1;
+    }
+    if (fclose(writer->file)) {
+        rc = -1;
+    }
+    writer->file = NULL;
+    return rc;
+}
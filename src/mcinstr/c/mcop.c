@@ -0,0 +1,112 @@
+
+#include <string.h>
+
+#include "mcinstr.h"
+#include "mcop.h"
+
+int mnemonic_type_index(int operand_type)
+{
+    const char *p = operand_type ? strchr(MCODE_OP_TYPES, operand_type) : 0;
+    return p ? (int) (p - MCODE_OP_TYPES) : -1;
+}
+
+static const char *iterate(mnemonic_operand_it *it, int operand_type, const short *list, int from, int to)
+{
+    const char *mnemonic = 0;
+    if (it) {
+        it->operand_type = operand_type;
+        it->index = -1;
+        it->next = list + from;
+        it->end = list + to;
+        mnemonic = mnemonic_operand_next(it);
+    }
+    return mnemonic;
+}
+
+const char *mnemonic_operand_first(mnemonic_operand_it *it, int operand_type)
+{
+    int t = mnemonic_type_index(operand_type);
+    if (t < 0) {
+        return iterate(it, operand_type, mnemonic_type_list, 0, 0);
+    }
+    return iterate(it, operand_type, mnemonic_type_list, mnemonic_type_offset[t], mnemonic_type_offset[t + 1]);
+}
+
+const char *mnemonic_operand_set_first(mnemonic_operand_it *it, int operand_type, int set)
+{
+    int t = mnemonic_type_index(operand_type);
+    int s = inst_set_index(set);
+    if (t < 0 || s < 0) {
+        return iterate(it, operand_type, mnemonic_type_set_list, 0, 0);
+    }
+    int k = t * INST_SET_COUNT + s;
+    return iterate(it, operand_type, mnemonic_type_set_list, mnemonic_type_set_offset[k],
+        mnemonic_type_set_offset[k + 1]);
+}
+
+const char *mnemonic_operand_next(mnemonic_operand_it *it)
+{
+    const char *mnemonic = 0;
+    if (it && it->next < it->end) {
+        it->index = *it->next++;
+        mnemonic = inst[it->index].name;
+    } else if (it) {
+        it->index = IHT_SIZE;
+    }
+    return mnemonic;
+}
+
+void mnemonic_select(mnemonic_bitset *result, const char *operand_types, int set)
+{
+    mnemonic_bitset sets;
+    memset(&sets, 0, sizeof(sets));
+    for (int s = SET_HP; s <= SET_ZENCODE; s <<= 1) {
+        if (set & s) {
+            for (int w = 0; w < MNEMONIC_BITSET_WORDS; w++) {
+                sets.bits[w] |= mnemonic_set_bits[inst_set_index(s)][w];
+            }
+        }
+    }
+    if (!operand_types) {
+        *result = sets;
+        return;
+    }
+    memset(result, 0, sizeof(*result));
+    for (const char *p = operand_types; *p; p++) {
+        int t = mnemonic_type_index(*p);
+        for (int w = 0; w < MNEMONIC_BITSET_WORDS && t >= 0; w++) {
+            result->bits[w] |= mnemonic_type_bits[t][w] & sets.bits[w];
+        }
+    }
+}
+
+static int lowest_bit(unsigned int bits)
+{
+#if defined(__GNUC__)
+    return __builtin_ctz(bits);
+#else
+    int n = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+int mnemonic_bitset_next(const mnemonic_bitset *b, int index)
+{
+    int i = index + 1;
+    int w = i / 32;
+    if (i >= IHT_SIZE) {
+        return -1;
+    }
+    unsigned int bits = b->bits[w] & (~0u << (i % 32));
+    while (!bits) {
+        if (++w == MNEMONIC_BITSET_WORDS) {
+            return -1;
+        }
+        bits = b->bits[w];
+    }
+    return w * 32 + lowest_bit(bits);
+}
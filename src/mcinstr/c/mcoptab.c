@@ -0,0 +1,236 @@
+/* Generated by mcinstrgen operands, do not edit. */
+
+#include "mcinstr.h"
+#include "mcop.h"
+
+const short mnemonic_type_offset[MCODE_OP_TYPE_COUNT + 1] = {
+    0, 282, 335, 352, 363, 368, 382, 385, 386, 400, 401, 403,
+    406, 409, 410, 412, 413, 416, 418, 424, 424
+};
+
+const short mnemonic_type_list[] = {
+    0, 1, 2, 4, 8, 10, 14, 15, 16, 17, 18, 19,
+    20, 22, 24, 27, 28, 30, 31, 32, 35, 37, 38, 41,
+    43, 45, 49, 50, 51, 53, 54, 58, 59, 60, 61, 68,
+    69, 70, 72, 75, 76, 77, 78, 80, 82, 84, 85, 86,
+    87, 90, 92, 93, 94, 95, 96, 97, 98, 99, 101, 102,
+    103, 105, 106, 108, 109, 110, 111, 113, 115, 116, 117, 118,
+    119, 120, 121, 122, 123, 124, 125, 127, 131, 132, 133, 134,
+    139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150,
+    151, 152, 154, 155, 156, 157, 159, 161, 162, 163, 165, 167,
+    168, 174, 180, 181, 183, 185, 186, 187, 189, 193, 196, 198,
+    199, 200, 201, 203, 205, 206, 207, 208, 215, 216, 218, 219,
+    220, 221, 222, 223, 224, 225, 226, 229, 232, 233, 234, 235,
+    236, 237, 239, 240, 241, 242, 243, 245, 246, 247, 249, 250,
+    251, 252, 253, 254, 255, 256, 257, 259, 262, 263, 264, 265,
+    266, 269, 271, 272, 274, 275, 276, 277, 279, 283, 284, 285,
+    286, 287, 289, 290, 291, 292, 293, 295, 297, 298, 299, 301,
+    303, 304, 305, 306, 307, 308, 309, 310, 311, 313, 315, 317,
+    319, 322, 323, 324, 325, 326, 327, 330, 331, 332, 333, 337,
+    338, 339, 341, 342, 343, 345, 346, 347, 348, 349, 350, 351,
+    352, 353, 354, 355, 356, 359, 360, 361, 362, 363, 364, 365,
+    366, 367, 368, 370, 371, 372, 373, 374, 375, 376, 377, 378,
+    379, 380, 381, 382, 384, 386, 387, 388, 389, 391, 392, 393,
+    394, 397, 399, 400, 402, 403, 407, 409, 410, 411, 412, 413,
+    414, 415, 416, 420, 421, 423, 11, 21, 26, 29, 33, 36,
+    39, 40, 48, 52, 57, 62, 63, 65, 66, 67, 71, 73,
+    83, 126, 129, 130, 137, 166, 169, 171, 172, 175, 177, 179,
+    182, 190, 202, 209, 211, 213, 214, 227, 228, 230, 258, 260,
+    267, 268, 270, 320, 328, 329, 344, 395, 404, 405, 418, 23,
+    25, 47, 100, 104, 114, 135, 197, 217, 231, 238, 248, 282,
+    358, 406, 408, 419, 7, 13, 44, 55, 138, 153, 244, 369,
+    383, 398, 424, 5, 89, 188, 191, 273, 3, 64, 81, 91,
+    107, 128, 173, 184, 204, 288, 340, 385, 417, 422, 79, 321,
+    357, 6, 136, 160, 164, 280, 281, 294, 296, 300, 302, 312,
+    314, 316, 318, 334, 401, 195, 212, 46, 56, 74, 178, 194,
+    390, 9, 176, 278, 158, 112, 170, 192, 42, 210, 12, 34,
+    88, 261, 335, 396
+};
+
+const short mnemonic_type_set_offset[MCODE_OP_TYPE_COUNT * INST_SET_COUNT + 1] = {
+    0, 158, 289, 408, 450, 486, 522, 529, 536, 543, 548, 552,
+    556, 559, 561, 563, 569, 573, 577, 578, 579, 580, 581, 582,
+    583, 597, 597, 597, 598, 599, 600, 601, 602, 603, 606, 609,
+    612, 615, 618, 621, 622, 623, 624, 625, 626, 627, 628, 629,
+    630, 631, 632, 633, 635, 637, 639, 645, 651, 657, 657, 657,
+    657
+};
+
+const short mnemonic_type_set_list[] = {
+    0, 1, 14, 15, 18, 19, 22, 24, 27, 30, 32, 37,
+    43, 45, 53, 54, 59, 60, 61, 69, 70, 72, 75, 76,
+    77, 78, 80, 82, 84, 85, 86, 90, 92, 93, 96, 97,
+    98, 99, 101, 103, 105, 108, 109, 111, 113, 115, 117, 121,
+    122, 123, 125, 131, 132, 139, 140, 141, 142, 143, 144, 145,
+    147, 149, 151, 155, 156, 157, 159, 162, 174, 185, 189, 196,
+    198, 199, 203, 205, 208, 215, 216, 218, 219, 220, 222, 223,
+    224, 232, 237, 239, 246, 247, 250, 251, 253, 262, 263, 265,
+    266, 269, 272, 274, 276, 277, 285, 292, 293, 295, 298, 303,
+    305, 306, 307, 308, 311, 313, 317, 319, 322, 324, 325, 326,
+    327, 331, 332, 337, 339, 341, 343, 346, 348, 354, 356, 359,
+    360, 361, 362, 363, 364, 366, 367, 368, 370, 372, 373, 374,
+    377, 381, 382, 384, 386, 387, 391, 392, 397, 402, 407, 413,
+    416, 421, 1, 2, 4, 8, 10, 16, 17, 20, 22, 28,
+    31, 35, 41, 43, 49, 51, 58, 60, 72, 84, 86, 87,
+    94, 95, 96, 102, 106, 111, 116, 117, 118, 119, 120, 124,
+    133, 134, 142, 143, 144, 146, 148, 150, 151, 152, 154, 157,
+    161, 163, 165, 167, 168, 180, 181, 183, 186, 187, 189, 193,
+    200, 201, 206, 224, 225, 226, 233, 234, 236, 240, 241, 242,
+    243, 245, 246, 250, 252, 253, 254, 255, 256, 257, 259, 264,
+    271, 275, 283, 286, 289, 290, 297, 298, 299, 301, 304, 308,
+    309, 310, 311, 315, 317, 323, 327, 330, 333, 338, 342, 345,
+    347, 349, 350, 351, 353, 354, 355, 360, 365, 371, 373, 376,
+    378, 380, 388, 389, 391, 394, 399, 403, 410, 412, 414, 420,
+    423, 0, 1, 18, 19, 32, 35, 38, 43, 50, 59, 60,
+    68, 70, 72, 76, 80, 82, 84, 86, 92, 96, 103, 105,
+    108, 110, 111, 116, 117, 121, 122, 125, 127, 139, 141, 142,
+    144, 151, 157, 159, 161, 162, 185, 189, 200, 203, 205, 207,
+    208, 215, 216, 218, 220, 221, 226, 229, 232, 235, 237, 242,
+    246, 247, 249, 250, 251, 253, 254, 256, 263, 265, 272, 274,
+    275, 276, 279, 284, 287, 291, 295, 298, 303, 306, 307, 308,
+    313, 317, 327, 337, 339, 341, 343, 349, 352, 354, 359, 360,
+    361, 362, 364, 366, 368, 370, 371, 374, 375, 377, 379, 380,
+    386, 387, 391, 393, 394, 400, 402, 407, 409, 411, 415, 416,
+    11, 21, 26, 29, 33, 36, 39, 40, 48, 52, 57, 62,
+    63, 65, 66, 67, 73, 83, 126, 129, 130, 137, 166, 169,
+    171, 172, 175, 177, 179, 182, 190, 211, 213, 228, 260, 320,
+    328, 329, 344, 395, 404, 405, 11, 21, 26, 29, 33, 48,
+    52, 57, 62, 63, 65, 66, 67, 73, 83, 126, 129, 130,
+    137, 166, 169, 171, 172, 175, 177, 179, 182, 190, 202, 209,
+    211, 213, 214, 227, 230, 258, 11, 21, 26, 29, 33, 48,
+    52, 57, 62, 63, 65, 66, 67, 71, 73, 83, 126, 129,
+    130, 137, 169, 171, 172, 177, 202, 209, 211, 213, 214, 227,
+    230, 258, 267, 268, 270, 418, 135, 197, 217, 238, 248, 358,
+    406, 47, 100, 114, 238, 248, 406, 408, 23, 25, 104, 231,
+    238, 282, 419, 7, 13, 44, 153, 244, 13, 369, 398, 424,
+    55, 138, 153, 383, 89, 191, 273, 5, 188, 5, 188, 3,
+    81, 91, 184, 340, 422, 107, 128, 173, 204, 64, 288, 385,
+    417, 79, 357, 321, 6, 6, 6, 136, 160, 164, 280, 281,
+    294, 296, 300, 302, 312, 314, 316, 318, 334, 401, 401, 401,
+    195, 195, 212, 46, 56, 74, 46, 56, 74, 46, 56, 74,
+    178, 194, 390, 178, 194, 390, 178, 194, 390, 9, 9, 9,
+    176, 176, 278, 158, 158, 158, 112, 192, 170, 42, 210, 42,
+    210, 42, 210, 12, 34, 88, 261, 335, 396, 12, 34, 88,
+    261, 335, 396, 12, 34, 88, 261, 335, 396
+};
+
+const unsigned int mnemonic_type_bits[MCODE_OP_TYPE_COUNT][MNEMONIC_BITSET_WORDS] = {
+    {
+        0xD95FC517, 0x3C6E2A69, 0xF4F57970, 0xBFFAF6EF, 0xBDFFF878, 0x2EB041AE,
+        0xFD81EBD2, 0xFEEFBF27, 0xF8BDA7CB, 0xAAFFAEBE, 0xFEEE3CFC, 0x7FFDFF9F,
+        0xFE8DA7BD, 0x000000B1
+    }, // A
+    {
+        0x24200800, 0xC2110192, 0x0008028E, 0x40000000, 0x00000206, 0x404A9A40,
+        0x006A0400, 0x00000058, 0x00005814, 0x00000000, 0x01000301, 0x00000000,
+        0x00300800, 0x00000004
+    }, // D
+    {
+        0x02800000, 0x00008000, 0x00000000, 0x00040110, 0x00000080, 0x00000000,
+        0x02000020, 0x01004080, 0x04000000, 0x00000000, 0x00000000, 0x00000040,
+        0x01400000, 0x00000008
+    }, // E
+    {
+        0x00002080, 0x00801000, 0x00000000, 0x00000000, 0x02000400, 0x00000000,
+        0x00000000, 0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x80020000,
+        0x00004000, 0x00000100
+    }, // F
+    {
+        0x00000020, 0x00000000, 0x02000000, 0x00000000, 0x00000000, 0x90000000,
+        0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000
+    }, // G
+    {
+        0x00000008, 0x00000000, 0x08020001, 0x00000800, 0x00000001, 0x01002000,
+        0x00001000, 0x00000000, 0x00000000, 0x00000001, 0x00100000, 0x00000000,
+        0x00000002, 0x00000042
+    }, // H
+    {
+        0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000020,
+        0x00000000, 0x00000000
+    }, // I
+    {
+        0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000
+    }, // J
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000011,
+        0x00000000, 0x00000000, 0x03000000, 0x55005140, 0x00004000, 0x00000000,
+        0x00000000, 0x00000000
+    }, // K
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00020000, 0x00000000
+    }, // L
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00100008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000
+    }, // M
+    {
+        0x00000000, 0x01004000, 0x00000400, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000
+    }, // N
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000,
+        0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000040, 0x00000000
+    }, // O
+    {
+        0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000
+    }, // P
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000,
+        0x00000000, 0x00000000, 0x00400000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000
+    }, // Q
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000
+    }, // R
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000400,
+        0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000
+    }, // S
+    {
+        0x00000000, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000
+    }, // T
+    {
+        0x00001000, 0x00000004, 0x01000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00008000, 0x00000000,
+        0x00001000, 0x00000000
+    }, // U
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000
+    } // ?
+};
+
+const unsigned int mnemonic_set_bits[INST_SET_COUNT][MNEMONIC_BITSET_WORDS] = {
+    {
+        0x6D6CFACB, 0xFB717DB7, 0x3F7FFF6E, 0x6E2BB2AF, 0xFAABFB9E, 0xE34FDA55,
+        0xDFAD28FC, 0x2DD0E111, 0x233726F0, 0xF79ED5F0, 0x15BADBF5, 0x6275DFD4,
+        0x20F639CD, 0x00000061
+    },
+    {
+        0xB4733F76, 0xD71BCE0E, 0xC1D8070E, 0x51F48C51, 0x65D5C267, 0x7CFFBBEA,
+        0x006E570F, 0xF56F564F, 0x4808812F, 0x28F12E06, 0xEA44A488, 0x152A212E,
+        0x554AD4F0, 0x00000190
+    },
+    {
+        0x26AC1A63, 0xDB954C4F, 0x115D17DF, 0xE630D381, 0xE2816E06, 0x32061E06,
+        0x35FFAD04, 0x6EC469EC, 0x94DD5AA5, 0x221C8489, 0x20AA8082, 0x9ACD5785,
+        0x8A8716CE, 0x0000000F
+    }
+};
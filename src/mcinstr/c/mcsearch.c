@@ -0,0 +1,48 @@
+#include <string.h>
+
+#include "mcinstr.h"
+#include "mchash.h"
+
+// Hash function of SDK41. The table inst[] was built with it: every
+// mnemonic either is stored at its hash position or is reachable from
+// there through the next chain.
+int hash_inst(char *name)
+{
+    unsigned int h = 0;
+    while (*name) {
+        h = (h + (unsigned char) *name++) * 2;
+    }
+    return h % IHT_SIZE;
+}
+
+// FNV-1a, the seed replaces the offset basis
+unsigned int inst_phash(const char *name, unsigned int seed)
+{
+    unsigned int h = seed ? seed : 2166136261u;
+    while (*name) {
+        h ^= (unsigned char) *name++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+int inst_phash_slot(const char *name)
+{
+    int d = inst_phash_displacement[inst_phash(name, 0) % INST_PHASH_BUCKETS];
+    if (d < 0) {
+        return -d - 1;
+    } else {
+        return inst_phash(name, d) % IHT_SIZE;
+    }
+}
+
+// Returns the index of the mnemonic in inst[] if it is part of one of
+// the given instruction sets (SET_*), or -1.
+int search_inst(char *name, int set)
+{
+    int i = inst_phash_index[inst_phash_slot(name)];
+    if (i >= 0 && (inst[i].set & set) && strcmp(inst[i].name, name) == 0) {
+        return i;
+    }
+    return -1;
+}
@@ -0,0 +1,245 @@
+#include <string.h>
+
+#include "mcinstr.h"
+#include "mcop.h"
+#include "mctrans.h"
+
+struct output_t {
+    char *buf;
+    size_t size;
+    size_t len;
+    int shift;          // columns the output is ahead of the line
+    int full;
+};
+
+typedef struct output_t output;
+
+static const struct {
+    const char *name;
+    int set;
+} set_directives[INST_SET_COUNT] = {
+    { "HP", SET_HP },
+    { "JDA", SET_JDA },
+    { "ZENCODE", SET_ZENCODE }
+};
+
+static int is_space(char ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
+}
+
+static int is_hex(char ch)
+{
+    return (ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'F');
+}
+
+// Length of the token at s: up to white space or a comment.
+static size_t token_length(const char *s, size_t len)
+{
+    size_t n = 0;
+    while (n < len && s[n] != ';' && !is_space(s[n])) {
+        n++;
+    }
+    return n;
+}
+
+static size_t skip_space(const char *s, size_t pos, size_t len)
+{
+    while (pos < len && is_space(s[pos])) {
+        pos++;
+    }
+    return pos;
+}
+
+static void put(output *out, const char *s, size_t n)
+{
+    if (out->len + n >= out->size) {
+        out->full = 1;
+        return;
+    }
+    memcpy(out->buf + out->len, s, n);
+    out->len += n;
+}
+
+// Copies text of the line, which goes on after it if more is set. A
+// run of spaces in front of more text gives back the columns the output
+// is ahead, or takes the columns it is behind, keeping at least one
+// space.
+static void copy(output *out, const char *s, size_t n, int more)
+{
+    size_t pos = 0;
+    while (pos < n) {
+        size_t end = pos;
+        while (end < n && s[end] == ' ') {
+            end++;
+        }
+        if (end > pos && (end < n || more) && out->shift != 0) {
+            int spaces = (int) (end - pos) - out->shift;
+            spaces = spaces < 1 ? 1 : spaces;
+            out->shift -= (int) (end - pos) - spaces;
+            while (spaces--) {
+                put(out, " ", 1);
+            }
+            pos = end;
+        }
+        while (end < n && s[end] != ' ') {
+            end++;
+        }
+        put(out, s + pos, end - pos);
+        pos = end;
+    }
+}
+
+static void replace(output *out, size_t old_length, const char *name)
+{
+    size_t n = strlen(name);
+    put(out, name, n);
+    out->shift += (int) n - (int) old_length;
+}
+
+// Index of a field name of any set, like mcodeasm, or -1.
+static int tef_index(const char *s, size_t n)
+{
+    for (int set = 0; set < INST_SET_COUNT; set++) {
+        for (int tef = 0; tef < 8; tef++) {
+            const char *name = inst_tef_names[set][tef];
+            if (strlen(name) == n && memcmp(s, name, n) == 0) {
+                return tef;
+            }
+        }
+    }
+    return -1;
+}
+
+// The mnemonic of set to for an instruction with a digit operand that
+// the set names with the digit, like CF 3 (S3= in HP), or -1.
+static int digit_mnemonic(int i, const char *s, size_t n, int to)
+{
+    int digit = -1;
+    if (inst[i].typ != MCODE_OP_0_TO_13_DEC) {
+        return -1;
+    }
+    if (n == 1 && s[0] >= '0' && s[0] <= '9') {
+        digit = s[0] - '0';
+    } else if (n == 2 && s[0] == '1' && s[1] >= '0' && s[1] <= '3') {
+        digit = 10 + s[1] - '0';
+    }
+    if (digit < 0) {
+        return -1;
+    }
+    const inst_decode_entry *entry = &inst_decode[inst[i].tyte1 | inst_digit_code[digit] << 6][inst_set_index(to)];
+    return entry->index >= 0 && entry->mask == 0 && entry->words == 1 ? entry->index : -1;
+}
+
+// Position after the listing prefix (address and 1 to 3 codes) and the
+// label of a line, as mcodeasm reads them.
+static size_t skip_prefix(const char *line, size_t len)
+{
+    size_t pos = skip_space(line, 0, len);
+    if (token_length(line + pos, len - pos) == 4 && is_hex(line[pos]) && is_hex(line[pos + 1]) &&
+        is_hex(line[pos + 2]) && is_hex(line[pos + 3])) {
+        size_t codes = skip_space(line, pos + 4, len);
+        size_t n = token_length(line + codes, len - codes);
+        int ok = n >= 3 && n <= 9 && n % 3 == 0;
+        for (size_t i = 0; ok && i < n; i += 3) {
+            ok = line[codes + i] >= '0' && line[codes + i] <= '3' && is_hex(line[codes + i + 1]) &&
+                is_hex(line[codes + i + 2]);
+        }
+        if (ok) {
+            pos = skip_space(line, codes + n, len);
+        }
+    }
+    if (pos < len && (line[pos] == '(' || line[pos] == '[')) {
+        const char *end = memchr(line + pos + 1, line[pos] == '(' ? ')' : ']', len - pos - 1);
+        if (end) {
+            pos = skip_space(line, end - line + 1, len);
+        }
+    }
+    return pos;
+}
+
+size_t inst_translate_line(const char *line, size_t len, int *set, int to, char *buf, size_t size,
+    int *status, int *start, int *length)
+{
+    output out = { buf, size, 0, 0, 0 };
+    size_t pos = skip_prefix(line, len);
+    size_t n = token_length(line + pos, len - pos);
+    char name[INAME_SIZE + 1];
+    int from = *set;
+
+    *status = TRANSLATE_OK;
+    *start = (int) pos;
+    *length = (int) n;
+    put(&out, line, pos);
+    if (pos == len || line[pos] == '*' || line[pos] == ';' || line[pos] == '#') {
+        copy(&out, line + pos, len - pos, 0);
+    } else if (line[pos] == '.') {
+        int directive = -1;
+        for (int i = 0; i < INST_SET_COUNT; i++) {
+            const char *d = set_directives[i].name;
+            if (strlen(d) == n - 1 && memcmp(line + pos + 1, d, n - 1) == 0) {
+                directive = i;
+            }
+        }
+        if (directive >= 0) {
+            *set = set_directives[directive].set;
+            put(&out, ".", 1);
+            replace(&out, n - 1, set_directives[inst_set_index(to)].name);
+            pos += n;
+        }
+        copy(&out, line + pos, len - pos, 0);
+    } else {
+        int i = -1;
+        inst_translation_entry target = { -1, -1 };
+        if (n <= INAME_SIZE) {
+            memcpy(name, line + pos, n);
+            name[n] = '\0';
+            i = search_inst(name, from);
+        }
+        if (i >= 0) {
+            target = inst_translation[i][inst_set_index(to)];
+        }
+        size_t operand = skip_space(line, pos + n, len);
+        size_t operand_length = token_length(line + operand, len - operand);
+        int named = target.index < 0 && i >= 0 ? digit_mnemonic(i, line + operand, operand_length, to) : -1;
+        if (named >= 0) {
+            // mnemonic and operand make the name
+            replace(&out, operand + operand_length - pos, inst[named].name);
+            copy(&out, line + operand + operand_length, len - operand - operand_length, 0);
+        } else if (target.index < 0) {
+            *status = i < 0 ? TRANSLATE_UNKNOWN : TRANSLATE_MISSING;
+            copy(&out, line + pos, len - pos, 0);
+        } else {
+            replace(&out, n, inst[target.index].name);
+            if (target.operand >= 0) {
+                char digits[3];
+                int k = 0;
+                digits[k++] = ' ';
+                if (target.operand >= 10) {
+                    digits[k++] = (char) ('0' + target.operand / 10);
+                }
+                digits[k++] = (char) ('0' + target.operand % 10);
+                put(&out, digits, k);
+                out.shift += k;
+            }
+            copy(&out, line + pos + n, operand - pos - n, operand < len);
+            pos = operand;
+            if (inst[i].typ == MCODE_OP_TEF1 || inst[i].typ == MCODE_OP_TEF2) {
+                n = token_length(line + pos, len - pos);
+                int tef = tef_index(line + pos, n);
+                if (tef >= 0) {
+                    replace(&out, n, inst_tef_names[inst_set_index(to)][tef]);
+                    pos += n;
+                }
+            }
+            copy(&out, line + pos, len - pos, 0);
+        }
+    }
+    if (out.full) {
+        *status = TRANSLATE_LONG;
+        n = len < size ? len : size - 1;
+        memcpy(buf, line, n);
+        return n;
+    }
+    return out.len;
+}
@@ -0,0 +1,432 @@
+/* Generated by mcinstrgen translate, do not edit. */
+
+#include "mcinstr.h"
+#include "mctrans.h"
+
+const inst_translation_entry inst_translation[IHT_SIZE][INST_SET_COUNT] = {
+    { {   0, -1 }, {   1, -1 }, {   0, -1 } }, // SRSDAB
+    { {   1, -1 }, {   1, -1 }, {   1, -1 } }, // STOPC
+    { {  18, -1 }, {   2, -1 }, {  18, -1 } }, // RDAB1R
+    { {   3, -1 }, { 204, -1 }, { 385, -1 } }, // GSUBC
+    { { 203, -1 }, {   4, -1 }, { 203, -1 } }, // WRABC1L
+    { { 191, -1 }, {   5, -1 }, {   5, -1 } }, // JC
+    { {   6, -1 }, {   6, -1 }, {   6, -1 } }, // XROM
+    { {   7, -1 }, { 398, -1 }, { 153, -1 } }, // HPL=CH
+    { {  60, -1 }, {   8, -1 }, {  60, -1 } }, // WSTS
+    { {   9, -1 }, {   9, -1 }, {   9, -1 } }, // FCNS
+    { { 139, -1 }, {  10, -1 }, { 139, -1 } }, // RDAB6L
+    { {  11, -1 }, {  11, -1 }, {  11, -1 } }, // A=0
+    { {  12, -1 }, {  12, -1 }, {  12, -1 } }, // RTNCPU
+    { {  13, -1 }, {  13, -1 }, {  55, -1 } }, // LC
+    { {  14, -1 }, { 349, -1 }, { 349, -1 } }, // C=KEYS
+    { {  15, -1 }, { 254, -1 }, { 254, -1 } }, // CMEX
+    { {  92, -1 }, {  16, -1 }, {  92, -1 } }, // WRABC4L
+    { {  82, -1 }, {  17, -1 }, {  82, -1 } }, // WRABC1R
+    { {  18, -1 }, {   2, -1 }, {  18, -1 } }, // FRSDAB
+    { {  19, -1 }, { 165, -1 }, {  19, -1 } }, // RDALM
+    { { 109, -1 }, {  20, -1 }, { 282,  9 } }, // ?FRNS
+    { {  21, -1 }, {  21, -1 }, {  21, -1 } }, // A=A+1
+    { {  22, -1 }, {  22, -1 }, { 110, -1 } }, // C=STK
+    { {  -1, -1 }, { 408, -1 }, {  23, -1 } }, // CLRF
+    { {  24, -1 }, { 255, -1 }, { 375, -1 } }, // SPOPND
+    { { 248, -1 }, { 248, -1 }, {  25, -1 } }, // R=
+    { {  26, -1 }, {  26, -1 }, {  26, -1 } }, // C=0
+    { {  27, -1 }, { 187, -1 }, {  38, -1 } }, // CLRABC
+    { { 103, -1 }, {  28, -1 }, { 103, -1 } }, // WRABC4R
+    { {  29, -1 }, {  29, -1 }, {  29, -1 } }, // A=A-1
+    { {  30, -1 }, {  35, -1 }, {  35, -1 } }, // CNEX
+    { {  32, -1 }, {  31, -1 }, {  32, -1 } }, // RDATA
+    { {  32, -1 }, {  31, -1 }, {  32, -1 } }, // RDTIME
+    { {  33, -1 }, {  33, -1 }, {  33, -1 } }, // B=0
+    { {  34, -1 }, {  34, -1 }, {  34, -1 } }, // STATUS
+    { {  30, -1 }, {  35, -1 }, {  35, -1 } }, // N<>C
+    { {  36, -1 }, {  73, -1 }, {  73, -1 } }, // B#0?
+    { {  37, -1 }, {  87, -1 }, { 282,  0 } }, // ?F0=1
+    { {  27, -1 }, { 187, -1 }, {  38, -1 } }, // A=B=C=0
+    { {  39, -1 }, {  67, -1 }, {  67, -1 } }, // A#0?
+    { {  40, -1 }, { 177, -1 }, { 177, -1 } }, // A#C?
+    { { 363, -1 }, {  41, -1 }, { 249, -1 } }, // NCRTN
+    { {  42, -1 }, {  42, -1 }, {  42, -1 } }, // U8KDEF
+    { {  43, -1 }, {  43, -1 }, {  43, -1 } }, // SETDEC
+    { {  44, -1 }, { 369, -1 }, { 138, -1 } }, // C=REGN
+    { {  45, -1 }, { 355, -1 }, { 282,  1 } }, // ?F1=1
+    { {  46, -1 }, {  46, -1 }, {  46, -1 } }, // A=B
+    { { 217, -1 }, {  47, -1 }, { 231, -1 } }, // SF
+    { {  48, -1 }, {  48, -1 }, {  48, -1 } }, // A=C
+    { {  82, -1 }, {  49, -1 }, {  82, -1 } }, // TIMER=B
+    { { 311, -1 }, { 311, -1 }, {  50, -1 } }, // PUSHADR
+    { { 203, -1 }, {  51, -1 }, { 203, -1 } }, // TIMER=A
+    { {  52, -1 }, {  52, -1 }, {  52, -1 } }, // B=A
+    { {  53, -1 }, { 186, -1 }, { 282,  2 } }, // ?F2=1
+    { {  54, -1 }, { 423, -1 }, { 284, -1 } }, // DECPT
+    { {  13, -1 }, {  13, -1 }, {  55, -1 } }, // LD@R
+    { {  56, -1 }, {  56, -1 }, {  56, -1 } }, // B=C
+    { {  57, -1 }, {  57, -1 }, {  57, -1 } }, // A=A+C
+    { {  70, -1 }, {  58, -1 }, {  70, -1 } }, // WTIME
+    { {  59, -1 }, { 111, -1 }, {  59, -1 } }, // ENWKUP
+    { {  60, -1 }, {  60, -1 }, {  60, -1 } }, // STREAD
+    { {  61, -1 }, { 114,  3 }, { 282,  3 } }, // ?F3=1
+    { {  62, -1 }, {  62, -1 }, {  62, -1 } }, // C=B
+    { {  63, -1 }, {  63, -1 }, {  63, -1 } }, // A=A-B
+    { { 422, -1 }, { 173, -1 }, {  64, -1 } }, // ?NCXQ
+    { {  65, -1 }, {  65, -1 }, {  65, -1 } }, // A=A-C
+    { {  66, -1 }, {  66, -1 }, {  66, -1 } }, // A=A+B
+    { {  67, -1 }, {  67, -1 }, {  67, -1 } }, // ?A#0
+    { { 224, -1 }, { 224, -1 }, {  68, -1 } }, // DSPTOG
+    { {  69, -1 }, { 114,  4 }, { 282,  4 } }, // ?F4=1
+    { {  70, -1 }, {  58, -1 }, {  70, -1 } }, // ENWRIT
+    { { 190, -1 }, { 190, -1 }, {  71, -1 } }, // LSHFA
+    { {  72, -1 }, {  72, -1 }, {  72, -1 } }, // C=G
+    { {  73, -1 }, {  73, -1 }, {  73, -1 } }, // ?B#0
+    { {  74, -1 }, {  74, -1 }, {  74, -1 } }, // C=A
+    { {  75, -1 }, { 181, -1 }, { 374, -1 } }, // FRSABC
+    { {  76, -1 }, { 124, -1 }, {  76, -1 } }, // WSINT
+    { {  77, -1 }, { 271, -1 }, { 282,  5 } }, // ?F5=1
+    { {  78, -1 }, { 380, -1 }, { 380, -1 } }, // CHKKB
+    { {  79, -1 }, { 357, -1 }, { 321, -1 } }, // GSB41C
+    { {  80, -1 }, {   1, -1 }, {  80, -1 } }, // TRPCRD
+    { {  81, -1 }, { 128, -1 }, { 288, -1 } }, // GOLC
+    { {  82, -1 }, {  17, -1 }, {  82, -1 } }, // CRDFLG
+    { {  83, -1 }, {  83, -1 }, {  83, -1 } }, // ?C#0
+    { {  84, -1 }, {  84, -1 }, {  84, -1 } }, // C=M
+    { {  85, -1 }, { 351, -1 }, { 282,  6 } }, // ?F6=1
+    { {  86, -1 }, {  86, -1 }, {  86, -1 } }, // C=N
+    { {  37, -1 }, {  87, -1 }, { 282,  0 } }, // ?PBSY
+    { {  88, -1 }, {  88, -1 }, {  88, -1 } }, // ERROR?
+    { {  89, -1 }, { 188, -1 }, { 188, -1 } }, // GONC
+    { {  90, -1 }, { 241, -1 }, { 282,  7 } }, // SRQR?
+    { {  91, -1 }, { 107, -1 }, { 417, -1 } }, // GOLONG
+    { {  92, -1 }, {  16, -1 }, {  92, -1 } }, // WRSCR
+    { {  93, -1 }, { 241, -1 }, { 282,  7 } }, // ?F7=1
+    { { 218, -1 }, {  94, -1 }, { 218, -1 } }, // RTIMEST
+    { { 305, -1 }, {  95, -1 }, { 411, -1 } }, // CRTN
+    { {  96, -1 }, {  96, -1 }, {  96, -1 } }, // G=C
+    { {  97, -1 }, { 264, -1 }, { 379, -1 } }, // LLD?
+    { {  98, -1 }, { 254, -1 }, { 254, -1 } }, // MCEX
+    { {  99, -1 }, { 327, -1 }, { 327, -1 } }, // C=C!A
+    { { 135, -1 }, { 100, -1 }, { 419, -1 } }, // ?FS
+    { { 101, -1 }, { 399, -1 }, { 282,  8 } }, // ?F8=1
+    { { 397, -1 }, { 102, -1 }, { 400, -1 } }, // PERSLCT
+    { { 103, -1 }, {  28, -1 }, { 103, -1 } }, // SLLABC
+    { { 197, -1 }, { 406, -1 }, { 104, -1 } }, // ?R=
+    { { 105, -1 }, { 183, -1 }, { 105, -1 } }, // WRTEN
+    { { 108, -1 }, { 106, -1 }, { 108, -1 } }, // READAN
+    { {  91, -1 }, { 107, -1 }, { 417, -1 } }, // NCGO
+    { { 108, -1 }, { 106, -1 }, { 108, -1 } }, // RDINT
+    { { 109, -1 }, {  20, -1 }, { 282,  9 } }, // ?F9=1
+    { {  22, -1 }, {  22, -1 }, { 110, -1 } }, // POPADR
+    { { 111, -1 }, { 111, -1 }, { 111, -1 } }, // CRDINF
+    { { 112, -1 }, { 192, -1 }, { 170, -1 } }, // GOL41C
+    { { 113, -1 }, { 116, -1 }, { 116, -1 } }, // C=C&A
+    { { 358, -1 }, { 114, -1 }, { 282, -1 } }, // ?PF
+    { { 115, -1 }, { 259, -1 }, { 287, -1 } }, // SB=F
+    { { 113, -1 }, { 116, -1 }, { 116, -1 } }, // C=CANDA
+    { { 117, -1 }, { 117, -1 }, { 117, -1 } }, // SETHEX
+    { { 132, -1 }, { 118, -1 }, { 282, 10 } }, // ?ORAV
+    { {  82, -1 }, { 119, -1 }, {  82, -1 } }, // CRDEXF
+    { {   0, -1 }, { 120, -1 }, {   0, -1 } }, // SETCTF
+    { { 121, -1 }, { 124, -1 }, { 121, -1 } }, // SLLDAB
+    { { 122, -1 }, { 106, -1 }, { 122, -1 } }, // READEN
+    { { 123, -1 }, { 100, 10 }, { 419, 10 } }, // ?S10=1
+    { {  76, -1 }, { 124, -1 }, {  76, -1 } }, // WINTST
+    { { 125, -1 }, { 180, -1 }, { 125, -1 } }, // FLLABC
+    { { 126, -1 }, { 126, -1 }, { 126, -1 } }, // C=A+C
+    { { 105, -1 }, { 183, -1 }, { 127, -1 } }, // WRITDATA
+    { {  81, -1 }, { 128, -1 }, { 288, -1 } }, // CGO
+    { { 129, -1 }, { 129, -1 }, { 129, -1 } }, // C=A-C
+    { { 130, -1 }, { 130, -1 }, { 130, -1 } }, // C=C+1
+    { { 131, -1 }, { 100, 11 }, { 419, 11 } }, // ?S11=1
+    { { 132, -1 }, { 118, -1 }, { 282, 10 } }, // ?F10=1
+    { { 413, -1 }, { 133, -1 }, { 352, -1 } }, // GTOC
+    { { 185, -1 }, { 134, -1 }, { 185, -1 } }, // ALMON
+    { { 135, -1 }, { 100, -1 }, { 419, -1 } }, // ST=1?
+    { { 136, -1 }, { 408,  2 }, {  23,  2 } }, // S2=
+    { { 137, -1 }, { 137, -1 }, { 137, -1 } }, // C=C+C
+    { {  44, -1 }, { 369, -1 }, { 138, -1 } }, // READ
+    { { 139, -1 }, {  10, -1 }, { 139, -1 } }, // FLLDAB
+    { { 140, -1 }, { 304, -1 }, { 282, 11 } }, // ?F11=1
+    { { 141, -1 }, { 180, -1 }, { 141, -1 } }, // RDSCR
+    { { 142, -1 }, { 142, -1 }, { 142, -1 } }, // CRDOHF
+    { { 143, -1 }, { 143, -1 }, { 415, -1 } }, // DISOFF
+    { { 144, -1 }, { 144, -1 }, { 144, -1 } }, // M=C
+    { { 145, -1 }, { 116, -1 }, { 116, -1 } }, // C=C.A
+    { { 156, -1 }, { 146, -1 }, { 282, 13 } }, // ?SERV
+    { { 147, -1 }, { 100, 13 }, { 419, 13 } }, // ?S13=1
+    { { 337, -1 }, { 148, -1 }, { 337, -1 } }, // ENBANK1
+    { { 149, -1 }, { 286, -1 }, { 282, 12 } }, // ?F12=1
+    { { 339, -1 }, { 150, -1 }, { 339, -1 } }, // ENBANK2
+    { { 151, -1 }, { 151, -1 }, { 151, -1 } }, // STPINT
+    { { 341, -1 }, { 152, -1 }, { 341, -1 } }, // ENBANK3
+    { { 153, -1 }, { 398, -1 }, { 153, -1 } }, // SELPF
+    { { 343, -1 }, { 154, -1 }, { 343, -1 } }, // ENBANK4
+    { { 155, -1 }, { 118, -1 }, { 282, 10 } }, // ORAV?
+    { { 156, -1 }, { 146, -1 }, { 282, 13 } }, // ?F13=1
+    { { 157, -1 }, { 157, -1 }, { 157, -1 } }, // N=C
+    { { 158, -1 }, { 158, -1 }, { 158, -1 } }, // CON
+    { { 159, -1 }, { 167, -1 }, { 159, -1 } }, // DSWKUP
+    { { 160, -1 }, { 408,  8 }, {  23,  8 } }, // S8=
+    { { 381, -1 }, { 161, -1 }, { 161, -1 } }, // CLRKEY
+    { { 162, -1 }, {   8, -1 }, { 162, -1 } }, // WRSTS
+    { { 348, -1 }, { 163, -1 }, { 291, -1 } }, // RDROM
+    { { 164, -1 }, { 408,  9 }, {  23,  9 } }, // S9=
+    { {  19, -1 }, { 165, -1 }, {  19, -1 } }, // RALM
+    { { 166, -1 }, { 166, -1 }, { 268, -1 } }, // ASR
+    { { 159, -1 }, { 167, -1 }, { 159, -1 } }, // WKUPOFF
+    { { 362, -1 }, { 168, -1 }, { 362, -1 } }, // RDABC1L
+    { { 169, -1 }, { 169, -1 }, { 169, -1 } }, // C=C+A
+    { { 112, -1 }, { 192, -1 }, { 170, -1 } }, // ?NCGOREL
+    { { 171, -1 }, { 171, -1 }, { 171, -1 } }, // C=C-1
+    { { 172, -1 }, { 172, -1 }, { 172, -1 } }, // C=-C-1
+    { { 422, -1 }, { 173, -1 }, {  64, -1 } }, // NCXQ
+    { { 174, -1 }, { 183, -1 }, { 105, -1 } }, // DATA=C
+    { { 175, -1 }, { 175, -1 }, { 418, -1 } }, // C=-C
+    { { 176, -1 }, { 176, -1 }, { 278, -1 } }, // LDI
+    { { 177, -1 }, { 177, -1 }, { 177, -1 } }, // ?A#C
+    { { 178, -1 }, { 178, -1 }, { 178, -1 } }, // DEFP4K
+    { { 179, -1 }, { 179, -1 }, { 270, -1 } }, // BSR
+    { { 125, -1 }, { 180, -1 }, { 125, -1 } }, // RDABC4L
+    { {  75, -1 }, { 181, -1 }, { 374, -1 } }, // RDABC1R
+    { { 182, -1 }, { 182, -1 }, { 267, -1 } }, // CSR
+    { { 105, -1 }, { 183, -1 }, { 105, -1 } }, // WDATA
+    { { 184, -1 }, { 173, -1 }, {  64, -1 } }, // GSUBNC
+    { { 185, -1 }, { 134, -1 }, { 185, -1 } }, // ENALM
+    { {  53, -1 }, { 186, -1 }, { 282,  2 } }, // ?WNDB
+    { {  27, -1 }, { 187, -1 }, {  38, -1 } }, // ABC=0
+    { {  89, -1 }, { 188, -1 }, { 188, -1 } }, // JNC
+    { { 189, -1 }, { 189, -1 }, { 189, -1 } }, // TSTBUF
+    { { 190, -1 }, { 190, -1 }, {  71, -1 } }, // ASL
+    { { 191, -1 }, {   5, -1 }, {   5, -1 } }, // GOC
+    { { 112, -1 }, { 192, -1 }, { 170, -1 } }, // NCGOREL
+    { { 262, -1 }, { 193, -1 }, { 221, -1 } }, // ST<>F
+    { { 194, -1 }, { 194, -1 }, { 194, -1 } }, // DEFR4K
+    { { 195, -1 }, { 195, -1 }, { 212, -1 } }, // LC3
+    { { 196, -1 }, { 351, -1 }, { 282,  6 } }, // IFCR?
+    { { 197, -1 }, { 406, -1 }, { 104, -1 } }, // PT=?
+    { { 198, -1 }, {  35, -1 }, {  35, -1 } }, // NCEX
+    { { 199, -1 }, { 354, -1 }, { 354, -1 } }, // P=Q?
+    { { 421, -1 }, { 200, -1 }, { 200, -1 } }, // GTOKEY
+    { {  70, -1 }, { 201, -1 }, {  70, -1 } }, // WRA12L
+    { { 328, -1 }, { 202, -1 }, { 202, -1 } }, // A<>C
+    { { 203, -1 }, {   4, -1 }, { 203, -1 } }, // PT=B
+    { {   3, -1 }, { 204, -1 }, { 385, -1 } }, // CXQ
+    { { 205, -1 }, {  17, -1 }, { 205, -1 } }, // PT=A
+    { { 306, -1 }, { 206, -1 }, { 306, -1 } }, // WTIME-
+    { { 372, -1 }, { 412, -1 }, { 207, -1 } }, // T=ST
+    { { 208, -1 }, {  10, -1 }, { 208, -1 } }, // RDSTS
+    { { 320, -1 }, { 209, -1 }, { 209, -1 } }, // A<>B
+    { { 210, -1 }, { 210, -1 }, { 210, -1 } }, // DEFR8K
+    { { 211, -1 }, { 211, -1 }, { 211, -1 } }, // ?A<C
+    { { 195, -1 }, { 195, -1 }, { 212, -1 } }, // LD@R3
+    { { 213, -1 }, { 213, -1 }, { 213, -1 } }, // ?A<B
+    { { 320, -1 }, { 214, -1 }, { 214, -1 } }, // B<>A
+    { { 215, -1 }, {  17, -1 }, { 215, -1 } }, // SLSABC
+    { { 216, -1 }, {  31, -1 }, { 216, -1 } }, // FLLDA
+    { { 217, -1 }, {  47, -1 }, { 231, -1 } }, // ST=1
+    { { 218, -1 }, {  94, -1 }, { 218, -1 } }, // FLLDB
+    { { 219, -1 }, { 234, -1 }, { 229, -1 } }, // SELP
+    { { 220, -1 }, { 165, -1 }, { 220, -1 } }, // FLLDC
+    { { 262, -1 }, { 193, -1 }, { 221, -1 } }, // ST<>T
+    { { 222, -1 }, { 286, -1 }, { 282, 12 } }, // ALARM?
+    { { 223, -1 }, { 233, -1 }, { 235, -1 } }, // SELQ
+    { { 224, -1 }, { 224, -1 }, {  68, -1 } }, // DISTOG
+    { { 306, -1 }, { 225, -1 }, { 306, -1 } }, // WRB12L
+    { { 266, -1 }, { 226, -1 }, { 226, -1 } }, // ST=0
+    { { 344, -1 }, { 227, -1 }, { 227, -1 } }, // B<>C
+    { { 228, -1 }, { 211, -1 }, { 211, -1 } }, // A<C?
+    { { 219, -1 }, { 234, -1 }, { 229, -1 } }, // SLCTP
+    { { 328, -1 }, { 230, -1 }, { 230, -1 } }, // C<>A
+    { { 217, -1 }, {  47, -1 }, { 231, -1 } }, // SETF
+    { { 232, -1 }, { 301, -1 }, { 232, -1 } }, // DSALM
+    { { 223, -1 }, { 233, -1 }, { 235, -1 } }, // PT=Q
+    { { 219, -1 }, { 234, -1 }, { 229, -1 } }, // PT=P
+    { { 223, -1 }, { 233, -1 }, { 235, -1 } }, // SLCTQ
+    { { 247, -1 }, { 236, -1 }, { 247, -1 } }, // WRC12L
+    { { 237, -1 }, { 345, -1 }, { 237, -1 } }, // SLSDAB
+    { { 238, -1 }, { 238, -1 }, { 238, -1 } }, // RCR
+    { { 239, -1 }, {  31, -1 }, {  32, -1 } }, // C=DATA
+    { {  59, -1 }, { 240, -1 }, {  59, -1 } }, // WKUPON
+    { {  90, -1 }, { 241, -1 }, { 282,  7 } }, // ?SRQR
+    { { 392, -1 }, { 242, -1 }, { 242, -1 } }, // C<>G
+    { {  70, -1 }, { 243, -1 }, {  70, -1 } }, // ENDWRIT
+    { { 244, -1 }, { 424, -1 }, { 383, -1 } }, // REGN=C
+    { { 247, -1 }, { 245, -1 }, { 247, -1 } }, // WALM
+    { { 246, -1 }, { 246, -1 }, { 246, -1 } }, // CRDWPF
+    { { 247, -1 }, { 236, -1 }, { 247, -1 } }, // ENREAD
+    { { 248, -1 }, { 248, -1 }, {  25, -1 } }, // PT=
+    { { 363, -1 }, {  41, -1 }, { 249, -1 } }, // ?NCRTN
+    { { 250, -1 }, { 250, -1 }, { 250, -1 } }, // NOP
+    { { 251, -1 }, { 420, -1 }, { 251, -1 } }, // FLSDAB
+    { { 105, -1 }, { 252, -1 }, { 105, -1 } }, // WRITAN
+    { { 253, -1 }, { 253, -1 }, { 253, -1 } }, // ST=C
+    { {  15, -1 }, { 254, -1 }, { 254, -1 } }, // C<>M
+    { {  24, -1 }, { 255, -1 }, { 375, -1 } }, // CLRRTN
+    { {  30, -1 }, { 256, -1 }, { 256, -1 } }, // C<>N
+    { { 108, -1 }, { 257, -1 }, { 108, -1 } }, // RINT
+    { { 344, -1 }, { 258, -1 }, { 258, -1 } }, // C<>B
+    { { 115, -1 }, { 259, -1 }, { 287, -1 } }, // ST=F
+    { { 260, -1 }, { 213, -1 }, { 213, -1 } }, // A<B?
+    { { 261, -1 }, { 261, -1 }, { 261, -1 } }, // PRINT
+    { { 262, -1 }, { 193, -1 }, { 221, -1 } }, // FEXSB
+    { { 263, -1 }, { 301, -1 }, { 263, -1 } }, // SLSDA
+    { {  97, -1 }, { 264, -1 }, { 379, -1 } }, // ?BAT
+    { { 265, -1 }, { 134, -1 }, { 265, -1 } }, // SLSDB
+    { { 266, -1 }, { 226, -1 }, { 226, -1 } }, // CLRST
+    { { 182, -1 }, { 182, -1 }, { 267, -1 } }, // RSHFC
+    { { 166, -1 }, { 166, -1 }, { 268, -1 } }, // RSHFA
+    { { 269, -1 }, { 100,  3 }, { 419,  3 } }, // ?S3=1
+    { { 179, -1 }, { 179, -1 }, { 270, -1 } }, // RSHFB
+    { {  77, -1 }, { 271, -1 }, { 282,  5 } }, // ?EDAV
+    { { 272, -1 }, { 330, -1 }, { 272, -1 } }, // FLSDA
+    { { 273, -1 }, { 188, -1 }, { 188, -1 } }, // GOTO
+    { { 274, -1 }, { 338, -1 }, { 274, -1 } }, // FLSDB
+    { { 346, -1 }, { 275, -1 }, { 275, -1 } }, // C<>ST
+    { { 276, -1 }, { 347, -1 }, { 276, -1 } }, // FLSDC
+    { { 277, -1 }, { 100,  4 }, { 419,  4 } }, // ?S4=1
+    { { 176, -1 }, { 176, -1 }, { 278, -1 } }, // LDIS&X
+    { { 382, -1 }, { 414, -1 }, { 279, -1 } }, // R=R+1
+    { { 280, -1 }, { 408,  0 }, {  23,  0 } }, // S0=
+    { { 281, -1 }, { 408,  1 }, {  23,  1 } }, // S1=
+    { { 358, -1 }, { 114, -1 }, { 282, -1 } }, // ?FI=
+    { {  32, -1 }, { 283, -1 }, {  32, -1 } }, // RDA12L
+    { {  54, -1 }, { 423, -1 }, { 284, -1 } }, // R=R-1
+    { { 285, -1 }, { 100,  5 }, { 419,  5 } }, // ?S5=1
+    { { 149, -1 }, { 286, -1 }, { 282, 12 } }, // ?ALM
+    { { 115, -1 }, { 259, -1 }, { 287, -1 } }, // ST=T
+    { {  81, -1 }, { 128, -1 }, { 288, -1 } }, // ?CGO
+    { { 142, -1 }, { 289, -1 }, { 142, -1 } }, // WRA1L
+    { { 125, -1 }, { 290, -1 }, { 125, -1 } }, // RSCR
+    { { 348, -1 }, { 163, -1 }, { 291, -1 } }, // FETCHS&X
+    { { 292, -1 }, { 399, -1 }, { 282,  8 } }, // FRAV?
+    { { 293, -1 }, { 100,  6 }, { 419,  6 } }, // ?S6=1
+    { { 294, -1 }, { 408,  3 }, {  23,  3 } }, // S3=
+    { { 295, -1 }, {  16, -1 }, { 295, -1 } }, // SRLABC
+    { { 296, -1 }, { 408,  4 }, {  23,  4 } }, // S4=
+    { { 159, -1 }, { 297, -1 }, { 159, -1 } }, // WRB1L
+    { { 298, -1 }, { 298, -1 }, { 298, -1 } }, // RTN
+    { { 218, -1 }, { 299, -1 }, { 218, -1 } }, // RDB12L
+    { { 300, -1 }, { 408,  5 }, {  23,  5 } }, // S5=
+    { { 232, -1 }, { 301, -1 }, { 232, -1 } }, // WRA1R
+    { { 302, -1 }, { 408,  6 }, {  23,  6 } }, // S6=
+    { { 303, -1 }, {  58, -1 }, { 303, -1 } }, // SRLDA
+    { { 140, -1 }, { 304, -1 }, { 282, 11 } }, // ?TFAIL
+    { { 305, -1 }, {  95, -1 }, { 411, -1 } }, // RTNC
+    { { 306, -1 }, { 206, -1 }, { 306, -1 } }, // SRLDB
+    { { 307, -1 }, { 236, -1 }, { 307, -1 } }, // SRLDC
+    { { 308, -1 }, { 308, -1 }, { 308, -1 } }, // STWRIT
+    { { 185, -1 }, { 309, -1 }, { 185, -1 } }, // WRB1R
+    { {  59, -1 }, { 310, -1 }, {  59, -1 } }, // WRC1L
+    { { 311, -1 }, { 311, -1 }, {  50, -1 } }, // STK=C
+    { { 312, -1 }, { 408,  7 }, {  23,  7 } }, // S7=
+    { { 313, -1 }, {   8, -1 }, { 313, -1 } }, // SRLDAB
+    { { 314, -1 }, { 408, 11 }, {  23, 11 } }, // S11=
+    { {  19, -1 }, { 315, -1 }, {  19, -1 } }, // RDC12L
+    { { 316, -1 }, { 408, 12 }, {  23, 12 } }, // S12=
+    { { 317, -1 }, { 317, -1 }, { 317, -1 } }, // POWOFF
+    { { 318, -1 }, { 408, 13 }, {  23, 13 } }, // S13=
+    { { 319, -1 }, { 100,  0 }, { 419,  0 } }, // ?S0=1
+    { { 320, -1 }, { 209, -1 }, { 209, -1 } }, // ABEX
+    { {  79, -1 }, { 357, -1 }, { 321, -1 } }, // ?NCXQREL
+    { { 322, -1 }, { 100, 12 }, { 419, 12 } }, // ?S12=1
+    { {  32, -1 }, { 323, -1 }, {  32, -1 } }, // RTIME
+    { { 324, -1 }, { 100,  1 }, { 419,  1 } }, // ?S1=1
+    { { 325, -1 }, { 100,  2 }, { 419,  2 } }, // ?S2=1
+    { { 326, -1 }, { 100,  7 }, { 419,  7 } }, // ?S7=1
+    { { 327, -1 }, { 327, -1 }, { 327, -1 } }, // C=CORA
+    { { 328, -1 }, { 202, -1 }, { 202, -1 } }, // ACEX
+    { { 329, -1 }, { 209, -1 }, { 209, -1 } }, // BAEX
+    { { 272, -1 }, { 330, -1 }, { 272, -1 } }, // RDA1L
+    { { 331, -1 }, { 100,  8 }, { 419,  8 } }, // ?S8=1
+    { { 332, -1 }, { 100,  9 }, { 419,  9 } }, // ?S9=1
+    { {   0, -1 }, { 333, -1 }, {   0, -1 } }, // WRAB1L
+    { { 334, -1 }, { 408, 10 }, {  23, 10 } }, // S10=
+    { { 335, -1 }, { 335, -1 }, { 335, -1 } }, // POWON?
+    { {  -1, -1 }, {  -1, -1 }, {  -1, -1 } },
+    { { 337, -1 }, { 148, -1 }, { 337, -1 } }, // ENROM1
+    { { 274, -1 }, { 338, -1 }, { 274, -1 } }, // RDB1L
+    { { 339, -1 }, { 150, -1 }, { 339, -1 } }, // ENROM2
+    { { 340, -1 }, { 107, -1 }, { 417, -1 } }, // GOLNC
+    { { 341, -1 }, { 152, -1 }, { 341, -1 } }, // ENROM3
+    { { 368, -1 }, { 342, -1 }, { 368, -1 } }, // RDA1R
+    { { 343, -1 }, { 154, -1 }, { 343, -1 } }, // ENROM4
+    { { 344, -1 }, { 227, -1 }, { 227, -1 } }, // BCEX
+    { { 237, -1 }, { 345, -1 }, { 237, -1 } }, // WRAB1R
+    { { 346, -1 }, { 275, -1 }, { 275, -1 } }, // CSTEX
+    { { 276, -1 }, { 347, -1 }, { 276, -1 } }, // RDC1L
+    { { 348, -1 }, { 163, -1 }, { 291, -1 } }, // CXISA
+    { {  14, -1 }, { 349, -1 }, { 349, -1 } }, // C=KEY
+    { { 370, -1 }, { 350, -1 }, { 370, -1 } }, // RDB1R
+    { {  85, -1 }, { 351, -1 }, { 282,  6 } }, // ?IFCR
+    { { 413, -1 }, { 133, -1 }, { 352, -1 } }, // GOTOADR
+    { {  60, -1 }, { 353, -1 }, {  60, -1 } }, // WRAB6L
+    { { 354, -1 }, { 354, -1 }, { 354, -1 } }, // ?P=Q
+    { {  45, -1 }, { 355, -1 }, { 282,  1 } }, // ?CRDR
+    { { 356, -1 }, { 264, -1 }, { 379, -1 } }, // ?LLD
+    { {  79, -1 }, { 357, -1 }, { 321, -1 } }, // NCXQREL
+    { { 358, -1 }, { 114, -1 }, { 282, -1 } }, // FLG=1?
+    { { 359, -1 }, { 142, -1 }, { 359, -1 } }, // SRSDA
+    { { 360, -1 }, { 360, -1 }, { 360, -1 } }, // C=ST
+    { { 361, -1 }, { 167, -1 }, { 361, -1 } }, // SRSDB
+    { { 362, -1 }, { 168, -1 }, { 362, -1 } }, // RABCL
+    { { 363, -1 }, {  41, -1 }, { 249, -1 } }, // RTNNC
+    { { 364, -1 }, { 111, -1 }, { 364, -1 } }, // SRSDC
+    { {  76, -1 }, { 365, -1 }, {  76, -1 } }, // WRAB6R
+    { { 366, -1 }, {  58, -1 }, { 366, -1 } }, // WRTIME
+    { { 367, -1 }, { 371, -1 }, { 371, -1 } }, // DADD=C
+    { { 368, -1 }, { 342, -1 }, { 368, -1 } }, // FRSDA
+    { {  44, -1 }, { 369, -1 }, { 138, -1 } }, // C=REG
+    { { 370, -1 }, { 350, -1 }, { 370, -1 } }, // FRSDB
+    { { 367, -1 }, { 371, -1 }, { 371, -1 } }, // RAMSLCT
+    { { 372, -1 }, { 412, -1 }, { 207, -1 } }, // F=SB
+    { { 373, -1 }, { 373, -1 }, { 393, -1 } }, // WMLDL
+    { { 374, -1 }, { 181, -1 }, { 374, -1 } }, // RABCR
+    { {  24, -1 }, { 255, -1 }, { 375, -1 } }, // XQ>GO
+    { { 232, -1 }, { 376, -1 }, { 232, -1 } }, // ALMOFF
+    { { 377, -1 }, { 378, -1 }, { 377, -1 } }, // FRSDC
+    { { 377, -1 }, { 378, -1 }, { 377, -1 } }, // RDC1R
+    { {  97, -1 }, { 264, -1 }, { 379, -1 } }, // ?LOWBAT
+    { {  78, -1 }, { 380, -1 }, { 380, -1 } }, // ?KEY
+    { { 381, -1 }, { 161, -1 }, { 161, -1 } }, // RSTKB
+    { { 382, -1 }, { 414, -1 }, { 279, -1 } }, // INCPT
+    { { 244, -1 }, { 424, -1 }, { 383, -1 } }, // WRIT
+    { { 384, -1 }, {  20, -1 }, { 282,  9 } }, // FRNS?
+    { {   3, -1 }, { 204, -1 }, { 385, -1 } }, // ?CXQ
+    { { 386, -1 }, { 345, -1 }, { 386, -1 } }, // TCLCRD
+    { { 387, -1 }, { 206, -1 }, { 387, -1 } }, // WDTIME
+    { {  92, -1 }, { 388, -1 }, {  92, -1 } }, // WSCR
+    { { 139, -1 }, { 389, -1 }, { 139, -1 } }, // RSTS
+    { { 390, -1 }, { 390, -1 }, { 390, -1 } }, // U4KDEF
+    { { 391, -1 }, { 391, -1 }, { 391, -1 } }, // STARTC
+    { { 392, -1 }, { 242, -1 }, { 242, -1 } }, // CGEX
+    { { 373, -1 }, { 373, -1 }, { 393, -1 } }, // WROM
+    { {  15, -1 }, { 394, -1 }, { 394, -1 } }, // M<>C
+    { { 395, -1 }, {  83, -1 }, {  83, -1 } }, // C#0?
+    { { 396, -1 }, { 396, -1 }, { 396, -1 } }, // BUSY?
+    { { 397, -1 }, { 102, -1 }, { 400, -1 } }, // PFAD=C
+    { {   7, -1 }, { 398, -1 }, { 153, -1 } }, // PERTCT
+    { { 101, -1 }, { 399, -1 }, { 282,  8 } }, // ?FRAV
+    { { 397, -1 }, { 102, -1 }, { 400, -1 } }, // PRPHSLCT
+    { { 401, -1 }, { 401, -1 }, { 401, -1 } }, // HPIL=C
+    { { 402, -1 }, { 236, -1 }, { 402, -1 } }, // WRALM
+    { { 237, -1 }, { 403, -1 }, { 237, -1 } }, // TCLCTF
+    { { 404, -1 }, { 202, -1 }, { 202, -1 } }, // CAEX
+    { { 405, -1 }, { 227, -1 }, { 227, -1 } }, // CBEX
+    { { 406, -1 }, { 406, -1 }, { 104, -1 } }, // ?PT=
+    { { 407, -1 }, {   4, -1 }, { 407, -1 } }, // SRSABC
+    { {  -1, -1 }, { 408, -1 }, {  23, -1 } }, // CF
+    { {  32, -1 }, {  31, -1 }, { 409, -1 } }, // READDATA
+    { { 247, -1 }, { 410, -1 }, { 247, -1 } }, // ENDREAD
+    { { 305, -1 }, {  95, -1 }, { 411, -1 } }, // ?CRTN
+    { { 372, -1 }, { 412, -1 }, { 207, -1 } }, // F=ST
+    { { 413, -1 }, { 133, -1 }, { 352, -1 } }, // GOTOC
+    { { 382, -1 }, { 414, -1 }, { 279, -1 } }, // +PT
+    { { 143, -1 }, { 143, -1 }, { 415, -1 } }, // DSPOFF
+    { { 416, -1 }, {  94, -1 }, { 416, -1 } }, // RCTIME
+    { {  91, -1 }, { 107, -1 }, { 417, -1 } }, // ?NCGO
+    { { 175, -1 }, { 175, -1 }, { 418, -1 } }, // C=0-C
+    { { 135, -1 }, { 100, -1 }, { 419, -1 } }, // ?FSET
+    { { 251, -1 }, { 420, -1 }, { 251, -1 } }, // RDAB1L
+    { { 421, -1 }, { 200, -1 }, { 200, -1 } }, // GOKEYS
+    { { 422, -1 }, { 173, -1 }, {  64, -1 } }, // GOSUB
+    { {  54, -1 }, { 423, -1 }, { 284, -1 } }, // -PT
+    { { 244, -1 }, { 424, -1 }, { 383, -1 } }  // REG=C
+};
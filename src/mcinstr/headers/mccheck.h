@@ -0,0 +1,66 @@
+#if !defined(__MCCHECK_H__)
+#define __MCCHECK_H__
+
+#include <stddef.h>
+
+// Checks of MCODE source lines without assembling them.
+//
+// inst_check_line() reads a line the way mcodeasm does: an optional
+// listing prefix and label, then a directive, a code literal or an
+// instruction. It looks up the mnemonic in all instruction sets and
+// checks the operand against the domain of the operand type (see
+// mcop.h), with the messages of mcodeasm. Labels are checked for their
+// form only and their places are returned for a label index (see
+// mclabel.h); nothing depends on other lines: whether the mnemonic
+// is part of the instruction set in effect is left to the caller, who
+// follows the set directives. Numbers are parsed without a branch per
+// digit, so a check costs about as much as the hash lookup of the
+// mnemonic.
+
+#define CHECK_OK                        0
+#define CHECK_UNKNOWN_MNEMONIC          1
+#define CHECK_FIELD_EXPECTED            2
+#define CHECK_NUMBER_EXPECTED           3
+#define CHECK_OUT_OF_RANGE              4
+#define CHECK_REGISTER_EXPECTED         5
+#define CHECK_DISPLACEMENT_EXPECTED     6
+#define CHECK_ADDRESS_EXPECTED          7
+#define CHECK_INVALID_LABEL             8
+#define CHECK_HEX3_EXPECTED             9
+#define CHECK_CODE_EXPECTED             10
+#define CHECK_UNEXPECTED_TEXT           11
+#define CHECK_LABEL_EXPECTED            12
+#define CHECK_COUNT                     13
+
+struct inst_check_t {
+    int code;           // CHECK_* of the first problem
+    int start;          // its text in bytes
+    int length;
+    int inst;           // inst[] index of the instruction, -1 if none
+    int word_start;     // the mnemonic in bytes, -1 if there is none
+    int word_length;
+    int set;            // SET_* selected by a directive, or 0
+    int label_start;    // label the line defines in bytes, with its
+    int label_length;   // brackets, -1 if none
+    int target_start;   // label of the operand, -1 if none
+    int target_length;
+};
+
+typedef struct inst_check_t inst_check;
+
+extern const char *const inst_check_messages[CHECK_COUNT];
+
+// Checks len bytes of line, without the line end. Returns the code.
+int inst_check_line(const char *line, size_t len, inst_check *result);
+
+// Writes the message of a result for the line it came from to buf, as
+// mcodeasm words it, e.g. "unknown mnemonic XYZ". Returns its length.
+int inst_check_format(const inst_check *result, const char *line, size_t len, char *buf, size_t size);
+
+// Checks the operand text of an instruction of operand type typ
+// (MCODE_OP_*), from its first character up to the end of the line or
+// a comment. Returns the code; start and length of result are set if
+// it is not CHECK_OK, target_start and target_length relative to text.
+int inst_check_operand(int typ, const char *text, size_t len, inst_check *result);
+
+#endif // !defined(__MCCHECK_H__)
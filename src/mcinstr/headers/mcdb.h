@@ -0,0 +1,142 @@
+#if !defined(__MCDB_H__)
+#define __MCDB_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Binary instruction database.
+//
+// One image of inst[] together with the views that the tools derive
+// from it at startup: a name index, an opcode index, lists per
+// instruction set and per operand type (and both), and the operand
+// descriptions, all strings interned in one table. mcinstrgen db writes
+// the image at build time; mcdb_open() maps it and uses it in place, so
+// a tool starts without building or sorting anything.
+//
+// Layout: the header at offset 0, then the tables it points to. Every
+// number has a fixed width, every offset counts from the start of the
+// image and every table is aligned to 4 bytes, so other languages can
+// read the image with plain struct unpacking over an mmap. Numbers are
+// in the byte order of the host that built the image; byte_order reads
+// as MCDB_BYTE_ORDER there, mcdb_open() rejects an image built for the
+// other one. Readers check the version and reject images they do not
+// know. inst_hash identifies the inst[] and operand types the image
+// was built from; mcdb_open() rejects an image of another inst[] than
+// the one the program is linked with, so a stale file left over from
+// an earlier build is never used.
+//
+// A list is a run of 16-bit record numbers in the list area. Record
+// numbers are inst[] indexes, so empty inst[] slots have a record with
+// an empty name; lists never contain them. Lists per set and per type
+// are in match order, longest name first and then by name, which is
+// the order alternations of mnemonics must be tried in. The name index
+// is sorted by strcmp() for binary search, the opcode lists are in
+// inst[] order.
+
+#define MCDB_MAGIC          "MCDB"
+#define MCDB_VERSION        2
+#define MCDB_BYTE_ORDER     0x0102
+#define MCDB_SET_COUNT      3           // HP, JDA, ZENCODE
+#define MCDB_OPCODE_COUNT   0x400
+#define MCDB_FILE_NAME      "mcinstr.db"
+
+struct mcdb_list_t {
+    uint32_t offset;                    // first record number in the list area
+    uint32_t count;
+};
+
+typedef struct mcdb_list_t mcdb_list;
+
+struct mcdb_inst_t {
+    uint32_t name;                      // offset in the string table
+    uint16_t tyte[3];
+    uint8_t set;                        // SET_*
+    char typ;                           // MCODE_OP_*
+};
+
+typedef struct mcdb_inst_t mcdb_inst;
+
+struct mcdb_type_t {
+    char typ;                           // MCODE_OP_*
+    uint8_t reserved[3];
+    uint32_t operand;                   // description, offset in the string table
+    mcdb_list mnemonics;                // all sets
+    mcdb_list sets[MCDB_SET_COUNT];     // per set
+};
+
+typedef struct mcdb_type_t mcdb_type;
+
+struct mcdb_header_t {
+    char magic[4];
+    uint16_t version;
+    uint16_t byte_order;
+    uint32_t size;                      // of the whole image
+    uint32_t inst_hash;                 // mcdb_inst_hash() of the builder
+    uint32_t inst_count;
+    uint32_t insts;                     // mcdb_inst[inst_count]
+    uint32_t type_count;
+    uint32_t types;                     // mcdb_type[type_count]
+    uint32_t opcodes;                   // mcdb_list[MCDB_OPCODE_COUNT], by tyte1
+    mcdb_list names;
+    mcdb_list sets[MCDB_SET_COUNT];
+    uint32_t lists;                     // uint16_t[]
+    uint32_t list_size;                 // in entries
+    uint32_t strings;                   // NUL-terminated strings
+    uint32_t string_size;               // in bytes
+};
+
+typedef struct mcdb_header_t mcdb_header;
+
+struct mcdb_t {
+    const unsigned char *base;
+    size_t size;
+    const mcdb_header *header;
+    int mapped;                         // base was mapped, not allocated
+};
+
+typedef struct mcdb_t mcdb;
+
+// Maps an image written by mcinstrgen db and checks that all its tables
+// and strings are within the file and that it was built from the linked
+// inst[]. Returns 0 or -1 with errno set (EINVAL if the image is not
+// valid or was built from another inst[]).
+int mcdb_open(mcdb *db, const char *path);
+
+// Builds the image of the inst[] the program is linked with in memory,
+// for tools that run without an image file. Returns 0 or -1.
+int mcdb_build(mcdb *db);
+
+// Opens the image at path or, without a path, the MCDB_FILE_NAME that
+// ./gradlew generateDb writes into the build directory: it is looked
+// for next to the program (argv0) and two directories up, where
+// build/exe/<tool>/<tool> finds build/mcinstr.db. Only if there is no
+// such file, or if it was built from another inst[], is the image built
+// in memory. Returns 0 or -1 with errno set.
+int mcdb_load(mcdb *db, const char *path, const char *argv0);
+
+// FNV-1a hash of the fields of inst[] and of the operand types that
+// go into an image.
+uint32_t mcdb_inst_hash(void);
+
+void mcdb_close(mcdb *db);
+
+// Writes the image of inst[]. Returns 0 or -1.
+int mcdb_write(FILE *out);
+
+const mcdb_inst *mcdb_get(const mcdb *db, int record);
+const char *mcdb_string(const mcdb *db, uint32_t offset);
+const uint16_t *mcdb_items(const mcdb *db, const mcdb_list *list);
+
+// Returns the record of the mnemonic if it is part of one of the given
+// instruction sets (SET_*), or -1.
+int mcdb_find(const mcdb *db, const char *name, int set);
+
+// Returns the entry of the operand type, or NULL.
+const mcdb_type *mcdb_find_type(const mcdb *db, int typ);
+
+// Instructions with the first word tyte1 in inst[] order, that is with
+// the given opcode and an empty operand field.
+const mcdb_list *mcdb_opcode(const mcdb *db, int tyte1);
+
+#endif // !defined(__MCDB_H__)
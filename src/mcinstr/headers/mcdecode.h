@@ -0,0 +1,43 @@
+#if !defined(__MCDECODE_H__)
+#define __MCDECODE_H__
+
+// Decode table for the 1024 possible first words of an instruction.
+//
+// inst_decode[word][set] holds the preferred instruction for a 10-bit
+// word in each instruction set: its index in inst[], the bits of the
+// word that carry the operand, and the length of the instruction in
+// words. All matching instructions are listed in inst_decode_candidates
+// from inst_decode_offset[word] to inst_decode_offset[word + 1].
+//
+// The tables are generated by mcinstrgen (see mcdecodetab.c). Pseudo
+// instructions without an encoding of their own (CON, XROM, FCNS and
+// the DEF*/U*KDEF page directives) are not part of the tables.
+
+#define INST_WORD_COUNT     0x400
+#define INST_SET_COUNT      3       // HP, JDA, ZENCODE
+
+struct inst_decode_t {
+    short index;            // index in inst[], -1 if the word is undefined
+    unsigned short mask;    // operand bits in the first word
+    unsigned char shift;    // position of the operand bits
+    unsigned char words;    // number of words including the first
+    char typ;               // MCODE_OP_*
+};
+
+typedef struct inst_decode_t inst_decode_entry;
+
+extern const inst_decode_entry inst_decode[INST_WORD_COUNT][INST_SET_COUNT];
+extern const short inst_decode_offset[INST_WORD_COUNT + 1];
+extern const short inst_decode_candidates[];
+
+// encoding of the digits 0 to 13 in bits 9-6 (flags, pointer, RCR)
+extern const unsigned char inst_digit_code[14];
+
+// field names of the TEF codes 0 to 7 per instruction set
+extern const char *const inst_tef_names[INST_SET_COUNT][8];
+
+int inst_set_index(int set);
+int inst_decode_field(int typ, unsigned short *mask, unsigned char *shift, unsigned char *words);
+int inst_decode_operand(const inst_decode_entry *entry, int word, int *value);
+
+#endif // !defined(__MCDECODE_H__)
@@ -0,0 +1,24 @@
+#if !defined(__MCHASH_H__)
+#define __MCHASH_H__
+
+// Perfect hash over the mnemonic names in inst[].
+//
+// The tables are generated by mcinstrgen (see mchash.c). A name is
+// first hashed into one of INST_PHASH_BUCKETS buckets. The bucket's
+// displacement either is the slot itself (negative values, -slot-1) or
+// the seed of a second hash that yields the slot. Each of the IHT_SIZE
+// slots holds at most one inst[] index, so a lookup costs two hashes
+// and a single string compare.
+//
+// Mnemonic names are unique across all instruction sets, therefore the
+// set only has to be checked against the entry that was found.
+
+#define INST_PHASH_BUCKETS  256
+
+extern const short inst_phash_displacement[INST_PHASH_BUCKETS];
+extern const short inst_phash_index[];
+
+unsigned int inst_phash(const char *name, unsigned int seed);
+int inst_phash_slot(const char *name);
+
+#endif // !defined(__MCHASH_H__)
@@ -0,0 +1,75 @@
+#if !defined(__MCIMAGE_H__)
+#define __MCIMAGE_H__
+
+#include <stddef.h>
+
+// ROM images of 10-bit words.
+//
+// Two formats are read and written:
+//
+//     IMAGE_ROM   4 words packed into 5 bytes, the first word in the
+//                 high bits (.rom dumps)
+//     IMAGE_BIN   one 16-bit big-endian word per 2 bytes (.bin)
+//
+// image_unpack() and image_pack() convert between the bytes of a format
+// and an array of words. Both have a scalar kernel and kernels for SSE2
+// and AVX2 on x86, picked at the first call by what the processor
+// supports. Unpacking the ROM format needs a byte shuffle, which SSE2
+// does not have, so it uses the scalar kernel below AVX2.
+//
+// image_open() maps an image file read-only, so the words are unpacked
+// from the file itself, a page at a time or all at once, without a copy
+// of the file in between.
+
+#define IMAGE_ROM       0
+#define IMAGE_BIN       1
+
+#define IMAGE_SCALAR    0
+#define IMAGE_SSE2      1
+#define IMAGE_AVX2      2
+
+struct image_view_t {
+    const unsigned char *data;
+    size_t size;                // in bytes
+    size_t words;               // whole words in the file
+    int format;                 // IMAGE_*
+    int mapped;                 // data was mapped, not allocated
+};
+
+typedef struct image_view_t image_view;
+
+// Returns IMAGE_BIN for names ending in .bin, IMAGE_ROM otherwise.
+int image_format(const char *path);
+
+// Number of whole words in size bytes and number of bytes of count
+// words, a ROM group of 4 words counting in full.
+size_t image_words(size_t size, int format);
+size_t image_bytes(size_t count, int format);
+
+// Unpacks count words from the bytes of a format, which start at a
+// group of 4 words in the ROM format.
+void image_unpack(const unsigned char *bytes, int format, size_t count, unsigned short *words);
+
+// Packs count words into image_bytes(count, format) bytes. Words above
+// 3FF are cut to 10 bits; a last ROM group is filled with zero words.
+void image_pack(const unsigned short *words, size_t count, int format, unsigned char *bytes);
+
+// Returns the kernel in use (IMAGE_SCALAR, IMAGE_SSE2 or IMAGE_AVX2).
+int image_kernel(void);
+
+// Selects a kernel, for comparisons. Returns 0, or -1 if the processor
+// or the build does not support it.
+int image_set_kernel(int kernel);
+
+// Maps an image file of a format (-1 for image_format() of the path).
+// Returns 0 or -1 with errno set.
+int image_open(image_view *view, const char *path, int format);
+
+void image_close(image_view *view);
+
+// Unpacks count words of a view from word first on, which is a multiple
+// of 4 in the ROM format. Returns the number of words, less than count
+// at the end of the file.
+size_t image_read(const image_view *view, size_t first, size_t count, unsigned short *words);
+
+#endif // !defined(__MCIMAGE_H__)
@@ -20,6 +20,11 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #define INAME_SIZE 9
 #define IHT_SIZE 425
 
+#define SET_HP      0x1
+#define SET_JDA     0x2
+#define SET_ZENCODE 0x4
+#define SET_ALL     (SET_HP|SET_JDA|SET_ZENCODE)
+
 /*------------------------------ PUBLIC STRUCTS -----------------------------*/
 extern struct inst_type
   {
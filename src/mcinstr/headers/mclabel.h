@@ -0,0 +1,138 @@
+#if !defined(__MCLABEL_H__)
+#define __MCLABEL_H__
+
+#include <stddef.h>
+
+// Label index of a ROM project.
+//
+// Records where the labels of all source files of a project are defined
+// and referenced, scoped the way mcodeasm resolves them: a local label
+// (name) belongs to its file, a global label [name] to all files. The
+// names are interned in a hash table, open addressing like the symbol
+// table of mcodeasm, with their scope and the number of definitions and
+// references in the project. Every file keeps its label sites in line
+// order.
+//
+// A file is updated on its own by replacing its sites. Only the sites
+// between the unchanged ones at the start and the end of the list are
+// counted again, so an edit costs the length of the list of one file
+// and nothing for the others. The sites of a name are found by going
+// through the lists of all files, a few ints per label.
+//
+// The index can be saved to a file and loaded again, with the size and
+// modification time each source file had when it was read. A tool that
+// loads it reads only the files whose stamp changed since and keeps the
+// sites of the others, so a project is not scanned again from scratch.
+
+#define LABEL_GLOBAL        (-1)    // scope of [name]
+
+#define LABEL_DEFINITION    0
+#define LABEL_REFERENCE     1
+
+struct label_site_t {
+    int name;           // index in names
+    int kind;           // LABEL_DEFINITION or LABEL_REFERENCE
+    int line;           // from 0
+    int start;          // the label with its brackets in bytes
+    int length;
+};
+
+struct label_name_t {
+    const char *name;   // without brackets
+    unsigned int hash;
+    int scope;          // file index or LABEL_GLOBAL
+    int definitions;
+    int references;
+    int before;         // definitions before an update, -1 outside
+};
+
+struct label_stamp_t {
+    long long size;     // of the source file in bytes
+    long long time;     // modified, -1 if the sites are not from the file
+};
+
+struct label_file_t {
+    char *path;
+    struct label_site_t *sites;
+    int count;
+    int size;
+    struct label_stamp_t stamp;
+    int state;          // of the tool, saved with the stamp
+};
+
+struct label_block_t;
+
+struct label_index_t {
+    struct label_name_t *names;
+    int name_count;
+    int name_size;
+    int *slots;         // name index + 1, 0 if free
+    int slot_count;
+    struct label_block_t *blocks;
+    struct label_file_t *files;
+    int file_count;
+    int file_size;
+    unsigned long resolution;   // counts the names that changed between
+};                              // undefined, defined and defined twice
+
+typedef struct label_site_t label_site;
+typedef struct label_stamp_t label_stamp;
+typedef struct label_name_t label_name;
+typedef struct label_file_t label_file;
+typedef struct label_index_t label_index;
+
+typedef void (*label_visit)(void *user, int file, const label_site *site);
+
+void label_index_init(label_index *index);
+void label_index_free(label_index *index);
+
+// Returns the file with the path (or URI), which is added without sites
+// if it is new, or -1 if memory ran out.
+int label_index_file(label_index *index, const char *path);
+
+// Returns the file with the path or -1.
+int label_index_find_file(const label_index *index, const char *path);
+
+// Interns a label written with its brackets in file. Returns the index
+// of its name, or -1 if it is no label or memory ran out.
+int label_index_intern(label_index *index, int file, const char *label, size_t len);
+
+// Returns the name of a label written in file, or -1 if it was never
+// interned.
+int label_index_lookup(const label_index *index, int file, const char *label, size_t len);
+
+// Replaces the sites of a file by count sites in line order. Returns 0
+// or -1 if memory ran out, in which case the file is left unchanged.
+int label_index_set_sites(label_index *index, int file, const label_site *sites, int count);
+
+// Replaces the sites of a file by those in len bytes of source text.
+// Returns 0 or -1 if memory ran out.
+int label_index_scan(label_index *index, int file, const char *text, size_t len);
+
+// Calls visit for the sites of a name of one kind, or of both kinds
+// with kind -1, file by file.
+void label_index_sites(const label_index *index, int name, int kind, label_visit visit, void *user);
+
+// Calls visit for the references to names without a definition and for
+// the definitions of names defined more than once, file by file.
+void label_index_problems(const label_index *index, label_visit visit, void *user);
+
+// Gets the stamp of a source file before it is read. A file modified in
+// the current second gets time -1, since it may change again within the
+// second. Returns 0 or -1 if the file cannot be found.
+int label_index_stamp(const char *path, label_stamp *stamp);
+
+// Returns 1 if the sites of a file were read from the file with the
+// stamp, 0 otherwise.
+int label_index_current(const label_index *index, int file, const label_stamp *stamp);
+
+// Writes the files with a stamp and their sites to path. Returns 0 or
+// -1 with errno set.
+int label_index_save(const label_index *index, const char *path);
+
+// Loads the files of a saved index into an empty index. Returns 0 or -1
+// with errno set, EINVAL if the file is no label index; the index is
+// empty then.
+int label_index_load(label_index *index, const char *path);
+
+#endif // !defined(__MCLABEL_H__)
@@ -0,0 +1,119 @@
+#if !defined(__MCMOD_H__)
+#define __MCMOD_H__
+
+#include <stdio.h>
+
+#include "mcimage.h"
+
+// MOD files, the module container of HP-41 emulators and archives.
+//
+// A MOD1 file is a header of MOD_HEADER_SIZE bytes with the module
+// description and the number of pages, followed by one record of
+// MOD_RECORD_SIZE bytes per page. A record holds the name and ROM id of
+// the page, where it goes (page, bank, groups), its flags and the 4K
+// words of the page, 4 words packed into 5 bytes with the first word in
+// the low bits (unlike the .rom dumps of mcimage.h).
+//
+// mod_open() maps the file and checks only the signature and that the
+// size matches the number of pages. The header fields are read by
+// mod_header(), a page record is read and checked by mod_page_get() when
+// it is asked for; its words stay in the mapping until mod_read()
+// unpacks them. Opening allocates nothing beyond the mapping, however
+// many pages the file has.
+//
+// mod_create(), mod_write() and mod_finish() write a file a page at a
+// time; the number of pages goes into the header at the end.
+
+#define MOD_SIGNATURE       "MOD1"
+#define MOD_HEADER_SIZE     729
+#define MOD_RECORD_SIZE     5188
+#define MOD_PAGE_WORDS      0x1000
+#define MOD_MAX_PAGES       255
+
+// Page numbers above 0xF place a page relative to the other pages of
+// its page group instead of at a fixed page.
+#define MOD_POSITION_ANY        0x1F    // any port page, 8 to F
+#define MOD_POSITION_LOWER      0x2F    // lower page of a port
+#define MOD_POSITION_UPPER      0x3F    // upper page of a port
+#define MOD_POSITION_EVEN       0x4F    // 8, A, C or E
+#define MOD_POSITION_ODD        0x5F    // 9, B, D or F
+#define MOD_POSITION_ORDERED    0x6F    // in file order
+
+struct mod_info_t {
+    char title[51];
+    char version[11];
+    char part_number[21];
+    char author[51];
+    char copyright[101];
+    char license[201];
+    char comments[256];
+    int category;
+    int hardware;
+    int mem_modules;                // main memory modules, 0 to 4
+    int xmem_modules;               // extended memory modules, 0 to 3
+    int original;                   // images as on the original ROMs
+    int app_auto_update;
+    int pages;
+};
+
+struct mod_page_t {
+    char name[21];                  // usually the name of the .rom file
+    char id[10];                    // ROM id, like PRT1B
+    int page;                       // 0 to F or MOD_POSITION_*
+    int page_group;                 // 0 or 1 to 8
+    int bank;                       // 1 to 4
+    int bank_group;                 // 0 or 1 to 8
+    int port;                       // 1 to 4 for pages 8 to F, 0 otherwise
+    int ram;
+    int write_protect;
+    int fat;                        // has a function address table
+    const unsigned char *image;     // packed words in the mapping
+};
+
+struct mod_file_t {
+    image_view view;
+    int pages;
+};
+
+struct mod_writer_t {
+    FILE *file;
+    int pages;
+};
+
+typedef struct mod_info_t mod_info;
+typedef struct mod_page_t mod_page;
+typedef struct mod_file_t mod_file;
+typedef struct mod_writer_t mod_writer;
+
+// Returns 1 for names ending in .mod, 0 otherwise.
+int mod_path(const char *path);
+
+// Maps a MOD file. Returns 0 or -1 with errno set (EINVAL if it is not
+// a MOD1 file or its size does not match its pages).
+int mod_open(mod_file *mod, const char *path);
+
+void mod_close(mod_file *mod);
+
+// Copies the header fields, the strings terminated.
+void mod_header(const mod_file *mod, mod_info *info);
+
+// Reads the record of page index (0 to mod->pages - 1). Returns 0, or
+// -1 if its page, bank or flags are out of range.
+int mod_page_get(const mod_file *mod, int index, mod_page *page);
+
+// Unpacks the MOD_PAGE_WORDS words of a page.
+void mod_read(const mod_page *page, unsigned short *words);
+
+// Creates a MOD file with the header fields of info (its pages are
+// counted by mod_write()). Returns 0 or -1 with errno set.
+int mod_create(mod_writer *writer, const char *path, const mod_info *info);
+
+// Appends a page with the fields of page and MOD_PAGE_WORDS words.
+// Returns 0 or -1 with errno set.
+int mod_write(mod_writer *writer, const mod_page *page, const unsigned short *words);
+
+// Writes the number of pages and closes the file. Returns 0 or -1 with
+// errno set; the file is closed either way.
+int mod_finish(mod_writer *writer);
+
+#endif // !defined(__MCMOD_H__)
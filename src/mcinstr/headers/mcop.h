@@ -0,0 +1,107 @@
+#if !defined(__MCOP_H__)
+#define __MCOP_H__
+
+#include "mcdecode.h"
+
+// MCODE operand types as used in A41
+// A: no operand
+// D: TEF
+// E: 0 to 13 (dec)
+// F: 0 to F (hex)
+// G: +0 to +63 and -1 to -64 (dec)
+// H: 0000 to FFFF (hex)
+// I: 0000 to FFFF (hex)
+// J: 1 to 31 (dec)
+// K: no operand
+// L: 0 to 7
+// M: 000 to FFF (hex)
+// N: TEF
+// O: 0000 to FFFF (hex)
+// P: 0 to 64 (dec)
+// Q: 000 to 3FF (hex)
+// R: ???
+// S: 0000 to FFFF (hex)
+// T: 0000 to FFFF (hex)
+// U: no operand
+// ?: no operand
+//
+#define MCODE_OP_NONE1          'A'
+#define MCODE_OP_TEF1           'D'
+#define MCODE_OP_0_TO_13_DEC    'E'
+#define MCODE_OP_0_TO_F_HEX     'F'
+#define MCODE_OP_DISPLACEMENT   'G'
+#define MCODE_OP_ADDRESS1       'H'
+#define MCODE_OP_ADDRESS2       'I'
+#define MCODE_OP_1_TO_31_DEC    'J'
+#define MCODE_OP_NONE2          'K'
+#define MCODE_OP_0_TO_7         'L'
+#define MCODE_OP_000_TO_FFF_HEX 'M'
+#define MCODE_OP_TEF2           'N'
+#define MCODE_OP_ADDRESS3       'O'
+#define MCODE_OP_0_TO_64_DEC    'P'
+#define MCODE_OP_000_TO_3FF_HEX 'Q'
+#define MCODE_OP_UNKNOWN        'R'
+#define MCODE_OP_ADDRESS4       'S'
+#define MCODE_OP_ADDRESS5       'T'
+#define MCODE_OP_NONE3          'U'
+#define MCODE_OP_NONE4          '?'
+
+// all operand types, in the order of the index tables
+#define MCODE_OP_TYPES          "ADEFGHIJKLMNOPQRSTU?"
+#define MCODE_OP_TYPE_COUNT     20
+
+// Indexes of inst[] by operand type and instruction set.
+//
+// The tables are generated by mcinstrgen (see mcoptab.c). The inst[]
+// indexes of operand type t are mnemonic_type_list[mnemonic_type_offset[t]]
+// up to mnemonic_type_list[mnemonic_type_offset[t + 1]], those of type t
+// in set s (inst_set_index()) are listed the same way in
+// mnemonic_type_set_list at t * INST_SET_COUNT + s. Both are in inst[]
+// order. The bitsets over inst[] per type and per set answer
+// combinations of types and sets with a few word operations. Include
+// mcinstr.h before this header.
+
+#define MNEMONIC_BITSET_WORDS   ((IHT_SIZE + 31) / 32)
+
+extern const short mnemonic_type_offset[MCODE_OP_TYPE_COUNT + 1];
+extern const short mnemonic_type_list[];
+extern const short mnemonic_type_set_offset[MCODE_OP_TYPE_COUNT * INST_SET_COUNT + 1];
+extern const short mnemonic_type_set_list[];
+extern const unsigned int mnemonic_type_bits[MCODE_OP_TYPE_COUNT][MNEMONIC_BITSET_WORDS];
+extern const unsigned int mnemonic_set_bits[INST_SET_COUNT][MNEMONIC_BITSET_WORDS];
+
+struct mnemonic_bitset_t {
+    unsigned int bits[MNEMONIC_BITSET_WORDS];
+};
+
+typedef struct mnemonic_bitset_t mnemonic_bitset;
+
+// Iterates over the mnemonics of one operand type in inst[] order, in
+// all sets or in one (SET_HP, SET_JDA or SET_ZENCODE). Each step costs
+// O(1), an unknown type or set yields no mnemonics.
+struct mnemonic_operand_it_t {
+    char operand_type;
+    int index;              // in inst[] of the last mnemonic returned
+    const short *next;      // rest of the index list
+    const short *end;
+};
+
+typedef struct mnemonic_operand_it_t mnemonic_operand_it;
+
+const char *mnemonic_operand_first(mnemonic_operand_it *it, int operand_type);
+const char *mnemonic_operand_set_first(mnemonic_operand_it *it, int operand_type, int set);
+const char *mnemonic_operand_next(mnemonic_operand_it *it);
+
+// Returns the position of the operand type in MCODE_OP_TYPES, or -1.
+int mnemonic_type_index(int operand_type);
+
+// Selects the mnemonics with one of the given operand types (any type
+// if NULL) in one of the given sets (SET_*), e.g. all JDA mnemonics with
+// a TEF operand: mnemonic_select(&b, "DN", SET_JDA).
+void mnemonic_select(mnemonic_bitset *result, const char *operand_types, int set);
+
+// Returns the first inst[] index in the bitset after index, or -1.
+// Start with -1.
+int mnemonic_bitset_next(const mnemonic_bitset *b, int index);
+
+#endif // !defined(__MCOP_H__)
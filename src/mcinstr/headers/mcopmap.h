@@ -0,0 +1,53 @@
+#if !defined(__MCOPMAP_H__)
+#define __MCOPMAP_H__
+
+#include <stdint.h>
+
+#include "mcdb.h"
+
+// Binary opcode map, written by mcodecvs -f bin.
+//
+// The same rows as the CSV output of mcodecvs: one per opcode (first
+// word with an empty operand field) and operand type, with the
+// mnemonics of each instruction set. A tool maps the file and reads the
+// rows in place instead of parsing text.
+//
+// Layout: the header at offset 0, then the rows, the name lists and the
+// string table. As in mcdb.h every number has a fixed width, offsets
+// count from the start of the file, tables are aligned to 4 bytes and
+// numbers are in the byte order of the host that wrote the file;
+// byte_order reads as MCOPMAP_BYTE_ORDER there. Rows are ordered by
+// code, then by operand type in the order of the mcdb type table. The
+// names of a row per set are a run of string offsets in the name area,
+// in inst[] order; the strings are NUL-terminated.
+
+#define MCOPMAP_MAGIC       "MCOM"
+#define MCOPMAP_VERSION     1
+#define MCOPMAP_BYTE_ORDER  0x0102
+
+struct mcopmap_row_t {
+    uint16_t code;                      // tyte1
+    char typ;                           // MCODE_OP_*
+    uint8_t reserved;
+    uint32_t operand;                   // description, offset in the string table
+    mcdb_list sets[MCDB_SET_COUNT];     // HP, JDA, ZENCODE, in the name area
+};
+
+typedef struct mcopmap_row_t mcopmap_row;
+
+struct mcopmap_header_t {
+    char magic[4];
+    uint16_t version;
+    uint16_t byte_order;
+    uint32_t size;                      // of the whole file
+    uint32_t row_count;
+    uint32_t rows;                      // mcopmap_row[row_count]
+    uint32_t name_count;
+    uint32_t names;                     // uint32_t[name_count], string offsets
+    uint32_t strings;                   // NUL-terminated strings
+    uint32_t string_size;               // in bytes
+};
+
+typedef struct mcopmap_header_t mcopmap_header;
+
+#endif // !defined(__MCOPMAP_H__)
@@ -0,0 +1,50 @@
+#if !defined(__MCTRANS_H__)
+#define __MCTRANS_H__
+
+#include <stddef.h>
+
+#include "mcdecode.h"
+
+// Translation of MCODE source lines between the mnemonics of the HP,
+// JDA and ZENCODE instruction sets.
+//
+// inst_translation[i][s] is the name that mnemonic i has in set s
+// (inst_set_index()): i itself if it belongs to the set, otherwise the
+// mnemonic of the set with the same opcode words and operand type. A
+// few HP mnemonics name a flag in the mnemonic (?F3=1, S3=) where the
+// other sets take it as operand; they translate to that mnemonic and
+// the digit. The table is generated by mcinstrgen (see mctranstab.c),
+// so a line costs one hash lookup of its mnemonic and one table read.
+//
+// inst_translate_line() reads a line the way mcodeasm does and replaces
+// the mnemonic, the field names of TEF operands and the set directives
+// .HP, .JDA and .ZENCODE. Everything else is copied: listing prefixes,
+// labels, operands, comments and the white space between them. Where a
+// name changes length, the spaces after it shrink or grow so that the
+// following columns stay where they were (at least one space remains).
+// Include mcinstr.h before this header.
+
+#define TRANSLATE_OK        0
+#define TRANSLATE_UNKNOWN   1       // mnemonic not in the current set
+#define TRANSLATE_MISSING   2       // no mnemonic in the target set
+#define TRANSLATE_LONG      3       // line longer than the output
+
+struct inst_translation_entry_t {
+    short index;            // in inst[], -1 if the set has no name for it
+    signed char operand;    // digit to add as operand, or -1
+};
+
+typedef struct inst_translation_entry_t inst_translation_entry;
+
+extern const inst_translation_entry inst_translation[IHT_SIZE][INST_SET_COUNT];
+
+// Translates len bytes of line, without the line end, from the set in
+// effect *set (SET_*) to set to, into out (at least len + 1 bytes, the
+// longer names need up to 16 more). A set directive changes *set. The
+// line is copied unchanged if it cannot be translated. Returns the
+// length of the output; *status is TRANSLATE_*, *start and *length
+// the mnemonic of a problem.
+size_t inst_translate_line(const char *line, size_t len, int *set, int to, char *out, size_t size,
+    int *status, int *start, int *length);
+
+#endif // !defined(__MCTRANS_H__)
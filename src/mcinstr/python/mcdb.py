@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""Reads the binary instruction database in place.
+
+The image that mcinstrgen db writes (see src/mcinstr/headers/mcdb.h) is
+mapped and read with struct unpacking where it lies, nothing is parsed
+or copied up front. A Pygments lexer, for example, takes the mnemonics
+of a set in match order from it instead of a list of its own:
+
+    with mcdb.Database('build/mcinstr.db') as db:
+        mnemonics = words(db.mnemonics(mcdb.SET_HP), suffix=r'\\b')
+
+Run as a script, it prints the number of mnemonics per set and type.
+"""
+
+import mmap
+import struct
+import sys
+
+MAGIC = b'MCDB'
+VERSION = 2
+BYTE_ORDER = 0x0102
+SET_COUNT = 3
+OPCODE_COUNT = 0x400
+
+SET_HP = 1
+SET_JDA = 2
+SET_ZENCODE = 4
+SET_ALL = SET_HP | SET_JDA | SET_ZENCODE
+SETS = (SET_HP, SET_JDA, SET_ZENCODE)
+
+# mcdb_header, mcdb_inst, mcdb_type and mcdb_list without byte order
+HEADER = '4sHHIIIIIIIII' + 'II' * SET_COUNT + 'IIII'
+INST = 'I3HBc'
+TYPE = 'c3xI' + 'II' * (1 + SET_COUNT)
+LIST = 'II'
+
+
+class Database:
+    """A mapped image; the lists are inst[] record numbers."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        order = struct.unpack_from('<H', self.data, 6)[0] if len(self.data) >= 8 else 0
+        self.order = '<' if order == BYTE_ORDER else '>'
+        if len(self.data) < struct.calcsize(self.order + HEADER):
+            raise ValueError('%s: not an instruction database' % path)
+        h = struct.unpack_from(self.order + HEADER, self.data, 0)
+        if h[0] != MAGIC or h[1] != VERSION or h[3] != len(self.data):
+            raise ValueError('%s: not an instruction database of version %d' % (path, VERSION))
+        (self.inst_hash, self.inst_count, self.insts, self.type_count, self.types,
+         self.opcodes) = h[4:10]
+        self.names = h[10:12]
+        self.sets = [h[12 + 2 * s:14 + 2 * s] for s in range(SET_COUNT)]
+        self.lists, self.list_size, self.strings, self.string_size = h[18:22]
+
+    def close(self):
+        self.data.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def string(self, offset):
+        start = self.strings + offset
+        return self.data[start:self.data.find(b'\0', start)].decode('ascii')
+
+    def items(self, lst):
+        offset, count = lst
+        return struct.unpack_from('%s%dH' % (self.order, count), self.data, self.lists + 2 * offset)
+
+    def record(self, index):
+        """(name, (tyte1, tyte2, tyte3), set, typ) of inst[index]."""
+        name, t1, t2, t3, sets, typ = struct.unpack_from(self.order + INST, self.data,
+                                                          self.insts + index * struct.calcsize(INST))
+        return self.string(name), (t1, t2, t3), sets, typ.decode('ascii')
+
+    def type_entry(self, typ):
+        """(typ, operand description, all mnemonics, per set) or None."""
+        size = struct.calcsize(TYPE)
+        for t in range(self.type_count):
+            e = struct.unpack_from(self.order + TYPE, self.data, self.types + t * size)
+            if e[0].decode('ascii') == typ:
+                return typ, self.string(e[1]), e[2:4], [e[4 + 2 * s:6 + 2 * s] for s in range(SET_COUNT)]
+        return None
+
+    def type_codes(self):
+        """The operand types in the order of the type table."""
+        size = struct.calcsize(TYPE)
+        return [struct.unpack_from('c', self.data, self.types + t * size)[0].decode('ascii')
+                for t in range(self.type_count)]
+
+    def mnemonics(self, set=SET_ALL, typ=None):
+        """Names of a set or all sets, and of an operand type, in match order
+        (longest first); all of them in name order."""
+        if typ is not None:
+            entry = self.type_entry(typ)
+            if entry is None:
+                return []
+            lst = entry[2] if set == SET_ALL else entry[3][SETS.index(set)]
+        else:
+            lst = self.names if set == SET_ALL else self.sets[SETS.index(set)]
+        return [self.record(i)[0] for i in self.items(lst)]
+
+    def find(self, name, set=SET_ALL):
+        """Record number of a mnemonic of one of the sets, or -1."""
+        items = self.items(self.names)
+        low, high = 0, len(items)
+        key = name.encode('ascii')
+        while low < high:
+            mid = (low + high) // 2
+            rec_name = self.record(items[mid])[0].encode('ascii')
+            if rec_name == key:
+                return items[mid] if self.record(items[mid])[2] & set else -1
+            if rec_name < key:
+                low = mid + 1
+            else:
+                high = mid
+        return -1
+
+    def opcode(self, tyte1):
+        """Records with the first word tyte1, in inst[] order."""
+        lst = struct.unpack_from(self.order + LIST, self.data, self.opcodes + tyte1 * struct.calcsize(LIST))
+        return list(self.items(lst))
+
+
+def main():
+    if len(sys.argv) != 2:
+        print('usage: mcdb.py mcinstr.db', file=sys.stderr)
+        return 2
+    with Database(sys.argv[1]) as db:
+        print('%-6s %6s %6s %8s' % ('type', 'hp', 'jda', 'zencode'))
+        for typ in db.type_codes():
+            print('%-6s %6d %6d %8d' % (typ, *(len(db.mnemonics(s, typ)) for s in SETS)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
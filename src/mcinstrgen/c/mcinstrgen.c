@@ -0,0 +1,415 @@
+/**********************************************************************
+ * MCODE Instruction Table Generator
+ *
+ * Derives lookup tables from the SDK41 instruction table inst[] and
+ * prints them as C source for the mcinstr library:
+ *
+ *     mcinstrgen hash     perfect hash over the mnemonic names
+ *     mcinstrgen decode   decode table for all 10-bit first words
+ *     mcinstrgen operands index of the mnemonics by operand type and set
+ *     mcinstrgen translate names of each mnemonic in the other sets
+ *     mcinstrgen db file  binary instruction database (see mcdb.h)
+ *
+ * Before anything is printed the next chains of inst[] are checked
+ * against hash_inst(). The program fails if the table is inconsistent.
+ *********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcinstr.h"
+#include "mcop.h"
+#include "mchash.h"
+#include "mcdecode.h"
+#include "mctrans.h"
+#include "mcdb.h"
+
+#define MAX_SEED    100000
+#define PER_LINE    12
+
+static int error(const char *fmt, const char *name)
+{
+    fprintf(stderr, "mcinstrgen: ");
+    fprintf(stderr, fmt, name);
+    fprintf(stderr, "\n");
+    return 0;
+}
+
+// Every mnemonic must be reachable from its hash position, chained
+// entries must share the hash of their predecessor and names must be
+// unique.
+static int check_chains(void)
+{
+    int ok = 1;
+    for (int i = 0; i < IHT_SIZE; i++) {
+        if (!inst[i].name[0]) {
+            continue;
+        }
+        int h = hash_inst(inst[i].name);
+        int found = 0;
+        int steps = 0;
+        for (int j = h; j >= 0 && steps <= IHT_SIZE; j = inst[j].next, steps++) {
+            if (strcmp(inst[j].name, inst[i].name) == 0) {
+                found++;
+            }
+        }
+        if (steps > IHT_SIZE) {
+            ok = error("cyclic next chain at %s", inst[h].name);
+        } else if (found == 0) {
+            ok = error("%s is not reachable from its hash position", inst[i].name);
+        } else if (found > 1) {
+            ok = error("%s is not unique", inst[i].name);
+        }
+        int next = inst[i].next;
+        if (next >= IHT_SIZE || (next >= 0 && hash_inst(inst[next].name) != h)) {
+            ok = error("next chain of %s leaves its hash bucket", inst[i].name);
+        }
+    }
+    return ok;
+}
+
+static void print_table(const char *decl, const short *values, int count)
+{
+    printf("%s = {", decl);
+    for (int i = 0; i < count; i++) {
+        printf("%s%s%d", i ? "," : "", (i % PER_LINE) ? " " : "\n    ", values[i]);
+    }
+    printf("\n};\n\n");
+}
+
+static int generate_hash(void)
+{
+    short displacement[INST_PHASH_BUCKETS];
+    short index[IHT_SIZE];
+    short buckets[INST_PHASH_BUCKETS][IHT_SIZE];
+    short sizes[INST_PHASH_BUCKETS];
+    short order[INST_PHASH_BUCKETS];
+
+    memset(sizes, 0, sizeof(sizes));
+    memset(displacement, 0, sizeof(displacement));
+    for (int i = 0; i < IHT_SIZE; i++) {
+        index[i] = -1;
+        if (inst[i].name[0]) {
+            int b = inst_phash(inst[i].name, 0) % INST_PHASH_BUCKETS;
+            buckets[b][sizes[b]++] = i;
+        }
+    }
+
+    // place the largest buckets first
+    for (int b = 0; b < INST_PHASH_BUCKETS; b++) {
+        order[b] = b;
+    }
+    for (int i = 1; i < INST_PHASH_BUCKETS; i++) {
+        for (int j = i; j > 0 && sizes[order[j]] > sizes[order[j - 1]]; j--) {
+            short tmp = order[j];
+            order[j] = order[j - 1];
+            order[j - 1] = tmp;
+        }
+    }
+
+    int free_slot = 0;
+    for (int k = 0; k < INST_PHASH_BUCKETS; k++) {
+        int b = order[k];
+        if (sizes[b] == 0) {
+            break;
+        } else if (sizes[b] == 1) {
+            while (index[free_slot] >= 0) {
+                free_slot++;
+            }
+            index[free_slot] = buckets[b][0];
+            displacement[b] = -free_slot - 1;
+            continue;
+        }
+        int seed;
+        for (seed = 1; seed < MAX_SEED; seed++) {
+            int slots[IHT_SIZE];
+            int n;
+            for (n = 0; n < sizes[b]; n++) {
+                slots[n] = inst_phash(inst[buckets[b][n]].name, seed) % IHT_SIZE;
+                int taken = index[slots[n]] >= 0;
+                for (int m = 0; m < n && !taken; m++) {
+                    taken = slots[m] == slots[n];
+                }
+                if (taken) {
+                    break;
+                }
+            }
+            if (n == sizes[b]) {
+                for (n = 0; n < sizes[b]; n++) {
+                    index[slots[n]] = buckets[b][n];
+                }
+                displacement[b] = seed;
+                break;
+            }
+        }
+        if (seed == MAX_SEED) {
+            return error("no displacement found for bucket of %s", inst[buckets[b][0]].name);
+        }
+    }
+
+    printf("/* Generated by mcinstrgen hash, do not edit. */\n\n");
+    printf("#include \"mcinstr.h\"\n");
+    printf("#include \"mchash.h\"\n\n");
+    print_table("const short inst_phash_displacement[INST_PHASH_BUCKETS]", displacement, INST_PHASH_BUCKETS);
+    print_table("const short inst_phash_index[IHT_SIZE]", index, IHT_SIZE);
+    return 1;
+}
+
+static int decode_candidate(int i, int word, inst_decode_entry *entry)
+{
+    int value;
+    entry->index = i;
+    entry->typ = inst[i].typ;
+    if (!inst[i].name[0] || !inst_decode_field(inst[i].typ, &entry->mask, &entry->shift, &entry->words)) {
+        return 0;
+    }
+    return ((word & ~entry->mask) == inst[i].tyte1) && (inst_decode_operand(entry, word, &value) == 0);
+}
+
+// Shorter instructions first. CPU instructions with an operand field
+// come before exact encodings, which mostly are peripheral instructions
+// reusing the same words (e.g. C=REGN 0 before RDTIME).
+static int compare_candidates(const void *a, const void *b)
+{
+    const inst_decode_entry *e1 = (const inst_decode_entry *) a;
+    const inst_decode_entry *e2 = (const inst_decode_entry *) b;
+    if (e1->words != e2->words) {
+        return e1->words - e2->words;
+    }
+    if ((e1->mask != 0) != (e2->mask != 0)) {
+        return (e1->mask != 0) ? -1 : 1;
+    }
+    return e1->index - e2->index;
+}
+
+static int generate_decode(void)
+{
+    static short candidates[INST_WORD_COUNT * IHT_SIZE];
+    short offset[INST_WORD_COUNT + 1];
+    int count = 0;
+
+    printf("/* Generated by mcinstrgen decode, do not edit. */\n\n");
+    printf("#include \"mcinstr.h\"\n");
+    printf("#include \"mcdecode.h\"\n\n");
+    printf("const inst_decode_entry inst_decode[INST_WORD_COUNT][INST_SET_COUNT] = {\n");
+    for (int word = 0; word < INST_WORD_COUNT; word++) {
+        inst_decode_entry matches[IHT_SIZE];
+        int n = 0;
+        for (int i = 0; i < IHT_SIZE; i++) {
+            if (decode_candidate(i, word, &matches[n])) {
+                n++;
+            }
+        }
+        qsort(matches, n, sizeof(inst_decode_entry), compare_candidates);
+
+        offset[word] = count;
+        for (int k = 0; k < n; k++) {
+            candidates[count++] = matches[k].index;
+        }
+        printf("    {");
+        for (int set = SET_HP; set <= SET_ZENCODE; set <<= 1) {
+            int k = 0;
+            while (k < n && !(inst[matches[k].index].set & set)) {
+                k++;
+            }
+            if (k < n) {
+                printf(" { %3d, 0x%3.3X, %d, %d, '%c' }", matches[k].index,
+                    matches[k].mask, matches[k].shift, matches[k].words, matches[k].typ);
+            } else {
+                printf(" {  -1, 0x000, 0, 0, 0   }");
+            }
+            printf("%s", set == SET_ZENCODE ? " " : ",");
+        }
+        printf("}%s // %3.3X\n", word < INST_WORD_COUNT - 1 ? "," : " ", word);
+    }
+    printf("};\n\n");
+    offset[INST_WORD_COUNT] = count;
+    print_table("const short inst_decode_offset[INST_WORD_COUNT + 1]", offset, INST_WORD_COUNT + 1);
+    print_table("const short inst_decode_candidates[]", candidates, count);
+    return 1;
+}
+
+static void print_bits(const unsigned int *bits)
+{
+    printf("    {");
+    for (int w = 0; w < MNEMONIC_BITSET_WORDS; w++) {
+        printf("%s%s0x%08X", w ? "," : "", (w % 6) ? " " : "\n        ", bits[w]);
+    }
+    printf("\n    }");
+}
+
+// Lists per type and per type and set in inst[] order, bitsets per type
+// and per set. Empty slots of inst[] are in none of them.
+static int generate_operands(void)
+{
+    static short type_list[IHT_SIZE];
+    static short type_set_list[INST_SET_COUNT * IHT_SIZE];
+    short type_offset[MCODE_OP_TYPE_COUNT + 1];
+    short type_set_offset[MCODE_OP_TYPE_COUNT * INST_SET_COUNT + 1];
+    unsigned int type_bits[MCODE_OP_TYPE_COUNT][MNEMONIC_BITSET_WORDS];
+    unsigned int set_bits[INST_SET_COUNT][MNEMONIC_BITSET_WORDS];
+    int count = 0;
+    int set_count = 0;
+
+    memset(type_bits, 0, sizeof(type_bits));
+    memset(set_bits, 0, sizeof(set_bits));
+    for (int i = 0; i < IHT_SIZE; i++) {
+        if (inst[i].name[0] && mnemonic_type_index(inst[i].typ) < 0) {
+            return error("%s has an unknown operand type", inst[i].name);
+        }
+    }
+    for (int t = 0; t < MCODE_OP_TYPE_COUNT; t++) {
+        type_offset[t] = count;
+        for (int i = 0; i < IHT_SIZE; i++) {
+            if (inst[i].name[0] && inst[i].typ == MCODE_OP_TYPES[t]) {
+                type_list[count++] = i;
+                type_bits[t][i / 32] |= 1u << (i % 32);
+            }
+        }
+        for (int set = SET_HP; set <= SET_ZENCODE; set <<= 1) {
+            type_set_offset[t * INST_SET_COUNT + inst_set_index(set)] = set_count;
+            for (int i = 0; i < IHT_SIZE; i++) {
+                if (inst[i].name[0] && inst[i].typ == MCODE_OP_TYPES[t] && (inst[i].set & set)) {
+                    type_set_list[set_count++] = i;
+                    set_bits[inst_set_index(set)][i / 32] |= 1u << (i % 32);
+                }
+            }
+        }
+    }
+    type_offset[MCODE_OP_TYPE_COUNT] = count;
+    type_set_offset[MCODE_OP_TYPE_COUNT * INST_SET_COUNT] = set_count;
+
+    printf("/* Generated by mcinstrgen operands, do not edit. */\n\n");
+    printf("#include \"mcinstr.h\"\n");
+    printf("#include \"mcop.h\"\n\n");
+    print_table("const short mnemonic_type_offset[MCODE_OP_TYPE_COUNT + 1]", type_offset, MCODE_OP_TYPE_COUNT + 1);
+    print_table("const short mnemonic_type_list[]", type_list, count);
+    print_table("const short mnemonic_type_set_offset[MCODE_OP_TYPE_COUNT * INST_SET_COUNT + 1]",
+        type_set_offset, MCODE_OP_TYPE_COUNT * INST_SET_COUNT + 1);
+    print_table("const short mnemonic_type_set_list[]", type_set_list, set_count);
+    printf("const unsigned int mnemonic_type_bits[MCODE_OP_TYPE_COUNT][MNEMONIC_BITSET_WORDS] = {\n");
+    for (int t = 0; t < MCODE_OP_TYPE_COUNT; t++) {
+        print_bits(type_bits[t]);
+        printf("%s // %c\n", t < MCODE_OP_TYPE_COUNT - 1 ? "," : "", MCODE_OP_TYPES[t]);
+    }
+    printf("};\n\n");
+    printf("const unsigned int mnemonic_set_bits[INST_SET_COUNT][MNEMONIC_BITSET_WORDS] = {\n");
+    for (int s = 0; s < INST_SET_COUNT; s++) {
+        print_bits(set_bits[s]);
+        printf("%s\n", s < INST_SET_COUNT - 1 ? "," : "");
+    }
+    printf("};\n");
+    return 1;
+}
+
+// Same encoding: opcode words and operand type.
+static int same_encoding(int i, int j)
+{
+    return inst[j].name[0] && inst[j].typ == inst[i].typ && inst[j].tyte1 == inst[i].tyte1 &&
+        inst[j].tyte2 == inst[i].tyte2 && inst[j].tyte3 == inst[i].tyte3;
+}
+
+// The name of a mnemonic in a set: itself if it is part of the set,
+// otherwise the first mnemonic of the set with the same encoding, with
+// GOSUB and GOLONG preferred over their aliases as in mcodedis. A word
+// without an operand that the set only has with a digit operand, like
+// ?F3=1 (FLG=1? 3, ?PF 3 in JDA), gets that mnemonic and the digit.
+static inst_translation_entry translate(int i, int set)
+{
+    inst_translation_entry t = { -1, -1 };
+    if (!inst[i].name[0]) {
+        return t;
+    }
+    if (inst[i].set & set) {
+        t.index = i;
+        return t;
+    }
+    for (int j = 0; j < IHT_SIZE; j++) {
+        if ((inst[j].set & set) && same_encoding(i, j) && (t.index < 0 ||
+                strcmp(inst[j].name, "GOSUB") == 0 || strcmp(inst[j].name, "GOLONG") == 0)) {
+            t.index = j;
+        }
+    }
+    unsigned short mask;
+    unsigned char shift, words;
+    if (t.index >= 0 || !inst_decode_field(inst[i].typ, &mask, &shift, &words) || mask || words != 1) {
+        return t;
+    }
+    for (int j = 0; j < IHT_SIZE && t.index < 0; j++) {
+        inst_decode_entry entry;
+        int value;
+        if ((inst[j].set & set) && inst[j].typ == MCODE_OP_0_TO_13_DEC && decode_candidate(j, inst[i].tyte1, &entry) &&
+                inst_decode_operand(&entry, inst[i].tyte1, &value) == 0) {
+            t.index = j;
+            t.operand = value;
+        }
+    }
+    return t;
+}
+
+static int generate_translate(void)
+{
+    printf("/* Generated by mcinstrgen translate, do not edit. */\n\n");
+    printf("#include \"mcinstr.h\"\n");
+    printf("#include \"mctrans.h\"\n\n");
+    printf("const inst_translation_entry inst_translation[IHT_SIZE][INST_SET_COUNT] = {\n");
+    for (int i = 0; i < IHT_SIZE; i++) {
+        printf("    {");
+        for (int set = SET_HP; set <= SET_ZENCODE; set <<= 1) {
+            inst_translation_entry t = translate(i, set);
+            printf(" { %3d, %2d }%s", t.index, t.operand, set == SET_ZENCODE ? " " : ",");
+        }
+        printf("}%s", i < IHT_SIZE - 1 ? "," : " ");
+        if (inst[i].name[0]) {
+            printf(" // %s", inst[i].name);
+        }
+        printf("\n");
+    }
+    printf("};\n");
+    return 1;
+}
+
+static int generate_db(const char *path)
+{
+    FILE *out = fopen(path, "wb");
+    if (!out) {
+        perror(path);
+        return 0;
+    }
+    int result = mcdb_write(out);
+    if (fclose(out) != 0 || result != 0) {
+        remove(path);
+        return error("cannot write %s", path);
+    }
+    return 1;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcinstrgen hash|decode|operands|translate|db file\n");
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2 && !(argc == 3 && strcmp(argv[1], "db") == 0)) {
+        usage();
+        return 2;
+    }
+    if (!check_chains()) {
+        return 1;
+    }
+    if (strcmp(argv[1], "hash") == 0) {
+        return generate_hash() ? 0 : 1;
+    } else if (strcmp(argv[1], "decode") == 0) {
+        return generate_decode() ? 0 : 1;
+    } else if (strcmp(argv[1], "operands") == 0) {
+        return generate_operands() ? 0 : 1;
+    } else if (strcmp(argv[1], "translate") == 0) {
+        return generate_translate() ? 0 : 1;
+    } else if (strcmp(argv[1], "db") == 0) {
+        return generate_db(argv[2]) ? 0 : 1;
+    }
+    usage();
+    return 2;
+}
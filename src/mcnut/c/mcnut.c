@@ -0,0 +1,821 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcinstr.h"
+#include "mcdecode.h"
+#include "mcnut.h"
+
+#if defined(__GNUC__) && !defined(NUT_SWITCH)
+#define THREADED        // labels as values
+#endif
+
+#define DIGITS          14
+#define REGISTER_MASK   0x00FFFFFFFFFFFFFFULL
+#define DIGIT_ONES      0x0011111111111111ULL   // bit 0 of every digit
+#define DIGIT_SIXES     0x0066666666666666ULL
+
+// Operations of the interpreter, in the order of their labels.
+#define OPERATIONS(X) \
+    X(NOP) X(LONG) X(JNC) X(JC) \
+    X(A_0) X(B_0) X(C_0) X(AB_EX) X(B_A) X(AC_EX) X(C_B) X(BC_EX) \
+    X(A_C) X(A_ADD_B) X(A_ADD_C) X(A_INC) X(A_SUB_B) X(A_DEC) X(A_SUB_C) X(C_ADD_C) \
+    X(C_A_ADD_C) X(C_INC) X(C_A_SUB_C) X(C_DEC) X(C_NEG) X(C_NEG_DEC) X(B_NZ) X(C_NZ) \
+    X(A_LT_C) X(A_LT_B) X(A_NZ) X(A_NE_C) X(A_SR) X(B_SR) X(C_SR) X(A_SL) \
+    X(ST_CLEAR) X(ST_SET) X(ST_TEST) X(LC) X(PT_TEST) X(PT_SET) X(POP) X(REG_C) \
+    X(FLAG_TEST) X(C_REG) X(RCR) X(G_C) X(POWOFF) X(N_C) X(C_G) X(SELP) \
+    X(C_N) X(CG_EX) X(SELQ) X(CN_EX) X(ENBANK) X(P_EQ_Q) X(LDI) X(M_C) \
+    X(BATTERY) X(PUSH) X(C_M) X(ABC_0) X(C_STK) X(CM_EX) X(GOTOC) X(C_KEYS) \
+    X(GOKEYS) X(F_ST) X(SETHEX) X(DADD) X(ST_F) X(SETDEC) X(STF_EX) X(DISOFF) \
+    X(DATA_C) X(DISTOG) X(CXISA) X(ST_C) X(RTNC) X(C_OR_A) X(C_ST) X(RTNNC) \
+    X(C_AND_A) X(CLRST) X(CLRKEY) X(CHKKB) X(DEC_PT) X(CST_EX) X(INC_PT) X(RTN) \
+    X(PFAD)
+
+#define OPERATION_ENUM(name) OP_##name,
+
+enum { OPERATIONS(OPERATION_ENUM) OP_COUNT };
+
+struct operation_t {
+    const char *name;   // JDA mnemonic
+    int op;
+    int arg;            // -1 for the operand of the word
+};
+
+typedef struct operation_t operation;
+
+// The operation of every JDA mnemonic the decode table has for a word.
+// The JDA set names every Nut instruction once; the peripheral
+// instructions of the HP set share their words.
+static const operation operations[] = {
+    { "NOP",     OP_NOP,        -1 },
+    { "NCGO",    OP_LONG,       -1 },
+    { "RTNCPU",  OP_LONG,       -1 },   // 005 is a long jump to the Nut
+    { "JNC",     OP_JNC,        -1 },
+    { "JC",      OP_JC,         -1 },
+    { "A=0",     OP_A_0,        -1 },
+    { "B=0",     OP_B_0,        -1 },
+    { "C=0",     OP_C_0,        -1 },
+    { "A<>B",    OP_AB_EX,      -1 },
+    { "B=A",     OP_B_A,        -1 },
+    { "A<>C",    OP_AC_EX,      -1 },
+    { "C=B",     OP_C_B,        -1 },
+    { "B<>C",    OP_BC_EX,      -1 },
+    { "A=C",     OP_A_C,        -1 },
+    { "A=A+B",   OP_A_ADD_B,    -1 },
+    { "A=A+C",   OP_A_ADD_C,    -1 },
+    { "A=A+1",   OP_A_INC,      -1 },
+    { "A=A-B",   OP_A_SUB_B,    -1 },
+    { "A=A-1",   OP_A_DEC,      -1 },
+    { "A=A-C",   OP_A_SUB_C,    -1 },
+    { "C=C+C",   OP_C_ADD_C,    -1 },
+    { "C=A+C",   OP_C_A_ADD_C,  -1 },
+    { "C=C+1",   OP_C_INC,      -1 },
+    { "C=A-C",   OP_C_A_SUB_C,  -1 },
+    { "C=C-1",   OP_C_DEC,      -1 },
+    { "C=-C",    OP_C_NEG,      -1 },
+    { "C=-C-1",  OP_C_NEG_DEC,  -1 },
+    { "?B#0",    OP_B_NZ,       -1 },
+    { "?C#0",    OP_C_NZ,       -1 },
+    { "?A<C",    OP_A_LT_C,     -1 },
+    { "?A<B",    OP_A_LT_B,     -1 },
+    { "?A#0",    OP_A_NZ,       -1 },
+    { "?A#C",    OP_A_NE_C,     -1 },
+    { "ASR",     OP_A_SR,       -1 },
+    { "BSR",     OP_B_SR,       -1 },
+    { "CSR",     OP_C_SR,       -1 },
+    { "ASL",     OP_A_SL,       -1 },
+    { "CF",      OP_ST_CLEAR,   -1 },
+    { "SF",      OP_ST_SET,     -1 },
+    { "?FS",     OP_ST_TEST,    -1 },
+    { "LC",      OP_LC,         -1 },
+    { "?PT=",    OP_PT_TEST,    -1 },
+    { "PT=",     OP_PT_SET,     -1 },
+    { "CLRRTN",  OP_POP,        -1 },
+    { "PERTCT",  OP_NOP,        -1 },   // hands over to a peripheral
+    { "REG=C",   OP_REG_C,      -1 },
+    { "?PF",     OP_FLAG_TEST,  -1 },
+    { "C=REG",   OP_C_REG,      -1 },
+    { "RCR",     OP_RCR,        -1 },
+    { "WMLDL",   OP_NOP,        -1 },
+    { "G=C",     OP_G_C,        -1 },
+    { "POWOFF",  OP_POWOFF,     -1 },
+    { "N=C",     OP_N_C,        -1 },
+    { "C=G",     OP_C_G,        -1 },
+    { "PT=P",    OP_SELP,       -1 },
+    { "C=N",     OP_C_N,        -1 },
+    { "C<>G",    OP_CG_EX,      -1 },
+    { "PT=Q",    OP_SELQ,       -1 },
+    { "N<>C",    OP_CN_EX,      -1 },
+    { "ENBANK1", OP_ENBANK,     0 },
+    { "ENBANK2", OP_ENBANK,     1 },
+    { "ENBANK3", OP_ENBANK,     2 },
+    { "ENBANK4", OP_ENBANK,     3 },
+    { "?P=Q",    OP_P_EQ_Q,     -1 },
+    { "LDI",     OP_LDI,        -1 },
+    { "M=C",     OP_M_C,        -1 },
+    { "?BAT",    OP_BATTERY,    -1 },
+    { "STK=C",   OP_PUSH,       -1 },
+    { "C=M",     OP_C_M,        -1 },
+    { "ABC=0",   OP_ABC_0,      -1 },
+    { "C=STK",   OP_C_STK,      -1 },
+    { "C<>M",    OP_CM_EX,      -1 },
+    { "GTOC",    OP_GOTOC,      -1 },
+    { "HPIL=C",  OP_NOP,        -1 },
+    { "C=KEY",   OP_C_KEYS,     -1 },
+    { "GTOKEY",  OP_GOKEYS,     -1 },
+    { "F=ST",    OP_F_ST,       -1 },
+    { "SETHEX",  OP_SETHEX,     -1 },
+    { "RAMSLCT", OP_DADD,       -1 },
+    { "ST=F",    OP_ST_F,       -1 },
+    { "SETDEC",  OP_SETDEC,     -1 },
+    { "ST<>F",   OP_STF_EX,     -1 },
+    { "DISOFF",  OP_DISOFF,     -1 },
+    { "WDATA",   OP_DATA_C,     -1 },
+    { "DISTOG",  OP_DISTOG,     -1 },
+    { "RDROM",   OP_CXISA,      -1 },
+    { "ST=C",    OP_ST_C,       -1 },
+    { "CRTN",    OP_RTNC,       -1 },
+    { "C=CORA",  OP_C_OR_A,     -1 },
+    { "C=ST",    OP_C_ST,       -1 },
+    { "NCRTN",   OP_RTNNC,      -1 },
+    { "C=CANDA", OP_C_AND_A,    -1 },
+    { "ST=0",    OP_CLRST,      -1 },
+    { "CLRKEY",  OP_CLRKEY,     -1 },
+    { "?KEY",    OP_CHKKB,      -1 },
+    { "-PT",     OP_DEC_PT,     -1 },
+    { "C<>ST",   OP_CST_EX,     -1 },
+    { "+PT",     OP_INC_PT,     -1 },
+    { "RTN",     OP_RTN,        -1 },
+    { "PERSLCT", OP_PFAD,       -1 },
+};
+
+#define OPERATION_COUNT ((int) (sizeof(operations) / sizeof(operations[0])))
+
+static const unsigned short empty_page[NUT_PAGE_WORDS];
+
+// first and last digit of the TEF fields, -1 where it is a pointer
+static const signed char field_first[8] = { -1, 0, 0, 0, -1, 2, 3, 13 };
+static const signed char field_last[8] = { -1, 2, -1, 13, -1, 2, 12, 13 };
+
+int nut_init(nut_cpu *cpu)
+{
+    short op_of[IHT_SIZE];
+    short arg_of[IHT_SIZE];
+    int jda = inst_set_index(SET_JDA);
+
+    memset(cpu, 0, sizeof(*cpu));
+    for (int p = 0; p < NUT_PAGES; p++) {
+        cpu->page[p] = empty_page;
+    }
+    cpu->display_on = 1;
+
+    for (int i = 0; i < IHT_SIZE; i++) {
+        op_of[i] = -1;
+    }
+    for (int k = 0; k < OPERATION_COUNT; k++) {
+        int i = search_inst((char *) operations[k].name, SET_JDA);
+        if (i < 0) {
+            cpu->unknown = operations[k].name;
+            return -1;
+        }
+        op_of[i] = (short) operations[k].op;
+        arg_of[i] = (short) operations[k].arg;
+    }
+    for (int word = 0; word < INST_WORD_COUNT; word++) {
+        const inst_decode_entry *entry = &inst_decode[word][jda];
+        nut_entry *e = &cpu->dispatch[word];
+        int value = 0;
+        if (entry->index < 0) {
+            // not an instruction, does nothing on the Nut
+            e->op = OP_NOP;
+            e->arg = 0;
+            continue;
+        }
+        if (op_of[entry->index] < 0) {
+            cpu->unknown = inst[entry->index].name;
+            return -1;
+        }
+        inst_decode_operand(entry, word, &value);
+        e->op = (unsigned char) op_of[entry->index];
+        if (e->op == OP_LONG) {
+            value = word >> 2;      // the low byte of the address
+        } else if (arg_of[entry->index] >= 0) {
+            value = arg_of[entry->index];
+        }
+        e->arg = (short) value;
+    }
+    return 0;
+}
+
+void nut_free(nut_cpu *cpu)
+{
+    for (int p = 0; p < NUT_PAGES; p++) {
+        for (int b = 0; b < NUT_BANKS; b++) {
+            free(cpu->rom[p][b]);
+            cpu->rom[p][b] = NULL;
+        }
+        cpu->page[p] = empty_page;
+    }
+}
+
+int nut_load(nut_cpu *cpu, int page, int bank, const unsigned short *words, int count)
+{
+    unsigned short *rom = cpu->rom[page][bank];
+    if (!rom) {
+        rom = calloc(NUT_PAGE_WORDS, sizeof(unsigned short));
+        if (!rom) {
+            return -1;
+        }
+        cpu->rom[page][bank] = rom;
+    }
+    for (int i = 0; i < count && i < NUT_PAGE_WORDS; i++) {
+        rom[i] = words[i] & 0x3FF;
+    }
+    if (cpu->bank[page] == bank) {
+        cpu->page[page] = rom;
+    }
+    return 0;
+}
+
+void nut_key(nut_cpu *cpu, int code)
+{
+    if (code >= 0) {
+        cpu->key = code & 0xFF;
+        cpu->key_flag = 1;
+        cpu->key_down = 1;
+    } else {
+        cpu->key_down = 0;
+    }
+}
+
+int nut_rom_word(const nut_cpu *cpu, int address)
+{
+    return cpu->page[(address >> 12) & 0xF][address & 0xFFF];
+}
+
+// Switches a page to a bank if the bank is loaded.
+static void switch_bank(nut_cpu *cpu, int page, int bank)
+{
+    if (cpu->rom[page][bank]) {
+        cpu->bank[page] = bank;
+        cpu->page[page] = cpu->rom[page][bank];
+    }
+}
+
+static void push(nut_cpu *cpu, unsigned int address)
+{
+    for (int i = NUT_STACK_DEPTH - 1; i > 0; i--) {
+        cpu->stack[i] = cpu->stack[i - 1];
+    }
+    cpu->stack[0] = address;
+}
+
+static unsigned int pop(nut_cpu *cpu)
+{
+    unsigned int address = cpu->stack[0];
+    for (int i = 0; i < NUT_STACK_DEPTH - 1; i++) {
+        cpu->stack[i] = cpu->stack[i + 1];
+    }
+    cpu->stack[NUT_STACK_DEPTH - 1] = 0;
+    return address;
+}
+
+static inline unsigned int get_digit(unsigned long long r, unsigned int i)
+{
+    return (unsigned int) (r >> 4*i) & 0xF;
+}
+
+static inline unsigned long long set_digit(unsigned long long r, unsigned int i, unsigned int d)
+{
+    return (r & ~(0xFULL << 4*i)) | ((unsigned long long) (d & 0xF) << 4*i);
+}
+
+// Position of a field in bits and the mask of its width.
+static inline void field_bits(const nut_cpu *cpu, int tef, int *shift, unsigned long long *mask)
+{
+    int first = field_first[tef];
+    int last = field_last[tef];
+    if (first < 0) {
+        if (tef == 0) {
+            first = last = cpu->pointer[cpu->pt];
+        } else {
+            // P to Q, or to the end if Q is below P
+            first = cpu->pointer[0];
+            last = cpu->pointer[1] >= cpu->pointer[0] ? cpu->pointer[1] : DIGITS - 1;
+        }
+    } else if (last < 0) {
+        last = cpu->pointer[cpu->pt];
+    }
+    *shift = 4*first;
+    *mask = (1ULL << 4*(last - first + 1)) - 1;
+}
+
+// Nonzero if a digit is above 9.
+static inline unsigned long long bad_digits(unsigned long long x)
+{
+    return (x >> 3) & ((x >> 2) | (x >> 1)) & DIGIT_ONES;
+}
+
+// Adds or subtracts digit by digit like the Nut does, also with digits
+// above 9.
+static unsigned long long digits(unsigned long long x, unsigned long long y, unsigned int in,
+    unsigned long long mask, int subtract, unsigned int *carry)
+{
+    unsigned long long r = 0;
+    int c = (int) in;
+    for (int s = 0; s < 64 && (mask >> s); s += 4) {
+        int dx = (int) (x >> s) & 0xF;
+        int dy = (int) (y >> s) & 0xF;
+        int d = subtract ? dx - dy - c : dx + dy + c;
+        if (subtract) {
+            c = d < 0;
+            d += c ? 10 : 0;
+        } else {
+            c = d >= 10;
+            d -= c ? 10 : 0;
+        }
+        r |= (unsigned long long) (d & 0xF) << s;
+    }
+    *carry = (unsigned int) c;
+    return r;
+}
+
+// x + y + in over a field at bit 0, setting the carry out of the field.
+static inline unsigned long long add(unsigned long long x, unsigned long long y, unsigned int in,
+    unsigned long long mask, unsigned int decimal, unsigned int *carry)
+{
+    unsigned long long s;
+    if (!decimal) {
+        s = x + y + in;
+    } else if (!(bad_digits(x) | bad_digits(y))) {
+        // add 6 to every digit, take it back where no carry came out
+        unsigned long long t = x + (DIGIT_SIXES & mask);
+        s = t + y + in;
+        unsigned long long out = ((t ^ y ^ s) >> 4) & DIGIT_ONES & mask;
+        s -= (~out & DIGIT_ONES & mask) * 6;
+    } else {
+        return digits(x, y, in, mask, 0, carry);
+    }
+    *carry = (s & ~mask) != 0;
+    return s & mask;
+}
+
+// x - y - in over a field at bit 0, setting the borrow out of the field.
+static inline unsigned long long subtract(unsigned long long x, unsigned long long y, unsigned int in,
+    unsigned long long mask, unsigned int decimal, unsigned int *carry)
+{
+    unsigned long long d = x - y - in;
+    if (decimal) {
+        if (bad_digits(x) | bad_digits(y)) {
+            return digits(x, y, in, mask, 1, carry);
+        }
+        // take 6 from every digit that borrowed
+        unsigned long long out = ((x ^ y ^ d) >> 4) & DIGIT_ONES & mask;
+        d -= out * 6;
+    }
+    *carry = (unsigned int) (d >> 63);
+    return d & mask;
+}
+
+int nut_run(nut_cpu *cpu, unsigned long long count, int stop)
+{
+#if defined(THREADED)
+#define OPERATION_LABEL(name) &&L_##name,
+    static const void *const labels[OP_COUNT] = { OPERATIONS(OPERATION_LABEL) };
+#endif
+    unsigned int pc = cpu->pc;
+    unsigned int carry = cpu->carry;
+    unsigned int in;
+    unsigned int at;
+    unsigned long long left = count;
+    int result = NUT_DONE;
+    nut_entry e;
+    int shift;
+    unsigned long long mask;
+    unsigned long long x;
+
+#define FETCH() \
+    if (left == 0) { \
+        goto done; \
+    } \
+    if ((int) pc == stop) { \
+        result = NUT_STOPPED; \
+        goto done; \
+    } \
+    left--; \
+    e = cpu->dispatch[cpu->page[pc >> 12][pc & 0xFFF]]; \
+    at = pc; \
+    pc = (pc + 1) & 0xFFFF; \
+    in = carry; \
+    carry = 0
+
+#if defined(THREADED)
+#define OPERATION(name) L_##name:
+#define NEXT            FETCH(); goto *labels[e.op]
+    NEXT;
+#else
+#define OPERATION(name) case OP_##name:
+#define NEXT            continue
+    for (;;) {
+        FETCH();
+        switch (e.op) {
+#endif
+
+#define FIELD()         field_bits(cpu, e.arg, &shift, &mask)
+#define GET(r)          (((r) >> shift) & mask)
+#define PUT(r, v)       ((r) = ((r) & ~(mask << shift)) | ((v) << shift))
+#define PT              cpu->pointer[cpu->pt]
+
+    OPERATION(NOP)
+        NEXT;
+    OPERATION(LONG) {
+        unsigned int word = cpu->page[pc >> 12][pc & 0xFFF];
+        unsigned int target = ((word & 0x3FC) << 6) | (unsigned int) e.arg;
+        pc = (pc + 1) & 0xFFFF;
+        // NC XQ, C XQ, NC GO, C GO
+        if ((word & 1) == in) {
+            if (!(word & 2)) {
+                push(cpu, pc);
+            }
+            pc = target;
+        }
+        NEXT;
+    }
+    OPERATION(JNC)
+        if (!in) {
+            pc = (at + e.arg) & 0xFFFF;
+        }
+        NEXT;
+    OPERATION(JC)
+        if (in) {
+            pc = (at + e.arg) & 0xFFFF;
+        }
+        NEXT;
+
+    // class 2, field arithmetic
+    OPERATION(A_0)
+        FIELD();
+        PUT(cpu->a, 0ULL);
+        NEXT;
+    OPERATION(B_0)
+        FIELD();
+        PUT(cpu->b, 0ULL);
+        NEXT;
+    OPERATION(C_0)
+        FIELD();
+        PUT(cpu->c, 0ULL);
+        NEXT;
+    OPERATION(AB_EX)
+        FIELD();
+        x = GET(cpu->a);
+        PUT(cpu->a, GET(cpu->b));
+        PUT(cpu->b, x);
+        NEXT;
+    OPERATION(B_A)
+        FIELD();
+        PUT(cpu->b, GET(cpu->a));
+        NEXT;
+    OPERATION(AC_EX)
+        FIELD();
+        x = GET(cpu->a);
+        PUT(cpu->a, GET(cpu->c));
+        PUT(cpu->c, x);
+        NEXT;
+    OPERATION(C_B)
+        FIELD();
+        PUT(cpu->c, GET(cpu->b));
+        NEXT;
+    OPERATION(BC_EX)
+        FIELD();
+        x = GET(cpu->b);
+        PUT(cpu->b, GET(cpu->c));
+        PUT(cpu->c, x);
+        NEXT;
+    OPERATION(A_C)
+        FIELD();
+        PUT(cpu->a, GET(cpu->c));
+        NEXT;
+    OPERATION(A_ADD_B)
+        FIELD();
+        x = add(GET(cpu->a), GET(cpu->b), 0, mask, cpu->decimal, &carry);
+        PUT(cpu->a, x);
+        NEXT;
+    OPERATION(A_ADD_C)
+        FIELD();
+        x = add(GET(cpu->a), GET(cpu->c), 0, mask, cpu->decimal, &carry);
+        PUT(cpu->a, x);
+        NEXT;
+    OPERATION(A_INC)
+        FIELD();
+        x = add(GET(cpu->a), 0, 1, mask, cpu->decimal, &carry);
+        PUT(cpu->a, x);
+        NEXT;
+    OPERATION(A_SUB_B)
+        FIELD();
+        x = subtract(GET(cpu->a), GET(cpu->b), 0, mask, cpu->decimal, &carry);
+        PUT(cpu->a, x);
+        NEXT;
+    OPERATION(A_DEC)
+        FIELD();
+        x = subtract(GET(cpu->a), 0, 1, mask, cpu->decimal, &carry);
+        PUT(cpu->a, x);
+        NEXT;
+    OPERATION(A_SUB_C)
+        FIELD();
+        x = subtract(GET(cpu->a), GET(cpu->c), 0, mask, cpu->decimal, &carry);
+        PUT(cpu->a, x);
+        NEXT;
+    OPERATION(C_ADD_C)
+        FIELD();
+        x = add(GET(cpu->c), GET(cpu->c), 0, mask, cpu->decimal, &carry);
+        PUT(cpu->c, x);
+        NEXT;
+    OPERATION(C_A_ADD_C)
+        FIELD();
+        x = add(GET(cpu->a), GET(cpu->c), 0, mask, cpu->decimal, &carry);
+        PUT(cpu->c, x);
+        NEXT;
+    OPERATION(C_INC)
+        FIELD();
+        x = add(GET(cpu->c), 0, 1, mask, cpu->decimal, &carry);
+        PUT(cpu->c, x);
+        NEXT;
+    OPERATION(C_A_SUB_C)
+        FIELD();
+        x = subtract(GET(cpu->a), GET(cpu->c), 0, mask, cpu->decimal, &carry);
+        PUT(cpu->c, x);
+        NEXT;
+    OPERATION(C_DEC)
+        FIELD();
+        x = subtract(GET(cpu->c), 0, 1, mask, cpu->decimal, &carry);
+        PUT(cpu->c, x);
+        NEXT;
+    OPERATION(C_NEG)
+        FIELD();
+        x = subtract(0, GET(cpu->c), 0, mask, cpu->decimal, &carry);
+        PUT(cpu->c, x);
+        NEXT;
+    OPERATION(C_NEG_DEC)
+        FIELD();
+        x = subtract(0, GET(cpu->c), 1, mask, cpu->decimal, &carry);
+        PUT(cpu->c, x);
+        NEXT;
+    OPERATION(B_NZ)
+        FIELD();
+        carry = GET(cpu->b) != 0;
+        NEXT;
+    OPERATION(C_NZ)
+        FIELD();
+        carry = GET(cpu->c) != 0;
+        NEXT;
+    OPERATION(A_LT_C)
+        // the borrow of A-C does not depend on the base
+        FIELD();
+        carry = GET(cpu->a) < GET(cpu->c);
+        NEXT;
+    OPERATION(A_LT_B)
+        FIELD();
+        carry = GET(cpu->a) < GET(cpu->b);
+        NEXT;
+    OPERATION(A_NZ)
+        FIELD();
+        carry = GET(cpu->a) != 0;
+        NEXT;
+    OPERATION(A_NE_C)
+        FIELD();
+        carry = GET(cpu->a) != GET(cpu->c);
+        NEXT;
+    OPERATION(A_SR)
+        FIELD();
+        PUT(cpu->a, GET(cpu->a) >> 4);
+        NEXT;
+    OPERATION(B_SR)
+        FIELD();
+        PUT(cpu->b, GET(cpu->b) >> 4);
+        NEXT;
+    OPERATION(C_SR)
+        FIELD();
+        PUT(cpu->c, GET(cpu->c) >> 4);
+        NEXT;
+    OPERATION(A_SL)
+        FIELD();
+        PUT(cpu->a, (GET(cpu->a) << 4) & mask);
+        NEXT;
+
+    // class 0
+    OPERATION(ST_CLEAR)
+        cpu->st &= ~(1u << e.arg);
+        NEXT;
+    OPERATION(ST_SET)
+        cpu->st |= 1u << e.arg;
+        NEXT;
+    OPERATION(ST_TEST)
+        carry = (cpu->st >> e.arg) & 1;
+        NEXT;
+    OPERATION(LC)
+        cpu->c = set_digit(cpu->c, PT, (unsigned int) e.arg);
+        PT = PT ? PT - 1 : DIGITS - 1;
+        NEXT;
+    OPERATION(PT_TEST)
+        carry = PT == (unsigned int) e.arg;
+        NEXT;
+    OPERATION(PT_SET)
+        PT = (unsigned int) e.arg;
+        NEXT;
+    OPERATION(POP)
+        pop(cpu);
+        NEXT;
+    OPERATION(REG_C)
+        cpu->ram_addr = (cpu->ram_addr & 0x3F0) | (unsigned int) e.arg;
+        if (!cpu->peripheral) {
+            cpu->ram[cpu->ram_addr] = cpu->c;
+        }
+        NEXT;
+    OPERATION(FLAG_TEST)
+        NEXT;
+    OPERATION(C_REG)
+        // C=REG 0 reads the register selected by DADD=C
+        if (e.arg) {
+            cpu->ram_addr = (cpu->ram_addr & 0x3F0) | (unsigned int) e.arg;
+        }
+        cpu->c = cpu->peripheral ? 0 : cpu->ram[cpu->ram_addr];
+        NEXT;
+    OPERATION(RCR)
+        if (e.arg) {
+            cpu->c = ((cpu->c >> 4*e.arg) | (cpu->c << (4*DIGITS - 4*e.arg))) & REGISTER_MASK;
+        }
+        NEXT;
+    OPERATION(G_C)
+        cpu->g = get_digit(cpu->c, PT) | get_digit(cpu->c, (PT + 1) % DIGITS) << 4;
+        NEXT;
+    OPERATION(POWOFF)
+        result = NUT_POWEROFF;
+        goto done;
+    OPERATION(N_C)
+        cpu->n = cpu->c;
+        NEXT;
+    OPERATION(C_G)
+        cpu->c = set_digit(cpu->c, PT, cpu->g);
+        cpu->c = set_digit(cpu->c, (PT + 1) % DIGITS, cpu->g >> 4);
+        NEXT;
+    OPERATION(SELP)
+        cpu->pt = 0;
+        NEXT;
+    OPERATION(C_N)
+        cpu->c = cpu->n;
+        NEXT;
+    OPERATION(CG_EX) {
+        unsigned int g = cpu->g;
+        cpu->g = get_digit(cpu->c, PT) | get_digit(cpu->c, (PT + 1) % DIGITS) << 4;
+        cpu->c = set_digit(cpu->c, PT, g);
+        cpu->c = set_digit(cpu->c, (PT + 1) % DIGITS, g >> 4);
+        NEXT;
+    }
+    OPERATION(SELQ)
+        cpu->pt = 1;
+        NEXT;
+    OPERATION(CN_EX)
+        x = cpu->c;
+        cpu->c = cpu->n;
+        cpu->n = x;
+        NEXT;
+    OPERATION(ENBANK)
+        // the page of the instruction, and the other page of its port
+        switch_bank(cpu, at >> 12, e.arg);
+        if (at >= 0x8000) {
+            switch_bank(cpu, (at >> 12) ^ 1, e.arg);
+        }
+        NEXT;
+    OPERATION(P_EQ_Q)
+        carry = cpu->pointer[0] == cpu->pointer[1];
+        NEXT;
+    OPERATION(LDI)
+        cpu->c = (cpu->c & ~0xFFFULL) | cpu->page[pc >> 12][pc & 0xFFF];
+        pc = (pc + 1) & 0xFFFF;
+        NEXT;
+    OPERATION(M_C)
+        cpu->m = cpu->c;
+        NEXT;
+    OPERATION(BATTERY)
+        NEXT;
+    OPERATION(PUSH)
+        push(cpu, (unsigned int) (cpu->c >> 12) & 0xFFFF);
+        NEXT;
+    OPERATION(C_M)
+        cpu->c = cpu->m;
+        NEXT;
+    OPERATION(ABC_0)
+        cpu->a = cpu->b = cpu->c = 0;
+        NEXT;
+    OPERATION(C_STK)
+        cpu->c = (cpu->c & ~(0xFFFFULL << 12)) | (unsigned long long) pop(cpu) << 12;
+        NEXT;
+    OPERATION(CM_EX)
+        x = cpu->c;
+        cpu->c = cpu->m;
+        cpu->m = x;
+        NEXT;
+    OPERATION(GOTOC)
+        pc = (unsigned int) (cpu->c >> 12) & 0xFFFF;
+        NEXT;
+    OPERATION(C_KEYS)
+        cpu->c = (cpu->c & ~(0xFFULL << 12)) | (unsigned long long) cpu->key << 12;
+        NEXT;
+    OPERATION(GOKEYS)
+        pc = (pc & 0xFF00) | cpu->key;
+        NEXT;
+    OPERATION(F_ST)
+        cpu->f = cpu->st & 0xFF;
+        NEXT;
+    OPERATION(SETHEX)
+        cpu->decimal = 0;
+        NEXT;
+    OPERATION(DADD)
+        cpu->ram_addr = (unsigned int) cpu->c & 0x3FF;
+        NEXT;
+    OPERATION(ST_F)
+        cpu->st = (cpu->st & ~0xFFu) | cpu->f;
+        NEXT;
+    OPERATION(SETDEC)
+        cpu->decimal = 1;
+        NEXT;
+    OPERATION(STF_EX) {
+        unsigned int f = cpu->f;
+        cpu->f = cpu->st & 0xFF;
+        cpu->st = (cpu->st & ~0xFFu) | f;
+        NEXT;
+    }
+    OPERATION(DISOFF)
+        cpu->display_on = 0;
+        NEXT;
+    OPERATION(DATA_C)
+        if (!cpu->peripheral) {
+            cpu->ram[cpu->ram_addr] = cpu->c;
+        }
+        NEXT;
+    OPERATION(DISTOG)
+        cpu->display_on ^= 1;
+        NEXT;
+    OPERATION(CXISA)
+        cpu->c = (cpu->c & ~0xFFFULL) | (unsigned long long) nut_rom_word(cpu, (int) (cpu->c >> 12) & 0xFFFF);
+        NEXT;
+    OPERATION(ST_C)
+        cpu->st = (cpu->st & ~0xFFu) | ((unsigned int) cpu->c & 0xFF);
+        NEXT;
+    OPERATION(RTNC)
+        if (in) {
+            pc = pop(cpu);
+        }
+        NEXT;
+    OPERATION(C_OR_A)
+        cpu->c |= cpu->a;
+        NEXT;
+    OPERATION(C_ST)
+        cpu->c = (cpu->c & ~0xFFULL) | (cpu->st & 0xFF);
+        NEXT;
+    OPERATION(RTNNC)
+        if (!in) {
+            pc = pop(cpu);
+        }
+        NEXT;
+    OPERATION(C_AND_A)
+        cpu->c &= cpu->a;
+        NEXT;
+    OPERATION(CLRST)
+        cpu->st &= ~0xFFu;
+        NEXT;
+    OPERATION(CLRKEY)
+        cpu->key_flag = cpu->key_down;
+        NEXT;
+    OPERATION(CHKKB)
+        carry = cpu->key_flag;
+        NEXT;
+    OPERATION(DEC_PT)
+        PT = PT ? PT - 1 : DIGITS - 1;
+        NEXT;
+    OPERATION(CST_EX) {
+        unsigned int st = cpu->st & 0xFF;
+        cpu->st = (cpu->st & ~0xFFu) | ((unsigned int) cpu->c & 0xFF);
+        cpu->c = (cpu->c & ~0xFFULL) | st;
+        NEXT;
+    }
+    OPERATION(INC_PT)
+        PT = PT == DIGITS - 1 ? 0 : PT + 1;
+        NEXT;
+    OPERATION(RTN)
+        pc = pop(cpu);
+        NEXT;
+    OPERATION(PFAD)
+        cpu->peripheral = (unsigned int) cpu->c & 0xFF;
+        NEXT;
+
+#if !defined(THREADED)
+        }
+    }
+#endif
+
+done:
+    cpu->pc = pc;
+    cpu->carry = carry;
+    cpu->executed += count - left;
+    return result;
+}
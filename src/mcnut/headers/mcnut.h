@@ -0,0 +1,91 @@
+#if !defined(__MCNUT_H__)
+#define __MCNUT_H__
+
+// Emulator of the HP-41 Nut processor.
+//
+// The instructions are not decoded while the emulator runs. nut_init()
+// builds a dispatch table with an entry for every 10-bit word, derived
+// from the decode table of mcinstr (see mcdecode.h): the instruction
+// the JDA set decodes for the word selects the operation by its
+// mnemonic, and its operand bits are decoded once into the entry. The
+// interpreter jumps from one operation to the next through the table
+// (threaded code with compilers that have computed gotos, a switch
+// otherwise or if NUT_SWITCH is defined).
+//
+// The registers A, B, C, M and N hold 14 digits, digit 0 in bits 3-0.
+// The field arithmetic works on whole fields at once; a field with a
+// digit above 9 in decimal mode falls back to digit by digit.
+//
+// Peripherals are not emulated: the peripheral instructions do nothing,
+// their flags test false, and while a peripheral is selected by PFAD=C
+// the RAM reads as 0 and is not written. All 1024 RAM registers are
+// present.
+
+#define NUT_PAGES           16
+#define NUT_BANKS           4
+#define NUT_PAGE_WORDS      0x1000
+#define NUT_RAM_SIZE        0x400
+#define NUT_STACK_DEPTH     4
+
+// results of nut_run()
+#define NUT_DONE            0       // executed the number of instructions
+#define NUT_STOPPED         1       // reached the stop address
+#define NUT_POWEROFF        2       // executed POWOFF
+
+struct nut_entry_t {
+    unsigned char op;       // operation
+    short arg;              // decoded operand (digit, field, offset, ...)
+};
+
+struct nut_cpu_t {
+    unsigned long long a, b, c, m, n;
+    unsigned int g;                 // 8 bits
+    unsigned int f;                 // 8 output flags
+    unsigned int st;                // flags S0 to S13
+    unsigned int pointer[2];        // P and Q
+    unsigned int pt;                // pointer selected, 0 for P, 1 for Q
+    unsigned int carry;
+    unsigned int decimal;
+    unsigned int pc;
+    unsigned int stack[NUT_STACK_DEPTH];
+    unsigned int ram_addr;          // selected by DADD=C
+    unsigned int peripheral;        // selected by PFAD=C, 0 if none
+    unsigned int key;               // key code for C=KEYS and GOKEYS
+    unsigned int key_flag;
+    unsigned int key_down;
+    unsigned int display_on;
+    unsigned long long executed;    // instructions since nut_init()
+    const unsigned short *page[NUT_PAGES];     // active bank per page
+    unsigned short *rom[NUT_PAGES][NUT_BANKS]; // NULL if not loaded
+    int bank[NUT_PAGES];
+    unsigned long long ram[NUT_RAM_SIZE];
+    struct nut_entry_t dispatch[0x400];
+    const char *unknown;            // mnemonic without an operation
+};
+
+typedef struct nut_entry_t nut_entry;
+typedef struct nut_cpu_t nut_cpu;
+
+// Resets the processor, with empty pages, and builds its dispatch
+// table. Returns 0, or -1 if a mnemonic of the table has no operation
+// (in unknown).
+int nut_init(nut_cpu *cpu);
+
+// Frees the loaded ROM.
+void nut_free(nut_cpu *cpu);
+
+// Loads count words into a bank (0 to 3) of a page. Returns 0 or -1 if
+// memory ran out.
+int nut_load(nut_cpu *cpu, int page, int bank, const unsigned short *words, int count);
+
+// Executes up to count instructions, or until POWOFF or the first
+// instruction at address stop (-1 for none). Returns NUT_*.
+int nut_run(nut_cpu *cpu, unsigned long long count, int stop);
+
+// Presses a key, or releases it with code -1.
+void nut_key(nut_cpu *cpu, int code);
+
+// Reads a ROM word through the active banks.
+int nut_rom_word(const nut_cpu *cpu, int address);
+
+#endif // !defined(__MCNUT_H__)
@@ -0,0 +1,761 @@
+/**********************************************************************
+ * MCODE Assembler
+ *
+ * Assembles MCODE source files into a ROM image:
+ *
+ *     mcodeasm [-s hp|jda|zencode] [-f rom|bin|mod] -o image file ...
+ *
+ * All files form one module. The first pass collects the labels, the
+ * second pass encodes the instructions from the SDK41 instruction
+ * table. Both passes read the files line by line, so only the symbol
+ * table and the 64K word address space are held in memory. Local
+ * labels (name) are visible in their file, global labels [name] in all
+ * files.
+ *
+ * Listing lines (address and code in front of the instruction, as
+ * written by mcodedis) are accepted. The address sets the location,
+ * the code is encoded again from the instruction.
+ *
+ * The image covers the pages from the first to the last used word.
+ * Files ending in .bin are written as 16-bit big-endian words, files
+ * ending in .mod as a MOD1 module with a page record for every page
+ * with code (see mcmod.h), all other files as 4 words packed into 5
+ * bytes. The first .TITLE is the title of a module.
+ *********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "mcinstr.h"
+#include "mcop.h"
+#include "mcdecode.h"
+#include "mcsymbol.h"
+#include "mcimage.h"
+#include "mcmod.h"
+
+#define ADDRESS_SPACE   0x10000
+#define PAGE_WORDS      0x1000
+#define MAX_LINE_SIZE   1024
+#define MAX_NAME_SIZE   256
+#define FORMAT_MOD      2
+
+struct assembler_t {
+    symtab symbols;
+    unsigned short image[ADDRESS_SPACE];
+    unsigned char used[ADDRESS_SPACE];
+    char title[MAX_NAME_SIZE];
+    int pass;
+    int set;
+    int location;
+    int errors;
+    int file;
+    const char *path;
+    int line;
+};
+
+typedef struct assembler_t assembler;
+
+static void error(assembler *as, const char *fmt, ...)
+{
+    va_list args;
+    as->errors++;
+    fprintf(stderr, "%s:%d: ", as->path, as->line);
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    fprintf(stderr, "\n");
+}
+
+static int is_space(char ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
+}
+
+static int hex_value(char ch)
+{
+    if (ch >= '0' && ch <= '9') {
+        return ch - '0';
+    } else if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + 10;
+    }
+    return -1;
+}
+
+static const char *skip_space(const char *p)
+{
+    while (is_space(*p)) {
+        p++;
+    }
+    return p;
+}
+
+// end of a token: white space, comment or end of line
+static int is_end(char ch)
+{
+    return !ch || ch == ';' || is_space(ch);
+}
+
+static void emit(assembler *as, int word)
+{
+    if (as->location >= ADDRESS_SPACE) {
+        if (as->location == ADDRESS_SPACE && as->pass == 2) {
+            error(as, "code beyond address FFFF");
+        }
+    } else if (as->pass == 2) {
+        if (as->used[as->location]) {
+            error(as, "address %04X is already used", as->location);
+        }
+        as->image[as->location] = word & 0x3FF;
+        as->used[as->location] = 1;
+    }
+    as->location++;
+}
+
+// Reads a hex number of min to max digits.
+static int parse_hex(const char **p, int min, int max, int *value)
+{
+    int n = 0;
+    *value = 0;
+    while (n < max && hex_value((*p)[n]) >= 0) {
+        *value = 16 * *value + hex_value((*p)[n++]);
+    }
+    if (n < min || !is_end((*p)[n])) {
+        return -1;
+    }
+    *p += n;
+    return 0;
+}
+
+static int parse_dec(const char **p, int *value)
+{
+    int n = 0;
+    *value = 0;
+    while ((*p)[n] >= '0' && (*p)[n] <= '9' && n < 6) {
+        *value = 10 * *value + (*p)[n++] - '0';
+    }
+    if (n == 0 || !is_end((*p)[n])) {
+        return -1;
+    }
+    *p += n;
+    return 0;
+}
+
+// Reads a label (name) or [name], returns its scope or -2.
+static int parse_label(assembler *as, const char **p, char *name)
+{
+    char close = **p == '(' ? ')' : **p == '[' ? ']' : 0;
+    const char *end = close ? strchr(*p + 1, close) : NULL;
+    if (!end || end == *p + 1 || end - *p > MAX_NAME_SIZE) {
+        return -2;
+    }
+    memcpy(name, *p + 1, end - *p - 1);
+    name[end - *p - 1] = '\0';
+    *p = end + 1;
+    return close == ')' ? as->file : SCOPE_GLOBAL;
+}
+
+// Reads a 4 digit hex address or a label. Labels may be undefined in
+// the first pass if forward references are allowed.
+static int parse_address(assembler *as, const char **p, int *value, int forward)
+{
+    char name[MAX_NAME_SIZE];
+    if (**p != '(' && **p != '[') {
+        if (parse_hex(p, 4, 4, value)) {
+            error(as, "address expected");
+            return -1;
+        }
+        return 0;
+    }
+    int scope = parse_label(as, p, name);
+    if (scope == -2) {
+        error(as, "invalid label");
+        return -1;
+    }
+    symbol *s = symtab_find(&as->symbols, name, scope);
+    *value = s ? s->value : 0;
+    if (!s && (as->pass == 2 || !forward)) {
+        error(as, "undefined label %s", name);
+        return -1;
+    }
+    return 0;
+}
+
+static int define_label(assembler *as, const char *name, int scope, int value)
+{
+    int created;
+    if (as->pass == 2) {
+        return 0;
+    }
+    if (!symtab_add(&as->symbols, name, scope, value, &created)) {
+        error(as, "out of memory");
+        return -1;
+    } else if (!created) {
+        error(as, "label %s is already defined", name);
+        return -1;
+    }
+    return 0;
+}
+
+static int parse_tef(const char **p)
+{
+    for (int set = 0; set < INST_SET_COUNT; set++) {
+        for (int tef = 0; tef < 8; tef++) {
+            size_t len = strlen(inst_tef_names[set][tef]);
+            if (strncmp(*p, inst_tef_names[set][tef], len) == 0 && is_end((*p)[len])) {
+                *p += len;
+                return tef;
+            }
+        }
+    }
+    return -1;
+}
+
+// Register operand: a hex digit or a decimal number up to 15, followed
+// by optional register names, e.g. 3(X) or 14/d.
+static int parse_register(const char **p)
+{
+    const char *s = *p;
+    int value = -1;
+    if (s[0] >= '0' && s[0] <= '9' && s[1] >= '0' && s[1] <= '9') {
+        value = 10*(s[0] - '0') + s[1] - '0';
+        s += 2;
+    } else if (hex_value(s[0]) >= 0) {
+        value = hex_value(s[0]);
+        s++;
+    }
+    if (*s == '(' && s[1] && s[2] == ')') {
+        s += 3;
+    }
+    if (*s == '/' && s[1]) {
+        s += 2;
+    }
+    if (value > 15 || !is_end(*s)) {
+        return -1;
+    }
+    *p = s;
+    return value;
+}
+
+// HP-41 display code of a character, -1 if it cannot be displayed
+static int display_code(char ch)
+{
+    if (ch >= 0x40 && ch <= 0x5F) {
+        return ch - 0x40;
+    } else if (ch >= 0x20 && ch <= 0x3F) {
+        return ch;
+    } else if (ch >= 'a' && ch <= 'e') {
+        return 0x101 + ch - 'a';
+    }
+    return -1;
+}
+
+// A quoted string of any characters, like the title of .TITLE
+static int parse_quoted(assembler *as, const char **p, char *text)
+{
+    const char *end = **p == '"' ? strchr(*p + 1, '"') : NULL;
+    if (!end || end - *p > MAX_NAME_SIZE) {
+        error(as, "string expected");
+        return -1;
+    }
+    memcpy(text, *p + 1, end - *p - 1);
+    text[end - *p - 1] = '\0';
+    *p = end + 1;
+    return 0;
+}
+
+// A quoted string that goes into the ROM, so every character needs a
+// display code
+static int parse_string(assembler *as, const char **p, char *text)
+{
+    if (parse_quoted(as, p, text) != 0) {
+        return -1;
+    }
+    for (const char *s = text; *s; s++) {
+        if (display_code(*s) < 0) {
+            error(as, "character '%c' cannot be displayed", *s);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// .TEXT emits the display codes, .NAME the function name backwards with
+// bit 7 set in its last character, .MESSL a message for the MESSL
+// routine with bit 9 set in its last character.
+static void emit_string(assembler *as, const char *directive, const char *text)
+{
+    int len = strlen(text);
+    for (int i = 0; i < len; i++) {
+        if (strcmp(directive, "NAME") == 0) {
+            emit(as, display_code(text[len - 1 - i]) | (i == 0 ? 0x080 : 0));
+        } else if (strcmp(directive, "MESSL") == 0) {
+            emit(as, display_code(text[i]) | (i == len - 1 ? 0x200 : 0));
+        } else {
+            emit(as, display_code(text[i]));
+        }
+    }
+}
+
+static int check_range(assembler *as, int value, int min, int max)
+{
+    if (value < min || value > max) {
+        error(as, "operand out of range");
+        return -1;
+    }
+    return 0;
+}
+
+static void assemble_directive(assembler *as, const char **p, const char *label, int label_scope)
+{
+    const char *s = *p + 1;
+    char directive[8];
+    char text[MAX_NAME_SIZE];
+    int n = 0;
+    int value;
+
+    while (s[n] >= 'A' && s[n] <= 'Z' && n < 7) {
+        directive[n] = s[n];
+        n++;
+    }
+    directive[n] = '\0';
+    *p = skip_space(s + n);
+
+    if (strcmp(directive, "HP") == 0) {
+        as->set = SET_HP;
+    } else if (strcmp(directive, "JDA") == 0) {
+        as->set = SET_JDA;
+    } else if (strcmp(directive, "ZENCODE") == 0) {
+        as->set = SET_ZENCODE;
+    } else if (strcmp(directive, "TITLE") == 0) {
+        if (parse_quoted(as, p, text) == 0 && !as->title[0]) {
+            strcpy(as->title, text);
+        }
+    } else if (strcmp(directive, "TEXT") == 0 ||
+               strcmp(directive, "NAME") == 0 ||
+               strcmp(directive, "MESSL") == 0) {
+        if (parse_string(as, p, text) == 0) {
+            emit_string(as, directive, text);
+        }
+    } else if (strcmp(directive, "BSS") == 0) {
+        if (parse_dec(p, &value) == 0) {
+            while (value--) {
+                emit(as, 0);
+            }
+        } else {
+            error(as, "number expected");
+        }
+    } else if (strcmp(directive, "ORG") == 0) {
+        if (parse_hex(p, 4, 4, &value) == 0) {
+            as->location = value;
+        } else {
+            error(as, "address expected");
+        }
+    } else if (strcmp(directive, "FILLTO") == 0) {
+        if (parse_hex(p, 4, 4, &value) == 0) {
+            if (value < as->location) {
+                error(as, "location is already beyond %04X", value);
+            }
+            while (as->location <= value) {
+                emit(as, 0);
+            }
+        } else {
+            error(as, "address expected");
+        }
+    } else if (strcmp(directive, "EQU") == 0) {
+        char name[MAX_NAME_SIZE];
+        if (!label) {
+            label_scope = parse_label(as, p, name);
+            label = name;
+            *p = skip_space(*p);
+        }
+        if (label_scope == -2) {
+            error(as, "label expected");
+        } else if (parse_address(as, p, &value, 0) == 0) {
+            define_label(as, label, label_scope, value);
+        }
+    } else {
+        error(as, "unknown directive .%s", directive);
+        *p += strlen(*p);
+    }
+}
+
+static void assemble_instruction(assembler *as, const char **p)
+{
+    char name[INAME_SIZE + 1];
+    int n = 0;
+    while (!is_end((*p)[n]) && n < INAME_SIZE) {
+        name[n] = (*p)[n];
+        n++;
+    }
+    name[n] = '\0';
+    int i = is_end((*p)[n]) ? search_inst(name, as->set) : -1;
+    if (i < 0) {
+        error(as, search_inst(name, SET_ALL) >= 0 ? "%s is not in the current instruction set" : "unknown mnemonic %s", name);
+        *p += strlen(*p);
+        return;
+    }
+    *p = skip_space(*p + n);
+
+    const struct inst_type *in = &inst[i];
+    int address = as->location;
+    int value = 0;
+    switch (in->typ) {
+        case MCODE_OP_NONE1:
+        case MCODE_OP_NONE2:
+        case MCODE_OP_NONE3:
+            emit(as, in->tyte1);
+            break;
+        case MCODE_OP_TEF1:
+        case MCODE_OP_TEF2:
+            value = parse_tef(p);
+            if (value < 0) {
+                error(as, "field expected");
+            }
+            emit(as, in->tyte1 | (value & 7) << 2);
+            if (in->typ == MCODE_OP_TEF2) {
+                emit(as, in->tyte2 | (value & 7) << 2);
+            }
+            break;
+        case MCODE_OP_0_TO_13_DEC:
+            if (parse_dec(p, &value) || check_range(as, value, 0, 13)) {
+                value = 0;
+            }
+            emit(as, in->tyte1 | inst_digit_code[value] << 6);
+            break;
+        case MCODE_OP_0_TO_F_HEX:
+            value = parse_register(p);
+            if (value < 0) {
+                error(as, "register expected");
+            }
+            emit(as, in->tyte1 | (value & 0xF) << 6);
+            break;
+        case MCODE_OP_0_TO_7:
+            if (parse_dec(p, &value) || check_range(as, value, 0, 7)) {
+                value = 0;
+            }
+            emit(as, in->tyte1 | value << 6);
+            break;
+        case MCODE_OP_DISPLACEMENT:
+            if (**p == '+' || **p == '-') {
+                int sign = *(*p)++ == '-' ? -1 : 1;
+                if (parse_dec(p, &value)) {
+                    error(as, "displacement expected");
+                }
+                value *= sign;
+            } else if (parse_address(as, p, &value, 1) == 0) {
+                value -= address;
+            }
+            if (as->pass == 2 && check_range(as, value, -64, 63)) {
+                value = 0;
+            }
+            emit(as, in->tyte1 | (value & 0x7F) << 3);
+            break;
+        case MCODE_OP_ADDRESS1:
+            parse_address(as, p, &value, 1);
+            emit(as, in->tyte1 | (value & 0xFF) << 2);
+            emit(as, in->tyte2 | (value >> 8) << 2);
+            break;
+        case MCODE_OP_ADDRESS2:
+        case MCODE_OP_ADDRESS4:
+            // the target word is relative to the current 1K block
+            if (parse_address(as, p, &value, 1) == 0 && as->pass == 2 &&
+                (value & 0xFC00) != (address & 0xFC00)) {
+                error(as, "%04X is not in the 1K block of the instruction", value);
+            }
+            emit(as, in->tyte1);
+            emit(as, in->tyte2);
+            emit(as, value & 0x3FF);
+            break;
+        case MCODE_OP_000_TO_FFF_HEX:
+            if (parse_hex(p, 3, 3, &value)) {
+                error(as, "3 digit hex number expected");
+            }
+            emit(as, in->tyte1 | (value >> 8 & 0xF) << 6);
+            emit(as, in->tyte2 | (value >> 4 & 0xF) << 6);
+            emit(as, in->tyte3 | (value & 0xF) << 6);
+            break;
+        case MCODE_OP_000_TO_3FF_HEX:
+            if (parse_hex(p, 3, 3, &value) || check_range(as, value, 0, 0x3FF)) {
+                error(as, "code expected");
+            }
+            emit(as, in->tyte1);
+            emit(as, value);
+            break;
+        case MCODE_OP_1_TO_31_DEC:
+        case MCODE_OP_0_TO_64_DEC:
+            if (parse_dec(p, &value) == 0) {
+                check_range(as, value, in->typ == MCODE_OP_1_TO_31_DEC ? 1 : 0,
+                    in->typ == MCODE_OP_1_TO_31_DEC ? 31 : 64);
+            } else {
+                error(as, "number expected");
+            }
+            emit(as, value);
+            break;
+        case MCODE_OP_ADDRESS3:
+        case MCODE_OP_ADDRESS5:
+            // function address table entry within a 4K or 8K ROM
+            parse_address(as, p, &value, 1);
+            emit(as, in->tyte1 | ((value >> 8) & (in->typ == MCODE_OP_ADDRESS3 ? 0x0F : 0x1F)));
+            emit(as, in->tyte2 | (value & 0xFF));
+            break;
+        case MCODE_OP_UNKNOWN:
+            // CON: a code or the low 10 bits of a label
+            if (**p == '(' || **p == '[') {
+                parse_address(as, p, &value, 1);
+            } else if (parse_hex(p, 3, 3, &value) || check_range(as, value, 0, 0x3FF)) {
+                error(as, "code expected");
+            }
+            emit(as, value);
+            break;
+        default:
+            error(as, "%s cannot be assembled", in->name);
+            break;
+    }
+}
+
+// A listing line starts with a 4 digit address and 1 to 3 codes.
+static int parse_listing_prefix(const char **p, int *address)
+{
+    const char *s = *p;
+    if (parse_hex(&s, 4, 4, address)) {
+        return 0;
+    }
+    s = skip_space(s);
+    int n = 0;
+    while (n < 9 && s[n] >= '0' && s[n] <= '3' && hex_value(s[n + 1]) >= 0 && hex_value(s[n + 2]) >= 0) {
+        n += 3;
+    }
+    if (n == 0 || !is_end(s[n])) {
+        return 0;
+    }
+    *p = s + n;
+    return 1;
+}
+
+static void assemble_line(assembler *as, const char *line)
+{
+    char label[MAX_NAME_SIZE];
+    int label_scope = -2;
+    int address;
+    int errors = as->errors;
+    const char *p = skip_space(line);
+
+    if (*p == '*') {
+        return;
+    }
+    if (parse_listing_prefix(&p, &address)) {
+        as->location = address;
+    }
+    p = skip_space(p);
+    if (*p == '(' || *p == '[') {
+        label_scope = parse_label(as, &p, label);
+        if (label_scope == -2) {
+            error(as, "invalid label");
+            return;
+        }
+        p = skip_space(p);
+        if (strncmp(p, ".EQU", 4) != 0) {
+            define_label(as, label, label_scope, as->location);
+        }
+    }
+
+    if (*p == '.') {
+        assemble_directive(as, &p, label_scope == -2 ? NULL : label, label_scope);
+    } else if (*p == '#') {
+        int value;
+        p = skip_space(p + 1);
+        if (parse_hex(&p, 3, 3, &value) || value > 0x3FF) {
+            error(as, "code expected");
+        }
+        emit(as, value);
+    } else if (*p && *p != ';') {
+        assemble_instruction(as, &p);
+    }
+
+    p = skip_space(p);
+    if (*p && *p != ';' && as->errors == errors) {
+        error(as, "unexpected text: %s", p);
+    }
+}
+
+static int assemble_file(assembler *as, const char *path)
+{
+    char line[MAX_LINE_SIZE];
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        perror(path);
+        as->errors++;
+        return -1;
+    }
+    as->path = path;
+    as->line = 0;
+    while (fgets(line, sizeof(line), file)) {
+        as->line++;
+        size_t len = strlen(line);
+        if (len == sizeof(line) - 1 && line[len - 1] != '\n' && !feof(file)) {
+            error(as, "line too long");
+            int ch;
+            while ((ch = fgetc(file)) != EOF && ch != '\n') {
+            }
+            continue;
+        }
+        while (len > 0 && is_space(line[len - 1])) {
+            line[--len] = '\0';
+        }
+        assemble_line(as, line);
+    }
+    fclose(file);
+    return 0;
+}
+
+static int write_image(const assembler *as, const char *path, int format)
+{
+    int first = ADDRESS_SPACE;
+    int last = -1;
+    for (int a = 0; a < ADDRESS_SPACE; a++) {
+        if (as->used[a]) {
+            first = a < first ? a : first;
+            last = a;
+        }
+    }
+    if (last < 0) {
+        fprintf(stderr, "mcodeasm: no code\n");
+        return -1;
+    }
+    first &= ~(PAGE_WORDS - 1);
+    last |= PAGE_WORDS - 1;
+
+    size_t size = image_bytes(last - first + 1, format);
+    unsigned char *bytes = malloc(size);
+    if (!bytes) {
+        fprintf(stderr, "mcodeasm: out of memory\n");
+        return -1;
+    }
+    image_pack(as->image + first, last - first + 1, format, bytes);
+
+    FILE *file = fopen(path, "wb");
+    int rc = -1;
+    if (!file) {
+        perror(path);
+    } else {
+        rc = fwrite(bytes, 1, size, file) == size ? 0 : -1;
+        if (fclose(file) || rc) {
+            perror(path);
+            rc = -1;
+        }
+    }
+    free(bytes);
+    return rc;
+}
+
+// Writes one page record per page with code, in bank 1, named after
+// the file.
+static int write_module(const assembler *as, const char *path)
+{
+    mod_info info;
+    mod_page record;
+    mod_writer writer;
+
+    memset(&info, 0, sizeof(info));
+    memset(&record, 0, sizeof(record));
+    size_t n = strlen(as->title);
+    memcpy(info.title, as->title, n < sizeof(info.title) ? n : sizeof(info.title) - 1);
+    const char *base = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    n = strcspn(base, ".");
+    memcpy(record.name, base, n < sizeof(record.name) ? n : sizeof(record.name) - 1);
+    record.bank = 1;
+
+    if (mod_create(&writer, path, &info)) {
+        perror(path);
+        return -1;
+    }
+    for (int page = 0; page < ADDRESS_SPACE / PAGE_WORDS; page++) {
+        const unsigned char *used = as->used + page * PAGE_WORDS;
+        if (!memchr(used, 1, PAGE_WORDS)) {
+            continue;
+        }
+        record.page = page;
+        if (mod_write(&writer, &record, as->image + page * PAGE_WORDS)) {
+            perror(path);
+            mod_finish(&writer);
+            return -1;
+        }
+    }
+    if (writer.pages == 0) {
+        fprintf(stderr, "mcodeasm: no code\n");
+        mod_finish(&writer);
+        return -1;
+    }
+    if (mod_finish(&writer)) {
+        perror(path);
+        return -1;
+    }
+    return 0;
+}
+
+static int parse_set(const char *name)
+{
+    if (strcmp(name, "hp") == 0) {
+        return SET_HP;
+    } else if (strcmp(name, "jda") == 0) {
+        return SET_JDA;
+    } else if (strcmp(name, "zencode") == 0) {
+        return SET_ZENCODE;
+    }
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodeasm [-s hp|jda|zencode] [-f rom|bin|mod] -o image file ...\n");
+    fprintf(stderr, "  -s  initial mnemonic set (default hp)\n");
+    fprintf(stderr, "  -f  image format (default bin for .bin files, mod for .mod files, rom otherwise)\n");
+    fprintf(stderr, "  -o  image file to write\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static assembler as;
+    const char *output = NULL;
+    int set = SET_HP;
+    int format = -1;
+    int i;
+
+    for (i = 1; i + 1 < argc && argv[i][0] == '-'; i += 2) {
+        const char *arg = argv[i + 1];
+        if (strcmp(argv[i], "-s") == 0 && parse_set(arg)) {
+            set = parse_set(arg);
+        } else if (strcmp(argv[i], "-f") == 0 && strcmp(arg, "mod") == 0) {
+            format = FORMAT_MOD;
+        } else if (strcmp(argv[i], "-f") == 0 && (strcmp(arg, "rom") == 0 || strcmp(arg, "bin") == 0)) {
+            format = strcmp(arg, "bin") == 0 ? IMAGE_BIN : IMAGE_ROM;
+        } else if (strcmp(argv[i], "-o") == 0) {
+            output = arg;
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (i == argc || !output) {
+        usage();
+        return 2;
+    }
+    if (format < 0) {
+        format = mod_path(output) ? FORMAT_MOD : image_format(output);
+    }
+
+    symtab_init(&as.symbols);
+    for (as.pass = 1; as.pass <= 2 && !as.errors; as.pass++) {
+        as.set = set;
+        as.location = 0;
+        for (int f = i; f < argc; f++) {
+            as.file = f - i;
+            assemble_file(&as, argv[f]);
+        }
+    }
+    int rc = as.errors ? -1 : format == FORMAT_MOD ? write_module(&as, output) : write_image(&as, output, format);
+    symtab_free(&as.symbols);
+    return rc ? 1 : 0;
+}
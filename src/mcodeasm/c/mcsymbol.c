@@ -0,0 +1,125 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcsymbol.h"
+
+#define INITIAL_SIZE    1024
+#define NAME_BLOCK_SIZE 0x10000
+
+struct name_block_t {
+    struct name_block_t *next;
+    size_t used;
+    char data[NAME_BLOCK_SIZE];
+};
+
+typedef struct name_block_t name_block;
+
+static unsigned int hash_name(const char *name, int scope)
+{
+    unsigned int h = 2166136261u ^ (unsigned int) scope;
+    while (*name) {
+        h = (h ^ (unsigned char) *name++) * 16777619u;
+    }
+    return h;
+}
+
+static const char *copy_name(symtab *table, const char *name)
+{
+    size_t len = strlen(name) + 1;
+    if (len > NAME_BLOCK_SIZE) {
+        return NULL;
+    }
+    if (!table->names || table->names->used + len > NAME_BLOCK_SIZE) {
+        name_block *block = malloc(sizeof(name_block));
+        if (!block) {
+            return NULL;
+        }
+        block->next = table->names;
+        block->used = 0;
+        table->names = block;
+    }
+    char *copy = table->names->data + table->names->used;
+    memcpy(copy, name, len);
+    table->names->used += len;
+    return copy;
+}
+
+static symbol *probe(const symtab *table, const char *name, int scope, unsigned int hash)
+{
+    unsigned int mask = table->size - 1;
+    for (unsigned int i = hash & mask;; i = (i + 1) & mask) {
+        symbol *s = &table->slots[i];
+        if (!s->name ||
+            (s->hash == hash && s->scope == scope && strcmp(s->name, name) == 0)) {
+            return s;
+        }
+    }
+}
+
+static int grow(symtab *table)
+{
+    int size = table->size ? 2*table->size : INITIAL_SIZE;
+    symbol *slots = calloc(size, sizeof(symbol));
+    if (!slots) {
+        return -1;
+    }
+    symtab old = *table;
+    table->slots = slots;
+    table->size = size;
+    for (int i = 0; i < old.size; i++) {
+        if (old.slots[i].name) {
+            *probe(table, old.slots[i].name, old.slots[i].scope, old.slots[i].hash) = old.slots[i];
+        }
+    }
+    free(old.slots);
+    return 0;
+}
+
+void symtab_init(symtab *table)
+{
+    table->slots = NULL;
+    table->size = 0;
+    table->count = 0;
+    table->names = NULL;
+}
+
+void symtab_free(symtab *table)
+{
+    while (table->names) {
+        name_block *next = table->names->next;
+        free(table->names);
+        table->names = next;
+    }
+    free(table->slots);
+    symtab_init(table);
+}
+
+symbol *symtab_find(const symtab *table, const char *name, int scope)
+{
+    if (!table->size) {
+        return NULL;
+    }
+    symbol *s = probe(table, name, scope, hash_name(name, scope));
+    return s->name ? s : NULL;
+}
+
+symbol *symtab_add(symtab *table, const char *name, int scope, int value, int *created)
+{
+    if (4*(table->count + 1) > 3*table->size && grow(table)) {
+        return NULL;
+    }
+    unsigned int hash = hash_name(name, scope);
+    symbol *s = probe(table, name, scope, hash);
+    *created = !s->name;
+    if (*created) {
+        s->name = copy_name(table, name);
+        if (!s->name) {
+            return NULL;
+        }
+        s->hash = hash;
+        s->scope = scope;
+        s->value = value;
+        table->count++;
+    }
+    return s;
+}
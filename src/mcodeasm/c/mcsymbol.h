@@ -0,0 +1,42 @@
+#if !defined(__MCSYMBOL_H__)
+#define __MCSYMBOL_H__
+
+// Symbol table of the assembler.
+//
+// Open addressing with linear probing over a power of two number of
+// slots, the table grows at 3/4 load. Names are copied into an arena
+// of large blocks that is freed as a whole. Local labels are scoped by
+// the index of their source file, global labels use SCOPE_GLOBAL.
+
+#define SCOPE_GLOBAL    (-1)
+
+struct symbol_t {
+    const char *name;
+    unsigned int hash;
+    int scope;
+    int value;
+};
+
+struct name_block_t;
+
+struct symtab_t {
+    struct symbol_t *slots;
+    int size;
+    int count;
+    struct name_block_t *names;
+};
+
+typedef struct symbol_t symbol;
+typedef struct symtab_t symtab;
+
+void symtab_init(symtab *table);
+void symtab_free(symtab *table);
+
+// Returns the symbol or NULL if it is not defined.
+symbol *symtab_find(const symtab *table, const char *name, int scope);
+
+// Adds a symbol. Returns NULL if there is no memory left, *created is
+// 0 if the symbol already existed.
+symbol *symtab_add(symtab *table, const char *name, int scope, int value, int *created);
+
+#endif // !defined(__MCSYMBOL_H__)
@@ -0,0 +1,346 @@
+/**********************************************************************
+ * MCODE Checker CLI
+ *
+ *     mcodechk [-s hp|jda|zencode] [-a] [-i index] [file ...]
+ *
+ * Checks MCODE source files line by line without assembling them: every
+ * mnemonic must be known and part of the instruction set in effect, and
+ * every operand must be in the domain of its operand type. Problems are
+ * printed as
+ *
+ *     path:line: message
+ *
+ * with the messages of mcodeasm. With -a, the files are written to
+ * standard output instead, with an *** ERROR annotation after every
+ * line with a problem, as mcodegen writes them and the lexers highlight
+ * them; annotations already in the input are dropped, so checking an
+ * annotated listing again gives the same listing.
+ *
+ * The labels of all files go into a label index (see mclabel.h). After
+ * the files, labels that no file defines and labels defined more than
+ * once are reported like other problems, to standard error with -a.
+ * Input is read in large chunks, so a check of a million lines takes a
+ * fraction of a second and can run on every save.
+ *
+ * With -i, the label index is loaded from a file and saved to it again
+ * after the check. A file that had no problem of its own at the last
+ * check, with the same initial set, and whose size and modification
+ * time are the same is not read again; its labels come from the saved
+ * index. Only changed files and files with problems are checked, so the
+ * output is the same as without the index. Files of the saved index
+ * that are not given drop out of it.
+ *
+ * The exit status is 1 if there was a problem.
+ *********************************************************************/
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcinstr.h"
+#include "mccheck.h"
+#include "mclabel.h"
+
+#define CHUNK_SIZE      (1 << 16)
+#define MAX_LINE_SIZE   1024            // of mcodeasm
+#define OUT_SIZE        (1 << 16)
+
+struct checker_t {
+    const char *path;
+    unsigned long line;
+    unsigned long problems;
+    int set;
+    int annotate;
+    label_index labels;
+    int file;                   // in labels
+    label_site *sites;          // of the file
+    int site_count;
+    int site_size;
+    int failed;                 // out of memory
+    char out[OUT_SIZE];
+    size_t out_len;
+};
+
+typedef struct checker_t checker;
+
+static void flush_output(checker *ck)
+{
+    fwrite(ck->out, 1, ck->out_len, stdout);
+    ck->out_len = 0;
+}
+
+static void put_bytes(checker *ck, const char *s, size_t len)
+{
+    if (ck->out_len + len > OUT_SIZE) {
+        flush_output(ck);
+    }
+    if (len > OUT_SIZE) {
+        fwrite(s, 1, len, stdout);
+        return;
+    }
+    memcpy(ck->out + ck->out_len, s, len);
+    ck->out_len += len;
+}
+
+static void report(checker *ck, const char *message, size_t len)
+{
+    char prefix[64];
+    ck->problems++;
+    if (ck->annotate) {
+        put_bytes(ck, "*** ERROR: ", 11);
+        put_bytes(ck, message, len);
+        put_bytes(ck, "\n", 1);
+    } else {
+        put_bytes(ck, ck->path, strlen(ck->path));
+        put_bytes(ck, prefix, snprintf(prefix, sizeof(prefix), ":%lu: ", ck->line));
+        put_bytes(ck, message, len);
+        put_bytes(ck, "\n", 1);
+    }
+}
+
+static void add_site(checker *ck, const char *line, int kind, int start, int length)
+{
+    if (ck->site_count == ck->site_size) {
+        int size = ck->site_size ? 2 * ck->site_size : 1024;
+        label_site *sites = realloc(ck->sites, size * sizeof(label_site));
+        if (!sites) {
+            ck->failed = 1;
+            return;
+        }
+        ck->sites = sites;
+        ck->site_size = size;
+    }
+    label_site *s = &ck->sites[ck->site_count];
+    s->name = label_index_intern(&ck->labels, ck->file, line + start, length);
+    s->kind = kind;
+    s->line = (int) ck->line - 1;
+    s->start = start;
+    s->length = length;
+    if (s->name < 0) {
+        ck->failed = 1;
+    } else {
+        ck->site_count++;
+    }
+}
+
+// line is len bytes without the line end, which has end_len bytes.
+static void check_line(checker *ck, const char *line, size_t len, size_t end_len)
+{
+    char message[128];
+    inst_check result;
+
+    ck->line++;
+    if (ck->annotate) {
+        if (len >= 9 && memcmp(line, "*** ERROR", 9) == 0) {
+            return;
+        }
+        put_bytes(ck, line, len + end_len);
+    }
+    if (len >= MAX_LINE_SIZE - 1) {
+        report(ck, "line too long", 13);
+        return;
+    }
+    inst_check_line(line, len, &result);
+    if (result.set) {
+        ck->set = result.set;
+    }
+    if (result.label_start >= 0) {
+        add_site(ck, line, LABEL_DEFINITION, result.label_start, result.label_length);
+    }
+    if (result.target_start >= 0) {
+        add_site(ck, line, LABEL_REFERENCE, result.target_start, result.target_length);
+    }
+    if (result.inst >= 0 && !(inst[result.inst].set & ck->set)) {
+        int n = snprintf(message, sizeof(message), "%.*s is not in the current instruction set",
+            result.word_length, line + result.word_start);
+        report(ck, message, n);
+    } else if (result.code) {
+        report(ck, message, inst_check_format(&result, line, len, message, sizeof(message)));
+    }
+}
+
+static int check_file(checker *ck, FILE *file)
+{
+    static char buf[CHUNK_SIZE + MAX_LINE_SIZE];
+    size_t kept = 0;
+    size_t len;
+    int too_long = 0;
+
+    ck->line = 0;
+    ck->site_count = 0;
+    ck->file = label_index_file(&ck->labels, ck->path);
+    if (ck->file < 0) {
+        return -1;
+    }
+    while ((len = fread(buf + kept, 1, CHUNK_SIZE, file)) > 0) {
+        char *p = buf;
+        char *end = buf + kept + len;
+        char *nl;
+        while ((nl = memchr(p, '\n', end - p)) != NULL) {
+            size_t n = nl - p;
+            size_t cr = n > 0 && p[n - 1] == '\r';
+            if (too_long) {
+                // the end of a line that is not checked, like mcodeasm
+                if (ck->annotate) {
+                    put_bytes(ck, p, n + 1);
+                }
+                ck->line++;
+                report(ck, "line too long", 13);
+                too_long = 0;
+            } else {
+                check_line(ck, p, n - cr, cr + 1);
+            }
+            p = nl + 1;
+        }
+        kept = end - p;
+        if (kept >= MAX_LINE_SIZE) {
+            if (ck->annotate) {
+                put_bytes(ck, p, kept);
+            }
+            too_long = 1;
+            kept = 0;
+        }
+        memmove(buf, p, kept);
+    }
+    if (too_long) {
+        if (ck->annotate) {
+            put_bytes(ck, buf, kept);
+            put_bytes(ck, "\n", 1);
+        }
+        ck->line++;
+        report(ck, "line too long", 13);
+    } else if (kept > 0) {
+        check_line(ck, buf, kept, 0);
+    }
+    if (label_index_set_sites(&ck->labels, ck->file, ck->sites, ck->site_count)) {
+        ck->failed = 1;
+    }
+    return ferror(file) ? -1 : 0;
+}
+
+// Reports a label that is not defined in any file or defined twice.
+static void report_label(void *user, int file, const label_site *site)
+{
+    checker *ck = (checker *) user;
+    const label_name *n = &ck->labels.names[site->name];
+    fprintf(ck->annotate ? stderr : stdout, "%s:%d: %s %s%s\n", ck->labels.files[file].path, site->line + 1,
+        site->kind == LABEL_REFERENCE ? "undefined label" : "label", n->name,
+        site->kind == LABEL_REFERENCE ? "" : " is defined more than once");
+    ck->problems++;
+}
+
+static int parse_set(const char *name)
+{
+    if (strcmp(name, "hp") == 0) {
+        return SET_HP;
+    } else if (strcmp(name, "jda") == 0) {
+        return SET_JDA;
+    } else if (strcmp(name, "zencode") == 0) {
+        return SET_ZENCODE;
+    }
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodechk [-s hp|jda|zencode] [-a] [-i index] [file ...]\n");
+    fprintf(stderr, "  -s set   initial instruction set (default hp)\n");
+    fprintf(stderr, "  -a       write the files with *** ERROR annotations\n");
+    fprintf(stderr, "  -i index load the label index from a file and save it\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static checker ck;
+    const char *index_path = NULL;
+    unsigned char *given = NULL;    // the files of the saved index given
+    int loaded = 0;
+    int set = SET_HP;
+    int rc = 0;
+    int i;
+
+    for (i = 1; i < argc && argv[i][0] == '-' && argv[i][1]; i++) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc && parse_set(argv[i + 1])) {
+            set = parse_set(argv[++i]);
+        } else if (strcmp(argv[i], "-a") == 0) {
+            ck.annotate = 1;
+        } else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) {
+            index_path = argv[++i];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+
+    if (index_path) {
+        // a missing or damaged index is built again
+        if (label_index_load(&ck.labels, index_path) && errno != ENOENT && errno != EINVAL) {
+            perror(index_path);
+        }
+        loaded = ck.labels.file_count;
+        given = calloc(loaded + 1, 1);
+        if (!given) {
+            ck.failed = 1;
+        }
+    }
+
+    if (i == argc) {
+        ck.path = "-";
+        ck.set = set;
+        rc = check_file(&ck, stdin);
+    }
+    for (; i < argc; i++) {
+        label_stamp stamp;
+        int stamped = given && label_index_stamp(argv[i], &stamp) == 0;
+        int f = stamped ? label_index_find_file(&ck.labels, argv[i]) : -1;
+        if (f >= 0 && f < loaded && !ck.annotate && label_index_current(&ck.labels, f, &stamp) &&
+            ck.labels.files[f].state == set) {
+            // unchanged and without problems, the saved sites stay
+            given[f] = 1;
+            continue;
+        }
+        FILE *file = fopen(argv[i], "rb");
+        if (!file) {
+            perror(argv[i]);
+            rc = -1;
+            continue;
+        }
+        ck.path = argv[i];
+        ck.set = set;
+        unsigned long problems = ck.problems;
+        if (check_file(&ck, file)) {
+            fprintf(stderr, "%s: read error\n", argv[i]);
+            rc = -1;
+            stamped = 0;
+        }
+        if (given && ck.file >= 0) {
+            label_file *lf = &ck.labels.files[ck.file];
+            lf->stamp.size = stamped ? stamp.size : 0;
+            lf->stamp.time = stamped ? stamp.time : -1;
+            lf->state = ck.problems == problems ? set : 0;
+            if (ck.file < loaded) {
+                given[ck.file] = 1;
+            }
+        }
+        fclose(file);
+    }
+    for (int f = 0; f < loaded && given; f++) {
+        if (!given[f] && label_index_set_sites(&ck.labels, f, NULL, 0) == 0) {
+            ck.labels.files[f].stamp.time = -1;
+        }
+    }
+
+    flush_output(&ck);
+    label_index_problems(&ck.labels, report_label, &ck);
+    if (ck.failed) {
+        fprintf(stderr, "mcodechk: out of memory\n");
+        rc = -1;
+    } else if (index_path && label_index_save(&ck.labels, index_path)) {
+        perror(index_path);
+    }
+    label_index_free(&ck.labels);
+    free(given);
+    free(ck.sites);
+    return rc || ck.problems ? 1 : 0;
+}
@@ -4,189 +4,339 @@
 #include <string.h>
 
 #include "mcinstr.h"
+#include "mcdb.h"
+#include "mcopmap.h"
+#include "mctrans.h"
 
-#define SET_HP          0x1
-#define SET_JDA         0x2
-#define SET_ZENCODE     0x4
+#define MAX_LINE_SIZE   4096
+#define OUTPUT_SIZE     (MAX_LINE_SIZE + 32)
 
-#define TYPE_COUNT      20  // strlen(mnemonic_types)
+static const int sets[MCDB_SET_COUNT] = { SET_HP, SET_JDA, SET_ZENCODE };
+static const char *const set_names[MCDB_SET_COUNT] = { "HP", "JDA", "ZENCODE" };
+static const char *const set_keys[MCDB_SET_COUNT] = { "hp", "jda", "zencode" };
 
-static const char *mnemonic_types = "ADEFGHIJKLMNOPQRSTU?";
+// Output formats of the mnemonic table; the binary map is written in
+// passes, rows first and then their name lists.
+#define FORMAT_COUNT        0
+#define FORMAT_CSV          1
+#define FORMAT_JSON         2
+#define FORMAT_ROWS         3
+#define FORMAT_NAMES        4
 
-struct mnemonic_t {
-    char *hp;
-    char *jda;
-    char *zencode;
+struct table_t {
+    int format;
+    uint32_t rows;
+    uint32_t names;
+    int failed;                         // writing stdout failed
 };
 
-typedef struct mnemonic_t *mnemonic;
+typedef struct table_t table;
 
-struct mnemonic_variants_t {
-    mnemonic m[TYPE_COUNT];
-};
-
-typedef struct mnemonic_variants_t *mnemonic_variants;
-
-static mnemonic_variants mvtab[0x400];
-
-static void clear_mnemonics()
+static void write_data(table *out, const void *data, size_t size)
 {
-    for (int code = 0; code < 0x400; code++) {
-        mvtab[code] = 0;
+    if (fwrite(data, 1, size, stdout) != size) {
+        out->failed = 1;
     }
 }
 
-static int get_variant(int ch)
+// The names and descriptions are plain ASCII; quotes and backslashes
+// are escaped all the same.
+static void print_json_string(const char *s)
 {
-    const char *pch = strchr(mnemonic_types, ch);
-    if (pch) {
-        return pch - mnemonic_types;
-    } else {
-        return -1;
+    putchar('"');
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            putchar('\\');
+        }
+        putchar(*s);
     }
+    putchar('"');
 }
 
-static void add_mnemonic(char **buf, const char *name)
+// Prints the mnemonics of one opcode, operand type and set in inst[]
+// order: separated by '|' (FORMAT_CSV), as JSON strings (FORMAT_JSON),
+// as string offsets (FORMAT_NAMES) or not at all. Returns the number of
+// mnemonics.
+static int print_names(const mcdb *db, const mcdb_list *opcode, int typ, int set, table *out)
 {
-    if (*buf) {
-        char *tmp = *buf;
-        *buf = malloc(strlen(tmp) + strlen(name) + 2);
-        if (*buf) {
-            strcpy(*buf, tmp);
-            strcat(*buf, "|");
-            strcat(*buf, name);
+    const uint16_t *items = mcdb_items(db, opcode);
+    int count = 0;
+    for (uint32_t i = 0; i < opcode->count; i++) {
+        const mcdb_inst *in = mcdb_get(db, items[i]);
+        if (in->typ == typ && (in->set & set)) {
+            if (out->format == FORMAT_CSV) {
+                printf("%s%s", count ? "|" : "", mcdb_string(db, in->name));
+            } else if (out->format == FORMAT_JSON) {
+                printf("%s", count ? ", " : "");
+                print_json_string(mcdb_string(db, in->name));
+            } else if (out->format == FORMAT_NAMES) {
+                write_data(out, &in->name, sizeof(in->name));
+            }
+            count++;
         }
-        free(tmp);
-    } else {
-        *buf = strdup(name);
     }
+    return count;
 }
 
-static mnemonic add_mnemonic_variant(int code, int variant)
+static void print_row(const mcdb *db, int code, const mcdb_type *type, table *out)
 {
-    if (!mvtab[code]) {
-        mvtab[code] = (mnemonic_variants) malloc(sizeof(struct mnemonic_variants_t));
-        if (mvtab[code]) {
-            for (int i = 0; i < TYPE_COUNT; i++) {
-                mvtab[code]->m[i] = 0;
-            }
-        } else {
-            return 0;
+    const mcdb_list *opcode = mcdb_opcode(db, code);
+    table count = { FORMAT_COUNT, 0, 0, 0 };
+    mcopmap_row row;
+
+    switch (out->format) {
+    case FORMAT_CSV:
+        printf("0x%3.3X;", code);
+        for (int s = 0; s < MCDB_SET_COUNT; s++) {
+            print_names(db, opcode, type->typ, sets[s], out);
+            printf(";");
         }
-    }
-    if (!mvtab[code]->m[variant]) {
-        mvtab[code]->m[variant] = (mnemonic) malloc(sizeof(struct mnemonic_t));
-        if (mvtab[code]->m[variant]) {
-            mvtab[code]->m[variant]->hp = 0;
-            mvtab[code]->m[variant]->jda = 0;
-            mvtab[code]->m[variant]->zencode = 0;
+        printf("%c;%s\n", type->typ, mcdb_string(db, type->operand));
+        break;
+    case FORMAT_JSON:
+        printf("%s\n  {\"code\": %d, \"typ\": \"%c\", \"operand\": ", out->rows ? "," : "", code, type->typ);
+        print_json_string(mcdb_string(db, type->operand));
+        for (int s = 0; s < MCDB_SET_COUNT; s++) {
+            printf(", \"%s\": [", set_keys[s]);
+            print_names(db, opcode, type->typ, sets[s], out);
+            printf("]");
         }
+        printf("}");
+        break;
+    case FORMAT_ROWS:
+        memset(&row, 0, sizeof(row));
+        row.code = (uint16_t) code;
+        row.typ = type->typ;
+        row.operand = type->operand;
+        for (int s = 0; s < MCDB_SET_COUNT; s++) {
+            row.sets[s].offset = out->names;
+            row.sets[s].count = print_names(db, opcode, type->typ, sets[s], &count);
+            out->names += row.sets[s].count;
+        }
+        write_data(out, &row, sizeof(row));
+        break;
+    default:
+        for (int s = 0; s < MCDB_SET_COUNT; s++) {
+            out->names += print_names(db, opcode, type->typ, sets[s], out);
+        }
+        break;
     }
-    return mvtab[code]->m[variant];
+    out->rows++;
 }
 
-void read_mnemonics() {
-    for (int i  = 0; i < IHT_SIZE; i++) {
-        int code = inst[i].tyte1;
-        int variant = get_variant(inst[i].typ);
-        if (variant >= 0) {
-            mnemonic m = add_mnemonic_variant(code, variant);
-            if (m) {
-                if (inst[i].set & SET_HP) {
-                    add_mnemonic(&m->hp, inst[i].name);
-                }
-                if (inst[i].set & SET_JDA) {
-                    add_mnemonic(&m->jda, inst[i].name);
-                }
-                if (inst[i].set & SET_ZENCODE) {
-                    add_mnemonic(&m->zencode, inst[i].name);
-                }
+// One row per opcode and operand type that has mnemonics, ordered by
+// code and then by the type table of the database.
+static void print_rows(const mcdb *db, table *out)
+{
+    const mcdb_type *types = (const mcdb_type *) (db->base + db->header->types);
+    table count = { FORMAT_COUNT, 0, 0, 0 };
+    for (int code = 0; code < MCDB_OPCODE_COUNT; code++) {
+        const mcdb_list *opcode = mcdb_opcode(db, code);
+        for (uint32_t t = 0; t < db->header->type_count && opcode->count; t++) {
+            if (print_names(db, opcode, types[t].typ, SET_ALL, &count) != 0) {
+                print_row(db, code, &types[t], out);
             }
         }
     }
 }
 
-static const char *get_operand(const int optype)
+// Writes the binary map (mcopmap.h) to stdout. Its string table is the
+// one of the database, so the rows and names keep the string offsets of
+// the database. Nothing is allocated: the rows and names are counted in
+// a first pass and written in two more.
+static int write_map(const mcdb *db)
 {
-    switch (optype) {
-        case 'A':
-        case 'K':
-        case 'U':
-        case '?': return "none";
-        case 'D':
-        case 'N': return "TEF";
-        case 'E': return "0 to 13 (dec)";
-        case 'F': return "0 to F (hex)";
-        case 'G': return "+0 to +63 and -1 to -64 (dec)";
-        case 'H':
-        case 'I':
-        case 'S':
-        case 'T': return "0000 to FFFF (hex)";
-        case 'J': return "1 to 31 (dec)";
-        case 'L': return "0 to 7";
-        case 'M': return "000 to FFF (hex)";
-        case 'O': return "0000 to FFFF (hex)";
-        case 'P': return "0 to 64 (dec)";
-        case 'Q': return "000 to 3FF (hex)";
-        case 'R': return "???";
-        default : return "unknown";
-    }
+    table count = { FORMAT_COUNT, 0, 0, 0 };
+    table rows = { FORMAT_ROWS, 0, 0, 0 };
+    table names = { FORMAT_NAMES, 0, 0, 0 };
+    const uint32_t zero = 0;
+    mcopmap_header h;
+
+    print_rows(db, &count);
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, MCOPMAP_MAGIC, 4);
+    h.version = MCOPMAP_VERSION;
+    h.byte_order = MCOPMAP_BYTE_ORDER;
+    h.row_count = count.rows;
+    h.rows = sizeof(h);
+    h.name_count = count.names;
+    h.names = h.rows + h.row_count * sizeof(mcopmap_row);
+    h.strings = h.names + h.name_count * sizeof(uint32_t);
+    h.string_size = db->header->string_size;
+    h.size = h.strings + ((h.string_size + 3) & ~3u);
+
+    write_data(&rows, &h, sizeof(h));
+    print_rows(db, &rows);
+    print_rows(db, &names);
+    write_data(&names, db->base + db->header->strings, h.string_size);
+    write_data(&names, &zero, h.size - h.strings - h.string_size);
+    return rows.failed || names.failed ? -1 : 0;
 }
 
-static void print_string(const char *name, int last)
+static int print_mnemonics(const mcdb *db, int format)
 {
-    if (name) {
-        printf("%s", name);
+    table out = { format, 0, 0, 0 };
+    if (format == FORMAT_ROWS) {
+        return write_map(db);
     }
-    if (!last) {
-        printf(";");
+    if (format == FORMAT_CSV) {
+        printf("code;%s;%s;%s;typ;operand\n", set_keys[0], set_keys[1], set_keys[2]);
+    } else {
+        printf("[");
+    }
+    print_rows(db, &out);
+    if (format == FORMAT_JSON) {
+        printf("\n]\n");
     }
+    return 0;
 }
 
-static void print_char(const char ch, int last)
+// Translates one source file, or stdin for "-", to stdout line by line,
+// from set from on. Lines longer than MAX_LINE_SIZE are copied. Returns
+// the number of lines that could not be translated, or -1.
+static int translate_file(const char *path, int from, int to)
 {
-    if (ch) {
-        printf("%c", ch);
+    static char line[MAX_LINE_SIZE];
+    static char out[OUTPUT_SIZE];
+    FILE *file = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    int set = from;
+    int number = 0;
+    int problems = 0;
+    int continued = 0;
+
+    if (!file) {
+        perror(path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), file)) {
+        size_t len = strlen(line);
+        int complete = len > 0 && line[len - 1] == '\n';
+        if (continued) {
+            fwrite(line, 1, len, stdout);
+            continued = !complete;
+            continue;
+        }
+        number++;
+        continued = !complete && !feof(file);
+        if (continued) {
+            fwrite(line, 1, len, stdout);
+            continue;
+        }
+        len -= complete;
+        int status, start, length;
+        size_t n = inst_translate_line(line, len, &set, to, out, sizeof(out), &status, &start, &length);
+        fwrite(out, 1, n, stdout);
+        if (complete) {
+            putchar('\n');
+        }
+        if (status == TRANSLATE_UNKNOWN) {
+            fprintf(stderr, "%s:%d: unknown mnemonic %.*s\n", path, number, length, line + start);
+            problems++;
+        } else if (status == TRANSLATE_MISSING) {
+            fprintf(stderr, "%s:%d: no %s mnemonic for %.*s\n", path, number, set_names[inst_set_index(to)],
+                length, line + start);
+            problems++;
+        }
     }
-    if (!last) {
-        printf(";");
+    if (ferror(file)) {
+        perror(path);
+        problems = -1;
     }
+    if (file != stdin) {
+        fclose(file);
+    }
+    return problems;
 }
 
-static void print_hex(int num, int last)
+static int parse_set(const char *name)
 {
-    printf("0x%3.3X", num);
-    if (!last) {
-        printf(";");
+    if (strcmp(name, "hp") == 0) {
+        return SET_HP;
+    } else if (strcmp(name, "jda") == 0) {
+        return SET_JDA;
+    } else if (strcmp(name, "zencode") == 0) {
+        return SET_ZENCODE;
     }
+    return 0;
 }
 
-static void print_mnemonics() {
-    printf("code;hp;jda;zencode;typ;operand\n");
-    for (int i = 0; i < 0x400; i++) {
-        if (mvtab[i]) {
-            for (int j = 0; j < TYPE_COUNT; j++) {
-                mnemonic m = mvtab[i]->m[j];
-                if (m) {
-                    if (m->hp || m->jda || m->zencode) {
-                        print_hex(i, 0);
-                        print_string(m->hp, 0);
-                        print_string(m->jda, 0);
-                        print_string(m->zencode, 0);
-                        print_char(mnemonic_types[j], 0);
-                        print_string(get_operand(mnemonic_types[j]), 1);
-                        printf("\n");
-                    }
-                }
-            }
-        }
+static int parse_format(const char *name)
+{
+    if (strcmp(name, "csv") == 0) {
+        return FORMAT_CSV;
+    } else if (strcmp(name, "json") == 0) {
+        return FORMAT_JSON;
+    } else if (strcmp(name, "bin") == 0) {
+        return FORMAT_ROWS;
     }
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodecvs [-D file] [-f csv|json|bin]\n");
+    fprintf(stderr, "       mcodecvs -t hp|jda|zencode [-s hp|jda|zencode] [file ...]\n");
+    fprintf(stderr, "  -D file  use this instruction database instead of " MCDB_FILE_NAME "\n");
+    fprintf(stderr, "  -f       format of the mnemonic table (default csv, bin see mcopmap.h)\n");
+    fprintf(stderr, "  -t       translate the source files (default stdin) to a mnemonic set\n");
+    fprintf(stderr, "  -s       mnemonic set at the start of each file (default hp)\n");
 }
 
 int main(int argc, char *argv[])
 {
-    clear_mnemonics();
-    read_mnemonics();
-    print_mnemonics();
+    mcdb db;
+    const char *database = NULL;
+    int from = SET_HP;
+    int to = 0;
+    int format = FORMAT_CSV;
+    int rc;
+    int i;
+
+    for (i = 1; i + 1 < argc && argv[i][0] == '-' && argv[i][1]; i += 2) {
+        const char *arg = argv[i + 1];
+        if (strcmp(argv[i], "-D") == 0) {
+            database = arg;
+        } else if (strcmp(argv[i], "-f") == 0 && parse_format(arg)) {
+            format = parse_format(arg);
+        } else if (strcmp(argv[i], "-t") == 0 && parse_set(arg)) {
+            to = parse_set(arg);
+        } else if (strcmp(argv[i], "-s") == 0 && parse_set(arg)) {
+            from = parse_set(arg);
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (to) {
+        int problems = 0;
+        setvbuf(stdout, NULL, _IOFBF, 1 << 16);
+        for (int f = i; f < argc || f == i; f++) {
+            int n = translate_file(f < argc ? argv[f] : "-", from, to);
+            if (n < 0 || problems < 0) {
+                problems = -1;
+            } else {
+                problems += n;
+            }
+        }
+        if (fflush(stdout) != 0) {
+            perror("mcodecvs");
+            return 1;
+        }
+        return problems ? 1 : 0;
+    }
+    if (i != argc) {
+        usage();
+        return 2;
+    }
+    if (mcdb_load(&db, database, argv[0]) != 0) {
+        perror(database ? database : MCDB_FILE_NAME);
+        return 1;
+    }
+    rc = print_mnemonics(&db, format);
+    mcdb_close(&db);
+    if (rc != 0 || fflush(stdout) != 0) {
+        perror("mcodecvs");
+        return 1;
+    }
     return 0;
-}
\ No newline at end of file
+}
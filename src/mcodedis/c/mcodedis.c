@@ -0,0 +1,422 @@
+/**********************************************************************
+ * MCODE ROM Disassembler
+ *
+ * Disassembles HP-41 ROM images into listing lines of the form
+ *
+ *     AAAA  CCC[CCC[CCC]]  MNEMONIC OPERAND
+ *
+ * which the data context of the grammar highlights as address, code
+ * and instruction. The image is memory-mapped and every 4K page is
+ * decoded on its own by a pool of worker threads. Instructions never
+ * cross a page boundary.
+ *
+ * Image formats:
+ *
+ *     rom   4 words packed into 5 bytes (default)
+ *     bin   one 16-bit big-endian word per 2 bytes (default for .bin)
+ *     mod   MOD1 module (default for .mod), each page at the page of
+ *           its record, or from -p on if the record has a position
+ *********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "mcinstr.h"
+#include "mcop.h"
+#include "mcdecode.h"
+#include "mcimage.h"
+#include "mcmod.h"
+
+#define PAGE_WORDS      0x1000
+#define MAX_THREADS     64
+#define LINE_SIZE       64
+#define FORMAT_MOD      2
+
+struct image_t {
+    image_view view;
+    mod_file mod;
+    int is_mod;
+    int pages;
+    int first_page;
+    int set;
+};
+
+struct listing_t {
+    char *buf;
+    size_t len;
+};
+
+struct pool_t {
+    const struct image_t *image;
+    struct listing_t *listings;
+    int next_page;
+    int failed;
+    pthread_mutex_t lock;
+};
+
+typedef struct image_t image;
+typedef struct listing_t listing;
+typedef struct pool_t pool;
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+// Checks the words following the first word of a multi-word candidate.
+static int follow_words_match(int i, const unsigned short *words)
+{
+    switch (inst[i].typ) {
+        case MCODE_OP_ADDRESS1:
+            return (words[1] & 0x003) == inst[i].tyte2;
+        case MCODE_OP_ADDRESS2:
+        case MCODE_OP_ADDRESS4:
+            return words[1] == inst[i].tyte2;
+        case MCODE_OP_000_TO_FFF_HEX:
+            return (words[1] & ~0x3C0) == inst[i].tyte2 && (words[2] & ~0x3C0) == inst[i].tyte3;
+        case MCODE_OP_TEF2:
+            return words[1] == (inst[i].tyte2 | (words[0] & 0x01C));
+        default:
+            return 1;
+    }
+}
+
+// HP names of the class 1 instructions preferred over their aliases
+// GSUBNC and GOLNC
+static int is_preferred(int i)
+{
+    return strcmp(inst[i].name, "GOSUB") == 0 || strcmp(inst[i].name, "GOLONG") == 0;
+}
+
+// Picks the longest instruction of the set that matches the words at
+// the current position. Among instructions of the same length the
+// order of inst_decode_candidates decides. Returns the index in inst[]
+// or -1 and the length in *length.
+static int decode_instruction(const unsigned short *words, int remaining, int set, int *length)
+{
+    int w = words[0];
+    int best = -1;
+    *length = 1;
+    for (int k = inst_decode_offset[w]; k < inst_decode_offset[w + 1]; k++) {
+        int i = inst_decode_candidates[k];
+        unsigned short mask;
+        unsigned char shift, count;
+        if (!(inst[i].set & set) || !inst_decode_field(inst[i].typ, &mask, &shift, &count)) {
+            continue;
+        }
+        if (count > remaining || !follow_words_match(i, words)) {
+            continue;
+        }
+        if (best < 0 || count > *length || (count == *length && is_preferred(i))) {
+            best = i;
+            *length = count;
+        }
+    }
+    return best;
+}
+
+static char *put_hex(char *p, int value, int digits)
+{
+    while (digits--) {
+        *p++ = hex_digits[(value >> (4*digits)) & 0xF];
+    }
+    return p;
+}
+
+static char *put_dec(char *p, int value)
+{
+    if (value >= 10) {
+        *p++ = '0' + value / 10;
+    }
+    *p++ = '0' + value % 10;
+    return p;
+}
+
+static char *put_str(char *p, const char *s)
+{
+    while (*s) {
+        *p++ = *s++;
+    }
+    return p;
+}
+
+static char *put_operand(char *p, int i, const unsigned short *words, int address, int set)
+{
+    inst_decode_entry entry;
+    entry.index = i;
+    entry.typ = inst[i].typ;
+    inst_decode_field(entry.typ, &entry.mask, &entry.shift, &entry.words);
+    int value;
+    inst_decode_operand(&entry, words[0], &value);
+
+    switch (entry.typ) {
+        case MCODE_OP_TEF1:
+        case MCODE_OP_TEF2:
+            return put_str(p, inst_tef_names[inst_set_index(set)][value]);
+        case MCODE_OP_0_TO_13_DEC:
+        case MCODE_OP_0_TO_7:
+            return put_dec(p, value);
+        case MCODE_OP_0_TO_F_HEX:
+            return put_hex(p, value, 1);
+        case MCODE_OP_DISPLACEMENT:
+            *p++ = value < 0 ? '-' : '+';
+            return put_dec(p, value < 0 ? -value : value);
+        case MCODE_OP_ADDRESS1:
+            return put_hex(p, ((words[1] & 0x3FC) << 6) | value, 4);
+        case MCODE_OP_ADDRESS2:
+        case MCODE_OP_ADDRESS4:
+            // the target word is relative to the current 1K block
+            return put_hex(p, (address & 0xFC00) | words[2], 4);
+        case MCODE_OP_000_TO_FFF_HEX:
+            return put_hex(p, (value << 8) | (words[1] & 0x3C0) >> 2 | (words[2] & 0x3C0) >> 6, 3);
+        case MCODE_OP_000_TO_3FF_HEX:
+            return put_hex(p, words[1], 3);
+        default:
+            return p;
+    }
+}
+
+static char *put_padding(char *p, char *start, int width)
+{
+    while (p < start + width) {
+        *p++ = ' ';
+    }
+    return p;
+}
+
+static int disassemble_page(const image *img, int page, listing *out)
+{
+    unsigned short words[PAGE_WORDS];
+    int count;
+    int base = ((img->first_page + page) * PAGE_WORDS) & 0xFFFF;
+    mod_page record;
+
+    if (img->is_mod) {
+        mod_page_get(&img->mod, page, &record);
+        mod_read(&record, words);
+        count = MOD_PAGE_WORDS;
+        if (record.page <= 0xF) {
+            base = record.page * PAGE_WORDS;
+        }
+    } else {
+        count = (int) image_read(&img->view, (size_t) page * PAGE_WORDS, PAGE_WORDS, words);
+    }
+
+    out->len = 0;
+    out->buf = malloc((size_t) (count + 1) * LINE_SIZE);
+    if (!out->buf) {
+        return -1;
+    }
+
+    char *p = out->buf;
+    p = put_str(p, "; page ");
+    p = put_hex(p, base >> 12, 1);
+    if (img->is_mod) {
+        p = put_str(p, " bank ");
+        p = put_dec(p, record.bank);
+        if (record.id[0]) {
+            p = put_str(p, " id ");
+            p = put_str(p, record.id);
+        }
+    }
+    *p++ = '\n';
+
+    for (int pos = 0; pos < count;) {
+        int length;
+        int address = base + pos;
+        int i = decode_instruction(words + pos, count - pos, img->set, &length);
+
+        char *line = p;
+        p = put_hex(p, address, 4);
+        *p++ = ' ';
+        *p++ = ' ';
+        for (int k = 0; k < length; k++) {
+            p = put_hex(p, words[pos + k], 3);
+        }
+        p = put_padding(p, line, 17);
+        if (i >= 0) {
+            char *mnemonic = p;
+            char *end = put_str(p, inst[i].name);
+            p = put_padding(end, mnemonic, 8);
+            *p++ = ' ';
+            char *operand = p;
+            p = put_operand(p, i, words + pos, address, img->set);
+            if (p == operand) {
+                p = end;
+            }
+        } else {
+            p = put_str(p, "CON      ");
+            p = put_hex(p, words[pos], 3);
+        }
+        *p++ = '\n';
+        pos += length;
+    }
+    out->len = p - out->buf;
+    return 0;
+}
+
+static void *worker(void *arg)
+{
+    pool *pl = (pool *) arg;
+    for (;;) {
+        pthread_mutex_lock(&pl->lock);
+        int page = pl->next_page++;
+        pthread_mutex_unlock(&pl->lock);
+        if (page >= pl->image->pages) {
+            return NULL;
+        }
+        if (disassemble_page(pl->image, page, &pl->listings[page])) {
+            pthread_mutex_lock(&pl->lock);
+            pl->failed = 1;
+            pthread_mutex_unlock(&pl->lock);
+        }
+    }
+}
+
+static int disassemble_image(const image *img, int threads)
+{
+    pool pl;
+    pthread_t ids[MAX_THREADS];
+    int started = 0;
+
+    pl.image = img;
+    pl.next_page = 0;
+    pl.failed = 0;
+    pl.listings = calloc(img->pages, sizeof(listing));
+    if (!pl.listings) {
+        return -1;
+    }
+    pthread_mutex_init(&pl.lock, NULL);
+    if (threads > img->pages) {
+        threads = img->pages;
+    }
+    while (started < threads - 1 && pthread_create(&ids[started], NULL, worker, &pl) == 0) {
+        started++;
+    }
+    worker(&pl);
+    for (int t = 0; t < started; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    pthread_mutex_destroy(&pl.lock);
+
+    for (int page = 0; page < img->pages; page++) {
+        if (!pl.failed) {
+            fwrite(pl.listings[page].buf, 1, pl.listings[page].len, stdout);
+        }
+        free(pl.listings[page].buf);
+    }
+    free(pl.listings);
+    return pl.failed ? -1 : 0;
+}
+
+#if defined(_WIN32)
+
+static int cpu_count(void)
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+}
+
+#else
+
+static int cpu_count(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int) n : 1;
+}
+
+#endif
+
+static int parse_set(const char *name)
+{
+    if (strcmp(name, "hp") == 0) {
+        return SET_HP;
+    } else if (strcmp(name, "jda") == 0) {
+        return SET_JDA;
+    } else if (strcmp(name, "zencode") == 0) {
+        return SET_ZENCODE;
+    }
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodedis [-s hp|jda|zencode] [-f rom|bin|mod] [-p page] [-j threads] file\n");
+    fprintf(stderr, "  -s  mnemonic set (default hp)\n");
+    fprintf(stderr, "  -f  image format (default bin for .bin files, mod for .mod files, rom otherwise)\n");
+    fprintf(stderr, "  -p  page of the first word, 0 to F (default 0)\n");
+    fprintf(stderr, "  -j  number of threads (default number of CPUs)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    image img;
+    int format = -1;
+    int threads = cpu_count();
+    int i;
+
+    img.set = SET_HP;
+    img.first_page = 0;
+    for (i = 1; i + 1 < argc && argv[i][0] == '-'; i += 2) {
+        const char *arg = argv[i + 1];
+        if (strcmp(argv[i], "-s") == 0 && parse_set(arg)) {
+            img.set = parse_set(arg);
+        } else if (strcmp(argv[i], "-f") == 0 && strcmp(arg, "mod") == 0) {
+            format = FORMAT_MOD;
+        } else if (strcmp(argv[i], "-f") == 0 && (strcmp(arg, "rom") == 0 || strcmp(arg, "bin") == 0)) {
+            format = strcmp(arg, "bin") == 0 ? IMAGE_BIN : IMAGE_ROM;
+        } else if (strcmp(argv[i], "-p") == 0 && strlen(arg) == 1 && strchr(hex_digits, arg[0])) {
+            img.first_page = strchr(hex_digits, arg[0]) - hex_digits;
+        } else if (strcmp(argv[i], "-j") == 0 && atoi(arg) > 0) {
+            threads = atoi(arg) < MAX_THREADS ? atoi(arg) : MAX_THREADS;
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (i + 1 != argc) {
+        usage();
+        return 2;
+    }
+
+    const char *path = argv[i];
+    img.is_mod = format == FORMAT_MOD || (format < 0 && mod_path(path));
+    if (img.is_mod) {
+        if (mod_open(&img.mod, path)) {
+            perror(path);
+            return 1;
+        }
+        img.pages = img.mod.pages;
+        for (int page = 0; page < img.pages; page++) {
+            mod_page record;
+            if (mod_page_get(&img.mod, page, &record)) {
+                fprintf(stderr, "%s: page record %d is invalid\n", path, page + 1);
+                mod_close(&img.mod);
+                return 1;
+            }
+        }
+    } else {
+        if (image_open(&img.view, path, format)) {
+            perror(path);
+            return 1;
+        }
+        img.pages = (int) ((img.view.words + PAGE_WORDS - 1) / PAGE_WORDS);
+    }
+
+    int rc = disassemble_image(&img, threads);
+    if (img.is_mod) {
+        mod_close(&img.mod);
+    } else {
+        image_close(&img.view);
+    }
+    if (rc) {
+        fprintf(stderr, "mcodedis: out of memory\n");
+    }
+    return rc ? 1 : 0;
+}
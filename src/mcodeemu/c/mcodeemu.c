@@ -0,0 +1,238 @@
+/**********************************************************************
+ * MCODE Emulator CLI
+ *
+ *     mcodeemu [-n count] [-g addr] [-x addr] [-v]
+ *              [[-f rom|bin|mod] [-p page] [-b bank] image] ...
+ *
+ * Runs ROM images on an emulated HP-41 Nut processor (see mcnut.h),
+ * from address addr of -g (default 0000) for up to count instructions,
+ * until POWOFF or until the instruction at the address of -x. Then the
+ * registers are printed:
+ *
+ *     PC=4000 POWOFF after 1203 instructions
+ *     A=00000000000000 B=00000000000000 C=0000000000A4C3
+ *     ...
+ *
+ * Every image is loaded into consecutive pages from page -p, or the page
+ * after the previous image, into bank -b (1 to 4, default 1). Image
+ * formats as for mcodedis (see mcimage.h): 16-bit big-endian words for
+ * .bin files, 4 words in 5 bytes otherwise, unless -f says otherwise.
+ * The pages of a .mod file (see mcmod.h) go to the page and bank of
+ * their records; pages with a position instead of a page take the next
+ * free page, or the page of the page before them in banks 2 to 4. With
+ * -v the number of instructions per second is printed to standard
+ * error.
+ *********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mcimage.h"
+#include "mcmod.h"
+#include "mcnut.h"
+
+#define FORMAT_MOD      2
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+// Parses 1 to 4 hex digits, returns -1 otherwise.
+static int parse_hex(const char *s)
+{
+    int value = 0;
+    size_t len = strlen(s);
+    if (len < 1 || len > 4) {
+        return -1;
+    }
+    for (size_t i = 0; i < len; i++) {
+        char ch = s[i] >= 'a' && s[i] <= 'f' ? s[i] - 'a' + 'A' : s[i];
+        const char *d = strchr(hex_digits, ch);
+        if (!ch || !d) {
+            return -1;
+        }
+        value = 16*value + (int) (d - hex_digits);
+    }
+    return value;
+}
+
+// Loads an image into pages from page on. Returns the number of pages
+// or -1.
+static int load_image(nut_cpu *cpu, const char *path, int format, int page, int bank)
+{
+    static unsigned short words[NUT_PAGE_WORDS];
+    image_view view;
+    if (image_open(&view, path, format)) {
+        perror(path);
+        return -1;
+    }
+    int pages = (int) ((view.words + NUT_PAGE_WORDS - 1) / NUT_PAGE_WORDS);
+    if (page + pages > NUT_PAGES) {
+        fprintf(stderr, "%s: image ends after page F\n", path);
+        pages = -1;
+    }
+    for (int p = 0; p < pages; p++) {
+        size_t count = image_read(&view, (size_t) p * NUT_PAGE_WORDS, NUT_PAGE_WORDS, words);
+        if (nut_load(cpu, page + p, bank, words, (int) count)) {
+            fprintf(stderr, "mcodeemu: out of memory\n");
+            pages = -1;
+            break;
+        }
+    }
+    image_close(&view);
+    return pages;
+}
+
+// Loads the pages of a MOD file, the positioned ones from page on.
+// Returns the number of pages from page to the last page loaded, or -1.
+static int load_module(nut_cpu *cpu, const char *path, int page)
+{
+    static unsigned short words[MOD_PAGE_WORDS];
+    mod_file mod;
+    if (mod_open(&mod, path)) {
+        perror(path);
+        return -1;
+    }
+    int next = page;
+    int end = page;
+    int rc = 0;
+    for (int i = 0; i < mod.pages && !rc; i++) {
+        mod_page record;
+        if (mod_page_get(&mod, i, &record)) {
+            fprintf(stderr, "%s: page record %d is invalid\n", path, i + 1);
+            rc = -1;
+            break;
+        }
+        int target = record.page;
+        if (target > 0xF) {
+            target = record.bank > 1 && next > page ? next - 1 : next++;
+        }
+        if (target >= NUT_PAGES) {
+            fprintf(stderr, "%s: image ends after page F\n", path);
+            rc = -1;
+            break;
+        }
+        mod_read(&record, words);
+        if (nut_load(cpu, target, record.bank - 1, words, MOD_PAGE_WORDS)) {
+            fprintf(stderr, "mcodeemu: out of memory\n");
+            rc = -1;
+        }
+        end = target + 1 > end ? target + 1 : end;
+    }
+    mod_close(&mod);
+    return rc ? -1 : end - page;
+}
+
+static void print_register(const char *name, unsigned long long r, const char *end)
+{
+    char digits[15];
+    for (int i = 0; i < 14; i++) {
+        digits[13 - i] = hex_digits[(r >> 4*i) & 0xF];
+    }
+    digits[14] = '\0';
+    printf("%s=%s%s", name, digits, end);
+}
+
+static void print_state(const nut_cpu *cpu)
+{
+    print_register("A", cpu->a, " ");
+    print_register("B", cpu->b, " ");
+    print_register("C", cpu->c, "\n");
+    print_register("M", cpu->m, " ");
+    print_register("N", cpu->n, " ");
+    printf("G=%02X F=%02X ST=%04X\n", cpu->g, cpu->f, cpu->st);
+    printf("P=%u Q=%u PT=%c CARRY=%u %s STK=%04X %04X %04X %04X\n", cpu->pointer[0], cpu->pointer[1],
+        cpu->pt ? 'Q' : 'P', cpu->carry, cpu->decimal ? "DEC" : "HEX", cpu->stack[0], cpu->stack[1],
+        cpu->stack[2], cpu->stack[3]);
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodeemu [-n count] [-g addr] [-x addr] [-v] [[-f rom|bin|mod] [-p page] [-b bank] image] ...\n");
+    fprintf(stderr, "  -n  maximum number of instructions (default 100000000)\n");
+    fprintf(stderr, "  -g  start address (default 0000)\n");
+    fprintf(stderr, "  -x  stop address\n");
+    fprintf(stderr, "  -v  print the emulation speed to standard error\n");
+    fprintf(stderr, "  -f  image format (default bin for .bin files, mod for .mod files, rom otherwise)\n");
+    fprintf(stderr, "  -p  page of the image, 0 to F (default the page after the previous image)\n");
+    fprintf(stderr, "  -b  bank of the image, 1 to 4 (default 1)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static nut_cpu cpu;
+    unsigned long long count = 100000000ULL;
+    int start = 0;
+    int stop = -1;
+    int verbose = 0;
+    int format = -1;
+    int page = 0;
+    int bank = 0;
+    int images = 0;
+
+    if (nut_init(&cpu)) {
+        fprintf(stderr, "mcodeemu: no operation for %s\n", cpu.unknown);
+        return 1;
+    }
+    for (int i = 1; i < argc; i++) {
+        const char *arg = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "-v") == 0) {
+            verbose = 1;
+        } else if (strcmp(argv[i], "-n") == 0 && arg && atof(arg) > 0) {
+            count = (unsigned long long) atof(arg);
+            i++;
+        } else if (strcmp(argv[i], "-g") == 0 && arg && parse_hex(arg) >= 0) {
+            start = parse_hex(arg);
+            i++;
+        } else if (strcmp(argv[i], "-x") == 0 && arg && parse_hex(arg) >= 0) {
+            stop = parse_hex(arg);
+            i++;
+        } else if (strcmp(argv[i], "-f") == 0 && arg && strcmp(arg, "mod") == 0) {
+            format = FORMAT_MOD;
+            i++;
+        } else if (strcmp(argv[i], "-f") == 0 && arg && (strcmp(arg, "rom") == 0 || strcmp(arg, "bin") == 0)) {
+            format = strcmp(arg, "bin") == 0 ? IMAGE_BIN : IMAGE_ROM;
+            i++;
+        } else if (strcmp(argv[i], "-p") == 0 && arg && strlen(arg) == 1 && parse_hex(arg) >= 0) {
+            page = parse_hex(arg);
+            i++;
+        } else if (strcmp(argv[i], "-b") == 0 && arg && strlen(arg) == 1 && arg[0] >= '1' && arg[0] <= '4') {
+            bank = arg[0] - '1';
+            i++;
+        } else if (argv[i][0] != '-') {
+            int pages = format == FORMAT_MOD || (format < 0 && mod_path(argv[i])) ?
+                load_module(&cpu, argv[i], page) : load_image(&cpu, argv[i], format, page, bank);
+            if (pages < 0) {
+                nut_free(&cpu);
+                return 1;
+            }
+            page += pages;
+            bank = 0;
+            format = -1;
+            images++;
+        } else {
+            usage();
+            nut_free(&cpu);
+            return 2;
+        }
+    }
+    if (!images) {
+        usage();
+        return 2;
+    }
+
+    cpu.pc = start;
+    clock_t begin = clock();
+    int result = nut_run(&cpu, count, stop);
+    double seconds = (double) (clock() - begin) / CLOCKS_PER_SEC;
+
+    printf("PC=%04X %s after %llu instructions\n", cpu.pc,
+        result == NUT_POWEROFF ? "POWOFF" : result == NUT_STOPPED ? "stopped" : "running", cpu.executed);
+    print_state(&cpu);
+    if (verbose) {
+        fprintf(stderr, "mcodeemu: %llu instructions in %.3f s, %.1f M/s\n", cpu.executed, seconds,
+            seconds > 0 ? cpu.executed / seconds / 1e6 : 0.0);
+    }
+    nut_free(&cpu);
+    return 0;
+}
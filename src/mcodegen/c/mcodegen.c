@@ -0,0 +1,491 @@
+/**********************************************************************
+ * MCODE Corpus Generator
+ *
+ * Writes a synthetic MCODE source file of a given size for measuring
+ * the lexers:
+ *
+ *     mcodegen [-s seed] [-n size] [-o file]
+ *
+ * The instructions are drawn from the SDK41 instruction table with an
+ * operand that fits their operand type, in source form with labels
+ * and comments or as listing lines like mcodedis writes them. Between
+ * them are directives, comment lines and *** ERROR annotations. Every
+ * label is defined once and every label operand is defined somewhere
+ * in the file, so mcodechk accepts the file. The same seed and size
+ * always give the same file.
+ *********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcinstr.h"
+#include "mcop.h"
+#include "mcdecode.h"
+
+#define DEFAULT_SIZE    (1 << 20)
+#define LINE_SIZE       256
+#define OUT_SIZE        (1 << 16)
+#define LABEL_COUNT     512
+#define LABEL_AHEAD     16              // forward references
+#define TITLE           "        .TITLE \"synthetic corpus\""
+
+// Line kinds, weights per 100 lines
+#define WEIGHT_SOURCE       52
+#define WEIGHT_LISTING      22
+#define WEIGHT_COMMENT      8
+#define WEIGHT_DIRECTIVE    4
+#define WEIGHT_ERROR        3
+#define WEIGHT_NOTE         2
+#define WEIGHT_LABEL        4
+#define WEIGHT_EMPTY        5
+
+struct generator_t {
+    unsigned long long state;
+    int set;
+    int location;
+    int instructions[IHT_SIZE];     // of the current set
+    int instruction_count;
+    char labels[LABEL_COUNT][12];   // names of the first labels
+    int defined[2];                 // labels defined, local and global
+    int used[2];                    // labels referenced
+    FILE *out;
+    char buf[OUT_SIZE];
+    size_t len;
+    unsigned long long written;
+};
+
+typedef struct generator_t generator;
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+static const char *const words[] = {
+    "loop", "display", "keyboard", "carry", "status", "flag", "register",
+    "digit", "exponent", "mantissa", "stack", "X", "Y", "alpha", "buffer",
+    "timer", "printer", "card", "reader", "peripheral", "RAM", "ROM",
+    "page", "bank", "return", "address", "pointer", "field", "nibble",
+    "sign", "overflow", "test", "set", "clear", "save", "restore"
+};
+
+static const char *const errors[] = {
+    "undefined label", "operand out of range", "unknown mnemonic",
+    "duplicate label", "field expected", "not in the 1K block",
+    "address expected", "3 digit hex number expected"
+};
+
+static const char *const sets[] = { ".HP", ".JDA", ".ZENCODE" };
+static const int set_flags[] = { SET_HP, SET_JDA, SET_ZENCODE };
+
+// splitmix64, the same sequence on every platform
+static unsigned long long next(generator *gen)
+{
+    unsigned long long z = (gen->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static int below(generator *gen, int n)
+{
+    return (int) (next(gen) % (unsigned) n);
+}
+
+static void flush_output(generator *gen)
+{
+    fwrite(gen->buf, 1, gen->len, gen->out);
+    gen->written += gen->len;
+    gen->len = 0;
+}
+
+static void put_line(generator *gen, const char *line, size_t len)
+{
+    if (gen->len + len + 1 > OUT_SIZE) {
+        flush_output(gen);
+    }
+    memcpy(gen->buf + gen->len, line, len);
+    gen->len += len;
+    gen->buf[gen->len++] = '\n';
+}
+
+static char *put_str(char *p, const char *s)
+{
+    while (*s) {
+        *p++ = *s++;
+    }
+    return p;
+}
+
+static char *put_hex(char *p, int value, int digits)
+{
+    for (int i = digits - 1; i >= 0; i--) {
+        *p++ = hex_digits[(value >> (4 * i)) & 0xF];
+    }
+    return p;
+}
+
+static char *put_dec(char *p, int value)
+{
+    char tmp[12];
+    int n = 0;
+    do {
+        tmp[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+    while (n) {
+        *p++ = tmp[--n];
+    }
+    return p;
+}
+
+static char *put_padding(char *p, char *start, int width)
+{
+    do {
+        *p++ = ' ';
+    } while (p - start < width);
+    return p;
+}
+
+// Label number k: one of the names, which end in a letter, and from
+// the second round on the round as a decimal suffix.
+static char *put_label(generator *gen, char *p, int global, int k)
+{
+    *p++ = global ? '[' : '(';
+    p = put_str(p, gen->labels[k % LABEL_COUNT]);
+    if (k >= LABEL_COUNT) {
+        p = put_dec(p, k / LABEL_COUNT);
+    }
+    *p++ = global ? ']' : ')';
+    return p;
+}
+
+static char *put_definition(generator *gen, char *p, int global)
+{
+    return put_label(gen, p, global, gen->defined[global]++);
+}
+
+// A label defined before or a few labels ahead; generate() defines the
+// ones ahead that are still missing at the end.
+static char *put_reference(generator *gen, char *p, int global)
+{
+    int k = below(gen, gen->defined[global] + LABEL_AHEAD);
+    if (k >= gen->used[global]) {
+        gen->used[global] = k + 1;
+    }
+    return put_label(gen, p, global, k);
+}
+
+static char *put_words(generator *gen, char *p, int count)
+{
+    for (int i = 0; i < count; i++) {
+        if (i) {
+            *p++ = ' ';
+        }
+        p = put_str(p, words[below(gen, sizeof(words) / sizeof(words[0]))]);
+    }
+    return p;
+}
+
+// Words in capitals, which the display can show as .TEXT and .NAME
+static char *put_capital_words(generator *gen, char *p, int count)
+{
+    char *start = p;
+    p = put_words(gen, p, count);
+    for (char *c = start; c < p; c++) {
+        if (*c >= 'a' && *c <= 'z') {
+            *c = *c - 'a' + 'A';
+        }
+    }
+    return p;
+}
+
+static void select_set(generator *gen, int index)
+{
+    gen->set = set_flags[index];
+    gen->instruction_count = 0;
+    mnemonic_bitset selected;
+    mnemonic_select(&selected, NULL, gen->set);
+    for (int i = mnemonic_bitset_next(&selected, -1); i >= 0; i = mnemonic_bitset_next(&selected, i)) {
+        gen->instructions[gen->instruction_count++] = i;
+    }
+}
+
+// A random operand of the type, labels where the assembler takes them
+static char *put_operand(generator *gen, char *p, int typ)
+{
+    switch (typ) {
+        case MCODE_OP_TEF1:
+        case MCODE_OP_TEF2:
+            return put_str(p, inst_tef_names[inst_set_index(gen->set)][below(gen, 8)]);
+        case MCODE_OP_0_TO_13_DEC:
+            return put_dec(p, below(gen, 14));
+        case MCODE_OP_0_TO_F_HEX:
+            return below(gen, 2) ? put_dec(p, below(gen, 16)) : put_hex(p, below(gen, 16), 1);
+        case MCODE_OP_DISPLACEMENT:
+            if (below(gen, 3) == 0) {
+                return put_reference(gen, p, 0);
+            }
+            *p++ = below(gen, 2) ? '+' : '-';
+            return put_dec(p, 1 + below(gen, 63));
+        case MCODE_OP_ADDRESS1:
+        case MCODE_OP_ADDRESS2:
+        case MCODE_OP_ADDRESS3:
+        case MCODE_OP_ADDRESS4:
+        case MCODE_OP_ADDRESS5:
+            if (below(gen, 2) == 0) {
+                return put_reference(gen, p, below(gen, 2));
+            }
+            return put_hex(p, below(gen, 0x10000), 4);
+        case MCODE_OP_1_TO_31_DEC:
+            return put_dec(p, 1 + below(gen, 31));
+        case MCODE_OP_0_TO_7:
+            return put_dec(p, below(gen, 8));
+        case MCODE_OP_000_TO_FFF_HEX:
+            return put_hex(p, below(gen, 0x1000), 3);
+        case MCODE_OP_0_TO_64_DEC:
+            return put_dec(p, below(gen, 65));
+        case MCODE_OP_000_TO_3FF_HEX:
+        case MCODE_OP_UNKNOWN:
+            return put_hex(p, below(gen, 0x400), 3);
+        default:
+            return p;
+    }
+}
+
+static void put_instruction(generator *gen, int listing)
+{
+    char line[LINE_SIZE];
+    char *p = line;
+    int i = gen->instructions[below(gen, gen->instruction_count)];
+    const struct inst_type *in = &inst[i];
+    unsigned short mask;
+    unsigned char shift;
+    unsigned char count = 1;
+    char *start;
+
+    inst_decode_field(in->typ, &mask, &shift, &count);
+    if (listing) {
+        // AAAA  CCC[CCC[CCC]]  MNEMONIC OPERAND
+        int tytes[3] = { in->tyte1, in->tyte2, in->tyte3 };
+        p = put_hex(p, gen->location & 0xFFFF, 4);
+        p = put_str(p, "  ");
+        start = p;
+        for (int k = 0; k < count && k < 3; k++) {
+            p = put_hex(p, tytes[k] & 0x3FF, 3);
+        }
+        p = put_padding(p, start, 11);
+    } else {
+        // label column, then mnemonic and operand
+        start = p;
+        if (below(gen, 8) == 0) {
+            p = put_definition(gen, p, below(gen, 3) == 0);
+        }
+        p = put_padding(p, start, 8);
+    }
+    gen->location += count;
+    start = p;
+    p = put_str(p, in->name);
+    if (in->typ != MCODE_OP_NONE1 && in->typ != MCODE_OP_NONE2 &&
+        in->typ != MCODE_OP_NONE3 && in->typ != MCODE_OP_NONE4) {
+        p = put_padding(p, start, 9);
+        p = put_operand(gen, p, in->typ);
+    }
+    if (!listing && below(gen, 5) == 0) {
+        p = put_padding(p, start, 24);
+        p = put_str(p, "; ");
+        p = put_words(gen, p, 1 + below(gen, 6));
+    }
+    put_line(gen, line, p - line);
+}
+
+static void put_directive(generator *gen)
+{
+    char line[LINE_SIZE];
+    char *p = put_str(line, "        ");
+    char *start;
+    int set;
+    int words;
+    switch (below(gen, 7)) {
+        case 0:
+            set = below(gen, 3);
+            select_set(gen, set);
+            p = put_str(p, sets[set]);
+            break;
+        case 1:
+            gen->location = below(gen, 16) << 12;
+            p = put_str(p, ".ORG ");
+            p = put_hex(p, gen->location, 4);
+            break;
+        case 2:
+            p = put_str(p, ".FILLTO ");
+            p = put_hex(p, gen->location | 0xFF, 4);
+            gen->location = (gen->location | 0xFF) + 1;
+            break;
+        case 3:
+            if (below(gen, 2)) {
+                p = put_str(p, ".TITLE \"");
+                p = put_words(gen, p, 1 + below(gen, 3));
+            } else {
+                p = put_str(p, ".NAME \"");
+                start = p;
+                p = put_capital_words(gen, p, 1 + below(gen, 3));
+                gen->location += p - start;
+            }
+            *p++ = '"';
+            break;
+        case 4:
+            p = put_str(p, ".TEXT \"");
+            start = p;
+            p = put_capital_words(gen, p, 1 + below(gen, 2));
+            gen->location += p - start;
+            *p++ = '"';
+            break;
+        case 5:
+            words = 1 + below(gen, 32);
+            p = put_str(p, ".BSS ");
+            p = put_dec(p, words);
+            gen->location += words;
+            break;
+        default:
+            p = put_definition(gen, line, below(gen, 2));
+            p = put_padding(p, line, 8);
+            p = put_str(p, ".EQU ");
+            p = put_hex(p, below(gen, 0x10000), 4);
+            break;
+    }
+    put_line(gen, line, p - line);
+}
+
+static void put_text_line(generator *gen, const char *lead, int count)
+{
+    char line[LINE_SIZE];
+    char *p = put_str(line, lead);
+    p = put_words(gen, p, count);
+    put_line(gen, line, p - line);
+}
+
+static void put_random_line(generator *gen)
+{
+    char line[LINE_SIZE];
+    char *p = line;
+    int kind = below(gen, 100);
+    if ((kind -= WEIGHT_SOURCE) < 0) {
+        put_instruction(gen, 0);
+    } else if ((kind -= WEIGHT_LISTING) < 0) {
+        put_instruction(gen, 1);
+    } else if ((kind -= WEIGHT_COMMENT) < 0) {
+        put_text_line(gen, "; ", 2 + below(gen, 8));
+    } else if ((kind -= WEIGHT_DIRECTIVE) < 0) {
+        put_directive(gen);
+    } else if ((kind -= WEIGHT_ERROR) < 0) {
+        p = put_str(p, "*** ERROR: ");
+        p = put_str(p, errors[below(gen, sizeof(errors) / sizeof(errors[0]))]);
+        put_line(gen, line, p - line);
+    } else if ((kind -= WEIGHT_NOTE) < 0) {
+        put_text_line(gen, "* ", 1 + below(gen, 6));
+    } else if ((kind -= WEIGHT_LABEL) < 0) {
+        p = put_definition(gen, p, below(gen, 2));
+        put_line(gen, line, p - line);
+    } else {
+        put_line(gen, "", 0);
+    }
+}
+
+static int generate(generator *gen, unsigned long long size)
+{
+    for (int i = 0; i < LABEL_COUNT; i++) {
+        char *p = gen->labels[i];
+        // a letter first, so no label reads as a number, and a letter
+        // last for the suffix
+        *p++ = 'A' + below(gen, 26);
+        for (int n = below(gen, 6); n > 0; n--) {
+            *p++ = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"[below(gen, 36)];
+        }
+        *p++ = 'A' + below(gen, 26);
+        *p = '\0';
+        for (int j = 0; j < i; j++) {
+            if (strcmp(gen->labels[i], gen->labels[j]) == 0) {
+                i--;
+                break;
+            }
+        }
+    }
+    select_set(gen, 0);
+    put_line(gen, TITLE, strlen(TITLE));
+    while (gen->written + gen->len < size) {
+        put_random_line(gen);
+    }
+    for (int global = 0; global < 2; global++) {
+        while (gen->defined[global] < gen->used[global]) {
+            char line[LINE_SIZE];
+            char *p = put_definition(gen, line, global);
+            put_line(gen, line, p - line);
+        }
+    }
+    flush_output(gen);
+    return ferror(gen->out) ? -1 : 0;
+}
+
+// Parses a size like 4096, 64K, 1M or 1G.
+static int parse_size(const char *s, unsigned long long *size)
+{
+    char *end;
+    unsigned long long value = strtoull(s, &end, 10);
+    if (end == s) {
+        return -1;
+    }
+    switch (*end) {
+        case 'K': case 'k': value <<= 10; end++; break;
+        case 'M': case 'm': value <<= 20; end++; break;
+        case 'G': case 'g': value <<= 30; end++; break;
+        default: break;
+    }
+    *size = value;
+    return *end ? -1 : 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodegen [-s seed] [-n size] [-o file]\n");
+    fprintf(stderr, "  -s  seed of the random numbers (default 1)\n");
+    fprintf(stderr, "  -n  size in bytes, K, M or G may follow (default 1M)\n");
+    fprintf(stderr, "  -o  write to file instead of stdout\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static generator gen;
+    unsigned long long size = DEFAULT_SIZE;
+    const char *path = 0;
+    int rc;
+
+    gen.state = 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            gen.state = strtoull(argv[++i], 0, 10);
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            if (parse_size(argv[++i], &size) != 0) {
+                usage();
+                return 2;
+            }
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            path = argv[++i];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+
+    gen.out = path ? fopen(path, "wb") : stdout;
+    if (!gen.out) {
+        perror(path);
+        return 1;
+    }
+    rc = generate(&gen, size);
+    if (path && fclose(gen.out) != 0) {
+        rc = -1;
+    }
+    if (rc != 0) {
+        fprintf(stderr, "mcodegen: write error\n");
+    }
+    return rc ? 1 : 0;
+}
@@ -0,0 +1,555 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#include <direct.h>
+#include <process.h>
+#define make_dir(path)  _mkdir(path)
+#define process_id()    _getpid()
+#else
+#include <unistd.h>
+#define make_dir(path)  mkdir(path, 0777)
+#define process_id()    getpid()
+#endif
+
+#include "mcodelex.h"
+#include "mchtml.h"
+#include "mcbatch.h"
+
+#define MAX_THREADS     64
+
+// Part of every cache key. Change it whenever the rendering changes.
+#define CACHE_VERSION   "mcodehtml 1"
+
+#define FNV_OFFSET      0xcbf29ce484222325ULL
+#define FNV_PRIME       0x100000001b3ULL
+
+struct batch_job_t {
+    char *path;             // input file
+    char *name;             // output file relative to the output directory
+    size_t size;
+};
+
+struct batch_queue_t {
+    struct batch_job_t **jobs;
+    size_t head;            // next job of the owner
+    size_t tail;
+    pthread_mutex_t lock;
+};
+
+struct batch_worker_t {
+    batch *b;
+    struct batch_queue_t *queues;
+    int threads;
+    int index;
+    int rendered;
+    int cached;
+    int failed;
+    pthread_t id;
+};
+
+typedef struct batch_job_t batch_job;
+typedef struct batch_queue_t batch_queue;
+typedef struct batch_worker_t batch_worker;
+
+static unsigned long long hash_bytes(unsigned long long hash, const char *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (unsigned char) data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+// The string and its terminator, so that option boundaries are part of
+// the key.
+static unsigned long long hash_string(unsigned long long hash, const char *s)
+{
+    return hash_bytes(hash, s ? s : "", s ? strlen(s) + 1 : 1);
+}
+
+static char *join_path(const char *dir, const char *name)
+{
+    size_t len = strlen(dir);
+    char *path = malloc(len + strlen(name) + 2);
+    if (path) {
+        strcpy(path, dir);
+        if (len > 0 && dir[len - 1] != '/') {
+            path[len++] = '/';
+        }
+        strcpy(path + len, name);
+    }
+    return path;
+}
+
+static int has_suffix(const char *name, const char *suffix)
+{
+    size_t len = strlen(name);
+    size_t n = strlen(suffix);
+    if (len < n) {
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        char c = name[len - n + i];
+        if ((c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c) != suffix[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Output name of an input: .src is replaced by .html, other names get
+// .html appended.
+static char *output_name(const char *name)
+{
+    size_t len = strlen(name);
+    char *out = malloc(len + 6);
+    if (out) {
+        if (has_suffix(name, ".src")) {
+            len -= 4;
+        }
+        memcpy(out, name, len);
+        strcpy(out + len, ".html");
+    }
+    return out;
+}
+
+// Whether a path has a component "..", unlike a name like a..b.src.
+static int has_parent_component(const char *path)
+{
+    while (1) {
+        size_t n = strcspn(path, "/");
+        if (n == 2 && path[0] == '.' && path[1] == '.') {
+            return 1;
+        }
+        if (path[n] == '\0') {
+            return 0;
+        }
+        path += n + 1;
+    }
+}
+
+// Relative names are kept, unless they leave the directory. Other
+// names are reduced to the file name.
+static const char *relative_name(const char *path)
+{
+    const char *base = strrchr(path, '/');
+    if (path[0] == '/' || has_parent_component(path)) {
+        return base ? base + 1 : path;
+    }
+    while (path[0] == '.' && path[1] == '/') {
+        path += 2;
+    }
+    return path;
+}
+
+static int add_job(batch *b, const char *path, const char *name, size_t size)
+{
+    if (b->count == b->size) {
+        size_t n = b->size ? 2 * b->size : 256;
+        batch_job *jobs = realloc(b->jobs, n * sizeof(batch_job));
+        if (!jobs) {
+            return -1;
+        }
+        b->jobs = jobs;
+        b->size = n;
+    }
+    batch_job *job = &b->jobs[b->count];
+    job->path = strdup(path);
+    job->name = output_name(name);
+    job->size = size;
+    if (!job->path || !job->name) {
+        free(job->path);
+        free(job->name);
+        return -1;
+    }
+    b->count++;
+    return 0;
+}
+
+// Adds all *.src files below dir. The output names are relative to the
+// directory the walk started at, which starts at root in path.
+static int add_tree(batch *b, const char *dir, size_t root)
+{
+    DIR *d = opendir(dir);
+    struct dirent *entry;
+    int rc = 0;
+    if (!d) {
+        perror(dir);
+        return -1;
+    }
+    while (rc == 0 && (entry = readdir(d)) != NULL) {
+        struct stat st;
+        char *path;
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+        path = join_path(dir, entry->d_name);
+        if (!path) {
+            rc = -1;
+        } else if (stat(path, &st) != 0) {
+            perror(path);
+            rc = -1;
+        } else if (S_ISDIR(st.st_mode)) {
+            rc = add_tree(b, path, root);
+        } else if (S_ISREG(st.st_mode) && has_suffix(entry->d_name, ".src")) {
+            rc = add_job(b, path, path + root, st.st_size);
+        }
+        free(path);
+    }
+    closedir(d);
+    return rc;
+}
+
+void batch_init(batch *b, const mchtml_options *options, const char *outdir, const char *cachedir)
+{
+    unsigned long long hash = FNV_OFFSET;
+    b->options = options;
+    b->outdir = outdir;
+    b->cachedir = cachedir;
+    b->jobs = NULL;
+    b->count = 0;
+    b->size = 0;
+    b->rendered = 0;
+    b->cached = 0;
+    b->failed = 0;
+
+    hash = hash_string(hash, CACHE_VERSION);
+    hash = hash_string(hash, options->cssclass);
+    hash = hash_string(hash, options->title);
+    hash = hash_string(hash, options->styledefs);
+    hash = hash_bytes(hash, options->full ? "1" : "0", 1);
+    b->options_hash = hash;
+}
+
+void batch_free(batch *b)
+{
+    for (size_t i = 0; i < b->count; i++) {
+        free(b->jobs[i].path);
+        free(b->jobs[i].name);
+    }
+    free(b->jobs);
+    b->jobs = NULL;
+    b->count = 0;
+    b->size = 0;
+}
+
+int batch_add(batch *b, const char *path)
+{
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        perror(path);
+        return -1;
+    }
+    if (S_ISDIR(st.st_mode)) {
+        size_t root = strlen(path);
+        root += (root > 0 && path[root - 1] != '/');
+        return add_tree(b, path, root);
+    }
+    return add_job(b, path, relative_name(path), st.st_size);
+}
+
+int batch_add_list(batch *b, FILE *list)
+{
+    char line[4096];
+    int rc = 0;
+    while (fgets(line, sizeof(line), list)) {
+        size_t len = strcspn(line, "\r\n");
+        line[len] = '\0';
+        if (len > 0 && batch_add(b, line) != 0) {
+            rc = -1;
+        }
+    }
+    return ferror(list) ? -1 : rc;
+}
+
+static int read_file(const char *path, char **data, size_t *len)
+{
+    FILE *file = fopen(path, "rb");
+    char *buf = NULL;
+    size_t size = 0;
+    size_t n;
+    *len = 0;
+    if (!file) {
+        return -1;
+    }
+    do {
+        if (*len == size) {
+            char *tmp;
+            size = size ? 2 * size : 1 << 16;
+            tmp = realloc(buf, size);
+            if (!tmp) {
+                free(buf);
+                fclose(file);
+                return -1;
+            }
+            buf = tmp;
+        }
+        n = fread(buf + *len, 1, size - *len, file);
+        *len += n;
+    } while (n > 0);
+    if (ferror(file)) {
+        free(buf);
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+    *data = buf;
+    return 0;
+}
+
+// Creates the directories leading to path.
+static void make_parents(char *path)
+{
+    for (char *p = path + 1; *p; p++) {
+        if (*p == '/') {
+            *p = '\0';
+            make_dir(path);
+            *p = '/';
+        }
+    }
+}
+
+// Writes a temporary file next to path and renames it, so readers see
+// either the old or the complete new file.
+static int write_atomic(const char *path, const char *data, size_t len, int worker)
+{
+    char *tmp = malloc(strlen(path) + 32);
+    FILE *file;
+    int rc = -1;
+    if (!tmp) {
+        return -1;
+    }
+    sprintf(tmp, "%s.%d.%d.tmp", path, (int) process_id(), worker);
+    file = fopen(tmp, "wb");
+    if (file) {
+        rc = fwrite(data, 1, len, file) == len ? 0 : -1;
+        if (fclose(file) != 0) {
+            rc = -1;
+        }
+#if defined(_WIN32)
+        // rename does not replace existing files on Windows
+        if (rc == 0) {
+            remove(path);
+        }
+#endif
+        if (rc == 0 && rename(tmp, path) != 0) {
+            rc = -1;
+        }
+        if (rc != 0) {
+            remove(tmp);
+        }
+    }
+    free(tmp);
+    return rc;
+}
+
+static int render_job(batch_worker *w, batch_job *job)
+{
+    batch *b = w->b;
+    char *text = NULL;
+    char *out_path = NULL;
+    char *cache_path = NULL;
+    size_t len;
+    int rc = -1;
+
+    if (read_file(job->path, &text, &len) != 0) {
+        fprintf(stderr, "%s: %s\n", job->path, strerror(errno));
+        return -1;
+    }
+    out_path = join_path(b->outdir, job->name);
+    if (!out_path) {
+        goto done;
+    }
+    make_parents(out_path);
+
+    if (b->cachedir) {
+        char key[24];
+        char *html;
+        size_t html_len;
+        sprintf(key, "%016llx.html", hash_bytes(b->options_hash, text, len));
+        cache_path = join_path(b->cachedir, key);
+        if (!cache_path) {
+            goto done;
+        }
+        if (read_file(cache_path, &html, &html_len) == 0) {
+            rc = write_atomic(out_path, html, html_len, w->index);
+            free(html);
+            w->cached += (rc == 0);
+            goto done;
+        }
+    }
+
+    mchtml_buffer html;
+    mchtml_stream st;
+    mchtml_buffer_init(&html, NULL, NULL);
+    mchtml_stream_init(&st, &html);
+    mchtml_begin(&html, b->options);
+    mchtml_stream_feed(&st, text, len);
+    mchtml_stream_finish(&st);
+    mchtml_end(&html, b->options);
+    if (!html.failed) {
+        rc = write_atomic(out_path, html.data, html.len, w->index);
+        // a cache entry that cannot be written only costs time later
+        if (rc == 0 && cache_path) {
+            write_atomic(cache_path, html.data, html.len, w->index);
+        }
+    }
+    mchtml_buffer_free(&html);
+    w->rendered += (rc == 0);
+
+done:
+    if (rc != 0) {
+        fprintf(stderr, "%s: cannot write %s\n", job->path, out_path ? out_path : job->name);
+    }
+    free(cache_path);
+    free(out_path);
+    free(text);
+    return rc;
+}
+
+static batch_job *take_job(batch_queue *q)
+{
+    batch_job *job = NULL;
+    pthread_mutex_lock(&q->lock);
+    if (q->head < q->tail) {
+        job = q->jobs[q->head++];
+    }
+    pthread_mutex_unlock(&q->lock);
+    return job;
+}
+
+static void *worker(void *arg)
+{
+    batch_worker *w = (batch_worker *) arg;
+    for (;;) {
+        batch_job *job = take_job(&w->queues[w->index]);
+        // no jobs are added while running, so all queues empty means done
+        for (int i = 1; !job && i < w->threads; i++) {
+            job = take_job(&w->queues[(w->index + i) % w->threads]);
+        }
+        if (!job) {
+            break;
+        }
+        if (render_job(w, job) != 0) {
+            w->failed++;
+        }
+    }
+    return NULL;
+}
+
+static int compare_names(const void *a, const void *b)
+{
+    const batch_job *ja = *(const batch_job **) a;
+    const batch_job *jb = *(const batch_job **) b;
+    return strcmp(ja->name, jb->name);
+}
+
+// Reports inputs with the same output name, which two workers would
+// write at the same time; jobs is sorted by name. Returns their number.
+static int count_duplicates(batch_job **jobs, size_t count)
+{
+    int duplicates = 0;
+    for (size_t i = 1; i < count; i++) {
+        if (strcmp(jobs[i - 1]->name, jobs[i]->name) == 0) {
+            fprintf(stderr, "%s: same output %s as %s\n", jobs[i]->path, jobs[i]->name, jobs[i - 1]->path);
+            duplicates++;
+        }
+    }
+    return duplicates;
+}
+
+// Largest first, then by name for a reproducible order.
+static int compare_jobs(const void *a, const void *b)
+{
+    const batch_job *ja = *(const batch_job **) a;
+    const batch_job *jb = *(const batch_job **) b;
+    if (ja->size != jb->size) {
+        return ja->size > jb->size ? -1 : 1;
+    }
+    return strcmp(ja->name, jb->name);
+}
+
+int batch_run(batch *b, int threads)
+{
+    batch_queue queues[MAX_THREADS];
+    batch_worker workers[MAX_THREADS];
+    batch_job **sorted;
+    batch_job **dealt;
+    size_t pos = 0;
+    int started = 0;
+
+    threads = threads < MAX_THREADS ? threads : MAX_THREADS;
+    threads = threads > 0 ? threads : 1;
+    sorted = malloc((b->count + 1) * sizeof(batch_job *));
+    dealt = malloc((b->count + 1) * sizeof(batch_job *));
+    if (!sorted || !dealt) {
+        free(sorted);
+        free(dealt);
+        return -1;
+    }
+    for (size_t i = 0; i < b->count; i++) {
+        sorted[i] = &b->jobs[i];
+    }
+    qsort(sorted, b->count, sizeof(batch_job *), compare_names);
+    b->failed = count_duplicates(sorted, b->count);
+    if (b->failed) {
+        free(sorted);
+        free(dealt);
+        return -1;
+    }
+    qsort(sorted, b->count, sizeof(batch_job *), compare_jobs);
+
+    // deal the sorted jobs round-robin, so queue t holds the jobs
+    // t, t + threads, t + 2 * threads, ... in sorted order
+    for (int t = 0; t < threads; t++) {
+        queues[t].jobs = dealt + pos;
+        queues[t].head = 0;
+        for (size_t i = t; i < b->count; i += threads) {
+            dealt[pos++] = sorted[i];
+        }
+        queues[t].tail = dealt + pos - queues[t].jobs;
+        pthread_mutex_init(&queues[t].lock, NULL);
+    }
+
+    make_dir(b->outdir);
+    if (b->cachedir) {
+        make_dir(b->cachedir);
+    }
+    mclex_setup();
+
+    for (int t = 0; t < threads; t++) {
+        workers[t].b = b;
+        workers[t].queues = queues;
+        workers[t].threads = threads;
+        workers[t].index = t;
+        workers[t].rendered = 0;
+        workers[t].cached = 0;
+        workers[t].failed = 0;
+    }
+    while (started < threads && pthread_create(&workers[started].id, NULL, worker, &workers[started]) == 0) {
+        started++;
+    }
+    if (started == 0) {
+        // the first worker steals all other queues
+        worker(&workers[0]);
+    }
+    for (int t = 0; t < started; t++) {
+        pthread_join(workers[t].id, NULL);
+    }
+
+    for (int t = 0; t < threads; t++) {
+        b->rendered += workers[t].rendered;
+        b->cached += workers[t].cached;
+        b->failed += workers[t].failed;
+        pthread_mutex_destroy(&queues[t].lock);
+    }
+    free(dealt);
+    free(sorted);
+    return b->failed ? -1 : 0;
+}
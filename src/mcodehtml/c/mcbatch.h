@@ -0,0 +1,55 @@
+#if !defined(__MCBATCH_H__)
+#define __MCBATCH_H__
+
+#include <stdio.h>
+
+#include "mchtml.h"
+
+// Batch rendering of many files.
+//
+// Files are collected from directory trees (all *.src files) and file
+// lists, sorted by size and dealt round-robin to one queue per thread,
+// so every thread starts with its largest files. A thread that runs
+// out of work steals the next file from the queue of another thread.
+//
+// Each output file name is the input path relative to the directory
+// given, or as given for relative file names, with .src replaced by
+// .html. Absolute names and names with a ".." component are reduced to
+// the file name. Two inputs with the same output name are an error, and
+// then nothing is rendered. With a cache directory, renderings are
+// stored under a hash of the file content and the options, and files
+// with a known hash are copied from the cache. Outputs and cache
+// entries are written to a temporary file first and then renamed into
+// place.
+
+struct batch_job_t;
+
+struct batch_t {
+    const mchtml_options *options;
+    const char *outdir;
+    const char *cachedir;       // NULL if no cache is used
+    struct batch_job_t *jobs;
+    size_t count;
+    size_t size;
+    unsigned long long options_hash;
+    int rendered;
+    int cached;
+    int failed;
+};
+
+typedef struct batch_t batch;
+
+void batch_init(batch *b, const mchtml_options *options, const char *outdir, const char *cachedir);
+void batch_free(batch *b);
+
+// Adds a file or all *.src files below a directory. Returns 0 or -1.
+int batch_add(batch *b, const char *path);
+
+// Adds the files named in a list, one per line. Returns 0 or -1.
+int batch_add_list(batch *b, FILE *list);
+
+// Renders all files on the given number of threads. Returns 0 if all
+// files were written.
+int batch_run(batch *b, int threads);
+
+#endif // !defined(__MCBATCH_H__)
@@ -0,0 +1,130 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "mcodelex.h"
+#include "mchtml.h"
+#include "mcchunk.h"
+
+#define MAX_THREADS     64
+
+struct chunk_t {
+    const char *text;
+    size_t len;
+    mchtml_buffer html;
+    int done;
+};
+
+struct chunk_pool_t {
+    struct chunk_t *chunks;
+    size_t count;
+    size_t next;            // next chunk to render
+    size_t written;         // chunks written so far
+    size_t window;          // chunks in flight
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+};
+
+typedef struct chunk_t chunk;
+typedef struct chunk_pool_t chunk_pool;
+
+static size_t split_chunks(const char *text, size_t len, chunk *chunks)
+{
+    const char *p = text;
+    const char *end = text + len;
+    size_t count = 0;
+    while (p < end) {
+        const char *nl = (end - p > CHUNK_TEXT_SIZE) ? memchr(p + CHUNK_TEXT_SIZE - 1, '\n', end - p - CHUNK_TEXT_SIZE + 1) : NULL;
+        const char *stop = nl ? nl + 1 : end;
+        if (chunks) {
+            chunks[count].text = p;
+            chunks[count].len = stop - p;
+            mchtml_buffer_init(&chunks[count].html, NULL, NULL);
+            chunks[count].done = 0;
+        }
+        count++;
+        p = stop;
+    }
+    return count;
+}
+
+static void *worker(void *arg)
+{
+    chunk_pool *pool = (chunk_pool *) arg;
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->next < pool->count && pool->next >= pool->written + pool->window) {
+            pthread_cond_wait(&pool->changed, &pool->lock);
+        }
+        if (pool->next == pool->count) {
+            break;
+        }
+        chunk *c = &pool->chunks[pool->next++];
+        pthread_mutex_unlock(&pool->lock);
+        mchtml_lines(&c->html, c->text, c->len);
+        pthread_mutex_lock(&pool->lock);
+        c->done = 1;
+        pthread_cond_broadcast(&pool->changed);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+int render_chunked(const char *text, size_t len, int threads, mchtml_buffer *out)
+{
+    chunk_pool pool;
+    pthread_t ids[MAX_THREADS];
+    int started = 0;
+    int failed = 0;
+
+    mclex_setup();
+    mchtml_buffer_flush(out);
+    pool.count = split_chunks(text, len, NULL);
+    pool.chunks = malloc(pool.count * sizeof(chunk));
+    if (!pool.chunks) {
+        return -1;
+    }
+    split_chunks(text, len, pool.chunks);
+    pool.next = 0;
+    pool.written = 0;
+    threads = threads < MAX_THREADS ? threads : MAX_THREADS;
+    pool.window = 2 * threads;
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.changed, NULL);
+
+    while (started < threads && pthread_create(&ids[started], NULL, worker, &pool) == 0) {
+        started++;
+    }
+    if (started == 0) {
+        pool.window = pool.count;
+        worker(&pool);
+    }
+
+    for (size_t i = 0; i < pool.count; i++) {
+        chunk *c = &pool.chunks[i];
+        pthread_mutex_lock(&pool.lock);
+        while (!c->done) {
+            pthread_cond_wait(&pool.changed, &pool.lock);
+        }
+        pthread_mutex_unlock(&pool.lock);
+
+        failed |= c->html.failed;
+        if (!failed) {
+            out->write(out->user, c->html.data, c->html.len);
+        }
+        mchtml_buffer_free(&c->html);
+
+        pthread_mutex_lock(&pool.lock);
+        pool.written++;
+        pthread_cond_broadcast(&pool.changed);
+        pthread_mutex_unlock(&pool.lock);
+    }
+
+    for (int t = 0; t < started; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    pthread_cond_destroy(&pool.changed);
+    pthread_mutex_destroy(&pool.lock);
+    free(pool.chunks);
+    return failed ? -1 : 0;
+}
@@ -0,0 +1,25 @@
+#if !defined(__MCCHUNK_H__)
+#define __MCCHUNK_H__
+
+#include <stddef.h>
+
+#include "mchtml.h"
+
+// Parallel rendering of one large input.
+//
+// Every pushed context of the grammar ends at the end of its line, so
+// lines can be rendered independently. The input is split into chunks
+// of about CHUNK_TEXT_SIZE bytes right after a \n, the chunks are
+// rendered by a pool of threads and written in input order. At most
+// two chunks per thread are in flight, which bounds the memory used.
+// The output is the same as that of a sequential run.
+
+#define CHUNK_TEXT_SIZE     (1 << 20)
+
+// Renders all lines of text, which must have been narrowed with
+// mchtml_trim() and must not be empty. The output buffer is flushed
+// first, the rendered chunks go directly to its write function.
+// Returns 0 on success and -1 if memory ran out.
+int render_chunked(const char *text, size_t len, int threads, mchtml_buffer *out);
+
+#endif // !defined(__MCCHUNK_H__)
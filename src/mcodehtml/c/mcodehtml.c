@@ -0,0 +1,271 @@
+/**********************************************************************
+ * MCODE HTML Renderer CLI
+ *
+ * Writes the HTML that pygmentize writes for MCODE source files:
+ *
+ *     mcodehtml [-O cssclass=NAME,full,title=TEXT] [-S styledefs] [-j threads] [file]
+ *     mcodehtml [-O ...] [-S styledefs] [-j threads] -o outdir [-c cachedir] [-L list] path...
+ *
+ * Files are memory-mapped, standard input is read in chunks. Output is
+ * written to stdout as it is produced, so memory use does not depend on
+ * the size of the input. With -j, a file is split at line boundaries
+ * and rendered on several threads (see mcchunk.h).
+ *
+ * With -o, all given files, all *.src files below given directories and
+ * all files named in the list (- for standard input) are rendered into
+ * the output directory, one file per thread (see mcbatch.h). Renderings
+ * are reused from the cache directory if the content is unchanged.
+ *
+ * Full documents embed the MCODE Monokai style definitions. Option -S
+ * embeds the definitions of another style instead, as written by
+ *
+ *     pygmentize -f html -S STYLE -a body >styledefs
+ *********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "mcodelex.h"
+#include "mchtml.h"
+#include "mcchunk.h"
+#include "mcbatch.h"
+
+#define CHUNK_SIZE  (1 << 16)
+
+static void write_stdout(void *user, const char *data, size_t len)
+{
+    (void) user;
+    fwrite(data, 1, len, stdout);
+}
+
+#if !defined(_WIN32)
+
+// Returns NULL if the file cannot be mapped, e.g. if it is empty.
+static const char *map_file(const char *path, size_t *size)
+{
+    struct stat st;
+    void *data = NULL;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            data = NULL;
+        }
+        *size = st.st_size;
+    }
+    close(fd);
+    return data;
+}
+
+static void unmap_file(const char *data, size_t size)
+{
+    munmap((void *) data, size);
+}
+
+#endif
+
+static int render_stream(FILE *file, mchtml_stream *st)
+{
+    static char chunk[CHUNK_SIZE];
+    size_t len;
+    int rc = 0;
+    while (rc == 0 && (len = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        rc = mchtml_stream_feed(st, chunk, len);
+    }
+    return ferror(file) ? -1 : rc;
+}
+
+static int render_file(const char *path, mchtml_stream *st, int threads)
+{
+#if !defined(_WIN32)
+    size_t size;
+    const char *data = map_file(path, &size);
+    if (data) {
+        const char *text = data;
+        size_t len = size;
+        int rc;
+        mchtml_trim(&text, &len);
+        if (threads > 1 && len > CHUNK_TEXT_SIZE) {
+            // the stream sees no lines and renders nothing on finish
+            st->started = 1;
+            rc = render_chunked(text, len, threads, st->out);
+        } else {
+            rc = mchtml_stream_feed(st, data, size);
+        }
+        unmap_file(data, size);
+        return rc;
+    }
+#endif
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        return -1;
+    }
+    int rc = render_stream(file, st);
+    fclose(file);
+    return rc;
+}
+
+static char *read_styledefs(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    char *defs = NULL;
+    size_t len = 0;
+    size_t n;
+    if (!file) {
+        return NULL;
+    }
+    do {
+        char *tmp = realloc(defs, len + CHUNK_SIZE + 1);
+        if (!tmp) {
+            free(defs);
+            fclose(file);
+            return NULL;
+        }
+        defs = tmp;
+        n = fread(defs + len, 1, CHUNK_SIZE, file);
+        len += n;
+    } while (n > 0);
+    fclose(file);
+    // pygmentize -S ends the definitions with a line break
+    while (len > 0 && (defs[len - 1] == '\n' || defs[len - 1] == '\r')) {
+        len--;
+    }
+    defs[len] = '\0';
+    return defs;
+}
+
+// Parses comma separated Pygments formatter options. Unknown options
+// are ignored like pygmentize does.
+static void parse_options(char *arg, mchtml_options *options)
+{
+    for (char *opt = strtok(arg, ","); opt; opt = strtok(NULL, ",")) {
+        char *value = strchr(opt, '=');
+        if (value) {
+            *value++ = '\0';
+        }
+        if (strcmp(opt, "full") == 0) {
+            options->full = !value || (strcmp(value, "False") != 0 && strcmp(value, "0") != 0);
+        } else if (strcmp(opt, "cssclass") == 0 && value) {
+            options->cssclass = value;
+        } else if (strcmp(opt, "title") == 0 && value) {
+            options->title = value;
+        }
+    }
+}
+
+static int render_batch(const mchtml_options *options, const char *outdir, const char *cachedir,
+                        const char *list, char **paths, int count, int threads)
+{
+    batch b;
+    int rc = 0;
+    batch_init(&b, options, outdir, cachedir);
+    if (list) {
+        FILE *file = strcmp(list, "-") == 0 ? stdin : fopen(list, "r");
+        if (!file) {
+            perror(list);
+            batch_free(&b);
+            return 1;
+        }
+        rc |= batch_add_list(&b, file);
+        if (file != stdin) {
+            fclose(file);
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        rc |= batch_add(&b, paths[i]);
+    }
+    if (rc == 0) {
+        rc = batch_run(&b, threads);
+        fprintf(stderr, "mcodehtml: %d rendered, %d from cache, %d failed\n", b.rendered, b.cached, b.failed);
+    }
+    batch_free(&b);
+    return rc ? 1 : 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodehtml [-O options] [-S styledefs] [-j threads] [file]\n");
+    fprintf(stderr, "       mcodehtml [-O options] [-S styledefs] [-j threads] -o outdir [-c cachedir] [-L list] path...\n");
+    fprintf(stderr, "  -O  formatter options cssclass=NAME, full and title=TEXT\n");
+    fprintf(stderr, "  -S  file with the style definitions of full documents\n");
+    fprintf(stderr, "  -j  number of threads for large files or batches (default 1)\n");
+    fprintf(stderr, "  -o  render files and *.src files below directories into outdir\n");
+    fprintf(stderr, "  -c  cache directory for batches\n");
+    fprintf(stderr, "  -L  file with the names of the files of a batch, - for stdin\n");
+}
+
+int main(int argc, char *argv[])
+{
+    mchtml_options options = { "highlight", "", NULL, 0 };
+    mchtml_buffer out;
+    mchtml_stream st;
+    char *styledefs = NULL;
+    const char *outdir = NULL;
+    const char *cachedir = NULL;
+    const char *list = NULL;
+    int threads = 1;
+    int rc;
+    int i;
+
+    for (i = 1; i + 1 < argc && argv[i][0] == '-'; i += 2) {
+        if (strcmp(argv[i], "-O") == 0) {
+            parse_options(argv[i + 1], &options);
+        } else if (strcmp(argv[i], "-j") == 0 && atoi(argv[i + 1]) > 0) {
+            threads = atoi(argv[i + 1]);
+        } else if (strcmp(argv[i], "-o") == 0) {
+            outdir = argv[i + 1];
+        } else if (strcmp(argv[i], "-c") == 0) {
+            cachedir = argv[i + 1];
+        } else if (strcmp(argv[i], "-L") == 0) {
+            list = argv[i + 1];
+        } else if (strcmp(argv[i], "-S") == 0) {
+            free(styledefs);
+            styledefs = read_styledefs(argv[i + 1]);
+            if (!styledefs) {
+                perror(argv[i + 1]);
+                return 1;
+            }
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    options.styledefs = styledefs;
+    if (outdir) {
+        rc = render_batch(&options, outdir, cachedir, list, argv + i, argc - i, threads);
+        free(styledefs);
+        return rc;
+    }
+    if (argc - i > 1 || (i < argc && argv[i][0] == '-' && argv[i][1]) || cachedir || list) {
+        usage();
+        return 2;
+    }
+
+    mchtml_buffer_init(&out, write_stdout, NULL);
+    mchtml_stream_init(&st, &out);
+    mchtml_begin(&out, &options);
+    rc = (i < argc && strcmp(argv[i], "-") != 0) ? render_file(argv[i], &st, threads) : render_stream(stdin, &st);
+    if (mchtml_stream_finish(&st)) {
+        rc = -1;
+    }
+    mchtml_end(&out, &options);
+    mchtml_buffer_flush(&out);
+    mchtml_buffer_free(&out);
+    free(styledefs);
+    if (rc) {
+        fprintf(stderr, "mcodehtml: rendering failed\n");
+    }
+    return rc ? 1 : 0;
+}
@@ -0,0 +1,255 @@
+/**********************************************************************
+ * MCODE Image Converter
+ *
+ *     mcodeimg [-f rom|bin] [-t rom|bin] -o output image
+ *     mcodeimg -b [-n words]
+ *
+ * Converts a ROM image between the formats of mcimage.h: 4 words packed
+ * into 5 bytes (rom) and 16-bit big-endian words (bin). The format of a
+ * file is bin if its name ends in .bin and rom otherwise, unless -f
+ * (input) or -t (output) says otherwise.
+ *
+ * With -b, the pack and unpack kernels the processor supports are timed
+ * on n random words (default 16M) and checked against the scalar
+ * kernel, including round trips of short runs at every alignment:
+ *
+ *     kernel  rom unpack     rom pack   bin unpack     bin pack
+ *     scalar   1198 Mw/s    1170 Mw/s    1481 Mw/s    1153 Mw/s
+ *     sse2     1023 Mw/s     889 Mw/s    2769 Mw/s    3297 Mw/s
+ *     avx2     4513 Mw/s    3514 Mw/s    3394 Mw/s    3700 Mw/s
+ *
+ * in millions of words per second. The exit status is 1 if a kernel
+ * gives a different result.
+ *********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mcimage.h"
+
+#define REPEAT_BYTES    (1 << 28)       // converted per measurement
+#define RUN_WORDS       64              // longest run of the round trips
+
+static const char *const kernel_names[] = { "scalar", "sse2", "avx2" };
+
+static unsigned int next_random(unsigned int *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static double seconds(clock_t begin)
+{
+    return (double) (clock() - begin) / CLOCKS_PER_SEC;
+}
+
+// Millions of words per second of one conversion, repeated on count
+// words until about REPEAT_BYTES were converted.
+static double measure(int format, int pack, size_t count, unsigned short *words, unsigned char *bytes)
+{
+    size_t repeat = REPEAT_BYTES / image_bytes(count, format) + 1;
+    clock_t begin = clock();
+    for (size_t r = 0; r < repeat; r++) {
+        if (pack) {
+            image_pack(words, count, format, bytes);
+        } else {
+            image_unpack(bytes, format, count, words);
+        }
+    }
+    double s = seconds(begin);
+    return s > 0 ? (double) count * repeat / s / 1e6 : 0;
+}
+
+// Packs and unpacks runs of 0 to RUN_WORDS words at every offset with
+// the current kernel and compares the bytes and words with those of the
+// scalar kernel. Returns the number of differences.
+static int check_runs(int kernel, unsigned int *state)
+{
+    unsigned short words[RUN_WORDS + 8];
+    unsigned short back[RUN_WORDS + 8];
+    unsigned short expected_words[RUN_WORDS + 8];
+    unsigned char bytes[2*RUN_WORDS + 16];
+    unsigned char expected[2*RUN_WORDS + 16];
+    int problems = 0;
+
+    for (int format = IMAGE_ROM; format <= IMAGE_BIN; format++) {
+        for (int count = 0; count <= RUN_WORDS; count++) {
+            for (int offset = 0; offset < 8; offset++) {
+                for (int i = 0; i < count; i++) {
+                    words[offset + i] = (unsigned short) (next_random(state) & 0xFFFF);
+                }
+                size_t n = image_bytes(count, format);
+                image_set_kernel(IMAGE_SCALAR);
+                image_pack(words + offset, count, format, expected + offset);
+                image_unpack(expected + offset, format, count, expected_words);
+                image_set_kernel(kernel);
+                image_pack(words + offset, count, format, bytes + offset);
+                image_unpack(bytes + offset, format, count, back + offset);
+                if (memcmp(bytes + offset, expected + offset, n) != 0 ||
+                    memcmp(back + offset, expected_words, count * sizeof(unsigned short)) != 0) {
+                    problems++;
+                }
+                for (int i = 0; i < count; i++) {
+                    if (back[offset + i] != (words[offset + i] & 0x3FF)) {
+                        problems++;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    return problems;
+}
+
+static int benchmark(size_t count)
+{
+    unsigned short *words = malloc(count * sizeof(unsigned short));
+    unsigned short *back = malloc(count * sizeof(unsigned short));
+    unsigned char *expected[2] = { malloc(image_bytes(count, IMAGE_ROM)), malloc(image_bytes(count, IMAGE_BIN)) };
+    unsigned char *bytes = malloc(image_bytes(count, IMAGE_BIN));
+    unsigned int state = 2463534242u;
+    int problems = 0;
+
+    if (!words || !back || !expected[0] || !expected[1] || !bytes) {
+        fprintf(stderr, "mcodeimg: out of memory\n");
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        words[i] = (unsigned short) (next_random(&state) & 0x3FF);
+    }
+    image_set_kernel(IMAGE_SCALAR);
+    image_pack(words, count, IMAGE_ROM, expected[0]);
+    image_pack(words, count, IMAGE_BIN, expected[1]);
+
+    printf("kernel  rom unpack     rom pack   bin unpack     bin pack\n");
+    for (int kernel = IMAGE_SCALAR; kernel <= IMAGE_AVX2; kernel++) {
+        if (image_set_kernel(kernel)) {
+            continue;
+        }
+        double rate[4];
+        for (int format = IMAGE_ROM; format <= IMAGE_BIN; format++) {
+            size_t n = image_bytes(count, format);
+            image_pack(words, count, format, bytes);
+            image_unpack(bytes, format, count, back);
+            if (memcmp(bytes, expected[format], n) != 0 || memcmp(back, words, count * sizeof(unsigned short)) != 0) {
+                fprintf(stderr, "mcodeimg: %s %s round trip differs\n", kernel_names[kernel],
+                    format == IMAGE_ROM ? "rom" : "bin");
+                problems++;
+            }
+            memcpy(bytes, expected[format], n);
+            rate[2*format] = measure(format, 0, count, back, bytes);
+            rate[2*format + 1] = measure(format, 1, count, words, bytes);
+        }
+        int runs = check_runs(kernel, &state);
+        if (runs) {
+            fprintf(stderr, "mcodeimg: %s differs on %d short runs\n", kernel_names[kernel], runs);
+            problems += runs;
+        }
+        printf("%-6s  %5.0f Mw/s   %5.0f Mw/s   %5.0f Mw/s   %5.0f Mw/s\n", kernel_names[kernel],
+            rate[0], rate[1], rate[2], rate[3]);
+    }
+
+    free(words);
+    free(back);
+    free(expected[0]);
+    free(expected[1]);
+    free(bytes);
+    return problems ? -1 : 0;
+}
+
+static int convert(const char *input, int from, const char *output, int to)
+{
+    image_view view;
+    if (image_open(&view, input, from)) {
+        perror(input);
+        return -1;
+    }
+    if (to < 0) {
+        to = image_format(output);
+    }
+    unsigned short *words = malloc((view.words + 1) * sizeof(unsigned short));
+    unsigned char *bytes = malloc(image_bytes(view.words, to) + 1);
+    int rc = -1;
+    if (!words || !bytes) {
+        fprintf(stderr, "mcodeimg: out of memory\n");
+    } else {
+        image_read(&view, 0, view.words, words);
+        image_pack(words, view.words, to, bytes);
+        FILE *file = fopen(output, "wb");
+        if (!file) {
+            perror(output);
+        } else {
+            size_t n = image_bytes(view.words, to);
+            rc = fwrite(bytes, 1, n, file) == n ? 0 : -1;
+            if (fclose(file) || rc) {
+                perror(output);
+                rc = -1;
+            }
+        }
+    }
+    free(words);
+    free(bytes);
+    image_close(&view);
+    return rc;
+}
+
+static int parse_format(const char *name)
+{
+    if (strcmp(name, "rom") == 0) {
+        return IMAGE_ROM;
+    } else if (strcmp(name, "bin") == 0) {
+        return IMAGE_BIN;
+    }
+    return -1;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodeimg [-f rom|bin] [-t rom|bin] -o output image\n");
+    fprintf(stderr, "       mcodeimg -b [-n words]\n");
+    fprintf(stderr, "  -f  input format (default bin for .bin files, rom otherwise)\n");
+    fprintf(stderr, "  -t  output format (default bin for .bin files, rom otherwise)\n");
+    fprintf(stderr, "  -o  image file to write\n");
+    fprintf(stderr, "  -b  time and check the kernels\n");
+    fprintf(stderr, "  -n  number of words of the benchmark (default 16M)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *output = NULL;
+    int from = -1;
+    int to = -1;
+    int bench = 0;
+    double count = 16 * 1024 * 1024;
+    int i;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        const char *arg = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "-b") == 0) {
+            bench = 1;
+        } else if (strcmp(argv[i], "-n") == 0 && arg && atof(arg) >= 1) {
+            count = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-f") == 0 && arg && parse_format(arg) >= 0) {
+            from = parse_format(argv[++i]);
+        } else if (strcmp(argv[i], "-t") == 0 && arg && parse_format(arg) >= 0) {
+            to = parse_format(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0 && arg) {
+            output = argv[++i];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (bench) {
+        return benchmark((size_t) count) ? 1 : 0;
+    }
+    if (i + 1 != argc || !output) {
+        usage();
+        return 2;
+    }
+    return convert(argv[i], from, output, to) ? 1 : 0;
+}
@@ -0,0 +1,989 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcgrammar.h"
+#include "mcregex.h"
+#include "mcbacktrack.h"
+
+#define EXPONENTIAL     -1          // degree of exponential growth
+#define MAX_DEGREE      9
+#define MAX_STEPS       20000000L   // steps of a line before giving up
+#define MAX_TRIPLES     (1 << 22)   // states of the IDA search
+#define MAX_TEXT        256         // of prefix and pump
+#define ON_PATH         4           // instruction on the path being followed
+#define PROBE_LENGTH    16          // pumps when choosing the suffix
+#define SHORT_LENGTH    64          // pumps of the two measurements
+#define LONG_LENGTH     128
+
+// Characters of worst-case lines, the printable ones first
+static const char preferred[] =
+    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+    " ;()[]\".+-#/@*?=&<>^_,:!$%'{}|~`\\\t";
+
+// The automaton of a pattern. Its states are the RE_SET instructions,
+// which consume a character, and a start state. An edge leads from a
+// state to the next ones through the instructions that consume nothing;
+// if there are several ways, the edge counts twice, as a backtracking
+// engine tries both. Word boundaries are assumed to pass.
+struct automaton_t {
+    mcregex *re;
+    int count;              // states, the start is re->count
+    int *first;             // per state, its first edge, count + 1 entries
+    int *to;
+    unsigned char *mult;    // 1, or 2 for several ways
+    int edge_count;
+    int edge_size;
+    int *comp;              // per state, its strongly connected component
+    int *loop;              // per component, its loop or -1
+    int loop_count;
+    int empty_loop;         // a loop that consumes nothing
+};
+
+// Worst-case line of a loop
+struct attack_t {
+    char prefix[MAX_TEXT];
+    char pump[MAX_TEXT];
+    char suffix[2];
+    int attempt;            // degree of a match attempt
+    int line;               // degree of lexing the line
+};
+
+// Stack of a backtracking engine
+struct engine_t {
+    mcregex *re;
+    long *stack;            // pairs of pc and position
+    size_t size;
+    long steps;
+};
+
+typedef struct automaton_t automaton;
+typedef struct attack_t attack;
+typedef struct engine_t engine;
+
+static int error(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "mcodeiro: ");
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    return -1;
+}
+
+// Lines never contain \n, so it is left out of all sets.
+static int sets_meet(const mcregex *re, int a, int b, int c)
+{
+    const unsigned char *x = re->sets[re->code[a].x];
+    const unsigned char *y = re->sets[re->code[b].x];
+    const unsigned char *z = re->sets[re->code[c].x];
+    for (int i = 0; i < RE_SET_SIZE; i++) {
+        if (x[i] & y[i] & z[i] & (i == '\n' / 8 ? ~(1 << '\n' % 8) : 0xFF)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Returns a character of set, or of its complement if inside is 0, or
+// -1 if there is none.
+static int pick(const mcregex *re, int set, int inside)
+{
+    for (const char *p = preferred; *p; p++) {
+        if (mcregex_in_set(re, set, (unsigned char) *p) == inside) {
+            return (unsigned char) *p;
+        }
+    }
+    for (int ch = 1; ch < 256; ch++) {
+        if (ch != '\n' && mcregex_in_set(re, set, ch) == inside) {
+            return ch;
+        }
+    }
+    return -1;
+}
+
+// Strongly connected components, Tarjan's algorithm without recursion.
+// Sets comp[v] of every node and returns the number of components, or
+// -1 if memory ran out.
+static int find_components(int n, const int *first, const int *to, int *comp)
+{
+    int *index = malloc(5 * (size_t) n * sizeof(int) + 1);
+    int *low = index + n;
+    int *stack = index + 2 * n;
+    int *call = index + 3 * n;
+    int *edge = index + 4 * n;
+    int counter = 0;
+    int count = 0;
+    int top = 0;
+    if (!index) {
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        index[i] = -1;
+    }
+    for (int root = 0; root < n; root++) {
+        int depth = 1;
+        if (index[root] >= 0) {
+            continue;
+        }
+        call[0] = root;
+        edge[0] = first[root];
+        index[root] = low[root] = counter++;
+        stack[top++] = root;
+        while (depth > 0) {
+            int v = call[depth - 1];
+            if (edge[depth - 1] < first[v + 1]) {
+                int w = to[edge[depth - 1]++];
+                if (index[w] < 0) {
+                    index[w] = low[w] = counter++;
+                    stack[top++] = w;
+                    call[depth] = w;
+                    edge[depth] = first[w];
+                    depth++;
+                } else if (comp[w] < 0 && index[w] < low[v]) {
+                    low[v] = index[w];  // w is still on the stack
+                }
+                continue;
+            }
+            if (low[v] == index[v]) {
+                int w;
+                do {
+                    w = stack[--top];
+                    comp[w] = count;
+                } while (w != v);
+                count++;
+            }
+            if (--depth > 0 && low[v] < low[call[depth - 1]]) {
+                low[call[depth - 1]] = low[v];
+            }
+        }
+    }
+    free(index);
+    return count;
+}
+
+static int add_edge(automaton *a, int to, int mult)
+{
+    if (a->edge_count == a->edge_size) {
+        int size = a->edge_size ? 2 * a->edge_size : 256;
+        int *edges = realloc(a->to, size * sizeof(int));
+        unsigned char *mults;
+        if (!edges) {
+            return -1;
+        }
+        a->to = edges;
+        mults = realloc(a->mult, size);
+        if (!mults) {
+            return -1;
+        }
+        a->mult = mults;
+        a->edge_size = size;
+    }
+    a->to[a->edge_count] = to;
+    a->mult[a->edge_count++] = mult;
+    return 0;
+}
+
+// Follows the instructions that consume nothing from pc and counts the
+// ways to each RE_SET, up to 2. An instruction is followed at most twice,
+// which is enough to tell one way from several.
+static void follow(automaton *a, int pc, unsigned char *visits, unsigned char *ways, int *targets, int *count)
+{
+    const mcregex_inst *in = &a->re->code[pc];
+    if (in->op == RE_SET) {
+        if (ways[pc] == 0) {
+            targets[(*count)++] = pc;
+        }
+        if (ways[pc] < 2) {
+            ways[pc]++;
+        }
+        return;
+    }
+    if (visits[pc] & ON_PATH) {
+        a->empty_loop = 1;
+        return;
+    }
+    if (in->op == RE_MATCH || visits[pc] == 2) {
+        return;
+    }
+    visits[pc] = (visits[pc] + 1) | ON_PATH;
+    switch (in->op) {
+    case RE_SPLIT:
+        follow(a, in->x, visits, ways, targets, count);
+        follow(a, in->y, visits, ways, targets, count);
+        break;
+    case RE_JMP:
+        follow(a, in->x, visits, ways, targets, count);
+        break;
+    default:
+        follow(a, pc + 1, visits, ways, targets, count);
+        break;
+    }
+    visits[pc] &= ~ON_PATH;
+}
+
+static void free_automaton(automaton *a)
+{
+    free(a->first);
+    free(a->to);
+    free(a->mult);
+    free(a->comp);
+    free(a->loop);
+}
+
+static int build_automaton(automaton *a, mcregex *re)
+{
+    int n = re->count + 1;
+    unsigned char *visits = calloc(2 * (size_t) re->count, 1);
+    unsigned char *ways = visits + re->count;
+    int *targets = malloc(re->count * sizeof(int));
+    int rc = 0;
+
+    memset(a, 0, sizeof(automaton));
+    a->re = re;
+    a->count = n;
+    a->first = malloc((n + 1) * sizeof(int));
+    a->comp = malloc(n * sizeof(int));
+    a->loop = malloc(n * sizeof(int));
+    if (!visits || !targets || !a->first || !a->comp || !a->loop) {
+        rc = -1;
+    }
+    for (int s = 0; s < n && rc == 0; s++) {
+        int count = 0;
+        a->first[s] = a->edge_count;
+        if (s < re->count && re->code[s].op != RE_SET) {
+            continue;
+        }
+        memset(visits, 0, 2 * (size_t) re->count);
+        follow(a, s < re->count ? s + 1 : 0, visits, ways, targets, &count);
+        for (int i = 0; i < count && rc == 0; i++) {
+            rc = add_edge(a, targets[i], ways[targets[i]]);
+        }
+    }
+    free(visits);
+    free(targets);
+    if (rc != 0) {
+        return -1;
+    }
+    a->first[n] = a->edge_count;
+
+    // a loop is a component with a cycle, numbered in the order of the
+    // components, which is reverse topological
+    for (int i = 0; i < n; i++) {
+        a->comp[i] = -1;
+        a->loop[i] = 0;
+    }
+    if (find_components(n, a->first, a->to, a->comp) < 0) {
+        return -1;
+    }
+    for (int s = 0; s < n; s++) {
+        for (int e = a->first[s]; e < a->first[s + 1]; e++) {
+            a->loop[a->comp[s]] |= a->comp[a->to[e]] == a->comp[s];
+        }
+    }
+    for (int c = 0; c < n; c++) {
+        a->loop[c] = a->loop[c] ? a->loop_count++ : -1;
+    }
+    return 0;
+}
+
+// States of a loop, in order
+static int loop_states(const automaton *a, int loop, int *states)
+{
+    int count = 0;
+    for (int s = 0; s < a->count; s++) {
+        if (a->loop[a->comp[s]] == loop) {
+            states[count++] = s;
+        }
+    }
+    return count;
+}
+
+// A loop is exponentially ambiguous if two different paths lead from a
+// state back to itself through the loop over the same text (Weber and
+// Seidl, On the degree of ambiguity of finite automata, 1991). On pairs
+// of states that read the same characters, that is a component with a
+// pair of equal and a pair of different states, or with an edge that
+// counts twice from an equal pair to an equal pair.
+static int exponential_loop(const automaton *a, int loop)
+{
+    int *states = malloc(a->count * sizeof(int));
+    int *local = malloc(a->count * sizeof(int));
+    int k = states ? loop_states(a, loop, states) : 0;
+    int pairs = k * k;
+    int *first = malloc((pairs + 1) * sizeof(int));
+    int *comp = malloc((pairs + 1) * sizeof(int));
+    int *to = NULL;
+    int *twice = NULL;
+    int edge_count = 0;
+    int edge_size = 0;
+    int twice_count = 0;
+    int found = 0;
+    if (!local || !states || !first || !comp) {
+        found = -1;
+    }
+
+    for (int i = 0; i < k && found == 0; i++) {
+        local[states[i]] = i;
+    }
+    for (int p = 0; p < pairs && found == 0; p++) {
+        int s = states[p / k];
+        int t = states[p % k];
+        first[p] = edge_count;
+        comp[p] = -1;
+        if (!sets_meet(a->re, s, t, t)) {
+            continue;
+        }
+        for (int e = a->first[s]; e < a->first[s + 1]; e++) {
+            for (int f = a->first[t]; f < a->first[t + 1]; f++) {
+                if (a->loop[a->comp[a->to[e]]] != loop || a->loop[a->comp[a->to[f]]] != loop) {
+                    continue;
+                }
+                if (edge_count + 2 > edge_size) {
+                    edge_size = edge_size ? 2 * edge_size : 256;
+                    int *edges = realloc(to, edge_size * sizeof(int));
+                    int *more = realloc(twice, 2 * edge_size * sizeof(int));
+                    if (edges) {
+                        to = edges;
+                    }
+                    if (more) {
+                        twice = more;
+                    }
+                    if (!edges || !more) {
+                        found = -1;
+                        break;
+                    }
+                }
+                to[edge_count++] = local[a->to[e]] * k + local[a->to[f]];
+                if (e == f && a->mult[e] == 2) {
+                    twice[twice_count++] = p;
+                    twice[twice_count++] = to[edge_count - 1];
+                }
+            }
+        }
+    }
+    if (found == 0) {
+        first[pairs] = edge_count;
+        found = find_components(pairs, first, to, comp) < 0 ? -1 : 0;
+    }
+    for (int p = 0; p < pairs && found == 0; p++) {
+        int diagonal = p / k == p % k;
+        for (int q = 0; q < k && !diagonal; q++) {
+            if (comp[q * k + q] == comp[p]) {
+                found = 1;
+            }
+        }
+    }
+    for (int i = 0; i < twice_count && found == 0; i += 2) {
+        found = comp[twice[i]] == comp[twice[i + 1]];
+    }
+    free(states);
+    free(local);
+    free(first);
+    free(comp);
+    free(to);
+    free(twice);
+    return found;
+}
+
+// Loops l1 and l2 are polynomially ambiguous if from some state p of l1
+// the same text leads back to p, from p to some state q of l2 and from q
+// back to q. Searched on triples of states that read the same character.
+static int ambiguous_loops(const automaton *a, int l1, int l2)
+{
+    int *s1 = malloc(a->count * sizeof(int));
+    int *s2 = malloc(a->count * sizeof(int));
+    int k1 = s1 ? loop_states(a, l1, s1) : 0;
+    int k2 = s2 ? loop_states(a, l2, s2) : 0;
+    long size = (long) k1 * a->count * k2;
+    unsigned char *seen = size <= MAX_TRIPLES ? malloc(size) : NULL;
+    int *queue = size <= MAX_TRIPLES ? malloc(size * 3 * sizeof(int)) : NULL;
+    int found = 0;
+    if (!s1 || !s2 || !seen || !queue) {
+        found = -1;
+    }
+
+    for (int i = 0; i < k1 && found == 0; i++) {
+        for (int j = 0; j < k2 && found == 0; j++) {
+            int p = s1[i];
+            int q = s2[j];
+            long head = 0;
+            long tail = 0;
+            memset(seen, 0, size);
+            seen[((long) i * a->count + p) * k2 + j] = 1;
+            queue[0] = p;
+            queue[1] = p;
+            queue[2] = q;
+            tail = 3;
+            while (head < tail && !found) {
+                int x = queue[head++];
+                int y = queue[head++];
+                int z = queue[head++];
+                if (x == p && y == q && z == q) {
+                    found = 1;
+                    break;
+                }
+                if (!sets_meet(a->re, x, y, z)) {
+                    continue;
+                }
+                for (int e = a->first[x]; e < a->first[x + 1]; e++) {
+                    int u = a->to[e];
+                    int iu = 0;
+                    if (a->loop[a->comp[u]] != l1) {
+                        continue;
+                    }
+                    while (s1[iu] != u) {
+                        iu++;
+                    }
+                    for (int f = a->first[y]; f < a->first[y + 1]; f++) {
+                        int v = a->to[f];
+                        for (int g = a->first[z]; g < a->first[z + 1]; g++) {
+                            int w = a->to[g];
+                            int iw = 0;
+                            long index;
+                            if (a->loop[a->comp[w]] != l2) {
+                                continue;
+                            }
+                            while (s2[iw] != w) {
+                                iw++;
+                            }
+                            index = ((long) iu * a->count + v) * k2 + iw;
+                            if (!seen[index]) {
+                                seen[index] = 1;
+                                queue[tail++] = u;
+                                queue[tail++] = v;
+                                queue[tail++] = w;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    free(s1);
+    free(s2);
+    free(seen);
+    free(queue);
+    return found;
+}
+
+// Degree of the time of a failing match attempt, from the ambiguity of
+// the automaton: 0 without loops, 1 plus the longest chain of ambiguous
+// loops, or EXPONENTIAL. Returns -2 if the search was given up.
+static int static_degree(const automaton *a)
+{
+    int *chain = malloc((a->loop_count + 1) * sizeof(int));
+    int degree = a->loop_count > 0;
+    if (!chain) {
+        return -2;
+    }
+    for (int l = 0; l < a->loop_count; l++) {
+        int found = exponential_loop(a, l);
+        if (found != 0) {
+            free(chain);
+            return found < 0 ? -2 : EXPONENTIAL;
+        }
+    }
+    // loops are numbered in reverse topological order of the components,
+    // so a loop is only reached from loops with a higher number
+    for (int l2 = 0; l2 < a->loop_count; l2++) {
+        chain[l2] = 0;
+        for (int l1 = 0; l1 < l2; l1++) {
+            int found = ambiguous_loops(a, l2, l1);
+            if (found < 0) {
+                free(chain);
+                return -2;
+            }
+            if (found && chain[l1] + 1 > chain[l2]) {
+                chain[l2] = chain[l1] + 1;
+            }
+        }
+        if (chain[l2] + 1 > degree) {
+            degree = chain[l2] + 1;
+        }
+    }
+    free(chain);
+    return degree;
+}
+
+// Alternatives that are not loops and whose first characters overlap, so
+// a failing first alternative is followed by another attempt.
+static int overlapping_alternatives(mcregex *re)
+{
+    int *out = malloc(2 * re->count * sizeof(int));
+    int count = 0;
+    if (!out) {
+        return 0;
+    }
+    for (int pc = 0; pc < re->count; pc++) {
+        const mcregex_inst *in = &re->code[pc];
+        int loop = 0;
+        int nx;
+        int ny;
+        if (in->op != RE_SPLIT) {
+            continue;
+        }
+        for (int j = pc + 1; j < re->count; j++) {
+            loop |= re->code[j].op == RE_JMP && re->code[j].x == pc;
+        }
+        if (loop) {
+            continue;
+        }
+        nx = mcregex_closure(re, &in->x, 1, 0, -1, out);
+        ny = mcregex_closure(re, &in->y, 1, 0, -1, out + nx);
+        for (int i = 0; i < nx; i++) {
+            for (int j = nx; j < nx + ny; j++) {
+                if (re->code[out[i]].op == RE_SET && re->code[out[j]].op == RE_SET &&
+                    sets_meet(re, out[i], out[j], out[j])) {
+                    count++;
+                    i = nx;
+                    break;
+                }
+            }
+        }
+    }
+    free(out);
+    return count;
+}
+
+// Backtracking matcher
+//
+// Runs the program like Oniguruma or Python's re do: the first branch
+// of a split is tried first and the second one when it fails. Returns
+// the end of the match, -1 if there is none and -2 if the steps ran out.
+
+static long backtrack(engine *en, const unsigned char *s, size_t n, size_t start)
+{
+    mcregex *re = en->re;
+    size_t top = 0;
+    size_t pos = start;
+    int pc = 0;
+    for (;;) {
+        const mcregex_inst *in = &re->code[pc];
+        int ok = 0;
+        if (++en->steps > MAX_STEPS) {
+            return -2;
+        }
+        switch (in->op) {
+        case RE_SET:
+            if (pos < n && mcregex_in_set(re, in->x, s[pos])) {
+                pos++;
+                ok = 1;
+            }
+            pc++;
+            break;
+        case RE_SPLIT:
+            if (top + 2 > en->size) {
+                size_t size = en->size ? 2 * en->size : 1024;
+                long *stack = realloc(en->stack, size * sizeof(long));
+                if (!stack) {
+                    return -2;
+                }
+                en->stack = stack;
+                en->size = size;
+            }
+            en->stack[top++] = in->y;
+            en->stack[top++] = (long) pos;
+            pc = in->x;
+            ok = 1;
+            break;
+        case RE_JMP:
+            pc = in->x;
+            ok = 1;
+            break;
+        case RE_BOUNDARY:
+            ok = (pos > 0 && mcregex_is_word(s[pos - 1])) != (pos < n && mcregex_is_word(s[pos]));
+            pc++;
+            break;
+        default:
+            return (long) pos;
+        }
+        if (!ok) {
+            if (top == 0) {
+                return -1;
+            }
+            pos = (size_t) en->stack[--top];
+            pc = (int) en->stack[--top];
+        }
+    }
+}
+
+// Steps of one match attempt at the start of the line, and of lexing the
+// whole line like Pygments, where a failing attempt is retried at the
+// next position. Both are -1 if the steps ran out.
+static void count_steps(engine *en, const char *line, size_t n, long *attempt, long *total)
+{
+    const unsigned char *s = (const unsigned char *) line;
+    size_t pos = 0;
+    en->steps = 0;
+    *attempt = -1;
+    while (pos < n) {
+        long end = backtrack(en, s, n, pos);
+        if (end == -2) {
+            *total = -1;
+            return;
+        }
+        if (pos == 0) {
+            *attempt = en->steps;
+        }
+        pos = end > (long) pos ? (size_t) end : pos + 1;
+    }
+    *total = en->steps;
+}
+
+static char *build_line(const attack *t, int pumps, size_t *n)
+{
+    size_t lp = strlen(t->prefix);
+    size_t lu = strlen(t->pump);
+    char *line = malloc(lp + pumps * lu + 2);
+    if (!line) {
+        return NULL;
+    }
+    memcpy(line, t->prefix, lp);
+    for (int i = 0; i < pumps; i++) {
+        memcpy(line + lp + i * lu, t->pump, lu);
+    }
+    *n = lp + pumps * lu;
+    if (t->suffix[0]) {
+        line[(*n)++] = t->suffix[0];
+    }
+    line[*n] = 0;
+    return line;
+}
+
+// Smallest degree d with s2 <= s1 * 2^(d + 1/2), s2 measured at twice the
+// length of s1.
+static int growth(long s1, long s2)
+{
+    double ratio;
+    double bound = 1.41421356;
+    int d = 0;
+    if (s1 < 0 || s2 < 0) {
+        return EXPONENTIAL;
+    }
+    ratio = (double) s2 / (s1 ? s1 : 1);
+    while (ratio > bound && d < MAX_DEGREE) {
+        bound *= 2;
+        d++;
+    }
+    return d;
+}
+
+static int measure(engine *en, const attack *t, int *attempt, int *total)
+{
+    long a[2];
+    long l[2];
+    for (int i = 0; i < 2; i++) {
+        size_t n;
+        char *line = build_line(t, i ? LONG_LENGTH : SHORT_LENGTH, &n);
+        if (!line) {
+            return -1;
+        }
+        count_steps(en, line, n, &a[i], &l[i]);
+        free(line);
+    }
+    *attempt = growth(a[0], a[1]);
+    *total = growth(l[0], l[1]);
+    return 0;
+}
+
+// Appends the characters of the shortest path from the states in from,
+// or the start if there are none, to the state to.
+static int shortest_path(const automaton *a, int from, int to, int loop, char *text)
+{
+    int *parent = malloc(a->count * sizeof(int));
+    int *queue = malloc(a->count * sizeof(int));
+    int head = 0;
+    int tail = 0;
+    int found = 0;
+    if (!parent || !queue) {
+        free(parent);
+        free(queue);
+        return -1;
+    }
+    for (int s = 0; s < a->count; s++) {
+        parent[s] = -2;
+    }
+    for (int e = a->first[from]; e < a->first[from + 1]; e++) {
+        int v = a->to[e];
+        if ((loop < 0 || a->loop[a->comp[v]] == loop) && parent[v] == -2) {
+            parent[v] = -1;
+            queue[tail++] = v;
+        }
+    }
+    while (head < tail && !found) {
+        int u = queue[head++];
+        if (u == to) {
+            found = 1;
+            break;
+        }
+        for (int e = a->first[u]; e < a->first[u + 1]; e++) {
+            int v = a->to[e];
+            if ((loop < 0 || a->loop[a->comp[v]] == loop) && parent[v] == -2) {
+                parent[v] = u;
+                queue[tail++] = v;
+            }
+        }
+    }
+    if (found) {
+        // the characters are read at the states before to, from the back
+        size_t len = strlen(text);
+        int steps = 0;
+        for (int u = parent[to]; u >= 0; u = parent[u]) {
+            steps++;
+        }
+        if (from < a->re->count) {
+            steps++;    // a pump reads at from first
+        }
+        if (len + steps >= MAX_TEXT) {
+            found = 0;
+        } else {
+            int i = (int) len + steps;
+            text[i] = 0;
+            for (int u = parent[to]; u >= 0; u = parent[u]) {
+                text[--i] = (char) pick(a->re, a->re->code[u].x, 1);
+            }
+            if (from < a->re->count) {
+                text[--i] = (char) pick(a->re, a->re->code[from].x, 1);
+            }
+        }
+    }
+    free(parent);
+    free(queue);
+    return found ? 0 : -1;
+}
+
+// Builds the worst-case line of a loop: reach its first state, go round
+// it n times and end in the character that costs most. A loop of one
+// state is also tried with a character that starts a new match.
+static int build_attack(const automaton *a, engine *en, int loop, attack *t)
+{
+    mcregex *re = a->re;
+    int q = 0;
+    int candidates[258];
+    int candidate_count = 0;
+    unsigned char seen[256];
+    char pumps[2][MAX_TEXT];
+    int pump_count = 1;
+    long most_attempt = -2;
+    long most_line = -2;
+    attack worst;
+    int degree;
+
+    while (a->loop[a->comp[q]] != loop) {
+        q++;
+    }
+    t->prefix[0] = 0;
+    pumps[0][0] = 0;
+    if (shortest_path(a, re->count, q, -1, t->prefix) != 0 ||
+        shortest_path(a, q, q, loop, pumps[0]) != 0) {
+        return error("cannot build a line that reaches a loop");
+    }
+    if (strlen(pumps[0]) == 1) {
+        for (int ch = 1; ch < 256; ch++) {
+            if (re->first[ch] && ch != '\n' && ch != *pumps[0] && mcregex_in_set(re, re->code[q].x, ch)) {
+                pumps[pump_count][0] = (char) ch;
+                pumps[pump_count++][1] = 0;
+                break;
+            }
+        }
+    }
+
+    // every character inside and outside some set
+    memset(seen, 0, sizeof(seen));
+    candidates[candidate_count++] = 0;
+    for (int pc = 0; pc < re->count; pc++) {
+        for (int inside = 0; inside < 2 && re->code[pc].op == RE_SET; inside++) {
+            int ch = pick(re, re->code[pc].x, inside);
+            if (ch > 0 && !seen[ch]) {
+                seen[ch] = 1;
+                candidates[candidate_count++] = ch;
+            }
+        }
+    }
+    worst = *t;
+    for (int p = 0; p < pump_count; p++) {
+        for (int i = 0; i < candidate_count; i++) {
+            attack probe = *t;
+            long steps_attempt;
+            long steps_line;
+            size_t n;
+            char *line;
+            strcpy(probe.pump, pumps[p]);
+            probe.suffix[0] = (char) candidates[i];
+            probe.suffix[1] = 0;
+            line = build_line(&probe, PROBE_LENGTH, &n);
+            if (!line) {
+                return error("out of memory");
+            }
+            count_steps(en, line, n, &steps_attempt, &steps_line);
+            free(line);
+            if (steps_attempt < 0 || steps_line < 0) {
+                steps_attempt = steps_line = MAX_STEPS;
+            }
+            if (steps_attempt > most_attempt) {
+                most_attempt = steps_attempt;
+                worst = probe;
+            }
+            if (steps_line > most_line) {
+                most_line = steps_line;
+                strcpy(t->pump, probe.pump);
+                strcpy(t->suffix, probe.suffix);
+            }
+        }
+    }
+    if (measure(en, &worst, &t->attempt, &degree) != 0 ||
+        measure(en, t, &degree, &t->line) != 0) {
+        return error("out of memory");
+    }
+    return 0;
+}
+
+static void print_degree(int degree, FILE *out)
+{
+    if (degree == EXPONENTIAL) {
+        fprintf(out, "exponential");
+    } else if (degree == 0) {
+        fprintf(out, "O(1)");
+    } else if (degree == 1) {
+        fprintf(out, "O(n)");
+    } else {
+        fprintf(out, "O(n^%d)", degree);
+    }
+}
+
+static void print_text(const char *s, FILE *out)
+{
+    fputc('"', out);
+    for (; *s; s++) {
+        unsigned char ch = (unsigned char) *s;
+        if (ch == '"' || ch == '\\') {
+            fprintf(out, "\\%c", ch);
+        } else if (ch < 0x20 || ch >= 0x7F) {
+            fprintf(out, "\\u%04x", ch);
+        } else {
+            fputc(ch, out);
+        }
+    }
+    fputc('"', out);
+}
+
+static void print_attack(const char *name, const char *regex, const attack *t, int *entries, FILE *out)
+{
+    fprintf(out, "%s\n  {\"context\": ", *entries ? "," : "[");
+    print_text(name, out);
+    fprintf(out, ", \"regex\": ");
+    print_text(regex, out);
+    fprintf(out, ",\n   \"prefix\": ");
+    print_text(t->prefix, out);
+    fprintf(out, ", \"pump\": ");
+    print_text(t->pump, out);
+    fprintf(out, ", \"suffix\": ");
+    print_text(t->suffix, out);
+    fprintf(out, ", \"attempt\": %d, \"line\": %d}", t->attempt, t->line);
+    (*entries)++;
+}
+
+static int check_pattern(const char *name, const char *regex, FILE *attacks, int *entries)
+{
+    const char *message;
+    mcregex *re = mcregex_compile(regex, &message);
+    automaton a;
+    engine en;
+    int degree;
+    int line = 0;
+    int attempt = 0;
+    int reported = 0;
+    int rc = 0;
+    if (!re) {
+        return error("cannot compile pattern of %s: %s", name, message);
+    }
+    if (build_automaton(&a, re) != 0) {
+        free_automaton(&a);
+        mcregex_free(re);
+        return error("out of memory at %s", name);
+    }
+    if (a.empty_loop) {
+        free_automaton(&a);
+        mcregex_free(re);
+        return error("pattern of %s has a loop that can match the empty string", name);
+    }
+    degree = static_degree(&a);
+    if (degree == -2) {
+        rc = error("cannot analyze the pattern of %s, it is too large", name);
+    } else if (degree == EXPONENTIAL || degree > 1) {
+        fprintf(stderr, "mcodeiro: pattern of %s has ambiguous loops, a match attempt takes ", name);
+        print_degree(degree, stderr);
+        fprintf(stderr, " time\n");
+        rc = -1;
+    }
+
+    en.re = re;
+    en.stack = NULL;
+    en.size = 0;
+    for (int l = 0; l < a.loop_count && degree != -2; l++) {
+        attack t;
+        if (build_attack(&a, &en, l, &t) != 0) {
+            rc = -1;
+            break;
+        }
+        if (t.attempt == EXPONENTIAL || (attempt != EXPONENTIAL && t.attempt > attempt)) {
+            attempt = t.attempt;
+        }
+        if (t.line == EXPONENTIAL || (line != EXPONENTIAL && t.line > line)) {
+            line = t.line;
+        }
+        if ((t.attempt == EXPONENTIAL || t.attempt > 1) && !reported) {
+            reported = 1;
+            fprintf(stderr, "mcodeiro: a match attempt of %s takes ", name);
+            print_degree(t.attempt, stderr);
+            fprintf(stderr, " time on ");
+            print_text(t.prefix, stderr);
+            fprintf(stderr, " + n * ");
+            print_text(t.pump, stderr);
+            fprintf(stderr, " + ");
+            print_text(t.suffix, stderr);
+            fprintf(stderr, "\n");
+            rc = -1;
+        }
+        if (attacks) {
+            print_attack(name, regex, &t, entries, attacks);
+        }
+    }
+    if (attacks && degree != -2) {
+        int overlaps = overlapping_alternatives(re);
+        fprintf(stderr, "%s: %d loops, %d overlapping alternatives, attempt ", name, a.loop_count, overlaps);
+        print_degree(attempt, stderr);
+        fprintf(stderr, ", line ");
+        print_degree(line, stderr);
+        fprintf(stderr, "\n");
+    }
+    free(en.stack);
+    free_automaton(&a);
+    mcregex_free(re);
+    return rc;
+}
+
+int backtrack_check(grammar *g, FILE *attacks)
+{
+    int entries = 0;
+    int rc = 0;
+    for (int i = 0; i < g->count; i++) {
+        const grammar_context *ctx = &g->contexts[i];
+        if (ctx->type == CONTEXT_INCLUDES) {
+            continue;
+        }
+        if (check_pattern(ctx->name, ctx->regex, attacks, &entries) != 0) {
+            rc = -1;
+        }
+        if (ctx->type == CONTEXT_PUSH && check_pattern(ctx->name, ctx->regex_end, attacks, &entries) != 0) {
+            rc = -1;
+        }
+    }
+    if (attacks) {
+        fprintf(attacks, "%s]\n", entries ? "\n" : "[");
+    }
+    return rc;
+}
@@ -0,0 +1,41 @@
+#if !defined(__MCBACKTRACK_H__)
+#define __MCBACKTRACK_H__
+
+#include <stdio.h>
+
+#include "mcgrammar.h"
+
+// Backtracking checker.
+//
+// The editors run the grammar on backtracking engines, Oniguruma in
+// TextMate and Sublime Text, Python's re in Pygments, and some patterns
+// make them take more than linear time. Every pattern is checked in two
+// ways.
+//
+// Statically, on the automaton of the pattern: a loop that can match the
+// same text in several ways, because of nested quantifiers like (a+)+ or
+// overlapping alternatives like (a|ab)*, makes a failing match attempt
+// take exponential time. Loops one after the other that can share text,
+// like \d+\d+, make it polynomial, one degree per loop.
+//
+// Dynamically, a worst-case line is built for every loop: a prefix that
+// reaches the loop, the loop body repeated n times and the suffix that
+// costs most. The steps of a backtracking engine are counted on it for
+// one match attempt and for lexing the whole line, where a failed
+// attempt is retried at the next position, at two lengths. Their ratio
+// gives the degree.
+//
+// A match attempt must take linear time. A line may take quadratic time
+// if an attempt can fail after reading the rest of the line, like
+// \([^\)]+\) on a line of ((((. Every lexer that retries at each
+// position pays this, so it is reported, but accepted. mcodelex does not
+// pay it, see mclexdfa.h.
+
+// Checks the patterns of all contexts. Returns 0, or -1 with a message
+// on stderr if a match attempt takes more than linear time or cannot be
+// analyzed. If attacks is not NULL, a line per pattern is reported on
+// stderr and the worst-case lines are written to attacks as JSON, to be
+// timed on the real engines.
+int backtrack_check(grammar *g, FILE *attacks);
+
+#endif // !defined(__MCBACKTRACK_H__)
@@ -0,0 +1,704 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcgrammar.h"
+#include "mcintern.h"
+#include "mcregex.h"
+#include "mcdfa.h"
+
+#define MAX_LEXERS      MAX_CONTEXTS
+#define MAX_RULES       254     // the accept table holds rule + 1 in a byte
+#define MAX_GROUPS      MAX_CONTEXT_STYLES
+#define MAX_PROGRAMS    (MAX_LEXERS + MAX_RULES * (MAX_GROUPS - 1))
+#define MAX_STATES      0xFFFF  // states are unsigned short
+#define PER_LINE        16
+
+struct rule_t {
+    int context;                    // grammar context of the pattern
+    int lexer;                      // lexer that tries the rule
+    int push;                       // lexer to switch to, or -1
+    char *regex;
+    int group_count;
+    const char *styles[MAX_GROUPS];
+    char *groups[MAX_GROUPS];       // patterns of the groups if there are several
+    int splits[MAX_GROUPS - 1];     // programs that find the end of the groups but the last
+};
+
+struct program_t {
+    mcregex *re;
+    int first_rule;                 // rule of pattern 0 of a lexer, -1 for a group
+};
+
+struct dfa_t {
+    grammar *g;
+    int lexers[MAX_LEXERS];         // grammar context per lexer
+    int lexer_count;
+    struct rule_t rules[MAX_RULES];
+    int rule_count;
+    struct program_t programs[MAX_PROGRAMS];
+    int program_count;              // lexers first, then groups
+    int start[MAX_PROGRAMS][2];     // per wordness of the previous character
+    unsigned char byte_class[256];
+    int class_byte[256];            // first byte of each class
+    int class_count;
+    intern_table states;            // program, previous wordness, pending positions
+    int state_count;                // after minimizing
+    int state_size;
+    unsigned short *next;
+    unsigned char (*accept)[2];     // per wordness of the next character
+    int *current;
+    int *closure[2];
+    int *pending;
+    int *mark;
+    int gen;
+};
+
+typedef struct rule_t rule;
+typedef struct program_t program;
+typedef struct dfa_t dfa;
+
+static int error(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "mcodeiro: ");
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    return -1;
+}
+
+static char *copy_text(const char *s, size_t n)
+{
+    char *copy = malloc(n + 1);
+    if (copy) {
+        memcpy(copy, s, n);
+        copy[n] = '\0';
+    }
+    return copy;
+}
+
+static const char *skip_class(const char *p)
+{
+    p++;
+    if (*p == '^') {
+        p++;
+    }
+    if (*p == ']') {
+        p++;
+    }
+    while (*p && *p != ']') {
+        p += (*p == '\\' && p[1]) ? 2 : 1;
+    }
+    return *p ? p + 1 : p;
+}
+
+// Splits a pattern into its top-level capturing groups, e.g. (a)|(b) or
+// (a)(b). Returns the number of groups, or -1 if there is anything else
+// at the top level. alts[i] is the alternative of group i.
+static int top_level_groups(const char *regex, const char **starts, int *lens, int *alts, int max)
+{
+    const char *p = regex;
+    int count = 0;
+    int alt = 0;
+    while (*p) {
+        if (*p == '|' && count > 0 && alts[count - 1] == alt) {
+            alt++;
+            p++;
+            continue;
+        }
+        if (*p != '(' || p[1] == '?' || count == max) {
+            return -1;
+        }
+        const char *start = p;
+        int depth = 0;
+        do {
+            if (*p == '\\' && p[1]) {
+                p += 2;
+            } else if (*p == '[') {
+                p = skip_class(p);
+            } else {
+                depth += (*p == '(') - (*p == ')');
+                p++;
+            }
+        } while (*p && depth > 0);
+        if (depth) {
+            return -1;
+        }
+        starts[count] = start;
+        lens[count] = p - start;
+        alts[count++] = alt;
+    }
+    return (count > 0 && alts[count - 1] == alt) ? count : -1;
+}
+
+static int lexer_index(dfa *d, int context)
+{
+    for (int i = 0; i < d->lexer_count; i++) {
+        if (d->lexers[i] == context) {
+            return i;
+        }
+    }
+    if (d->lexer_count == MAX_LEXERS) {
+        return error("too many lexers at %s", d->g->contexts[context].name);
+    }
+    d->lexers[d->lexer_count] = context;
+    return d->lexer_count++;
+}
+
+static rule *new_rule(dfa *d, int lexer, int context, const char *regex, size_t len)
+{
+    rule *r = &d->rules[d->rule_count];
+    if (d->rule_count == MAX_RULES) {
+        error("too many rules at %s", d->g->contexts[context].name);
+        return NULL;
+    }
+    memset(r, 0, sizeof(*r));
+    r->context = context;
+    r->lexer = lexer;
+    r->push = -1;
+    r->group_count = 1;
+    r->regex = copy_text(regex, len);
+    if (!r->regex) {
+        error("out of memory at %s", d->g->contexts[context].name);
+        return NULL;
+    }
+    d->rule_count++;
+    return r;
+}
+
+static int add_pattern_rules(dfa *d, int lexer, int context)
+{
+    grammar_context *ctx = &d->g->contexts[context];
+    const char *starts[MAX_GROUPS];
+    int lens[MAX_GROUPS];
+    int alts[MAX_GROUPS];
+    int count = top_level_groups(ctx->regex, starts, lens, alts, MAX_GROUPS);
+    if (count < 0 || count != grammar_count(ctx->styles)) {
+        return error("pattern of %s is not a list of groups with one style each", ctx->name);
+    }
+    if (alts[count - 1] == count - 1) {
+        // (a)|(b) is tried like two patterns
+        for (int i = 0; i < count; i++) {
+            rule *r = new_rule(d, lexer, context, starts[i], lens[i]);
+            if (!r) {
+                return -1;
+            }
+            r->styles[0] = ctx->styles[i];
+        }
+        return 0;
+    }
+    if (alts[count - 1] != 0) {
+        return error("pattern of %s mixes alternatives and sequences of groups", ctx->name);
+    }
+    rule *r = new_rule(d, lexer, context, ctx->regex, strlen(ctx->regex));
+    if (!r) {
+        return -1;
+    }
+    r->group_count = count;
+    for (int i = 0; i < count; i++) {
+        r->styles[i] = ctx->styles[i];
+        if (count > 1 && !(r->groups[i] = copy_text(starts[i], lens[i]))) {
+            return error("out of memory at %s", ctx->name);
+        }
+    }
+    return 0;
+}
+
+static int add_rules(dfa *d, int lexer)
+{
+    const grammar_context *ctx = &d->g->contexts[d->lexers[lexer]];
+    for (int i = 0; ctx->includes[i]; i++) {
+        grammar_context *inc = grammar_find(d->g, ctx->includes[i]);
+        int context = inc ? (int) (inc - d->g->contexts) : -1;
+        rule *r;
+        if (!inc) {
+            return error("no context %s", ctx->includes[i]);
+        }
+        switch (inc->type) {
+            case CONTEXT_PATTERN:
+                if (add_pattern_rules(d, lexer, context) < 0) {
+                    return -1;
+                }
+                break;
+            case CONTEXT_PUSH_EOL:
+                r = new_rule(d, lexer, context, inc->regex, strlen(inc->regex));
+                if (!r || (r->push = lexer_index(d, context)) < 0) {
+                    return -1;
+                }
+                r->styles[0] = inc->styles[0];
+                break;
+            default:
+                return error("cannot include %s in a lexer, it has no single pattern", inc->name);
+        }
+    }
+    return 0;
+}
+
+static mcregex *compile(const char *name, const char **patterns, int count, int empty)
+{
+    const char *message;
+    mcregex *re = mcregex_compile_set(patterns, count, &message);
+    if (!re) {
+        fprintf(stderr, "mcodeiro: cannot compile pattern of %s: %s\n", name, message);
+    } else if (re->nullable && !empty) {
+        fprintf(stderr, "mcodeiro: pattern of %s matches the empty string\n", name);
+        mcregex_free(re);
+        re = NULL;
+    }
+    return re;
+}
+
+static int add_program(dfa *d, mcregex *re, int first_rule)
+{
+    if (!re) {
+        return -1;
+    }
+    d->programs[d->program_count].re = re;
+    d->programs[d->program_count].first_rule = first_rule;
+    return d->program_count++;
+}
+
+// One program per lexer with its rules as a set, then one per group
+// that is not the last of its rule.
+static int compile_programs(dfa *d)
+{
+    const char *patterns[MAX_RULES];
+    for (int lexer = 0; lexer < d->lexer_count; lexer++) {
+        int first = -1;
+        int count = 0;
+        for (int i = 0; i < d->rule_count; i++) {
+            if (d->rules[i].lexer == lexer) {
+                first = (first < 0) ? i : first;
+                patterns[count++] = d->rules[i].regex;
+            }
+        }
+        const char *name = d->g->contexts[d->lexers[lexer]].name;
+        if (count == 0) {
+            return error("lexer %s has no rules", name);
+        }
+        for (int i = 0; i < count; i++) {
+            // rule by rule first, to tell which pattern fails
+            mcregex *re = compile(d->g->contexts[d->rules[first + i].context].name, &patterns[i], 1, 0);
+            if (!re) {
+                return -1;
+            }
+            mcregex_free(re);
+        }
+        if (add_program(d, compile(name, patterns, count, 0), first) < 0) {
+            return -1;
+        }
+    }
+    for (int i = 0; i < d->rule_count; i++) {
+        rule *r = &d->rules[i];
+        const char *name = d->g->contexts[r->context].name;
+        for (int k = 0; k + 1 < r->group_count; k++) {
+            if ((r->splits[k] = add_program(d, compile(name, (const char **) &r->groups[k], 1, 1), -1)) < 0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+// Bytes are in the same class if they are in the same sets of all
+// programs and are both word characters or both not.
+static void compute_classes(dfa *d)
+{
+    for (int ch = 0; ch < 256; ch++) {
+        d->byte_class[ch] = mcregex_is_word(ch);
+    }
+    for (int p = 0; p < d->program_count; p++) {
+        const mcregex *re = d->programs[p].re;
+        for (int set = 0; set < re->set_count; set++) {
+            short remap[256][2];
+            short n = 0;
+            memset(remap, 0xff, sizeof(remap));
+            for (int ch = 0; ch < 256; ch++) {
+                int in = mcregex_in_set(re, set, ch);
+                short *to = &remap[d->byte_class[ch]][in];
+                if (*to < 0) {
+                    *to = n++;
+                }
+                d->byte_class[ch] = *to;
+            }
+        }
+    }
+    // number the classes by their first byte
+    short order[256];
+    memset(order, 0xff, sizeof(order));
+    d->class_count = 0;
+    for (int ch = 0; ch < 256; ch++) {
+        if (order[d->byte_class[ch]] < 0) {
+            d->class_byte[d->class_count] = ch;
+            order[d->byte_class[ch]] = d->class_count++;
+        }
+        d->byte_class[ch] = order[d->byte_class[ch]];
+    }
+}
+
+static int compare_ints(const void *a, const void *b)
+{
+    return *(const int *) a - *(const int *) b;
+}
+
+static int add_state(dfa *d, int prog, int prev_word, const int *pcs, int n)
+{
+    d->current[0] = prog;
+    d->current[1] = prev_word;
+    memmove(d->current + 2, pcs, n * sizeof(int));
+    int id = intern_ints(&d->states, d->current, n + 2);
+    if (id < 0) {
+        return error("out of memory");
+    }
+    if (id > MAX_STATES - 1) {
+        return error("more than %d states", MAX_STATES);
+    }
+    if (id >= d->state_size) {
+        int size = d->state_size ? 2 * d->state_size : 1024;
+        unsigned short *next = realloc(d->next, (size_t) size * d->class_count * sizeof(unsigned short));
+        if (next) {
+            d->next = next;
+        }
+        unsigned char (*accept)[2] = realloc(d->accept, size * sizeof(*accept));
+        if (accept) {
+            d->accept = accept;
+        }
+        if (!next || !accept) {
+            return error("out of memory");
+        }
+        memset(d->next + (size_t) d->state_size * d->class_count, 0,
+            (size_t) (size - d->state_size) * d->class_count * sizeof(unsigned short));
+        memset(d->accept + d->state_size, 0, (size - d->state_size) * sizeof(*accept));
+        d->state_size = size;
+    }
+    return id;
+}
+
+// Computes the accepts and transitions of a state. Lexers follow the
+// threads in priority order and cut them at the first match, groups
+// keep all threads since any end of the group may be the one.
+static int expand_state(dfa *d, int id)
+{
+    int n;
+    const int *key = intern_get(&d->states, id, &n);
+    int prog = key[0];
+    int prev_word = key[1];
+    const program *pg = &d->programs[prog];
+    mcregex *re = pg->re;
+    int count[2];
+
+    n -= 2;
+    memcpy(d->pending, key + 2, n * sizeof(int));
+    for (int next_word = 0; next_word < 2; next_word++) {
+        count[next_word] = mcregex_closure(re, d->pending, n, prev_word, next_word, d->closure[next_word]);
+        for (int i = 0; i < count[next_word]; i++) {
+            const mcregex_inst *in = &re->code[d->closure[next_word][i]];
+            if (in->op == RE_MATCH) {
+                d->accept[id][next_word] = (pg->first_rule >= 0) ? pg->first_rule + in->x + 1 : 1;
+                break;
+            }
+        }
+    }
+    for (int c = 0; c < d->class_count; c++) {
+        int ch = d->class_byte[c];
+        int word = mcregex_is_word(ch);
+        const int *closure = d->closure[word];
+        int k = 0;
+        d->gen++;
+        for (int i = 0; i < count[word]; i++) {
+            const mcregex_inst *in = &re->code[closure[i]];
+            if (in->op == RE_MATCH) {
+                if (pg->first_rule >= 0) {
+                    break;
+                }
+            } else if (mcregex_in_set(re, in->x, ch) && d->mark[closure[i] + 1] != d->gen) {
+                d->mark[closure[i] + 1] = d->gen;
+                d->pending[n + k++] = closure[i] + 1;
+            }
+        }
+        if (pg->first_rule < 0) {
+            qsort(d->pending + n, k, sizeof(int), compare_ints);
+        }
+        int next = k ? add_state(d, prog, word, d->pending + n, k) : 0;
+        if (next < 0) {
+            return -1;
+        }
+        d->next[(size_t) id * d->class_count + c] = next;
+    }
+    return 0;
+}
+
+static int build_states(dfa *d)
+{
+    int dead = -1;
+    int size = 0;
+    int zero = 0;
+    for (int p = 0; p < d->program_count; p++) {
+        size = (d->programs[p].re->count > size) ? d->programs[p].re->count : size;
+    }
+    // closure and both pending lists fit in 2 * size positions
+    d->current = malloc((2 * size + 2) * sizeof(int));
+    d->closure[0] = malloc(size * sizeof(int));
+    d->closure[1] = malloc(size * sizeof(int));
+    d->pending = malloc(2 * size * sizeof(int));
+    d->mark = calloc(size + 1, sizeof(int));
+    if (!d->current || !d->closure[0] || !d->closure[1] || !d->pending || !d->mark) {
+        return error("out of memory");
+    }
+    intern_init(&d->states);
+    if (intern_ints(&d->states, &dead, 1) != 0) {
+        return error("out of memory");
+    }
+    for (int p = 0; p < d->program_count; p++) {
+        for (int prev_word = 0; prev_word < 2; prev_word++) {
+            if ((d->start[p][prev_word] = add_state(d, p, prev_word, &zero, 1)) < 0) {
+                return -1;
+            }
+        }
+    }
+    for (int id = 1; id < d->states.count; id++) {
+        if (expand_state(d, id) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// The end of a group is the last position where the automaton of the
+// group accepts before it dies. That is the end a backtracking engine
+// finds if no character may both continue the group and start the next.
+static int check_groups(dfa *d)
+{
+    for (int i = 0; i < d->rule_count; i++) {
+        const rule *r = &d->rules[i];
+        const char *name = d->g->contexts[r->context].name;
+        for (int k = 0; k + 1 < r->group_count; k++) {
+            mcregex *following = compile(name, (const char **) &r->groups[k + 1], 1, 0);
+            int ambiguous = 0;
+            if (!following) {
+                return -1;
+            }
+            for (int id = 1; id < d->states.count && !ambiguous; id++) {
+                int n;
+                if (intern_get(&d->states, id, &n)[0] != r->splits[k]) {
+                    continue;
+                }
+                for (int ch = 0; ch < 256; ch++) {
+                    int word = mcregex_is_word(ch);
+                    ambiguous |= d->accept[id][word] && following->first[ch] &&
+                        d->next[(size_t) id * d->class_count + d->byte_class[ch]];
+                }
+            }
+            mcregex_free(following);
+            if (ambiguous) {
+                return error("a group of %s may end in several places", name);
+            }
+        }
+    }
+    return 0;
+}
+
+// Moore's algorithm: states stay equivalent until a class leads them
+// into different blocks. Blocks are numbered in the order of their
+// first state, so the dead state stays 0 and no block number is larger
+// than the states it replaces.
+static int minimize(dfa *d)
+{
+    int count = d->states.count;
+    int classes = d->class_count;
+    int *block = calloc(count, sizeof(int));
+    int *refined = malloc(count * sizeof(int));
+    int *signature = malloc((classes + 2) * sizeof(int));
+    int block_count = 1;
+    int rc = 0;
+
+    while (rc == 0 && block && refined && signature) {
+        intern_table blocks;
+        intern_init(&blocks);
+        for (int id = 0; id < count && rc == 0; id++) {
+            const unsigned short *next = d->next + (size_t) id * classes;
+            signature[0] = d->accept[id][0];
+            signature[1] = d->accept[id][1];
+            for (int c = 0; c < classes; c++) {
+                signature[c + 2] = block[next[c]];
+            }
+            if ((refined[id] = intern_ints(&blocks, signature, classes + 2)) < 0) {
+                rc = -1;
+            }
+        }
+        int stable = (blocks.count == block_count);
+        block_count = blocks.count;
+        intern_free(&blocks);
+        memcpy(block, refined, count * sizeof(int));
+        if (stable) {
+            break;
+        }
+    }
+    if (rc != 0 || !block || !refined || !signature) {
+        rc = error("out of memory");
+    } else {
+        int last = -1;
+        for (int id = 0; id < count; id++) {
+            if (block[id] > last) {
+                unsigned short *from = d->next + (size_t) id * classes;
+                unsigned short *to = d->next + (size_t) block[id] * classes;
+                for (int c = 0; c < classes; c++) {
+                    to[c] = block[from[c]];
+                }
+                memcpy(d->accept[block[id]], d->accept[id], sizeof(d->accept[id]));
+                last = block[id];
+            }
+        }
+        for (int p = 0; p < d->program_count; p++) {
+            d->start[p][0] = block[d->start[p][0]];
+            d->start[p][1] = block[d->start[p][1]];
+        }
+        d->state_count = block_count;
+    }
+    free(block);
+    free(refined);
+    free(signature);
+    return rc;
+}
+
+static void print_values(FILE *out, const char *decl, const int *values, size_t count)
+{
+    fprintf(out, "%s = {", decl);
+    for (size_t i = 0; i < count; i++) {
+        fprintf(out, "%s%s%d", i ? "," : "", (i % PER_LINE) ? " " : "\n    ", values[i]);
+    }
+    fprintf(out, "\n};\n\n");
+}
+
+static int print_tables(dfa *d, FILE *out)
+{
+    int states = d->state_count;
+    int splits = d->program_count - d->lexer_count;
+    size_t size = (size_t) states * d->class_count;
+    int *values = malloc((size > 2 * 256 * MAX_LEXERS ? size : 2 * 256 * MAX_LEXERS) * sizeof(int));
+    char decl[128];
+    if (!values) {
+        return error("out of memory");
+    }
+
+    fprintf(out, "/* Generated by mcodeiro -d, do not edit. */\n\n");
+    fprintf(out, "#include \"mcodelex.h\"\n");
+    fprintf(out, "#include \"mclexdfa.h\"\n\n");
+    fprintf(out, "// lexers:");
+    for (int l = 0; l < d->lexer_count; l++) {
+        fprintf(out, "%s %d %s", l ? "," : "", l, d->g->contexts[d->lexers[l]].name);
+    }
+    fprintf(out, "\n// %d rules, %d states, %d byte classes\n\n", d->rule_count, states, d->class_count);
+
+    for (int ch = 0; ch < 256; ch++) {
+        values[ch] = d->byte_class[ch];
+    }
+    print_values(out, "static const unsigned char byte_class[256]", values, 256);
+
+    for (size_t i = 0; i < size; i++) {
+        values[i] = d->next[i];
+    }
+    snprintf(decl, sizeof(decl), "static const unsigned short next[%d * %d]", states, d->class_count);
+    print_values(out, decl, values, size);
+
+    for (int id = 0; id < states; id++) {
+        values[2 * id] = d->accept[id][0];
+        values[2 * id + 1] = d->accept[id][1];
+    }
+    snprintf(decl, sizeof(decl), "static const unsigned char accept[%d * 2]", states);
+    print_values(out, decl, values, 2 * (size_t) states);
+
+    for (int l = 0; l < d->lexer_count; l++) {
+        for (int prev_word = 0; prev_word < 2; prev_word++) {
+            int start = d->start[l][prev_word];
+            for (int ch = 0; ch < 256; ch++) {
+                values[(2 * l + prev_word) * 256 + ch] = d->next[(size_t) start * d->class_count + d->byte_class[ch]];
+            }
+        }
+    }
+    snprintf(decl, sizeof(decl), "static const unsigned short dispatch[%d * 2 * 256]", d->lexer_count);
+    print_values(out, decl, values, 2 * 256 * (size_t) d->lexer_count);
+
+    values[0] = values[1] = 0;
+    for (int s = 0; s < splits; s++) {
+        values[2 * s] = d->start[d->lexer_count + s][0];
+        values[2 * s + 1] = d->start[d->lexer_count + s][1];
+    }
+    snprintf(decl, sizeof(decl), "static const unsigned short split_start[%d * 2]", splits ? splits : 1);
+    print_values(out, decl, values, splits ? 2 * (size_t) splits : 2);
+
+    fprintf(out, "static const mclex_dfa_rule rules[%d] = {\n", d->rule_count);
+    for (int i = 0; i < d->rule_count; i++) {
+        const rule *r = &d->rules[i];
+        fprintf(out, "    { \"%s\", %d, %d, {", d->g->contexts[r->context].name, r->push, r->group_count);
+        for (int k = 0; k < r->group_count; k++) {
+            fprintf(out, "%s \"%s\"", k ? "," : "", r->styles[k]);
+        }
+        fprintf(out, " }, {");
+        for (int k = 0; k + 1 < r->group_count; k++) {
+            fprintf(out, "%s %d", k ? "," : "", r->splits[k] - d->lexer_count);
+        }
+        fprintf(out, "%s } }%s\n", r->group_count > 1 ? "" : " -1", i + 1 < d->rule_count ? "," : "");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const mclex_dfa mclex_dfa_tables = {\n");
+    fprintf(out, "    %d, %d, %d, %d,\n", states, d->class_count, d->lexer_count, d->rule_count);
+    fprintf(out, "    byte_class, next, accept, dispatch, split_start, rules\n");
+    fprintf(out, "};\n");
+    free(values);
+    return 0;
+}
+
+static void free_dfa(dfa *d)
+{
+    for (int i = 0; i < d->rule_count; i++) {
+        free(d->rules[i].regex);
+        for (int k = 0; k < MAX_GROUPS; k++) {
+            free(d->rules[i].groups[k]);
+        }
+    }
+    for (int p = 0; p < d->program_count; p++) {
+        mcregex_free(d->programs[p].re);
+    }
+    intern_free(&d->states);
+    free(d->next);
+    free(d->accept);
+    free(d->current);
+    free(d->closure[0]);
+    free(d->closure[1]);
+    free(d->pending);
+    free(d->mark);
+}
+
+int dfa_print_tables(grammar *g, const char *main, FILE *out)
+{
+    dfa *d = calloc(1, sizeof(dfa));
+    grammar_context *ctx = grammar_find(g, main);
+    int rc = -1;
+    if (!d) {
+        return error("out of memory");
+    }
+    d->g = g;
+    if (!ctx) {
+        error("no context %s", main);
+    } else if (lexer_index(d, (int) (ctx - g->contexts)) == 0) {
+        rc = 0;
+        // lexers are added while their includes are collected
+        for (int lexer = 0; rc == 0 && lexer < d->lexer_count; lexer++) {
+            rc = add_rules(d, lexer);
+        }
+        if (rc == 0 && compile_programs(d) == 0) {
+            compute_classes(d);
+            rc = (build_states(d) == 0 && check_groups(d) == 0 && minimize(d) == 0) ? print_tables(d, out) : -1;
+        } else {
+            rc = -1;
+        }
+    }
+    free_dfa(d);
+    free(d);
+    return rc;
+}
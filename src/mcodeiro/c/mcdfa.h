@@ -0,0 +1,35 @@
+#if !defined(__MCDFA_H__)
+#define __MCDFA_H__
+
+#include <stdio.h>
+
+#include "mcgrammar.h"
+
+// Grammar to DFA compiler.
+//
+// The main context and every context pushed until the end of the line
+// are lexers. Each included pattern becomes a rule of its lexer, an
+// alternation of groups like (a)|(b) one rule per group. The rules of a
+// lexer are compiled into one deterministic automaton with the same
+// leftmost-first semantics as a backtracking engine: the first rule in
+// include order that matches wins, and its match is the one Oniguruma
+// or Pygments would find.
+//
+// A pattern with several groups like (a)(b) is a single rule. Where a
+// group ends is found by an automaton of the group alone, which is only
+// possible if no character both continues a match of the group and
+// starts the next group; this is checked.
+//
+// Word boundaries depend on the characters around a position, so a
+// state remembers whether the last character was a word character, and
+// whether a state accepts depends on the next character.
+//
+// The tables are printed as C source for the driver in mcodelex, see
+// mclexdfa.h.
+
+// Compiles the lexers starting at the main context and prints their
+// tables. Returns 0, or -1 with a message on stderr if the grammar uses
+// something the automata cannot express.
+int dfa_print_tables(grammar *g, const char *main, FILE *out);
+
+#endif // !defined(__MCDFA_H__)
@@ -0,0 +1,1052 @@
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcgrammar.h"
+#include "mcregex.h"
+#include "mcexport.h"
+
+#define MAX_PATH_SIZE   0x400
+#define MAX_ATOM_SIZE   0x100
+#define WORDS_WIDTH     100     // line width of words() lists
+#define GENERATED       "Generated by mcodeiro, do not edit."
+
+// Literal alternatives of a pattern prefix(a|b|...)suffix for words()
+struct words_t {
+    char *prefix;
+    char *suffix;
+    char *buffer;
+    char **words;               // unescaped
+    int count;
+};
+
+typedef struct words_t words;
+
+static int error(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "mcodeiro: ");
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    return -1;
+}
+
+static char *substring(const char *s, size_t n)
+{
+    char *copy = malloc(n + 1);
+    if (copy) {
+        memcpy(copy, s, n);
+        copy[n] = '\0';
+    }
+    return copy;
+}
+
+// Wraps a start pattern into a group like the Iro export does.
+static char *wrap_group(const char *regex)
+{
+    size_t n = strlen(regex);
+    char *wrapped = malloc(n + 3);
+    if (wrapped) {
+        wrapped[0] = '(';
+        memcpy(wrapped + 1, regex, n);
+        strcpy(wrapped + n + 1, ")");
+    }
+    return wrapped;
+}
+
+static const styledef *find_style(const syntaxdef *syntax, const char *name)
+{
+    for (const styledef *style = syntax->styles; style->name; style++) {
+        if (strcmp(style->name, name) == 0) {
+            return style;
+        }
+    }
+    return NULL;
+}
+
+static int check_styles(const grammar *g, const syntaxdef *syntax)
+{
+    for (int i = 0; i < g->count; i++) {
+        for (const char *const *style = g->contexts[i].styles; *style; style++) {
+            if (!find_style(syntax, *style)) {
+                return error("context %s has undefined style %s", g->contexts[i].name, *style);
+            }
+        }
+    }
+    return 0;
+}
+
+// Pattern syntax, see mcregex.h
+
+// Length of the character class at s, including the brackets.
+static size_t class_length(const char *s)
+{
+    size_t i = 1;
+    if (s[i] == '^') {
+        i++;
+    }
+    if (s[i] == ']') {
+        i++;
+    }
+    while (s[i] && s[i] != ']') {
+        i += (s[i] == '\\' && s[i + 1]) ? 2 : 1;
+    }
+    return s[i] ? i + 1 : i;
+}
+
+// Length of the group at s, including the parentheses.
+static size_t group_length(const char *s)
+{
+    int depth = 0;
+    size_t i = 0;
+    while (s[i]) {
+        if (s[i] == '\\' && s[i + 1]) {
+            i += 2;
+            continue;
+        }
+        if (s[i] == '[') {
+            i += class_length(s + i);
+            continue;
+        }
+        if (s[i] == '(') {
+            depth++;
+        } else if (s[i] == ')' && --depth == 0) {
+            return i + 1;
+        }
+        i++;
+    }
+    return i;
+}
+
+// Length of the single character atom at s: an escape, a class, '.' or
+// a literal.
+static size_t atom_length(const char *s)
+{
+    if (*s == '\\') {
+        return s[1] ? 2 : 1;
+    }
+    return (*s == '[') ? class_length(s) : 1;
+}
+
+// Length of the quantifier at s, 0 if there is none. Sets the minimum
+// and the maximum number of repetitions, -1 if unbounded.
+static size_t quantifier_length(const char *s, int *min, int *max, int *greedy)
+{
+    size_t n = 1;
+    *min = 1;
+    *max = 1;
+    *greedy = 1;
+    if (*s == '?') {
+        *min = 0;
+    } else if (*s == '*') {
+        *min = 0;
+        *max = -1;
+    } else if (*s == '+') {
+        *max = -1;
+    } else if (*s == '{' && isdigit((unsigned char) s[1])) {
+        char *end;
+        *min = *max = (int) strtol(s + 1, &end, 10);
+        if (*end == ',') {
+            *max = isdigit((unsigned char) end[1]) ? (int) strtol(end + 1, &end, 10) : (end++, -1);
+        }
+        if (*end != '}') {
+            *min = *max = 1;
+            return 0;
+        }
+        n = end + 1 - s;
+    } else {
+        return 0;
+    }
+    if (s[n] == '?' || s[n] == '+') {
+        *greedy = 0;    // lazy or possessive
+        n++;
+    }
+    return n;
+}
+
+// Returns 1 if the n characters at s have an alternation outside groups.
+static int has_alternation(const char *s, size_t n)
+{
+    int depth = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (s[i] == '\\') {
+            i++;
+        } else if (s[i] == '[') {
+            i += class_length(s + i) - 1;
+        } else if (s[i] == '(') {
+            depth++;
+        } else if (s[i] == ')') {
+            depth--;
+        } else if (s[i] == '|' && depth == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Characters that the single character atom at s matches.
+static int atom_set(const char *s, size_t n, unsigned char *set)
+{
+    char atom[MAX_ATOM_SIZE];
+    const char *message;
+    mcregex *re;
+    if (n >= sizeof(atom) || (s[0] == '\\' && (s[1] == 'b' || s[1] == 'B'))) {
+        return -1;
+    }
+    memcpy(atom, s, n);
+    atom[n] = '\0';
+    re = mcregex_compile(atom, &message);
+    if (!re) {
+        return -1;
+    }
+    memcpy(set, re->first, 256);
+    mcregex_free(re);
+    return 0;
+}
+
+// Returns 1 if a word boundary between two characters of set never
+// holds.
+static int same_wordness(const unsigned char *set)
+{
+    int word = 0;
+    int other = 0;
+    for (int ch = 0; ch < 256; ch++) {
+        if (set[ch]) {
+            word |= mcregex_is_word(ch);
+            other |= !mcregex_is_word(ch);
+        }
+    }
+    return !(word && other);
+}
+
+// Returns 1 if the pattern that continues at s must next match a
+// character outside set, or a word boundary that cannot hold between
+// two characters of set. Then a loop over set before s never has to
+// give back characters.
+static int next_is_disjoint(const char *s, const unsigned char *set)
+{
+    int min, max, greedy;
+    for (;;) {
+        if (*s == '|') {
+            // the alternative ends, the pattern continues after the group
+            int depth = 0;
+            while (*s && (*s != ')' || depth > 0)) {
+                if (*s == '\\' && s[1]) {
+                    s++;
+                } else if (*s == '[') {
+                    s += class_length(s) - 1;
+                } else if (*s == '(') {
+                    depth++;
+                } else if (*s == ')') {
+                    depth--;
+                }
+                s++;
+            }
+        } else if (*s == ')') {
+            if (quantifier_length(s + 1, &min, &max, &greedy)) {
+                return 0;
+            }
+            s++;
+        } else if (*s == '(') {
+            size_t n = group_length(s);
+            quantifier_length(s + n, &min, &max, &greedy);
+            if (min == 0 || (s[1] == '?' && s[2] != ':') || has_alternation(s + 1, n - 2)) {
+                return 0;
+            }
+            s += (s[1] == '?') ? 3 : 1;
+        } else if (*s == '\0' || *s == '^' || *s == '$') {
+            return 0;
+        } else {
+            unsigned char next[256];
+            size_t n = atom_length(s);
+            quantifier_length(s + n, &min, &max, &greedy);
+            if (min == 0) {
+                return 0;
+            }
+            if (s[0] == '\\' && s[1] == 'b') {
+                return same_wordness(set);
+            }
+            if (atom_set(s, n, next) != 0) {
+                return 0;
+            }
+            for (int ch = 0; ch < 256; ch++) {
+                if (set[ch] && next[ch]) {
+                    return 0;
+                }
+            }
+            return 1;
+        }
+    }
+}
+
+// Copies an atom, escaping [ in a class, which Oniguruma reads as a
+// nested class.
+static size_t copy_atom(char *out, const char *s, size_t n)
+{
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (s[i] == '\\' && i + 1 < n) {
+            out[k++] = s[i++];
+        } else if (s[i] == '[' && i > 0) {
+            out[k++] = '\\';
+        }
+        out[k++] = s[i];
+    }
+    return k;
+}
+
+// Rewrites a pattern for Oniguruma, with atomic greedy loops where they
+// match the same if atomic is set. Returns a new string or NULL.
+static char *oniguruma_regex(const char *regex, int atomic_loops)
+{
+    char *out = malloc(4 * strlen(regex) + 1);
+    size_t i = 0;
+    size_t k = 0;
+    if (!out) {
+        return NULL;
+    }
+    while (regex[i]) {
+        const char *s = regex + i;
+        int min, max, greedy;
+        size_t n = 1;
+        if (*s == '(') {
+            n = (s[1] == '?' && s[2]) ? 3 : 1;
+        } else if (*s == ')') {
+            n += quantifier_length(s + 1, &min, &max, &greedy);
+        } else if (*s != '|' && *s != '^' && *s != '$') {
+            unsigned char set[256];
+            size_t q;
+            int atomic;
+            n = atom_length(s);
+            q = quantifier_length(s + n, &min, &max, &greedy);
+            atomic = atomic_loops && q && max < 0 && greedy &&
+                     atom_set(s, n, set) == 0 && next_is_disjoint(s + n + q, set);
+            if (atomic) {
+                memcpy(out + k, "(?>", 3);
+                k += 3;
+            }
+            k += copy_atom(out + k, s, n);
+            memcpy(out + k, s + n, q);
+            k += q;
+            if (atomic) {
+                out[k++] = ')';
+            }
+            i += n + q;
+            continue;
+        }
+        memcpy(out + k, s, n);
+        k += n;
+        i += n;
+    }
+    out[k] = '\0';
+    return out;
+}
+
+// Rewrites a pattern for Python. Pygments matches against the whole
+// text, so negated classes must not match line ends.
+static char *python_regex(const char *regex)
+{
+    char *out = malloc(3 * strlen(regex) + 1);
+    size_t i = 0;
+    size_t k = 0;
+    if (!out) {
+        return NULL;
+    }
+    while (regex[i]) {
+        size_t n = atom_length(regex + i);
+        if (regex[i] == '[' && regex[i + 1] == '^' && regex[i + n - 1] == ']') {
+            memcpy(out + k, regex + i, n - 1);
+            k += n - 1;
+            memcpy(out + k, "\\n\\r]", 5);
+            k += 5;
+        } else {
+            memcpy(out + k, regex + i, n);
+            k += n;
+        }
+        i += n;
+    }
+    out[k] = '\0';
+    return out;
+}
+
+// Unescapes the literal of n characters at s into out. Returns -1 if it
+// is not a literal.
+static int unescape_literal(const char *s, size_t n, char *out)
+{
+    size_t k = 0;
+    if (n == 0) {
+        return -1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (s[i] == '\\') {
+            if (i + 1 == n || isalnum((unsigned char) s[i + 1])) {
+                return -1;
+            }
+            i++;
+        } else if (strchr(".[](){}*+?|^$", s[i])) {
+            return -1;
+        }
+        out[k++] = s[i];
+    }
+    out[k] = '\0';
+    return 0;
+}
+
+static void words_free(words *w)
+{
+    free(w->prefix);
+    free(w->suffix);
+    free(w->buffer);
+    free(w->words);
+    memset(w, 0, sizeof(*w));
+}
+
+// Splits a pattern of the form prefix(a|b|...)suffix or a|b|..., where
+// prefix and suffix have no group or alternation, into its literals.
+// Returns 0, or -1 if the pattern has another form or if a literal is a
+// prefix of a later one.
+static int split_words(const char *regex, words *w)
+{
+    size_t len = strlen(regex);
+    size_t open = 0;
+    size_t close = len;
+    const char *body = regex;
+    size_t body_len = len;
+    memset(w, 0, sizeof(*w));
+
+    while (open < len && regex[open] != '(') {
+        open += (regex[open] == '[') ? class_length(regex + open) : atom_length(regex + open);
+    }
+    if (open < len) {
+        int min, max, greedy;
+        close = open + group_length(regex + open);
+        if (has_alternation(regex, open) || has_alternation(regex + close, len - close) ||
+            strpbrk(regex + close, "()") || quantifier_length(regex + close, &min, &max, &greedy)) {
+            return -1;
+        }
+        body = regex + open + 1;
+        body_len = close - open - 2;
+        if (*body == '?') {
+            if (body[1] != ':') {
+                return -1;
+            }
+            body += 2;
+            body_len -= 2;
+        }
+    } else {
+        open = 0;
+        close = len;
+    }
+
+    w->prefix = substring(regex, open);
+    w->suffix = substring(regex + close, len - close);
+    w->buffer = malloc(body_len + 1);
+    w->words = malloc((body_len / 2 + 1) * sizeof(char *));
+    if (!w->prefix || !w->suffix || !w->buffer || !w->words) {
+        words_free(w);
+        return -1;
+    }
+    char *out = w->buffer;
+    for (size_t i = 0; i <= body_len; ) {
+        size_t j = i;
+        while (j < body_len && body[j] != '|') {
+            j += (body[j] == '\\' && j + 1 < body_len) ? 2 : 1;
+        }
+        if (unescape_literal(body + i, j - i, out) != 0) {
+            words_free(w);
+            return -1;
+        }
+        w->words[w->count++] = out;
+        out += strlen(out) + 1;
+        i = j + 1;
+    }
+    for (int i = 0; i < w->count; i++) {
+        size_t n = strlen(w->words[i]);
+        for (int j = i + 1; j < w->count; j++) {
+            if (strlen(w->words[j]) > n && strncmp(w->words[i], w->words[j], n) == 0) {
+                words_free(w);
+                return -1;
+            }
+        }
+    }
+    if (w->count < 2) {
+        words_free(w);
+        return -1;
+    }
+    return 0;
+}
+
+// TextMate
+
+static void print_xml(FILE *out, const char *s)
+{
+    for (; *s; s++) {
+        if (*s == '&') {
+            fputs("&amp;", out);
+        } else if (*s == '<') {
+            fputs("&lt;", out);
+        } else if (*s == '>') {
+            fputs("&gt;", out);
+        } else {
+            fputc(*s, out);
+        }
+    }
+}
+
+static void print_plist_tag(FILE *out, int level, const char *tag)
+{
+    fprintf(out, "%*s<%s>\n", 2 * level, "", tag);
+}
+
+static void print_plist_key(FILE *out, int level, const char *key)
+{
+    fprintf(out, "%*s<key>%s</key>\n", 2 * level, "", key);
+}
+
+static void print_plist_string(FILE *out, int level, const char *s)
+{
+    fprintf(out, "%*s<string>", 2 * level, "");
+    print_xml(out, s);
+    fprintf(out, "</string>\n");
+}
+
+static void print_plist_scope(FILE *out, int level, const char *style, const syntaxdef *syntax)
+{
+    fprintf(out, "%*s<string>%s.%s</string>\n", 2 * level, "",
+            find_style(syntax, style)->textmateScope, syntax->name);
+}
+
+static int print_plist_regex(FILE *out, int level, const char *key, const char *regex, int wrap)
+{
+    char *wrapped = wrap ? wrap_group(regex) : NULL;
+    char *onig = oniguruma_regex(wrap ? (wrapped ? wrapped : "") : regex, 1);
+    if ((wrap && !wrapped) || !onig) {
+        free(wrapped);
+        free(onig);
+        return error("out of memory");
+    }
+    print_plist_key(out, level, key);
+    print_plist_string(out, level, onig);
+    free(wrapped);
+    free(onig);
+    return 0;
+}
+
+static void print_textmate_captures(FILE *out, int level, const char *key, const char *const *styles, const syntaxdef *syntax)
+{
+    char group[16];
+    print_plist_key(out, level, key);
+    print_plist_tag(out, level, "dict");
+    for (int i = 0; styles[i]; i++) {
+        snprintf(group, sizeof(group), "%d", i + 1);
+        print_plist_key(out, level + 1, group);
+        print_plist_tag(out, level + 1, "dict");
+        print_plist_key(out, level + 2, "name");
+        print_plist_scope(out, level + 2, styles[i], syntax);
+        print_plist_tag(out, level + 1, "/dict");
+    }
+    print_plist_tag(out, level, "/dict");
+}
+
+static void print_textmate_includes(FILE *out, int level, const char *const *includes)
+{
+    char name[MAX_PATH_SIZE];
+    print_plist_key(out, level, "patterns");
+    print_plist_tag(out, level, "array");
+    for (; *includes; includes++) {
+        snprintf(name, sizeof(name), "#%s", *includes);
+        print_plist_tag(out, level + 1, "dict");
+        print_plist_key(out, level + 2, "include");
+        print_plist_string(out, level + 2, name);
+        print_plist_tag(out, level + 1, "/dict");
+    }
+    print_plist_tag(out, level, "/array");
+}
+
+static int print_textmate_rule(FILE *out, int level, const grammar_context *ctx, const syntaxdef *syntax)
+{
+    const char *const styles[] = { ctx->styles[0], 0 };
+    print_plist_tag(out, level, "dict");
+    switch (ctx->type) {
+        case CONTEXT_PATTERN:
+            if (print_plist_regex(out, level + 1, "match", ctx->regex, 0) != 0) {
+                return -1;
+            }
+            if (ctx->styles[1]) {
+                print_textmate_captures(out, level + 1, "captures", ctx->styles, syntax);
+            } else {
+                print_plist_key(out, level + 1, "name");
+                print_plist_scope(out, level + 1, ctx->styles[0], syntax);
+            }
+            break;
+        case CONTEXT_PUSH:
+            if (print_plist_regex(out, level + 1, "begin", ctx->regex, 1) != 0 ||
+                print_plist_regex(out, level + 1, "end", ctx->regex_end, 1) != 0) {
+                return -1;
+            }
+            print_textmate_captures(out, level + 1, "beginCaptures", styles, syntax);
+            print_textmate_captures(out, level + 1, "endCaptures", styles, syntax);
+            print_plist_key(out, level + 1, "contentName");
+            print_plist_scope(out, level + 1, ctx->styles[0], syntax);
+            break;
+        case CONTEXT_PUSH_EOL:
+            if (print_plist_regex(out, level + 1, "begin", ctx->regex, 1) != 0) {
+                return -1;
+            }
+            print_textmate_captures(out, level + 1, "beginCaptures", styles, syntax);
+            print_plist_key(out, level + 1, "end");
+            print_plist_string(out, level + 1, "$");
+            print_textmate_includes(out, level + 1, ctx->includes);
+            break;
+    }
+    print_plist_tag(out, level, "/dict");
+    return 0;
+}
+
+int export_textmate(grammar *g, const syntaxdef *syntax, FILE *out)
+{
+    const char *const main[] = { g->contexts[0].name, 0 };
+    char scope[MAX_PATH_SIZE];
+    if (check_styles(g, syntax) != 0) {
+        return -1;
+    }
+    fprintf(out, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    fprintf(out, "<!DOCTYPE plist PUBLIC \"-//Apple Computer//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">\n");
+    fprintf(out, "<!-- " GENERATED " -->\n");
+    fprintf(out, "<plist version=\"1.0\">\n");
+    print_plist_tag(out, 0, "dict");
+    print_plist_key(out, 1, "fileTypes");
+    print_plist_tag(out, 1, "array");
+    print_plist_string(out, 2, syntax->extension);
+    print_plist_tag(out, 1, "/array");
+    print_plist_key(out, 1, "firstLineMatch");
+    print_plist_string(out, 1, syntax->first_line);
+    print_plist_key(out, 1, "name");
+    print_plist_string(out, 1, syntax->name);
+    print_textmate_includes(out, 1, main);
+    print_plist_key(out, 1, "repository");
+    print_plist_tag(out, 1, "dict");
+    for (int i = 0; i < g->count; i++) {
+        const grammar_context *ctx = &g->contexts[i];
+        print_plist_key(out, 2, ctx->name);
+        print_plist_tag(out, 2, "dict");
+        if (ctx->type == CONTEXT_INCLUDES) {
+            print_textmate_includes(out, 3, ctx->includes);
+        } else {
+            print_plist_key(out, 3, "patterns");
+            print_plist_tag(out, 3, "array");
+            if (print_textmate_rule(out, 4, ctx, syntax) != 0) {
+                return -1;
+            }
+            print_plist_tag(out, 3, "/array");
+        }
+        print_plist_tag(out, 2, "/dict");
+    }
+    print_plist_tag(out, 1, "/dict");
+    snprintf(scope, sizeof(scope), "source.%s", syntax->name);
+    print_plist_key(out, 1, "scopeName");
+    print_plist_string(out, 1, scope);
+    print_plist_key(out, 1, "uuid");
+    print_plist_string(out, 1, syntax->uuid);
+    print_plist_tag(out, 0, "/dict");
+    fprintf(out, "</plist>\n");
+    return 0;
+}
+
+// Pygments
+
+static void print_python_string(FILE *out, const char *s)
+{
+    fputs("u'", out);
+    for (; *s; s++) {
+        if (*s == '\\' || *s == '\'') {
+            fputc('\\', out);
+        }
+        fputc(*s, out);
+    }
+    fputc('\'', out);
+}
+
+static void print_pygments_tokens(FILE *out, const char *const *styles, const syntaxdef *syntax)
+{
+    fprintf(out, "bygroups(");
+    for (int i = 0; styles[i]; i++) {
+        fprintf(out, "%s%s", i ? ", " : "", find_style(syntax, styles[i])->pygmentsScope);
+    }
+    fprintf(out, ")");
+}
+
+static int print_pygments_regex(FILE *out, const char *regex)
+{
+    char *python = python_regex(regex);
+    if (!python) {
+        return error("out of memory");
+    }
+    print_python_string(out, python);
+    free(python);
+    return 0;
+}
+
+static int print_pygments_words(FILE *out, const words *w)
+{
+    int column = 16;
+    fprintf(out, "words((\n%16s", "");
+    for (int i = 0; i < w->count; i++) {
+        int width = (int) strlen(w->words[i]) + 5;
+        if (i > 0 && column + width > WORDS_WIDTH) {
+            fprintf(out, ",\n%16s", "");
+            column = 16;
+        } else if (i > 0) {
+            fprintf(out, ", ");
+        }
+        print_python_string(out, w->words[i]);
+        column += width;
+    }
+    fprintf(out, ")");
+    if (*w->prefix) {
+        fprintf(out, ", prefix=");
+        if (print_pygments_regex(out, w->prefix) != 0) {
+            return -1;
+        }
+    }
+    if (*w->suffix) {
+        fprintf(out, ", suffix=");
+        if (print_pygments_regex(out, w->suffix) != 0) {
+            return -1;
+        }
+    }
+    fprintf(out, ")");
+    return 0;
+}
+
+// The start pattern is wrapped into a group like the Iro export does,
+// words() match as a whole with the style of the group.
+static int print_pygments_rule(FILE *out, const grammar_context *ctx, const syntaxdef *syntax)
+{
+    const char *regex = ctx->regex;
+    char *wrapped = NULL;
+    words w;
+    int result = 0;
+    if (ctx->type != CONTEXT_PATTERN) {
+        regex = wrapped = wrap_group(ctx->regex);
+        if (!wrapped) {
+            return error("out of memory");
+        }
+    }
+    fprintf(out, "%12s(", "");
+    if (!ctx->styles[1] && split_words(ctx->type == CONTEXT_PATTERN ? regex : ctx->regex, &w) == 0) {
+        result = print_pygments_words(out, &w);
+        fprintf(out, ", %s", find_style(syntax, ctx->styles[0])->pygmentsScope);
+        words_free(&w);
+    } else {
+        result = print_pygments_regex(out, regex);
+        fprintf(out, ", ");
+        print_pygments_tokens(out, ctx->styles, syntax);
+    }
+    if (ctx->type != CONTEXT_PATTERN) {
+        fprintf(out, ", '%s__1'", ctx->name);
+    }
+    fprintf(out, "),\n");
+    free(wrapped);
+    return result;
+}
+
+static int print_pygments_includes(FILE *out, grammar *g, const grammar_context *ctx, const syntaxdef *syntax)
+{
+    for (const char *const *name = ctx->includes; *name; name++) {
+        const grammar_context *inc = grammar_find(g, *name);
+        if (!inc) {
+            return error("context %s includes undefined context %s", ctx->name, *name);
+        }
+        if (inc->type == CONTEXT_INCLUDES ?
+            print_pygments_includes(out, g, inc, syntax) :
+            print_pygments_rule(out, inc, syntax)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// Characters that no rule matches are styled as strings, like in the
+// Iro export.
+static void print_pygments_fallback(FILE *out)
+{
+    fprintf(out, "%12s('(\\n|\\r|\\r\\n)', String),\n", "");
+    fprintf(out, "%12s('.', String),\n", "");
+}
+
+// Names of the grammar contexts of the rules of a state, one per rule
+// in tokens, so that a profiler can attribute the rules' work to the
+// contexts of the grammar. The context names are stable between
+// grammar versions, the rule indexes are not.
+static void print_pygments_name(FILE *out, const char *name, int *column)
+{
+    int width = (int) strlen(name) + 4;
+    if (*column > 16 && *column + width > WORDS_WIDTH) {
+        fprintf(out, ",\n%16s", "");
+        *column = 16;
+    } else if (*column > 16) {
+        fprintf(out, ", ");
+    }
+    fprintf(out, "'%s'", name);
+    *column += width;
+}
+
+static void print_pygments_names(FILE *out, grammar *g, const grammar_context *ctx, int *column)
+{
+    for (const char *const *name = ctx->includes; *name; name++) {
+        const grammar_context *inc = grammar_find(g, *name);
+        if (inc->type == CONTEXT_INCLUDES) {
+            print_pygments_names(out, g, inc, column);
+        } else {
+            print_pygments_name(out, inc->name, column);
+        }
+    }
+}
+
+static void print_pygments_contexts(FILE *out, grammar *g)
+{
+    int column = 16;
+    fprintf(out, "    # grammar context of each rule in tokens, '<pop>' for the end of a\n");
+    fprintf(out, "    # pushed context, '<newline>' and '<fallback>' for what no rule matches\n");
+    fprintf(out, "    contexts = {\n");
+    fprintf(out, "        'root' : [\n%16s", "");
+    print_pygments_names(out, g, &g->contexts[0], &column);
+    print_pygments_name(out, "<newline>", &column);
+    print_pygments_name(out, "<fallback>", &column);
+    fprintf(out, "],\n");
+    for (int i = 0; i < g->count; i++) {
+        const grammar_context *ctx = &g->contexts[i];
+        if (ctx->type != CONTEXT_PUSH && ctx->type != CONTEXT_PUSH_EOL) {
+            continue;
+        }
+        column = 16;
+        fprintf(out, "        '%s__1' : [\n%16s", ctx->name, "");
+        print_pygments_name(out, "<pop>", &column);
+        if (ctx->type == CONTEXT_PUSH) {
+            // the body of the context is matched by its own fallback rules
+            print_pygments_name(out, ctx->name, &column);
+            print_pygments_name(out, ctx->name, &column);
+        } else {
+            print_pygments_names(out, g, ctx, &column);
+            print_pygments_name(out, "<newline>", &column);
+            print_pygments_name(out, "<fallback>", &column);
+        }
+        fprintf(out, "],\n");
+    }
+    fprintf(out, "    }\n\n");
+}
+
+int export_pygments(grammar *g, const syntaxdef *syntax, FILE *out)
+{
+    char title[MAX_PATH_SIZE];
+    snprintf(title, sizeof(title), "%s", syntax->name);
+    title[0] = toupper((unsigned char) title[0]);
+    if (check_styles(g, syntax) != 0) {
+        return -1;
+    }
+    fprintf(out, "# " GENERATED "\n\n");
+    fprintf(out, "from pygments.lexer import RegexLexer, bygroups, words\n");
+    fprintf(out, "from pygments.token import *\n\n");
+    fprintf(out, "import re\n\n");
+    fprintf(out, "__all__=['%sLexer']\n\n", title);
+    fprintf(out, "class %sLexer(RegexLexer):\n", title);
+    fprintf(out, "    name = '%s'\n", title);
+    fprintf(out, "    aliases = ['%s']\n", syntax->name);
+    fprintf(out, "    filenames = ['*.%s']\n", syntax->extension);
+    fprintf(out, "    flags = re.MULTILINE | re.UNICODE\n\n");
+    fprintf(out, "    def analyse_text(text):\n");
+    fprintf(out, "        if re.match(");
+    print_python_string(out, syntax->first_line);
+    fprintf(out, ", text):\n");
+    fprintf(out, "            return 0.5\n");
+    fprintf(out, "        return 0.0\n\n");
+    print_pygments_contexts(out, g);
+    fprintf(out, "    tokens = {\n");
+    fprintf(out, "        'root' : [\n");
+    if (print_pygments_includes(out, g, &g->contexts[0], syntax) != 0) {
+        return -1;
+    }
+    print_pygments_fallback(out);
+    fprintf(out, "        ],\n");
+    for (int i = 0; i < g->count; i++) {
+        const grammar_context *ctx = &g->contexts[i];
+        const char *const styles[] = { ctx->styles[0], 0 };
+        if (ctx->type != CONTEXT_PUSH && ctx->type != CONTEXT_PUSH_EOL) {
+            continue;
+        }
+        fprintf(out, "        '%s__1' : [\n", ctx->name);
+        if (ctx->type == CONTEXT_PUSH) {
+            char *end = wrap_group(ctx->regex_end);
+            if (!end) {
+                return error("out of memory");
+            }
+            fprintf(out, "%12s(", "");
+            print_pygments_regex(out, end);
+            fprintf(out, ", ");
+            print_pygments_tokens(out, styles, syntax);
+            fprintf(out, ", '#pop'),\n");
+            fprintf(out, "%12s('(\\n|\\r|\\r\\n)', %s),\n", "", find_style(syntax, ctx->styles[0])->pygmentsScope);
+            fprintf(out, "%12s('.', %s),\n", "", find_style(syntax, ctx->styles[0])->pygmentsScope);
+            free(end);
+        } else {
+            // the line end pops, styled as a comment like in the Iro export
+            fprintf(out, "%12s(u'(\\n|\\r|\\r\\n)', bygroups(Comment), '#pop'),\n", "");
+            if (print_pygments_includes(out, g, ctx, syntax) != 0) {
+                return -1;
+            }
+            print_pygments_fallback(out);
+        }
+        fprintf(out, "        ],\n");
+    }
+    fprintf(out, "    }\n");
+    return 0;
+}
+
+// Sublime Text
+
+static void print_yaml_string(FILE *out, const char *s)
+{
+    fputc('\'', out);
+    for (; *s; s++) {
+        if (*s == '\'') {
+            fputc('\'', out);
+        }
+        fputc(*s, out);
+    }
+    fputc('\'', out);
+}
+
+// Sublime Text runs patterns without backtracking constructs on its own
+// engine, which never backtracks, and only falls back to Oniguruma for
+// the others, so loops are not made atomic here.
+static int print_yaml_regex(FILE *out, const char *key, const char *regex, int wrap)
+{
+    char *wrapped = wrap ? wrap_group(regex) : NULL;
+    char *onig = oniguruma_regex(wrap ? (wrapped ? wrapped : "") : regex, 0);
+    if ((wrap && !wrapped) || !onig) {
+        free(wrapped);
+        free(onig);
+        return error("out of memory");
+    }
+    fprintf(out, "    - %s: ", key);
+    print_yaml_string(out, onig);
+    fprintf(out, "\n");
+    free(wrapped);
+    free(onig);
+    return 0;
+}
+
+static void print_sublime_captures(FILE *out, const char *const *styles, const syntaxdef *syntax)
+{
+    fprintf(out, "      captures:\n");
+    for (int i = 0; styles[i]; i++) {
+        fprintf(out, "        %d: %s.%s\n", i + 1, find_style(syntax, styles[i])->textmateScope, syntax->name);
+    }
+}
+
+static void print_sublime_includes(FILE *out, const char *const *includes)
+{
+    for (; *includes; includes++) {
+        fprintf(out, "    - include: %s\n", *includes);
+    }
+}
+
+int export_sublime(grammar *g, const syntaxdef *syntax, FILE *out)
+{
+    if (check_styles(g, syntax) != 0) {
+        return -1;
+    }
+    fprintf(out, "%%YAML 1.2\n");
+    fprintf(out, "---\n");
+    fprintf(out, "# " GENERATED "\n");
+    fprintf(out, "name: %s\n", syntax->name);
+    fprintf(out, "file_extensions:\n");
+    fprintf(out, "  - %s\n", syntax->extension);
+    fprintf(out, "first_line_match: ");
+    print_yaml_string(out, syntax->first_line);
+    fprintf(out, "\n");
+    fprintf(out, "scope: source.%s\n\n", syntax->name);
+    fprintf(out, "contexts:\n");
+    for (int i = 0; i < g->count; i++) {
+        const grammar_context *ctx = &g->contexts[i];
+        const char *const styles[] = { ctx->styles[0], 0 };
+        fprintf(out, "  %s:\n", ctx->name);
+        switch (ctx->type) {
+            case CONTEXT_INCLUDES:
+                print_sublime_includes(out, ctx->includes);
+                break;
+            case CONTEXT_PATTERN:
+                if (print_yaml_regex(out, "match", ctx->regex, 0) != 0) {
+                    return -1;
+                }
+                if (ctx->styles[1]) {
+                    print_sublime_captures(out, ctx->styles, syntax);
+                } else {
+                    fprintf(out, "      scope: %s.%s\n", find_style(syntax, ctx->styles[0])->textmateScope, syntax->name);
+                }
+                break;
+            case CONTEXT_PUSH:
+            case CONTEXT_PUSH_EOL:
+                if (print_yaml_regex(out, "match", ctx->regex, 1) != 0) {
+                    return -1;
+                }
+                print_sublime_captures(out, styles, syntax);
+                fprintf(out, "      push: %s__1\n", ctx->name);
+                fprintf(out, "\n  %s__1:\n", ctx->name);
+                if (ctx->type == CONTEXT_PUSH) {
+                    fprintf(out, "    - meta_content_scope: %s.%s\n", find_style(syntax, ctx->styles[0])->textmateScope, syntax->name);
+                    if (print_yaml_regex(out, "match", ctx->regex_end, 1) != 0) {
+                        return -1;
+                    }
+                    print_sublime_captures(out, styles, syntax);
+                    fprintf(out, "      pop: true\n");
+                } else {
+                    fprintf(out, "    - match: '$'\n");
+                    fprintf(out, "      pop: true\n");
+                    print_sublime_includes(out, ctx->includes);
+                }
+                break;
+        }
+        if (i + 1 < g->count) {
+            fprintf(out, "\n");
+        }
+    }
+    return 0;
+}
+
+static int export_file(grammar *g, const syntaxdef *syntax, const char *dir, const char *suffix,
+                       int (*writer)(grammar *, const syntaxdef *, FILE *))
+{
+    char path[MAX_PATH_SIZE];
+    FILE *out;
+    int result;
+    if (snprintf(path, sizeof(path), "%s/%s%s", dir, syntax->file, suffix) >= (int) sizeof(path)) {
+        return error("path too long: %s", dir);
+    }
+    out = fopen(path, "w");
+    if (!out) {
+        return error("cannot create %s", path);
+    }
+    result = writer(g, syntax, out);
+    if (ferror(out)) {
+        result = error("cannot write %s", path);
+    }
+    if (fclose(out) != 0 && result == 0) {
+        result = error("cannot write %s", path);
+    }
+    return result;
+}
+
+int export_grammars(grammar *g, const syntaxdef *syntax, const char *dir)
+{
+    int result = 0;
+    result |= export_file(g, syntax, dir, ".tmLanguage", export_textmate);
+    result |= export_file(g, syntax, dir, "Lexer.py", export_pygments);
+    result |= export_file(g, syntax, dir, ".sublime-syntax", export_sublime);
+    return result ? -1 : 0;
+}
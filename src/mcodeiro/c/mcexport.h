@@ -0,0 +1,58 @@
+#if !defined(__MCEXPORT_H__)
+#define __MCEXPORT_H__
+
+#include <stdio.h>
+
+#include "mcgrammar.h"
+
+// Grammar exporters.
+//
+// Write the grammar model for TextMate, Pygments and Sublime Text
+// directly, from the same contexts and styles that mcodeiro prints for
+// Iro. Every writer uses what its regex engine offers:
+//
+//  * TextMate uses Oniguruma, which has atomic groups. A greedy loop
+//    like \d+ in \d+\b or [^"]* in "[^"]*" becomes (?>...) where giving
+//    characters back can never lead to a match, that is if the next
+//    character the pattern needs cannot be one of the loop, so a failing
+//    match is not retried at every shorter length. Sublime Text only
+//    falls back to Oniguruma for patterns its own engine cannot run,
+//    atomic groups among them, so its patterns are left as they are.
+//  * Pygments compiles words() into an optimized alternation, so an
+//    alternation of literals like the mnemonics of an instruction class
+//    is written as words() with the rest of the pattern as prefix and
+//    suffix. This is only done if no literal is a prefix of a later one,
+//    so the first literal that matches stays the longest.
+//  * All of them recognize a file by its first line.
+
+struct styledef_t {
+    const char *name;
+    const char *color;
+    const char *textmateScope;
+    const char *pygmentsScope;
+};
+
+struct syntaxdef_t {
+    const char *name;           // e.g. hp41mcode, also the scope suffix
+    const char *description;
+    const char *extension;      // file extension without the dot
+    const char *uuid;           // of the TextMate grammar
+    const char *first_line;     // regex matching the first line of a file
+    const char *file;           // base name of the exported files
+    const struct styledef_t *styles;
+};
+
+typedef struct styledef_t styledef;
+typedef struct syntaxdef_t syntaxdef;
+
+// Each writer returns 0, or -1 with a message on stderr. The main
+// context must be the first one of the grammar.
+int export_textmate(grammar *g, const syntaxdef *syntax, FILE *out);
+int export_pygments(grammar *g, const syntaxdef *syntax, FILE *out);
+int export_sublime(grammar *g, const syntaxdef *syntax, FILE *out);
+
+// Writes <file>.tmLanguage, <file>Lexer.py and <file>.sublime-syntax
+// into the directory dir.
+int export_grammars(grammar *g, const syntaxdef *syntax, const char *dir);
+
+#endif // !defined(__MCEXPORT_H__)
@@ -0,0 +1,110 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcgrammar.h"
+
+static void copy_names(const char **dst, const char **src, int size)
+{
+    int i = 0;
+    while (src && src[i] && i < size) {
+        dst[i] = src[i];
+        i++;
+    }
+    if (src && src[i]) {
+        fprintf(stderr, "mcodeiro: too many names, only %d are kept\n", size);
+    }
+    dst[i] = 0;
+}
+
+static grammar_context *add_context(grammar *g, const char *name, int type)
+{
+    grammar_context *ctx;
+    if (g->count == MAX_CONTEXTS) {
+        fprintf(stderr, "mcodeiro: too many contexts\n");
+        exit(1);
+    }
+    ctx = &g->contexts[g->count++];
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->name = name;
+    ctx->type = type;
+    return ctx;
+}
+
+void grammar_init(grammar *g)
+{
+    g->count = 0;
+}
+
+void grammar_free(grammar *g)
+{
+    for (int i = 0; i < g->count; i++) {
+        free(g->contexts[i].buffer);
+    }
+    g->count = 0;
+}
+
+grammar_context *grammar_add_includes(grammar *g, const char *name, const char **includes)
+{
+    grammar_context *ctx = add_context(g, name, CONTEXT_INCLUDES);
+    copy_names(ctx->includes, includes, MAX_CONTEXT_INCLUDES);
+    return ctx;
+}
+
+grammar_context *grammar_add_pattern(grammar *g, const char *name, const char *regex, const char **styles)
+{
+    grammar_context *ctx = add_context(g, name, CONTEXT_PATTERN);
+    ctx->regex = regex;
+    copy_names(ctx->styles, styles, MAX_CONTEXT_STYLES);
+    return ctx;
+}
+
+grammar_context *grammar_add_push(grammar *g, const char *name, const char *regex, const char *regex_end, const char *style)
+{
+    grammar_context *ctx = add_context(g, name, CONTEXT_PUSH);
+    ctx->regex = regex;
+    ctx->regex_end = regex_end;
+    ctx->styles[0] = style;
+    return ctx;
+}
+
+grammar_context *grammar_add_push_eol(grammar *g, const char *name, const char *regex, const char *style, const char **includes)
+{
+    grammar_context *ctx = add_context(g, name, CONTEXT_PUSH_EOL);
+    ctx->regex = regex;
+    ctx->styles[0] = style;
+    copy_names(ctx->includes, includes, MAX_CONTEXT_INCLUDES);
+    return ctx;
+}
+
+grammar_context *grammar_add_generated(grammar *g, const char *name, const char *regex, const char *style, const char **includes)
+{
+    grammar_context *ctx = grammar_add_push_eol(g, name, NULL, style, includes);
+    ctx->buffer = malloc(strlen(regex) + 1);
+    if (!ctx->buffer) {
+        fprintf(stderr, "mcodeiro: out of memory\n");
+        exit(1);
+    }
+    strcpy(ctx->buffer, regex);
+    ctx->regex = ctx->buffer;
+    return ctx;
+}
+
+grammar_context *grammar_find(grammar *g, const char *name)
+{
+    for (int i = 0; i < g->count; i++) {
+        if (strcmp(g->contexts[i].name, name) == 0) {
+            return &g->contexts[i];
+        }
+    }
+    return NULL;
+}
+
+int grammar_count(const char **names)
+{
+    int count = 0;
+    while (names[count]) {
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,54 @@
+#if !defined(__MCGRAMMAR_H__)
+#define __MCGRAMMAR_H__
+
+// Grammar model.
+//
+// mcodeiro first builds the grammar as a list of contexts and then
+// writes it. A context either only includes other contexts (main), is
+// a single pattern with one style per group, or is an inline push with
+// a start pattern that ends at a pop pattern or at the end of the line.
+
+#define MAX_CONTEXTS            32
+#define MAX_CONTEXT_STYLES      2
+#define MAX_CONTEXT_INCLUDES    24
+
+#define CONTEXT_INCLUDES        0
+#define CONTEXT_PATTERN         1
+#define CONTEXT_PUSH            2
+#define CONTEXT_PUSH_EOL        3
+
+struct grammar_context_t {
+    const char *name;
+    int type;
+    const char *regex;          // pattern, or start pattern of a push
+    const char *regex_end;      // pop pattern of CONTEXT_PUSH
+    const char *styles[MAX_CONTEXT_STYLES + 1];
+    const char *includes[MAX_CONTEXT_INCLUDES + 1];
+    char *buffer;               // owned copy of a generated regex
+};
+
+struct grammar_t {
+    struct grammar_context_t contexts[MAX_CONTEXTS];
+    int count;
+};
+
+typedef struct grammar_context_t grammar_context;
+typedef struct grammar_t grammar;
+
+void grammar_init(grammar *g);
+void grammar_free(grammar *g);
+
+// The string arrays are 0-terminated and copied, the strings are not.
+// The generated regex of grammar_add_generated() is copied.
+grammar_context *grammar_add_includes(grammar *g, const char *name, const char **includes);
+grammar_context *grammar_add_pattern(grammar *g, const char *name, const char *regex, const char **styles);
+grammar_context *grammar_add_push(grammar *g, const char *name, const char *regex, const char *regex_end, const char *style);
+grammar_context *grammar_add_push_eol(grammar *g, const char *name, const char *regex, const char *style, const char **includes);
+grammar_context *grammar_add_generated(grammar *g, const char *name, const char *regex, const char *style, const char **includes);
+
+grammar_context *grammar_find(grammar *g, const char *name);
+
+// Number of entries of a 0-terminated string array.
+int grammar_count(const char **names);
+
+#endif // !defined(__MCGRAMMAR_H__)
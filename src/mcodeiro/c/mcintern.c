@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcintern.h"
+
+static unsigned hash_ints(const int *v, int n)
+{
+    unsigned h = 2166136261u;
+    for (int i = 0; i < n; i++) {
+        h = (h ^ (unsigned) v[i]) * 16777619u;
+    }
+    return h;
+}
+
+static int grow_slots(intern_table *t)
+{
+    int count = t->slot_count ? 2 * t->slot_count : 1024;
+    int *slots = calloc(count, sizeof(int));
+    if (!slots) {
+        return -1;
+    }
+    for (int i = 0; i < t->count; i++) {
+        unsigned h = hash_ints(t->pool + t->start[i], t->start[i + 1] - t->start[i]);
+        while (slots[h & (count - 1)]) {
+            h++;
+        }
+        slots[h & (count - 1)] = i + 1;
+    }
+    free(t->slots);
+    t->slots = slots;
+    t->slot_count = count;
+    return 0;
+}
+
+void intern_init(intern_table *t)
+{
+    memset(t, 0, sizeof(*t));
+}
+
+void intern_free(intern_table *t)
+{
+    free(t->pool);
+    free(t->start);
+    free(t->slots);
+    memset(t, 0, sizeof(*t));
+}
+
+int intern_ints(intern_table *t, const int *v, int n)
+{
+    if (4 * (t->count + 1) > 3 * t->slot_count && grow_slots(t) < 0) {
+        return -1;
+    }
+    unsigned h = hash_ints(v, n);
+    for (;; h++) {
+        int id = t->slots[h & (t->slot_count - 1)] - 1;
+        if (id < 0) {
+            break;
+        }
+        if (t->start[id + 1] - t->start[id] == n && memcmp(t->pool + t->start[id], v, n * sizeof(int)) == 0) {
+            return id;
+        }
+    }
+    if (t->pool_len + n > t->pool_size) {
+        int size = t->pool_size ? 2 * t->pool_size : 4096;
+        while (size < t->pool_len + n) {
+            size *= 2;
+        }
+        int *pool = realloc(t->pool, size * sizeof(int));
+        if (!pool) {
+            return -1;
+        }
+        t->pool = pool;
+        t->pool_size = size;
+    }
+    if (t->count + 2 > t->size) {
+        int size = t->size ? 2 * t->size : 1024;
+        int *start = realloc(t->start, size * sizeof(int));
+        if (!start) {
+            return -1;
+        }
+        if (!t->start) {
+            start[0] = 0;
+        }
+        t->start = start;
+        t->size = size;
+    }
+    memcpy(t->pool + t->pool_len, v, n * sizeof(int));
+    t->pool_len += n;
+    t->start[t->count + 1] = t->pool_len;
+    t->slots[h & (t->slot_count - 1)] = t->count + 1;
+    return t->count++;
+}
+
+const int *intern_get(const intern_table *t, int id, int *n)
+{
+    *n = t->start[id + 1] - t->start[id];
+    return t->pool + t->start[id];
+}
@@ -0,0 +1,29 @@
+#if !defined(__MCINTERN_H__)
+#define __MCINTERN_H__
+
+// Interning of int arrays, e.g. the thread lists of automaton states.
+// Every distinct array gets the next id, starting at 0.
+
+struct intern_table_t {
+    int *pool;
+    int pool_len;
+    int pool_size;
+    int *start;         // array i is pool[start[i]] up to pool[start[i + 1]]
+    int count;
+    int size;
+    int *slots;         // hash table of ids + 1
+    int slot_count;
+};
+
+typedef struct intern_table_t intern_table;
+
+void intern_init(intern_table *t);
+void intern_free(intern_table *t);
+
+// Returns the id of the array, adding it if it is new, or -1 if memory
+// ran out.
+int intern_ints(intern_table *t, const int *v, int n);
+
+const int *intern_get(const intern_table *t, int id, int *n);
+
+#endif // !defined(__MCINTERN_H__)
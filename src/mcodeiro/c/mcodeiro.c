@@ -14,11 +14,21 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "mcinstr.h"
 #include "mcop.h"
+#include "mcdb.h"
+#include "mcpattern.h"
+#include "mcgrammar.h"
+#include "mcprofile.h"
+#include "mcdfa.h"
+#include "mcexport.h"
+#include "mcbacktrack.h"
 
 #define MNEMONIC_COUNT              0x400
+#define MAX_OPERAND_TYPES           8
 #define MAX_MNEMONIC_SIZE           20
 #define MAX_MNEMONIC_PATTERN_SIZE   2*MAX_MNEMONIC_SIZE
+#define MAX_CONTEXT_PATTERN_SIZE    0x2000
 
 #define INDENT      "   "
 #define EQUAL_POS   30
@@ -36,12 +46,7 @@
 #define STYLE_HEXADECIMAL   "hexadecimal"
 #define STYLE_CODE          "code"
 
-struct styledef_t {
-    const char *name;
-    const char *color;
-    const char *textmateScope;
-    const char *pygmentsScope;
-} style_definitions[] = {
+static const styledef style_definitions[] = {
     { STYLE_COMMENT,     "grey",       "comment",                      "Comment"         },
     { STYLE_ANNOTATION,  "brown",      "comment.block.preprocessor",   "Comment.Preproc" },
     { STYLE_ERROR,       "red",        "message.error",                "Generic.Error"   },
@@ -56,6 +61,16 @@ struct styledef_t {
     { 0,                 0,            0,                              0                 }
 };
 
+static const syntaxdef syntax_definition = {
+    "hp41mcode",
+    "HP-41 MCODE Syntax Highlighter",
+    "src",
+    "ec78fc6d-d744-485c-b450-ad86e83e4405",
+    "^\\.(?:HP|JDA|ZENCODE|TITLE)\\b",
+    "mcode",
+    style_definitions
+};
+
 // context identifiers
 #define CTX_MAIN                    "main"
 #define CTX_COMMENT                 "comment"
@@ -106,6 +121,15 @@ static const int fw[] = {
 // temporary buffer for collecting mnemonics
 static const char *mnemonics[MNEMONIC_COUNT];
 
+// instruction database of the linked inst[]
+static mcdb db;
+
+// print trie-factored instead of flat mnemonic patterns
+static int factored = 0;
+
+// set if a mnemonic pattern failed its self-check
+static int failed = 0;
+
 
 static void print_iro_context_begin(const char *name)
 {
@@ -117,12 +141,7 @@ static void print_iro_context_end(void)
     printf("%s}\n\n", indent[0]);
 }
 
-static void print_iro_context_include(const char *name, const char *indent)
-{
-    printf("%s: include \"%s\";\n", indent, name);
-}
-
-static void print_iro_context_includes(const char **names, const char *indent)
+static void print_iro_context_includes(const char *const *names, const char *indent)
 {
     while (*names) {
         printf("%s: include \"%s\";\n", indent, *names);
@@ -165,18 +184,18 @@ static void print_iro_style_scopes(
     printf("%s%-*s  = %s\n", indent[1], fw[2], "pygments_scope", pygments_scope);
 }
 
-static void print_iro_header(void)
+static void print_iro_header(const syntaxdef *syntax)
 {
-    printf("%-*s  = hp41mcode\n", fw[0], "name");
-    printf("%-*s  = src;\n", fw[0], "file_extensions []");
-    printf("%-*s  = \"HP-41 MCODE Syntax Highlighter\";\n", fw[0], "description");
-    printf("%-*s  = \"ec78fc6d-d744-485c-b450-ad86e83e4405\";\n", fw[0], "textmate_uuid");
+    printf("%-*s  = %s\n", fw[0], "name", syntax->name);
+    printf("%-*s  = %s;\n", fw[0], "file_extensions []", syntax->extension);
+    printf("%-*s  = \"%s\";\n", fw[0], "description", syntax->description);
+    printf("%-*s  = \"%s\";\n", fw[0], "textmate_uuid", syntax->uuid);
     printf("\n");
 }
 
-static void print_iro_styles(struct styledef_t *styles)
+static void print_iro_styles(const styledef *styles)
 {
-    struct styledef_t *style = styles;
+    const styledef *style = styles;
     printf("#-------------------------------------------------\n");
     printf("# Styles\n");
     printf("#-------------------------------------------------\n\n");
@@ -194,14 +213,19 @@ static void print_iro_styles(struct styledef_t *styles)
     printf("}\n\n");
 }
 
-static void print_iro_pattern_context_multistyle(
-    const char *name,
-    const char *regex,
-    const char **styles)
+static void print_iro_includes_context(const grammar_context *ctx)
 {
-    print_iro_context_begin(name);
+    print_iro_context_begin(ctx->name);
+    print_iro_context_includes(ctx->includes, indent[1]);
+    print_iro_context_end();
+}
+
+static void print_iro_pattern_context(const grammar_context *ctx)
+{
+    const char *const *styles = ctx->styles;
+    print_iro_context_begin(ctx->name);
     printf("%s: pattern {\n", indent[1]);
-    printf("%s%-*s \\= %s\n", indent[2], fw[3], "regex", regex);
+    printf("%s%-*s \\= %s\n", indent[2], fw[3], "regex", ctx->regex);
     printf("%s%-*s  = .%s", indent[2], fw[3], "styles []", *styles++);
     while (*styles) {
         printf(", .%s", *styles++);
@@ -210,203 +234,226 @@ static void print_iro_pattern_context_multistyle(
     print_iro_context_end();
 }
 
-static void print_iro_pattern_context(
-    const char *name,
-    const char *regex,
-    const char *style)
-{
-    const char *styles[] = { style, 0 };
-    print_iro_pattern_context_multistyle(name, regex, styles);
-}
-
-static void print_iro_push_context(
-    const char *name,
-    const char *regex_start,
-    const char *regex_end,
-    const char *style)
+static void print_iro_push_context(const grammar_context *ctx)
 {
-    print_iro_context_begin(name);
+    const char *style = ctx->styles[0];
+    print_iro_context_begin(ctx->name);
     print_iro_context_push_begin();
-    printf("%s%-*s \\= (%s)\n", indent[2], fw[3], "regex", regex_start);
+    printf("%s%-*s \\= (%s)\n", indent[2], fw[3], "regex", ctx->regex);
     printf("%s%-*s  = .%s;\n", indent[2], fw[3], "styles []", style);
     printf("%s%-*s  = .%s\n", indent[2], fw[3], "default_style", style);
     printf("%s: pop {\n", indent[2]);
-    printf("%s%-*s \\= (%s)\n", indent[3], fw[4], "regex", regex_end);
+    printf("%s%-*s \\= (%s)\n", indent[3], fw[4], "regex", ctx->regex_end);
     printf("%s%-*s  = .%s;\n", indent[3], fw[4], "styles []", style);
     printf("%s}\n", indent[2]);
     print_iro_context_push_end();
     print_iro_context_end();
 }
 
-static void print_iro_push_eol_context(
-    const char *name,
-    const char *regex,
-    const char *style,
-    const char **includes)
+static void print_iro_push_eol_context(const grammar_context *ctx)
 {
-    print_iro_context_begin(name);
+    print_iro_context_begin(ctx->name);
     print_iro_context_push_begin();
-    printf("%s%-*s \\= (%s)\n", indent[2], fw[3], "regex", regex);
-    printf("%s%-*s  = .%s;\n", indent[2], fw[3], "styles []", style);
+    printf("%s%-*s \\= (%s)\n", indent[2], fw[3], "regex", ctx->regex);
+    printf("%s%-*s  = .%s;\n", indent[2], fw[3], "styles []", ctx->styles[0]);
     printf("%s: eol_pop {}\n", indent[2]);
-    print_iro_context_includes(includes, indent[2]);
+    print_iro_context_includes(ctx->includes, indent[2]);
     print_iro_context_push_end();
     print_iro_context_end();
 }
 
-static void print_iro_context_comment(void)
+static void print_iro_context(const grammar_context *ctx)
+{
+    switch (ctx->type) {
+        case CONTEXT_INCLUDES:
+            print_iro_includes_context(ctx);
+            break;
+        case CONTEXT_PATTERN:
+            print_iro_pattern_context(ctx);
+            break;
+        case CONTEXT_PUSH:
+            print_iro_push_context(ctx);
+            break;
+        case CONTEXT_PUSH_EOL:
+            print_iro_push_eol_context(ctx);
+            break;
+    }
+}
+
+static void add_pattern_context(grammar *g, const char *name, const char *regex, const char *style)
+{
+    const char *styles[] = { style, 0 };
+    grammar_add_pattern(g, name, regex, styles);
+}
+
+static void add_context_comment(grammar *g)
 {
-    print_iro_pattern_context(CTX_COMMENT, "(;.*)", STYLE_COMMENT);
+    add_pattern_context(g, CTX_COMMENT, "(;.*)", STYLE_COMMENT);
 }
 
-static void print_iro_context_annotation(void)
+static void add_context_annotation(grammar *g)
 {
     const char *styles[] = {
         STYLE_ERROR,
         STYLE_ANNOTATION,
         0  
     };
-    print_iro_pattern_context_multistyle(
+    grammar_add_pattern(
+        g,
         CTX_ANNOTATION,
         "(\\*\\*\\* ERROR.*)|(\\*.*)",
         styles);
 }
 
-static void print_iro_context_string(void)
+static void add_context_string(grammar *g)
 {
-    print_iro_pattern_context(CTX_STRING, "(\\\"[^\\\"]*\\\")", CTX_STRING);
+    add_pattern_context(g, CTX_STRING, "(\\\"[^\\\"]*\\\")", CTX_STRING);
 }
 
-static void print_iro_context_number(void)
+static void add_context_number(grammar *g)
 {
-    print_iro_pattern_context(CTX_DEC_NUMBER, "(\\d+\\b)", STYLE_DECIMAL);
-    print_iro_pattern_context(CTX_HEX_NUMBER, "([0-9A-F]+\\b)", STYLE_HEXADECIMAL);
+    add_pattern_context(g, CTX_DEC_NUMBER, "(\\d+\\b)", STYLE_DECIMAL);
+    add_pattern_context(g, CTX_HEX_NUMBER, "([0-9A-F]+\\b)", STYLE_HEXADECIMAL);
 }
 
-static void print_iro_context_address(void)
+static void add_context_address(grammar *g)
 {
-    print_iro_pattern_context(CTX_ADDRESS, "([0-9A-F]{4}\\b)", STYLE_HEXADECIMAL);
+    add_pattern_context(g, CTX_ADDRESS, "([0-9A-F]{4}\\b)", STYLE_HEXADECIMAL);
 }
 
-static void print_iro_context_code(void)
+static void add_context_code(grammar *g)
 {
-    print_iro_pattern_context(CTX_CODE, "([0-3][0-9A-F]{2}\\b)", STYLE_CODE);
+    add_pattern_context(g, CTX_CODE, "([0-3][0-9A-F]{2}\\b)", STYLE_CODE);
 }
 
-static void print_iro_context_data(void)
+static void add_context_data(grammar *g)
 {
-    print_iro_context_begin(CTX_DATA);
-    printf("%s: pattern {\n", indent[1]);
-    printf("%s%-*s \\= ([0-9A-F]{4}\\s+)((?:[0-3][0-9A-F]{2}){1,3})\n", indent[2], fw[3], "regex");
-    printf("%s%-*s  = .%s, .%s;\n", indent[2], fw[3], "styles []", STYLE_HEXADECIMAL, STYLE_CODE);
-    printf("%s}\n", indent[1]);
-    print_iro_context_end();
+    const char *styles[] = {
+        STYLE_HEXADECIMAL,
+        STYLE_CODE,
+        0
+    };
+    grammar_add_pattern(
+        g,
+        CTX_DATA,
+        "([0-9A-F]{4}[ \\t]+)((?:[0-3][0-9A-F]{2}){1,3})",
+        styles);
 }
 
-static void print_iro_context_tef(void)
+static void add_context_tef(grammar *g)
 {
-    print_iro_pattern_context(
+    add_pattern_context(
+        g,
         CTX_TEF,
         "([P[QT^-]|XS?|W(PT)?|MS?|S(&X)?|ALL|@R|R<|P-Q)",
         STYLE_OPERAND);
 }
 
-static void print_iro_context_register(void)
+static void add_context_register(grammar *g)
 {
-    print_iro_pattern_context(
+    add_pattern_context(
+        g,
         CTX_REGISTER,
         "((\\d{1,2}|[0-9A-F])(\\([TZYXLMNOPQabcde]\\))?(/[TZYXLMNOPQabcde])?)",
         STYLE_OPERAND);
 }
 
-static void print_iro_context_positive_displacement(void)
+static void add_context_positive_displacement(grammar *g)
 {
-    print_iro_pattern_context(
+    add_pattern_context(
+        g,
         CTX_POS_DISPLACEMENT,
         "(\\+(?:(?:[1-5]\\d)|(?:6[0-3])|\\d))",
         STYLE_OPERAND);
 }
 
-static void print_iro_context_negative_displacement(void)
+static void add_context_negative_displacement(grammar *g)
 {
-    print_iro_pattern_context(
+    add_pattern_context(
+        g,
         CTX_NEG_DISPLACEMENT,
         "(\\-(?:(?:[1-5]\\d)|(?:6[0-4])|[1-9]))",
         STYLE_OPERAND);
 }
 
-static void print_iro_context_local_label(void)
+static void add_context_local_label(grammar *g)
 {
-    print_iro_pattern_context(
+    add_pattern_context(
+        g,
         CTX_LOCAL_LABEL,
         "(\\([^\\)]+\\))",
         STYLE_LABEL);
 }
 
-static void print_iro_context_global_label(void)
+static void add_context_global_label(grammar *g)
 {
-    print_iro_pattern_context(
+    add_pattern_context(
+        g,
         CTX_GLOBAL_LABEL,
         "(\\[[^\\]]+\\])",
         STYLE_LABEL);
 }
 
-static void print_iro_context_simple_directive(void)
+static void add_context_simple_directive(grammar *g)
 {
     const char *includes[] = {
         CTX_COMMENT,
         0
     };
-    print_iro_push_eol_context(
+    grammar_add_push_eol(
+        g,
         CTX_SIMPLE_DIRECTIVE,
         "\\.(HP|JDA|ZENCODE)",
         STYLE_DIRECTIVE,
         includes);
 }
 
-static void print_iro_context_string_directive(void)
+static void add_context_string_directive(grammar *g)
 {
     const char *includes[] = {
         CTX_STRING,
         CTX_COMMENT,
         0
     };
-    print_iro_push_eol_context(
+    grammar_add_push_eol(
+        g,
         CTX_STRING_DIRECTIVE,
         "\\.(TITLE|TEXT|NAME|MESSL)",
         STYLE_DIRECTIVE,
         includes);
 }
 
-static void print_iro_context_number_directive(void)
+static void add_context_number_directive(grammar *g)
 {
     const char *includes[] = {
         CTX_DEC_NUMBER,
         CTX_COMMENT,
         0
     };
-    print_iro_push_eol_context(
+    grammar_add_push_eol(
+        g,
         CTX_NUMBER_DIRECTIVE,
         "\\.BSS",
         STYLE_DIRECTIVE,
         includes);
 }
 
-static void print_iro_context_address_directive(void)
+static void add_context_address_directive(grammar *g)
 {
     const char *includes[] = {
         CTX_ADDRESS,
         CTX_COMMENT,
         0
     };
-    print_iro_push_eol_context(
+    grammar_add_push_eol(
+        g,
         CTX_ADDRESS_DIRECTIVE,
         "\\.(FILLTO|ORG)",
         STYLE_DIRECTIVE,
         includes);
 }
 
-static void print_iro_context_symbol_directive(void)
+static void add_context_symbol_directive(grammar *g)
 {
     const char *includes[] = {
         CTX_LOCAL_LABEL,
@@ -415,46 +462,27 @@ static void print_iro_context_symbol_directive(void)
         CTX_COMMENT,
         0
     };
-    print_iro_push_eol_context(
+    grammar_add_push_eol(
+        g,
         CTX_SYMBOL_DIRECTIVE,
         "\\.EQU",
         STYLE_DIRECTIVE,
         includes);
 }
 
-static void print_iro_context_code_literal(void)
+static void add_context_code_literal(grammar *g)
 {
     const char *includes[] = {
         CTX_CODE, CTX_COMMENT, 0
     };
-    print_iro_push_eol_context(
+    grammar_add_push_eol(
+        g,
         CTX_CODE_LITERAL,
         "#",
         STYLE_DIRECTIVE,
         includes);
 }
 
-static const char *mnemonic_to_pattern(const char *mnemonic, char *pattern)
-{
-    char *p = pattern;
-    if (pattern) {
-        while (mnemonic && *mnemonic) {
-            switch (*mnemonic) {
-                case '?':
-                case '+':
-                case '-':
-                case '.':
-                    *p++ = '\\';
-                default:
-                    *p++ = *mnemonic++;
-                    break;
-            }
-        }
-        *p++ = '\0';
-    }
-    return pattern;
-}
-
 static int compare_mnemonics(const void *a, const void *b) {
     const char **ps1 = (const char **) a;
     const char **ps2 = (const char **) b;
@@ -467,57 +495,91 @@ static int compare_mnemonics(const void *a, const void *b) {
     }
 }
 
+// Merges the mnemonic lists of the operand types, which the instruction
+// database keeps in match order.
 static int collect_mnemonics(const int *operand_type)
 {
-    int i;
-    mnemonic_operand_it it;
-    for (i = 0; i < MNEMONIC_COUNT; i++) {
-        mnemonics[i] = 0;
+    const uint16_t *items[MAX_OPERAND_TYPES];
+    uint32_t left[MAX_OPERAND_TYPES];
+    int lists = 0;
+    int i = 0;
+    while (operand_type && *operand_type && lists < MAX_OPERAND_TYPES) {
+        const mcdb_type *type = mcdb_find_type(&db, *operand_type++);
+        if (type) {
+            items[lists] = mcdb_items(&db, &type->mnemonics);
+            left[lists++] = type->mnemonics.count;
+        }
     }
-    i = 0;
-    if (operand_type) {
-        while (*operand_type) {
-            const char *m = mnemonic_operand_first(&it, *operand_type++);
-            while (m) {
-                mnemonics[i++] = m;
-                m = mnemonic_operand_next(&it);
+    for (;;) {
+        const char *best_name = 0;
+        int best = -1;
+        for (int k = 0; k < lists; k++) {
+            const char *name = left[k] ? mcdb_string(&db, mcdb_get(&db, *items[k])->name) : 0;
+            if (name && (best < 0 || compare_mnemonics(&name, &best_name) < 0)) {
+                best = k;
+                best_name = name;
             }
         }
-        qsort(mnemonics, i, sizeof(char *), compare_mnemonics);
+        if (best < 0) {
+            break;
+        }
+        mnemonics[i++] = best_name;
+        items[best]++;
+        left[best]--;
     }
     return i;
 }
 
-static void print_mnemonics_pattern(int *operand_type)
+static int flat_pattern(int count, char *buf, int size)
 {
-    if (collect_mnemonics(operand_type) > 0) {
-        int i = 0;
-        char pattern[MAX_MNEMONIC_PATTERN_SIZE];
-        printf("%s", mnemonic_to_pattern(mnemonics[i++], pattern));
-        while (mnemonics[i]) {
-            printf("|%s", mnemonic_to_pattern(mnemonics[i++], pattern));
+    int len = 0;
+    char pattern[MAX_MNEMONIC_PATTERN_SIZE];
+    for (int i = 0; i < count; i++) {
+        mnemonic_to_pattern(mnemonics[i], pattern);
+        len += snprintf(buf + len, size > len ? size - len : 0, "%s%s", i ? "|" : "", pattern);
+    }
+    return (len < size) ? len : -1;
+}
+
+// Both patterns are built and checked to accept exactly the collected
+// mnemonics, the selected one is returned.
+static const char *mnemonics_pattern(const char *name, const int *operand_type)
+{
+    static char flat[MAX_CONTEXT_PATTERN_SIZE];
+    static char trie[MAX_CONTEXT_PATTERN_SIZE];
+    int count = collect_mnemonics(operand_type);
+    flat[0] = '\0';
+    trie[0] = '\0';
+    if (count > 0) {
+        if (flat_pattern(count, flat, sizeof(flat)) < 0 ||
+            mnemonic_pattern_accepts(flat, mnemonics, count) != 1) {
+            fprintf(stderr, "mcodeiro: flat pattern of %s does not match its mnemonics\n", name);
+            failed = 1;
+        }
+        if (mnemonic_factored_pattern(mnemonics, count, trie, sizeof(trie)) < 0 ||
+            mnemonic_pattern_accepts(trie, mnemonics, count) != 1) {
+            fprintf(stderr, "mcodeiro: factored pattern of %s does not match its mnemonics\n", name);
+            failed = 1;
         }
     }
+    return factored ? trie : flat;
 }
 
-static void print_iro_context_instruction_aux(
+static void add_context_instruction_aux(
+    grammar *g,
     const char *name,
     const int *operand_type,
     const char **includes)
 {
-    print_iro_context_begin(name);
-    print_iro_context_push_begin();
-    printf("%s%-*s \\= (", indent[2], fw[3], "regex");
-    print_mnemonics_pattern(operand_type);
-    printf(")\n");
-    printf("%s%-*s  = .%s;\n", indent[2], fw[3], "styles []", STYLE_MNEMONIC);
-    printf("%s: eol_pop {}\n", indent[2]);
-    print_iro_context_includes(includes, indent[2]);
-    print_iro_context_push_end();
-    print_iro_context_end();
+    grammar_add_generated(
+        g,
+        name,
+        mnemonics_pattern(name, operand_type),
+        STYLE_MNEMONIC,
+        includes);
 }
 
-static void print_iro_context_instruction_none(void)
+static void add_context_instruction_none(grammar *g)
 {
     const int operands[] = {
         MCODE_OP_NONE1,
@@ -529,11 +591,11 @@ static void print_iro_context_instruction_none(void)
         CTX_COMMENT,
         0
     };
-    print_iro_context_instruction_aux(
-        CTX_INSTRUCTION_NONE, operands, includes);
+    add_context_instruction_aux(
+        g, CTX_INSTRUCTION_NONE, operands, includes);
 }
 
-static void print_iro_context_instruction_number()
+static void add_context_instruction_number(grammar *g)
 {
     const int operands[] = {
         MCODE_OP_0_TO_7,
@@ -547,11 +609,11 @@ static void print_iro_context_instruction_number()
         CTX_COMMENT,
         0
     };
-    print_iro_context_instruction_aux(
-        CTX_INSTRUCTION_NUMBER, operands, includes);
+    add_context_instruction_aux(
+        g, CTX_INSTRUCTION_NUMBER, operands, includes);
 }
 
-static void print_iro_context_instruction_address()
+static void add_context_instruction_address(grammar *g)
 {
     const int operands[] = {
         MCODE_OP_ADDRESS1,
@@ -567,11 +629,11 @@ static void print_iro_context_instruction_address()
         CTX_COMMENT,
         0
     };
-    print_iro_context_instruction_aux(
-        CTX_INSTRUCTION_ADDRESS, operands, includes);
+    add_context_instruction_aux(
+        g, CTX_INSTRUCTION_ADDRESS, operands, includes);
 }
 
-static void print_iro_context_instruction_class2()
+static void add_context_instruction_class2(grammar *g)
 {
     const int operands[] = {
         MCODE_OP_TEF1,
@@ -583,11 +645,11 @@ static void print_iro_context_instruction_class2()
         CTX_COMMENT,
         0
     };
-    print_iro_context_instruction_aux(
-        CTX_INSTRUCTION_CLASS2, operands, includes);
+    add_context_instruction_aux(
+        g, CTX_INSTRUCTION_CLASS2, operands, includes);
 }
 
-static void print_iro_context_instruction_class3()
+static void add_context_instruction_class3(grammar *g)
 {
     const int operands[] = {
         MCODE_OP_DISPLACEMENT,
@@ -602,11 +664,11 @@ static void print_iro_context_instruction_class3()
         CTX_COMMENT,
         0
     };
-    print_iro_context_instruction_aux(
-        CTX_INSTRUCTION_CLASS3, operands, includes);
+    add_context_instruction_aux(
+        g, CTX_INSTRUCTION_CLASS3, operands, includes);
 }
 
-static void print_iro_context_instruction_register()
+static void add_context_instruction_register(grammar *g)
 {
     const int operands[] = {
         MCODE_OP_0_TO_F_HEX,
@@ -617,11 +679,11 @@ static void print_iro_context_instruction_register()
         CTX_COMMENT,
         0
     };
-    print_iro_context_instruction_aux(
-        CTX_INSTRUCTION_REGISTER, operands, includes);
+    add_context_instruction_aux(
+        g, CTX_INSTRUCTION_REGISTER, operands, includes);
 }
 
-static void print_iro_context_instruction_special1()
+static void add_context_instruction_special1(grammar *g)
 {
     const int operands[] = {
         MCODE_OP_000_TO_FFF_HEX,
@@ -633,11 +695,11 @@ static void print_iro_context_instruction_special1()
         CTX_COMMENT,
         0
     };
-    print_iro_context_instruction_aux(
-        CTX_INSTRUCTION_SPECIAL1, operands, includes);
+    add_context_instruction_aux(
+        g, CTX_INSTRUCTION_SPECIAL1, operands, includes);
 }
 
-static void print_iro_context_instruction_special2()
+static void add_context_instruction_special2(grammar *g)
 {
     const int operands[] = {
         MCODE_OP_UNKNOWN, // CON (not really an instruction)
@@ -650,11 +712,11 @@ static void print_iro_context_instruction_special2()
         CTX_COMMENT,
         0
     };
-    print_iro_context_instruction_aux(
-        CTX_INSTRUCTION_SPECIAL2, operands, includes);
+    add_context_instruction_aux(
+        g, CTX_INSTRUCTION_SPECIAL2, operands, includes);
 }
 
-static void print_iro_main_context(void)
+static void add_main_context(grammar *g)
 {
     const char *includes[] = {
         CTX_COMMENT,
@@ -678,79 +740,157 @@ static void print_iro_main_context(void)
         CTX_GLOBAL_LABEL,
         0
     };
-    print_iro_context_begin(CTX_MAIN);
-    print_iro_context_includes(includes, indent[1]);
-    print_iro_context_end();
+    grammar_add_includes(g, CTX_MAIN, includes);
 }
 
-static void print_iro_basic_contexts(void)
+static void add_basic_contexts(grammar *g)
 {
-    print_iro_context_comment();
-    print_iro_context_annotation();
-    print_iro_context_data();
-    print_iro_context_string();
-    print_iro_context_number();
-    print_iro_context_address();
-    print_iro_context_code();
-    print_iro_context_local_label();
-    print_iro_context_global_label();
-    print_iro_context_tef();
-    print_iro_context_register();
-    print_iro_context_positive_displacement();
-    print_iro_context_negative_displacement();
+    add_context_comment(g);
+    add_context_annotation(g);
+    add_context_data(g);
+    add_context_string(g);
+    add_context_number(g);
+    add_context_address(g);
+    add_context_code(g);
+    add_context_local_label(g);
+    add_context_global_label(g);
+    add_context_tef(g);
+    add_context_register(g);
+    add_context_positive_displacement(g);
+    add_context_negative_displacement(g);
 }
 
-static void print_iro_directive_contexts(void)
+static void add_directive_contexts(grammar *g)
 {
-    print_iro_context_simple_directive();
-    print_iro_context_string_directive();
-    print_iro_context_number_directive();
-    print_iro_context_address_directive();
-    print_iro_context_symbol_directive();
-    print_iro_context_code_literal();
+    add_context_simple_directive(g);
+    add_context_string_directive(g);
+    add_context_number_directive(g);
+    add_context_address_directive(g);
+    add_context_symbol_directive(g);
+    add_context_code_literal(g);
 }
 
-static void print_iro_instruction_contexts(void)
+static void add_instruction_contexts(grammar *g)
 {
-    print_iro_context_instruction_none();
-    print_iro_context_instruction_number();
-    print_iro_context_instruction_address();
-    print_iro_context_instruction_class2();
-    print_iro_context_instruction_class3();
-    print_iro_context_instruction_register();
-    print_iro_context_instruction_special1();
-    print_iro_context_instruction_special2();
+    add_context_instruction_none(g);
+    add_context_instruction_number(g);
+    add_context_instruction_address(g);
+    add_context_instruction_class2(g);
+    add_context_instruction_class3(g);
+    add_context_instruction_register(g);
+    add_context_instruction_special1(g);
+    add_context_instruction_special2(g);
 }
 
-static void print_iro_contexts(void)
+static void add_mcode_contexts(grammar *g)
+{
+    add_main_context(g);
+    add_basic_contexts(g);
+    add_directive_contexts(g);
+    add_instruction_contexts(g);
+}
+
+static void print_iro_contexts(const grammar *g)
 {
     printf("#-------------------------------------------------\n");
     printf("# Main Context\n");
     printf("#-------------------------------------------------\n\n");
     printf("contexts [] {\n");
-    print_iro_main_context();
+    print_iro_context(&g->contexts[0]);
     printf("#-------------------------------------------------\n");
     printf("# Auxiliary Contexts\n");
     printf("#-------------------------------------------------\n\n");
-    print_iro_basic_contexts();
-    print_iro_directive_contexts();
-    print_iro_instruction_contexts();
+    for (int i = 1; i < g->count; i++) {
+        print_iro_context(&g->contexts[i]);
+    }
     printf("}\n");
 }
 
-static void print_iro_mcode_syntax(void)
+static void print_iro_mcode_syntax(const grammar *g)
 {
     printf("#-------------------------------------------------\n");
     printf("# HP-41 MCODE Syntax Highlighter\n");
     printf("# 2019 by Jurgen Keller <jkeller@gmx.ch>\n");
     printf("#-------------------------------------------------\n\n");
-    print_iro_header();
-    print_iro_styles(style_definitions);
-    print_iro_contexts();
+    print_iro_header(&syntax_definition);
+    print_iro_styles(syntax_definition.styles);
+    print_iro_contexts(g);
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodeiro [-D file] [-t] [-d] [-o dir] [-b file] [-p corpus]...\n");
+    fprintf(stderr, "  -D  use this instruction database instead of " MCDB_FILE_NAME "\n");
+    fprintf(stderr, "  -t  print trie-factored mnemonic patterns\n");
+    fprintf(stderr, "  -d  print the grammar as DFA tables for mcodelex instead of Iro\n");
+    fprintf(stderr, "  -o  also write the TextMate, Pygments and Sublime Text grammars into dir\n");
+    fprintf(stderr, "  -b  report the backtracking cost of the patterns and write worst-case lines to file\n");
+    fprintf(stderr, "  -p  order the main context includes by a profile of .src files\n");
 }
 
 int main(int argc, char *argv[])
 {
-    print_iro_mcode_syntax();
-    return 0;
+    grammar g;
+    const char **corpus = malloc(argc * sizeof(char *));
+    int corpus_count = 0;
+    const char *grammar_dir = 0;
+    const char *attack_file = 0;
+    const char *database = 0;
+    FILE *attacks = NULL;
+    int tables = 0;
+    if (!corpus) {
+        return 1;
+    }
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-D") == 0 && i + 1 < argc) {
+            database = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0) {
+            factored = 1;
+        } else if (strcmp(argv[i], "-d") == 0) {
+            tables = 1;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            grammar_dir = argv[++i];
+        } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            attack_file = argv[++i];
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            corpus[corpus_count++] = argv[++i];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (mcdb_load(&db, database, argv[0]) != 0) {
+        perror(database ? database : MCDB_FILE_NAME);
+        return 1;
+    }
+    grammar_init(&g);
+    add_mcode_contexts(&g);
+    if (corpus_count > 0 && profile_main_includes(&g, CTX_MAIN, corpus, corpus_count, stderr) != 0) {
+        failed = 1;
+    }
+    if (attack_file && !(attacks = fopen(attack_file, "w"))) {
+        fprintf(stderr, "mcodeiro: cannot write %s\n", attack_file);
+        failed = 1;
+    }
+    if (backtrack_check(&g, attacks) != 0) {
+        failed = 1;
+    }
+    if (attacks && fclose(attacks) != 0) {
+        fprintf(stderr, "mcodeiro: cannot write %s\n", attack_file);
+        failed = 1;
+    }
+    if (grammar_dir && export_grammars(&g, &syntax_definition, grammar_dir) != 0) {
+        failed = 1;
+    }
+    if (tables) {
+        if (dfa_print_tables(&g, CTX_MAIN, stdout) != 0) {
+            failed = 1;
+        }
+    } else {
+        print_iro_mcode_syntax(&g);
+    }
+    grammar_free(&g);
+    mcdb_close(&db);
+    free(corpus);
+    return failed ? 1 : 0;
 }
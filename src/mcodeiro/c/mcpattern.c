@@ -0,0 +1,376 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcpattern.h"
+
+#define MAX_TRIE_NODES      4096
+#define MAX_EXPANDED_SIZE   32
+
+struct trie_node_t {
+    char ch;
+    char terminal;
+    short child;    // first child, children are sorted by character
+    short sibling;
+};
+
+struct builder_t {
+    char *buf;
+    int size;
+    int len;
+};
+
+struct strset_t {
+    char (*items)[MAX_EXPANDED_SIZE];
+    int count;
+    int size;
+};
+
+typedef struct trie_node_t trie_node;
+typedef struct builder_t builder;
+typedef struct strset_t strset;
+
+static trie_node trie[MAX_TRIE_NODES];
+static int trie_size;
+
+const char *mnemonic_to_pattern(const char *mnemonic, char *pattern)
+{
+    char *p = pattern;
+    if (pattern) {
+        while (mnemonic && *mnemonic) {
+            switch (*mnemonic) {
+                case '?':
+                case '+':
+                case '-':
+                case '.':
+                    *p++ = '\\';
+                    // fall through
+                default:
+                    *p++ = *mnemonic++;
+                    break;
+            }
+        }
+        *p++ = '\0';
+    }
+    return pattern;
+}
+
+static int trie_new_node(char ch, int sibling)
+{
+    if (trie_size == MAX_TRIE_NODES) {
+        return -1;
+    }
+    trie[trie_size].ch = ch;
+    trie[trie_size].terminal = 0;
+    trie[trie_size].child = -1;
+    trie[trie_size].sibling = sibling;
+    return trie_size++;
+}
+
+static int trie_insert(const char *mnemonic)
+{
+    int node = 0;
+    while (*mnemonic) {
+        short *link = &trie[node].child;
+        while (*link >= 0 && trie[*link].ch < *mnemonic) {
+            link = &trie[*link].sibling;
+        }
+        if (*link < 0 || trie[*link].ch != *mnemonic) {
+            int n = trie_new_node(*mnemonic, *link);
+            if (n < 0) {
+                return -1;
+            }
+            *link = n;
+        }
+        node = *link;
+        mnemonic++;
+    }
+    trie[node].terminal = 1;
+    return 0;
+}
+
+static int is_leaf(int node)
+{
+    return trie[node].child < 0;
+}
+
+// number of alternatives after merging the leaves into one class
+static int alternative_count(int node)
+{
+    int count = 0;
+    int leaves = 0;
+    for (int c = trie[node].child; c >= 0; c = trie[c].sibling) {
+        if (is_leaf(c)) {
+            leaves = 1;
+        } else {
+            count++;
+        }
+    }
+    return count + leaves;
+}
+
+// true if the alternatives are a single character or class
+static int is_atom(int node)
+{
+    for (int c = trie[node].child; c >= 0; c = trie[c].sibling) {
+        if (!is_leaf(c)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void put(builder *b, const char *s)
+{
+    while (*s) {
+        if (b->len < b->size) {
+            b->buf[b->len] = *s;
+        }
+        b->len++;
+        s++;
+    }
+}
+
+static void put_char(builder *b, char ch)
+{
+    char mnemonic[2] = { ch, '\0' };
+    char pattern[3];
+    put(b, mnemonic_to_pattern(mnemonic, pattern));
+}
+
+static void put_alternatives(builder *b, int node);
+
+static void put_tail(builder *b, int node)
+{
+    if (is_leaf(node)) {
+        return;
+    }
+    if (trie[node].terminal) {
+        if (is_atom(node)) {
+            put_alternatives(b, node);
+        } else {
+            put(b, "(?:");
+            put_alternatives(b, node);
+            put(b, ")");
+        }
+        put(b, "?");
+    } else if (alternative_count(node) > 1) {
+        put(b, "(?:");
+        put_alternatives(b, node);
+        put(b, ")");
+    } else {
+        put_alternatives(b, node);
+    }
+}
+
+static void put_alternatives(builder *b, int node)
+{
+    int first = 1;
+    int leaves = 0;
+    for (int c = trie[node].child; c >= 0; c = trie[c].sibling) {
+        if (is_leaf(c)) {
+            leaves++;
+        } else {
+            put(b, first ? "" : "|");
+            put_char(b, trie[c].ch);
+            put_tail(b, c);
+            first = 0;
+        }
+    }
+    if (leaves) {
+        put(b, first ? "" : "|");
+        put(b, leaves > 1 ? "[" : "");
+        for (int c = trie[node].child; c >= 0; c = trie[c].sibling) {
+            if (is_leaf(c)) {
+                put_char(b, trie[c].ch);
+            }
+        }
+        put(b, leaves > 1 ? "]" : "");
+    }
+}
+
+int mnemonic_factored_pattern(const char **mnemonics, int count, char *buf, int size)
+{
+    builder b = { buf, size, 0 };
+    trie_size = 0;
+    trie_new_node('\0', -1);
+    for (int i = 0; i < count; i++) {
+        if (trie_insert(mnemonics[i]) < 0) {
+            return -1;
+        }
+    }
+    put_alternatives(&b, 0);
+    if (b.len >= size) {
+        return -1;
+    }
+    buf[b.len] = '\0';
+    return b.len;
+}
+
+static int set_add(strset *set, const char *s, int len)
+{
+    if (len >= MAX_EXPANDED_SIZE) {
+        return -1;
+    }
+    if (set->count == set->size) {
+        int size = set->size ? 2*set->size : 16;
+        void *items = realloc(set->items, size * sizeof(*set->items));
+        if (!items) {
+            return -1;
+        }
+        set->items = items;
+        set->size = size;
+    }
+    memset(set->items[set->count], 0, sizeof(*set->items));
+    memcpy(set->items[set->count], s, len);
+    set->count++;
+    return 0;
+}
+
+static int set_concat(strset *a, const strset *b)
+{
+    strset result = { 0, 0, 0 };
+    char tmp[2*MAX_EXPANDED_SIZE];
+    for (int i = 0; i < a->count; i++) {
+        for (int j = 0; j < b->count; j++) {
+            int len1 = strlen(a->items[i]);
+            int len2 = strlen(b->items[j]);
+            memcpy(tmp, a->items[i], len1);
+            memcpy(tmp + len1, b->items[j], len2);
+            if (set_add(&result, tmp, len1 + len2)) {
+                free(result.items);
+                return -1;
+            }
+        }
+    }
+    free(a->items);
+    *a = result;
+    return 0;
+}
+
+static int compare_items(const void *a, const void *b)
+{
+    return strcmp((const char *) a, (const char *) b);
+}
+
+static void set_normalize(strset *set)
+{
+    int n = 0;
+    qsort(set->items, set->count, sizeof(*set->items), compare_items);
+    for (int i = 0; i < set->count; i++) {
+        if (n == 0 || strcmp(set->items[n - 1], set->items[i]) != 0) {
+            memmove(set->items[n++], set->items[i], sizeof(*set->items));
+        }
+    }
+    set->count = n;
+}
+
+static int expand_alternation(const char **p, strset *set);
+
+static int expand_atom(const char **p, strset *set)
+{
+    char ch;
+    switch (**p) {
+        case '(':
+            if (strncmp(*p, "(?:", 3) != 0) {
+                return -1;
+            }
+            *p += 3;
+            if (expand_alternation(p, set) || **p != ')') {
+                return -1;
+            }
+            (*p)++;
+            return 0;
+        case '[':
+            (*p)++;
+            while (**p && **p != ']') {
+                if (**p == '\\') {
+                    (*p)++;
+                }
+                ch = **p;
+                if (!ch || set_add(set, &ch, 1)) {
+                    return -1;
+                }
+                (*p)++;
+            }
+            if (**p != ']') {
+                return -1;
+            }
+            (*p)++;
+            return 0;
+        case '\\':
+            (*p)++;
+            // fall through
+        default:
+            ch = **p;
+            if (!ch || set_add(set, &ch, 1)) {
+                return -1;
+            }
+            (*p)++;
+            return 0;
+    }
+}
+
+static int expand_sequence(const char **p, strset *set)
+{
+    if (set_add(set, "", 0)) {
+        return -1;
+    }
+    while (**p && **p != '|' && **p != ')') {
+        strset atom = { 0, 0, 0 };
+        int rc = expand_atom(p, &atom);
+        if (rc == 0 && **p == '?') {
+            (*p)++;
+            rc = set_add(&atom, "", 0);
+        }
+        if (rc == 0) {
+            rc = set_concat(set, &atom);
+        }
+        free(atom.items);
+        if (rc) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int expand_alternation(const char **p, strset *set)
+{
+    for (;;) {
+        strset sequence = { 0, 0, 0 };
+        int rc = expand_sequence(p, &sequence);
+        for (int i = 0; i < sequence.count && rc == 0; i++) {
+            rc = set_add(set, sequence.items[i], strlen(sequence.items[i]));
+        }
+        free(sequence.items);
+        if (rc) {
+            return -1;
+        }
+        if (**p != '|') {
+            return 0;
+        }
+        (*p)++;
+    }
+}
+
+int mnemonic_pattern_accepts(const char *pattern, const char **mnemonics, int count)
+{
+    strset accepted = { 0, 0, 0 };
+    strset expected = { 0, 0, 0 };
+    const char *p = pattern;
+    int rc = expand_alternation(&p, &accepted);
+    if (rc == 0 && *p) {
+        rc = -1;
+    }
+    for (int i = 0; i < count && rc == 0; i++) {
+        rc = set_add(&expected, mnemonics[i], strlen(mnemonics[i]));
+    }
+    if (rc == 0) {
+        set_normalize(&accepted);
+        set_normalize(&expected);
+        rc = (accepted.count == expected.count) &&
+             (memcmp(accepted.items, expected.items, accepted.count * sizeof(*accepted.items)) == 0);
+    }
+    free(accepted.items);
+    free(expected.items);
+    return rc;
+}
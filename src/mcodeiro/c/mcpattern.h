@@ -0,0 +1,24 @@
+#if !defined(__MCPATTERN_H__)
+#define __MCPATTERN_H__
+
+// Regular expression patterns for lists of mnemonics.
+//
+// The flat pattern is an alternation of all mnemonics, sorted longest
+// first. The factored pattern is built from a prefix trie, e.g. the
+// mnemonics C=C+1, C=C+A and C=C+C become C=C\+[1AC]. Alternatives of a
+// trie node always start with different characters and optional tails
+// are greedy, so the factored pattern matches the longest mnemonic just
+// like the flat one.
+
+const char *mnemonic_to_pattern(const char *mnemonic, char *pattern);
+
+// Writes the factored pattern into buf. Returns its length or -1 if buf
+// is too small.
+int mnemonic_factored_pattern(const char **mnemonics, int count, char *buf, int size);
+
+// Expands a pattern that uses only literals, escapes, character classes,
+// (?:...) groups and the ? quantifier. Returns 1 if the pattern accepts
+// exactly the given mnemonics, 0 if not and -1 if it cannot be parsed.
+int mnemonic_pattern_accepts(const char *pattern, const char **mnemonics, int count);
+
+#endif // !defined(__MCPATTERN_H__)
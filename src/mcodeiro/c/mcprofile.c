@@ -0,0 +1,265 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcgrammar.h"
+#include "mcregex.h"
+#include "mcprofile.h"
+
+#define READ_SIZE   (1 << 16)
+
+struct profile_t {
+    grammar *g;
+    grammar_context *main;
+    mcregex *regex[MAX_CONTEXTS];           // per context, the pattern or start pattern
+    mcregex *regex_end[MAX_CONTEXTS];       // per CONTEXT_PUSH context
+    int count;                              // includes of main
+    unsigned long long first[MAX_CONTEXT_INCLUDES];
+    unsigned long long unmatched;           // positions where no include matches
+    unsigned long long lines;
+};
+
+typedef struct profile_t profile;
+
+static int context_index(const profile *pf, const char *name)
+{
+    grammar_context *ctx = grammar_find(pf->g, name);
+    return ctx ? (int) (ctx - pf->g->contexts) : -1;
+}
+
+static mcregex *compile(const grammar_context *ctx, const char *regex)
+{
+    const char *error;
+    mcregex *re = mcregex_compile(regex, &error);
+    if (!re) {
+        fprintf(stderr, "mcodeiro: cannot profile pattern of %s: %s\n", ctx->name, error);
+    }
+    return re;
+}
+
+static int compile_contexts(profile *pf)
+{
+    for (int i = 0; i < pf->g->count; i++) {
+        grammar_context *ctx = &pf->g->contexts[i];
+        if (ctx->regex && !(pf->regex[i] = compile(ctx, ctx->regex))) {
+            return -1;
+        }
+        if (ctx->regex_end && !(pf->regex_end[i] = compile(ctx, ctx->regex_end))) {
+            return -1;
+        }
+        for (int k = 0; ctx->includes[k]; k++) {
+            int n = context_index(pf, ctx->includes[k]);
+            if (n < 0 || !pf->g->contexts[n].regex) {
+                fprintf(stderr, "mcodeiro: cannot profile include %s of %s\n", ctx->includes[k], ctx->name);
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+// Lexes one line like a backtracking engine and counts the first
+// matches of the main context.
+static void profile_line(profile *pf, const char *line, size_t len)
+{
+    const grammar_context *ctx = pf->main;
+    size_t pos = 0;
+    pf->lines++;
+    while (pos < len) {
+        int prev = pos ? (unsigned char) line[pos - 1] : -1;
+        int ch = (unsigned char) line[pos];
+        const grammar_context *push = NULL;
+        long matched = -1;
+        int rank = -1;
+        int n = (int) (ctx - pf->g->contexts);
+
+        if (ctx->type == CONTEXT_PUSH) {
+            if (pf->regex_end[n]->first[ch] &&
+                (matched = mcregex_match(pf->regex_end[n], line + pos, len - pos, prev)) >= 0) {
+                ctx = pf->main;
+                pos += matched ? matched : 1;
+                continue;
+            }
+        }
+        for (int i = 0; ctx->includes[i]; i++) {
+            int k = context_index(pf, ctx->includes[i]);
+            if (!pf->regex[k]->first[ch]) {
+                continue;
+            }
+            matched = mcregex_match(pf->regex[k], line + pos, len - pos, prev);
+            if (matched >= 0) {
+                rank = i;
+                if (pf->g->contexts[k].type == CONTEXT_PUSH || pf->g->contexts[k].type == CONTEXT_PUSH_EOL) {
+                    push = &pf->g->contexts[k];
+                }
+                break;
+            }
+        }
+        if (ctx == pf->main) {
+            if (rank >= 0) {
+                pf->first[rank]++;
+            } else {
+                pf->unmatched++;
+            }
+        }
+        if (push) {
+            ctx = push;
+        }
+        pos += (matched > 0) ? (size_t) matched : (push ? 0 : 1);
+    }
+}
+
+static int profile_file(profile *pf, const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    char *text = NULL;
+    size_t len = 0;
+    size_t n;
+    if (!file) {
+        perror(path);
+        return -1;
+    }
+    do {
+        char *tmp = realloc(text, len + READ_SIZE);
+        if (!tmp) {
+            free(text);
+            fclose(file);
+            return -1;
+        }
+        text = tmp;
+        n = fread(text + len, 1, READ_SIZE, file);
+        len += n;
+    } while (n > 0);
+    fclose(file);
+
+    const char *p = text;
+    const char *end = text + len;
+    while (p < end) {
+        const char *nl = memchr(p, '\n', end - p);
+        const char *eol = nl ? nl : end;
+        size_t line_len = eol - p;
+        if (line_len > 0 && p[line_len - 1] == '\r') {
+            line_len--;
+        }
+        profile_line(pf, p, line_len);
+        p = nl ? nl + 1 : end;
+    }
+    free(text);
+    return 0;
+}
+
+static unsigned long long attempts(const profile *pf, const int *order)
+{
+    unsigned long long total = pf->unmatched * pf->count;
+    for (int i = 0; i < pf->count; i++) {
+        total += pf->first[order[i]] * (i + 1);
+    }
+    return total;
+}
+
+// Sorts the includes by their counts, but never moves an include before
+// one that it overlaps with and that comes first today.
+static void order_includes(const profile *pf, unsigned char overlap[][MAX_CONTEXT_INCLUDES], int *order)
+{
+    int placed[MAX_CONTEXT_INCLUDES] = { 0 };
+    for (int rank = 0; rank < pf->count; rank++) {
+        int best = -1;
+        for (int i = 0; i < pf->count; i++) {
+            int ready = !placed[i];
+            for (int j = 0; j < i && ready; j++) {
+                ready = placed[j] || !overlap[j][i];
+            }
+            if (ready && (best < 0 || pf->first[i] > pf->first[best])) {
+                best = i;
+            }
+        }
+        placed[best] = 1;
+        order[rank] = best;
+    }
+}
+
+static double per_position(unsigned long long n, unsigned long long positions)
+{
+    return positions ? (double) n / positions : 0.0;
+}
+
+int profile_main_includes(grammar *g, const char *main, const char **files, int count, FILE *report)
+{
+    profile pf;
+    unsigned char overlap[MAX_CONTEXT_INCLUDES][MAX_CONTEXT_INCLUDES];
+    int old_order[MAX_CONTEXT_INCLUDES];
+    int order[MAX_CONTEXT_INCLUDES];
+    const char *names[MAX_CONTEXT_INCLUDES];
+    int rc = 0;
+
+    memset(&pf, 0, sizeof(pf));
+    pf.g = g;
+    pf.main = grammar_find(g, main);
+    if (!pf.main) {
+        fprintf(stderr, "mcodeiro: no context %s\n", main);
+        return -1;
+    }
+    pf.count = grammar_count(pf.main->includes);
+    rc = compile_contexts(&pf);
+    for (int i = 0; rc == 0 && i < count; i++) {
+        rc = profile_file(&pf, files[i]);
+    }
+
+    if (rc == 0) {
+        unsigned long long positions = pf.unmatched;
+        for (int i = 0; i < pf.count; i++) {
+            positions += pf.first[i];
+            old_order[i] = i;
+        }
+        for (int i = 0; i < pf.count; i++) {
+            for (int j = i + 1; j < pf.count; j++) {
+                int a = context_index(&pf, pf.main->includes[i]);
+                int b = context_index(&pf, pf.main->includes[j]);
+                int r = mcregex_overlap(pf.regex[a], pf.regex[b]);
+                if (r < 0) {
+                    fprintf(report, "mcodeiro: cannot decide if %s and %s overlap, keeping their order\n",
+                        pf.main->includes[i], pf.main->includes[j]);
+                }
+                overlap[i][j] = overlap[j][i] = (r != 0);
+            }
+        }
+        order_includes(&pf, overlap, order);
+
+        fprintf(report, "mcodeiro: %d files, %llu lines, %llu positions lexed by %s\n",
+            count, pf.lines, positions, main);
+        fprintf(report, "    %-24s %10s %7s %4s %4s\n", "include", "first", "share", "old", "new");
+        for (int rank = 0; rank < pf.count; rank++) {
+            int i = order[rank];
+            fprintf(report, "    %-24s %10llu %6.1f%% %4d %4d\n", pf.main->includes[i],
+                pf.first[i], 100.0 * per_position(pf.first[i], positions), i + 1, rank + 1);
+        }
+        fprintf(report, "    %-24s %10llu %6.1f%%\n", "(none)", pf.unmatched,
+            100.0 * per_position(pf.unmatched, positions));
+        for (int i = 0; i < pf.count; i++) {
+            for (int j = i + 1; j < pf.count; j++) {
+                if (overlap[i][j] && pf.first[j] > pf.first[i]) {
+                    fprintf(report, "mcodeiro: keeping %s before %s, their patterns overlap\n",
+                        pf.main->includes[i], pf.main->includes[j]);
+                }
+            }
+        }
+        unsigned long long before = attempts(&pf, old_order);
+        unsigned long long after = attempts(&pf, order);
+        fprintf(report, "mcodeiro: regex attempts in %s %llu -> %llu (%.1f -> %.1f per position, %+.1f%%)\n",
+            main, before, after, per_position(before, positions), per_position(after, positions),
+            before ? 100.0 * ((double) after - before) / before : 0.0);
+
+        for (int rank = 0; rank < pf.count; rank++) {
+            names[rank] = pf.main->includes[order[rank]];
+        }
+        for (int rank = 0; rank < pf.count; rank++) {
+            pf.main->includes[rank] = names[rank];
+        }
+    }
+
+    for (int i = 0; i < g->count; i++) {
+        mcregex_free(pf.regex[i]);
+        mcregex_free(pf.regex_end[i]);
+    }
+    return rc;
+}
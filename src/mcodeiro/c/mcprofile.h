@@ -0,0 +1,27 @@
+#if !defined(__MCPROFILE_H__)
+#define __MCPROFILE_H__
+
+#include <stdio.h>
+
+#include "mcgrammar.h"
+
+// Profile-guided ordering of the main context includes.
+//
+// A backtracking engine tries the includes of the main context in order
+// at every position the main context lexes, so the attempts per
+// position are the rank of the first include that matches, or all of
+// them if none does. The profile lexes a corpus with the grammar,
+// counts which include matches first, and sorts the includes by these
+// counts.
+//
+// Two includes may only swap if no position of any line is matched by
+// both patterns; this is decided on the patterns, not on the corpus.
+// Then every position is lexed as before. Includes that overlap keep
+// their order, and the pairs that would have moved are reported.
+
+// Lexes the files, reorders the includes of the main context and writes
+// a report. Returns 0, or -1 if a file cannot be read or a pattern
+// cannot be compiled.
+int profile_main_includes(grammar *g, const char *main, const char **files, int count, FILE *report);
+
+#endif // !defined(__MCPROFILE_H__)
@@ -0,0 +1,856 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcintern.h"
+#include "mcregex.h"
+
+#define NODE_EMPTY          0
+#define NODE_SET            1
+#define NODE_CONCAT         2
+#define NODE_ALTERNATE      3
+#define NODE_REPEAT         4
+#define NODE_BOUNDARY       5
+
+#define MAX_REPEAT          1000
+#define MAX_OVERLAP_STATES  (1 << 18)
+
+struct node_t {
+    int type;
+    int left;           // operand of NODE_REPEAT, set of NODE_SET
+    int right;
+    int min;
+    int max;            // -1 for no limit
+};
+
+struct parser_t {
+    const char *p;
+    const char *error;
+    struct node_t *nodes;
+    int node_count;
+    int node_size;
+    mcregex *re;
+    int code_size;
+    int set_size;
+};
+
+typedef struct node_t node;
+typedef struct parser_t parser;
+
+int mcregex_is_word(int ch)
+{
+    return (ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'Z') ||
+           (ch >= 'a' && ch <= 'z') || ch == '_' || ch >= 0x80;
+}
+
+int mcregex_in_set(const mcregex *re, int set, int ch)
+{
+    return (re->sets[set][ch >> 3] >> (ch & 7)) & 1;
+}
+
+static void set_add(unsigned char *set, int ch)
+{
+    set[ch >> 3] |= 1 << (ch & 7);
+}
+
+static void set_invert(unsigned char *set)
+{
+    for (int i = 0; i < RE_SET_SIZE; i++) {
+        set[i] = ~set[i];
+    }
+}
+
+static int new_node(parser *ps, int type, int left, int right)
+{
+    if (ps->node_count == ps->node_size) {
+        int size = ps->node_size ? 2 * ps->node_size : 256;
+        node *nodes = realloc(ps->nodes, size * sizeof(node));
+        if (!nodes) {
+            ps->error = "out of memory";
+            return -1;
+        }
+        ps->nodes = nodes;
+        ps->node_size = size;
+    }
+    ps->nodes[ps->node_count].type = type;
+    ps->nodes[ps->node_count].left = left;
+    ps->nodes[ps->node_count].right = right;
+    ps->nodes[ps->node_count].min = 0;
+    ps->nodes[ps->node_count].max = 0;
+    return ps->node_count++;
+}
+
+static unsigned char *new_set(parser *ps, int *index)
+{
+    mcregex *re = ps->re;
+    if (re->set_count == ps->set_size) {
+        int size = ps->set_size ? 2 * ps->set_size : 256;
+        unsigned char (*sets)[RE_SET_SIZE] = realloc(re->sets, size * RE_SET_SIZE);
+        if (!sets) {
+            ps->error = "out of memory";
+            return NULL;
+        }
+        re->sets = sets;
+        ps->set_size = size;
+    }
+    *index = re->set_count++;
+    memset(re->sets[*index], 0, RE_SET_SIZE);
+    return re->sets[*index];
+}
+
+// Returns the character of an escape that stands for one character, or
+// -1 if it does not.
+static int escape_char(int ch)
+{
+    switch (ch) {
+        case 'n':
+            return '\n';
+        case 'r':
+            return '\r';
+        case 't':
+            return '\t';
+        case 'f':
+            return '\f';
+        case 'v':
+            return '\v';
+        default:
+            if (!ch || (ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z')) {
+                return -1;
+            }
+            return ch;
+    }
+}
+
+// Adds the characters of an escape to set. Returns 0 if the escape is
+// not a character or class, like \b.
+static int escape_set(int ch, unsigned char *set)
+{
+    unsigned char tmp[RE_SET_SIZE];
+    int invert = 0;
+    memset(tmp, 0, sizeof(tmp));
+    switch (ch) {
+        case 'D':
+            invert = 1;
+            // fall through
+        case 'd':
+            for (int c = '0'; c <= '9'; c++) {
+                set_add(tmp, c);
+            }
+            break;
+        case 'S':
+            invert = 1;
+            // fall through
+        case 's':
+            set_add(tmp, ' ');
+            set_add(tmp, '\t');
+            set_add(tmp, '\n');
+            set_add(tmp, '\r');
+            set_add(tmp, '\f');
+            set_add(tmp, '\v');
+            break;
+        case 'W':
+            invert = 1;
+            // fall through
+        case 'w':
+            for (int c = 0; c < 256; c++) {
+                if (mcregex_is_word(c)) {
+                    set_add(tmp, c);
+                }
+            }
+            break;
+        default:
+            ch = escape_char(ch);
+            if (ch < 0) {
+                return 0;   // \b, anchors and back references
+            }
+            set_add(tmp, ch);
+            break;
+    }
+    if (invert) {
+        set_invert(tmp);
+    }
+    for (int i = 0; i < RE_SET_SIZE; i++) {
+        set[i] |= tmp[i];
+    }
+    return 1;
+}
+
+static int parse_class(parser *ps)
+{
+    int index;
+    int invert = 0;
+    unsigned char *set = new_set(ps, &index);
+    if (!set) {
+        return -1;
+    }
+    ps->p++;
+    if (*ps->p == '^') {
+        invert = 1;
+        ps->p++;
+    }
+    int first = 1;
+    while (*ps->p && (*ps->p != ']' || first)) {
+        int lo = (unsigned char) *ps->p++;
+        first = 0;
+        if (lo == '\\') {
+            int ch = (unsigned char) *ps->p++;
+            if (ch && strchr("dDsSwW", ch)) {
+                escape_set(ch, set);
+                continue;
+            }
+            lo = escape_char(ch);
+            if (lo < 0) {
+                ps->error = "unsupported escape in class";
+                return -1;
+            }
+        }
+        if (ps->p[0] == '-' && ps->p[1] && ps->p[1] != ']') {
+            int hi = (unsigned char) ps->p[1];
+            ps->p += 2;
+            if (hi == '\\') {
+                hi = escape_char((unsigned char) *ps->p++);
+            }
+            if (hi < lo) {
+                ps->error = "bad range";
+                return -1;
+            }
+            for (int c = lo; c <= hi; c++) {
+                set_add(set, c);
+            }
+        } else {
+            set_add(set, lo);
+        }
+    }
+    if (*ps->p != ']') {
+        ps->error = "missing ]";
+        return -1;
+    }
+    ps->p++;
+    if (invert) {
+        set_invert(set);
+    }
+    return new_node(ps, NODE_SET, index, 0);
+}
+
+static int parse_alternation(parser *ps);
+
+static int parse_atom(parser *ps)
+{
+    int index;
+    unsigned char *set;
+    int ch = (unsigned char) *ps->p;
+    switch (ch) {
+        case '(': {
+            int inner;
+            ps->p++;
+            if (ps->p[0] == '?') {
+                if (ps->p[1] != ':') {
+                    ps->error = "unsupported group";
+                    return -1;
+                }
+                ps->p += 2;
+            }
+            inner = parse_alternation(ps);
+            if (inner < 0) {
+                return -1;
+            }
+            if (*ps->p != ')') {
+                ps->error = "missing )";
+                return -1;
+            }
+            ps->p++;
+            return inner;
+        }
+        case '[':
+            return parse_class(ps);
+        case '^':
+        case '$':
+            ps->error = "unsupported anchor";
+            return -1;
+        case '\\':
+            ch = (unsigned char) ps->p[1];
+            if (ch == 'b') {
+                ps->p += 2;
+                return new_node(ps, NODE_BOUNDARY, 0, 0);
+            }
+            set = new_set(ps, &index);
+            if (!set) {
+                return -1;
+            }
+            if (!ch || !escape_set(ch, set)) {
+                ps->error = "unsupported escape";
+                return -1;
+            }
+            ps->p += 2;
+            return new_node(ps, NODE_SET, index, 0);
+        case '.':
+            set = new_set(ps, &index);
+            if (!set) {
+                return -1;
+            }
+            memset(set, 0xff, RE_SET_SIZE);
+            set['\n' >> 3] &= ~(1 << ('\n' & 7));
+            ps->p++;
+            return new_node(ps, NODE_SET, index, 0);
+        default:
+            set = new_set(ps, &index);
+            if (!set) {
+                return -1;
+            }
+            set_add(set, ch);
+            ps->p++;
+            return new_node(ps, NODE_SET, index, 0);
+    }
+}
+
+static int parse_number(parser *ps)
+{
+    int n = 0;
+    if (*ps->p < '0' || *ps->p > '9') {
+        return -1;
+    }
+    while (*ps->p >= '0' && *ps->p <= '9' && n <= MAX_REPEAT) {
+        n = 10 * n + *ps->p++ - '0';
+    }
+    return n;
+}
+
+static int parse_repeat(parser *ps)
+{
+    int atom = parse_atom(ps);
+    while (atom >= 0 && *ps->p && strchr("?*+{", *ps->p)) {
+        int min = 0;
+        int max = -1;
+        switch (*ps->p++) {
+            case '?':
+                max = 1;
+                break;
+            case '+':
+                min = 1;
+                break;
+            case '{':
+                min = parse_number(ps);
+                max = min;
+                if (*ps->p == ',') {
+                    ps->p++;
+                    max = (*ps->p == '}') ? -1 : parse_number(ps);
+                }
+                if (min < 0 || min > MAX_REPEAT || max > MAX_REPEAT || *ps->p != '}' ||
+                    (max >= 0 && max < min)) {
+                    ps->error = "bad repetition";
+                    return -1;
+                }
+                ps->p++;
+                break;
+        }
+        if (*ps->p == '?' || *ps->p == '+') {
+            ps->error = "unsupported lazy or possessive quantifier";
+            return -1;
+        }
+        int n = new_node(ps, NODE_REPEAT, atom, 0);
+        if (n >= 0) {
+            ps->nodes[n].min = min;
+            ps->nodes[n].max = max;
+        }
+        atom = n;
+    }
+    return atom;
+}
+
+static int parse_concatenation(parser *ps)
+{
+    int left = -1;
+    while (*ps->p && *ps->p != '|' && *ps->p != ')') {
+        int right = parse_repeat(ps);
+        if (right < 0) {
+            return -1;
+        }
+        left = (left < 0) ? right : new_node(ps, NODE_CONCAT, left, right);
+        if (left < 0) {
+            return -1;
+        }
+    }
+    return left < 0 ? new_node(ps, NODE_EMPTY, 0, 0) : left;
+}
+
+static int parse_alternation(parser *ps)
+{
+    int left = parse_concatenation(ps);
+    if (left >= 0 && *ps->p == '|') {
+        ps->p++;
+        int right = parse_alternation(ps);
+        return right < 0 ? -1 : new_node(ps, NODE_ALTERNATE, left, right);
+    }
+    return left;
+}
+
+static int emit(parser *ps, int op, int x, int y)
+{
+    mcregex *re = ps->re;
+    if (re->count == ps->code_size) {
+        int size = ps->code_size ? 2 * ps->code_size : 1024;
+        mcregex_inst *code = realloc(re->code, size * sizeof(mcregex_inst));
+        if (!code) {
+            ps->error = "out of memory";
+            return -1;
+        }
+        re->code = code;
+        ps->code_size = size;
+    }
+    re->code[re->count].op = op;
+    re->code[re->count].x = x;
+    re->code[re->count].y = y;
+    return re->count++;
+}
+
+static int compile_node(parser *ps, int n)
+{
+    node *nd = &ps->nodes[n];
+    int split;
+    int jmp;
+    switch (nd->type) {
+        case NODE_EMPTY:
+            return 0;
+        case NODE_SET:
+            return emit(ps, RE_SET, nd->left, 0) < 0 ? -1 : 0;
+        case NODE_BOUNDARY:
+            return emit(ps, RE_BOUNDARY, 0, 0) < 0 ? -1 : 0;
+        case NODE_CONCAT:
+            return (compile_node(ps, nd->left) < 0 || compile_node(ps, nd->right) < 0) ? -1 : 0;
+        case NODE_ALTERNATE:
+            split = emit(ps, RE_SPLIT, 0, 0);
+            if (split < 0 || compile_node(ps, nd->left) < 0) {
+                return -1;
+            }
+            jmp = emit(ps, RE_JMP, 0, 0);
+            if (jmp < 0) {
+                return -1;
+            }
+            ps->re->code[split].x = split + 1;
+            ps->re->code[split].y = ps->re->count;
+            if (compile_node(ps, nd->right) < 0) {
+                return -1;
+            }
+            ps->re->code[jmp].x = ps->re->count;
+            return 0;
+        case NODE_REPEAT: {
+            int min = nd->min;
+            int max = nd->max;
+            int operand = nd->left;
+            for (int i = 0; i < min; i++) {
+                if (compile_node(ps, operand) < 0) {
+                    return -1;
+                }
+            }
+            if (max < 0) {
+                split = emit(ps, RE_SPLIT, 0, 0);
+                if (split < 0 || compile_node(ps, operand) < 0 || emit(ps, RE_JMP, split, 0) < 0) {
+                    return -1;
+                }
+                ps->re->code[split].x = split + 1;
+                ps->re->code[split].y = ps->re->count;
+                return 0;
+            }
+            // x{0,n} is (?:x(?:x...)?)? with all optional parts ending
+            // at the same place
+            int splits[MAX_REPEAT];
+            int count = 0;
+            for (int i = min; i < max; i++) {
+                splits[count] = emit(ps, RE_SPLIT, 0, 0);
+                if (splits[count] < 0 || compile_node(ps, operand) < 0) {
+                    return -1;
+                }
+                ps->re->code[splits[count]].x = splits[count] + 1;
+                count++;
+            }
+            for (int i = 0; i < count; i++) {
+                ps->re->code[splits[i]].y = ps->re->count;
+            }
+            return 0;
+        }
+    }
+    return -1;
+}
+
+// Follows the control flow from pc. Positions of RE_SET and RE_MATCH
+// are added to list in priority order. Word boundaries are decided by
+// prev_word and next_word, or pass if next_word is -1.
+static void add_thread(const mcregex *re, int *list, int *count, int *mark, int gen,
+    int pc, int prev_word, int next_word)
+{
+    if (mark[pc] == gen) {
+        return;
+    }
+    mark[pc] = gen;
+    switch (re->code[pc].op) {
+        case RE_JMP:
+            add_thread(re, list, count, mark, gen, re->code[pc].x, prev_word, next_word);
+            break;
+        case RE_SPLIT:
+            add_thread(re, list, count, mark, gen, re->code[pc].x, prev_word, next_word);
+            add_thread(re, list, count, mark, gen, re->code[pc].y, prev_word, next_word);
+            break;
+        case RE_BOUNDARY:
+            if (next_word < 0 || prev_word != next_word) {
+                add_thread(re, list, count, mark, gen, pc + 1, prev_word, next_word);
+            }
+            break;
+        default:
+            list[(*count)++] = pc;
+            break;
+    }
+}
+
+static void compute_first(mcregex *re)
+{
+    int *list = re->scratch;
+    int *mark = re->scratch + 2 * re->count;
+    int count = 0;
+    memset(re->first, 0, sizeof(re->first));
+    re->nullable = 0;
+    add_thread(re, list, &count, mark, ++re->generation, 0, 0, -1);
+    for (int i = 0; i < count; i++) {
+        const mcregex_inst *in = &re->code[list[i]];
+        if (in->op == RE_MATCH) {
+            re->nullable = 1;
+            memset(re->first, 1, sizeof(re->first));
+        } else {
+            for (int ch = 0; ch < 256; ch++) {
+                re->first[ch] |= mcregex_in_set(re, in->x, ch);
+            }
+        }
+    }
+}
+
+mcregex *mcregex_compile(const char *pattern, const char **error)
+{
+    return mcregex_compile_set(&pattern, 1, error);
+}
+
+mcregex *mcregex_compile_set(const char **patterns, int count, const char **error)
+{
+    parser ps;
+    memset(&ps, 0, sizeof(ps));
+    ps.re = calloc(1, sizeof(mcregex));
+    if (!ps.re) {
+        *error = "out of memory";
+        return NULL;
+    }
+    for (int i = 0; i < count && !ps.error; i++) {
+        int split = -1;
+        int root;
+        ps.p = patterns[i];
+        ps.node_count = 0;
+        root = parse_alternation(&ps);
+        if (root >= 0 && *ps.p) {
+            ps.error = "unbalanced )";
+        }
+        if (ps.error) {
+            break;
+        }
+        if (i + 1 < count && (split = emit(&ps, RE_SPLIT, 0, 0)) >= 0) {
+            ps.re->code[split].x = split + 1;
+        }
+        if (compile_node(&ps, root) < 0 || emit(&ps, RE_MATCH, i, 0) < 0) {
+            break;
+        }
+        if (split >= 0) {
+            ps.re->code[split].y = ps.re->count;
+        }
+    }
+    free(ps.nodes);
+    if (ps.error) {
+        *error = ps.error;
+        mcregex_free(ps.re);
+        return NULL;
+    }
+    ps.re->scratch = calloc(3 * ps.re->count, sizeof(int));
+    if (!ps.re->scratch) {
+        *error = "out of memory";
+        mcregex_free(ps.re);
+        return NULL;
+    }
+    compute_first(ps.re);
+    return ps.re;
+}
+
+void mcregex_free(mcregex *re)
+{
+    if (re) {
+        free(re->code);
+        free(re->sets);
+        free(re->scratch);
+        free(re);
+    }
+}
+
+static void next_generation(mcregex *re)
+{
+    if (++re->generation == 0) {
+        memset(re->scratch + 2 * re->count, 0, re->count * sizeof(int));
+        re->generation = 1;
+    }
+}
+
+int mcregex_closure(mcregex *re, const int *pcs, int n, int prev_word, int next_word, int *out)
+{
+    int count = 0;
+    next_generation(re);
+    for (int i = 0; i < n; i++) {
+        add_thread(re, out, &count, re->scratch + 2 * re->count, re->generation, pcs[i], prev_word, next_word);
+    }
+    return count;
+}
+
+long mcregex_match(mcregex *re, const char *s, size_t n, int prev)
+{
+    return mcregex_match_set(re, s, n, prev, NULL);
+}
+
+long mcregex_match_set(mcregex *re, const char *s, size_t n, int prev, int *which)
+{
+    int *clist = re->scratch;
+    int *nlist = re->scratch + re->count;
+    int *mark = re->scratch + 2 * re->count;
+    int ccount = 0;
+    long matched = -1;
+    int prev_word = prev >= 0 && mcregex_is_word(prev);
+
+    next_generation(re);
+    add_thread(re, clist, &ccount, mark, re->generation, 0, prev_word,
+        n > 0 ? mcregex_is_word((unsigned char) s[0]) : 0);
+    for (size_t pos = 0; ccount > 0; pos++) {
+        int ch = pos < n ? (unsigned char) s[pos] : -1;
+        int word = ch >= 0 && mcregex_is_word(ch);
+        int next_word = pos + 1 < n ? mcregex_is_word((unsigned char) s[pos + 1]) : 0;
+        int ncount = 0;
+        next_generation(re);
+        for (int i = 0; i < ccount; i++) {
+            const mcregex_inst *in = &re->code[clist[i]];
+            if (in->op == RE_MATCH) {
+                // threads of lower priority are cut
+                matched = pos;
+                if (which) {
+                    *which = in->x;
+                }
+                break;
+            }
+            if (ch >= 0 && mcregex_in_set(re, in->x, ch)) {
+                add_thread(re, nlist, &ncount, mark, re->generation, clist[i] + 1, word, next_word);
+            }
+        }
+        int *tmp = clist;
+        clist = nlist;
+        nlist = tmp;
+        ccount = ncount;
+        if (ch < 0) {
+            break;
+        }
+    }
+    return matched;
+}
+
+// Overlap search
+//
+// Both programs are run on all lines at once. A search state holds the
+// thread positions of each program before following the control flow,
+// or a mark that the program has already matched, and whether the last
+// character was a word character.
+
+struct side_t {
+    const mcregex *re;
+    intern_table sets;
+    int *list;
+    int *mark;
+    int gen;
+    int *next;
+};
+
+typedef struct side_t side;
+
+static int compare_ints(const void *a, const void *b)
+{
+    return *(const int *) a - *(const int *) b;
+}
+
+// Follows the control flow of set id for the next character ch, or the
+// end of the line if ch is -1. Returns 1 if the program matches there.
+// If ch is not -1, *next is set to the id of the positions after ch, or
+// -1 if there are none.
+static int step_side(side *sd, int id, int prev_word, int ch, int *next)
+{
+    const mcregex *re = sd->re;
+    int n;
+    const int *v = intern_get(&sd->sets, id, &n);
+    int count = 0;
+    int ncount = 0;
+    int matched = 0;
+    int next_word = ch >= 0 && mcregex_is_word(ch);
+
+    sd->gen++;
+    for (int i = 0; i < n; i++) {
+        add_thread(re, sd->list, &count, sd->mark, sd->gen, v[i], prev_word, next_word);
+    }
+    for (int i = 0; i < count; i++) {
+        const mcregex_inst *in = &re->code[sd->list[i]];
+        if (in->op == RE_MATCH) {
+            matched = 1;
+        } else if (ch >= 0 && mcregex_in_set(re, in->x, ch)) {
+            sd->next[ncount++] = sd->list[i] + 1;
+        }
+    }
+    if (ch >= 0) {
+        qsort(sd->next, ncount, sizeof(int), compare_ints);
+        int k = 0;
+        for (int i = 0; i < ncount; i++) {
+            if (k == 0 || sd->next[k - 1] != sd->next[i]) {
+                sd->next[k++] = sd->next[i];
+            }
+        }
+        *next = k ? intern_ints(&sd->sets, sd->next, k) : -1;
+    }
+    return matched;
+}
+
+static int init_side(side *sd, const mcregex *re)
+{
+    int start = 0;
+    memset(sd, 0, sizeof(*sd));
+    intern_init(&sd->sets);
+    sd->re = re;
+    sd->list = malloc(re->count * sizeof(int));
+    sd->mark = calloc(re->count, sizeof(int));
+    sd->next = malloc(re->count * sizeof(int));
+    if (!sd->list || !sd->mark || !sd->next) {
+        return -1;
+    }
+    return intern_ints(&sd->sets, &start, 1);
+}
+
+static void free_side(side *sd)
+{
+    free(sd->list);
+    free(sd->mark);
+    free(sd->next);
+    intern_free(&sd->sets);
+}
+
+// States are encoded as (a + 2) * 2^32 + (b + 2) * 2 + prev_word, where
+// a and b are set ids, -1 for matched.
+struct state_table_t {
+    unsigned long long *keys;
+    int count;
+    int size;
+};
+
+typedef struct state_table_t state_table;
+
+static int visit(state_table *t, unsigned long long key)
+{
+    if (4 * (t->count + 1) > 3 * t->size) {
+        int size = t->size ? 2 * t->size : 4096;
+        unsigned long long *keys = calloc(size, sizeof(unsigned long long));
+        if (!keys) {
+            return -1;
+        }
+        for (int i = 0; i < t->size; i++) {
+            if (t->keys[i]) {
+                unsigned long long h = t->keys[i] * 0x9e3779b97f4a7c15ULL;
+                int j = (int) (h >> 40) & (size - 1);
+                while (keys[j]) {
+                    j = (j + 1) & (size - 1);
+                }
+                keys[j] = t->keys[i];
+            }
+        }
+        free(t->keys);
+        t->keys = keys;
+        t->size = size;
+    }
+    unsigned long long h = key * 0x9e3779b97f4a7c15ULL;
+    int j = (int) (h >> 40) & (t->size - 1);
+    while (t->keys[j]) {
+        if (t->keys[j] == key) {
+            return 0;
+        }
+        j = (j + 1) & (t->size - 1);
+    }
+    t->keys[j] = key;
+    t->count++;
+    return 1;
+}
+
+static unsigned long long state_key(int a, int b, int prev_word)
+{
+    return ((unsigned long long) (a + 2) << 32) | ((unsigned long long) (b + 2) << 1) | prev_word;
+}
+
+int mcregex_overlap(const mcregex *a, const mcregex *b)
+{
+    side sa;
+    side sb;
+    state_table visited = { 0, 0, 0 };
+    unsigned long long *queue = NULL;
+    int head = 0;
+    int tail = 0;
+    int result = 0;
+
+    // quick answer if no character starts both
+    int common = 0;
+    for (int ch = 0; ch < 256; ch++) {
+        common |= (ch != '\n' && a->first[ch] && b->first[ch]);
+    }
+    if (!common && !a->nullable && !b->nullable) {
+        return 0;
+    }
+
+    int start_a = init_side(&sa, a);
+    int start_b = init_side(&sb, b);
+    queue = malloc(MAX_OVERLAP_STATES * sizeof(unsigned long long));
+    if (start_a < 0 || start_b < 0 || !queue) {
+        result = -1;
+        goto done;
+    }
+    for (int word = 0; word < 2; word++) {
+        unsigned long long key = state_key(start_a, start_b, word);
+        visit(&visited, key);
+        queue[tail++] = key;
+    }
+    while (head < tail && result == 0) {
+        unsigned long long key = queue[head++];
+        int ia = (int) (key >> 32) - 2;
+        int ib = (int) ((key & 0xffffffffULL) >> 1) - 2;
+        int prev_word = (int) (key & 1);
+        for (int ch = -1; ch < 256 && result == 0; ch++) {
+            int na = -1;
+            int nb = -1;
+            int ma = (ia == -1) || step_side(&sa, ia, prev_word, ch, &na);
+            int mb = (ib == -1) || step_side(&sb, ib, prev_word, ch, &nb);
+            if (ma && mb) {
+                result = 1;
+                break;
+            }
+            if (ch < 0 || ch == '\n') {
+                continue;
+            }
+            na = ma ? -1 : na;
+            nb = mb ? -1 : nb;
+            if ((!ma && na < 0) || (!mb && nb < 0)) {
+                continue;   // one program can no longer match
+            }
+            unsigned long long next = state_key(ma ? -1 : na, mb ? -1 : nb, mcregex_is_word(ch));
+            int added = visit(&visited, next);
+            if (added < 0 || (added && tail == MAX_OVERLAP_STATES)) {
+                result = -1;
+            } else if (added) {
+                queue[tail++] = next;
+            }
+        }
+    }
+
+done:
+    free(queue);
+    free(visited.keys);
+    free_side(&sa);
+    free_side(&sb);
+    return result;
+}
@@ -0,0 +1,75 @@
+#if !defined(__MCREGEX_H__)
+#define __MCREGEX_H__
+
+#include <stddef.h>
+
+// Regular expressions of the grammar.
+//
+// Supports the syntax the grammar uses: literals and escapes, \d, \s, \w
+// and their negations, \b, character classes, '.', capturing and (?:)
+// groups, alternation and the greedy quantifiers ?, *, +, {n}, {m,} and
+// {m,n}. A pattern is compiled into a program for a Pike VM, which finds
+// the same match as a backtracking engine like Oniguruma or Python's re,
+// but in time linear in the length of the input.
+//
+// Like the tokenizer, \b treats bytes from 0x80 up as word characters.
+
+#define RE_SET          0   // consume a character of sets[x]
+#define RE_SPLIT        1   // continue at x, then at y
+#define RE_JMP          2   // continue at x
+#define RE_BOUNDARY     3   // \b
+#define RE_MATCH        4   // pattern x of a set matches
+
+#define RE_SET_SIZE     32  // bytes of a character set
+
+struct mcregex_inst_t {
+    unsigned char op;
+    int x;
+    int y;
+};
+
+struct mcregex_t {
+    struct mcregex_inst_t *code;
+    int count;
+    unsigned char (*sets)[RE_SET_SIZE];
+    int set_count;
+    unsigned char first[256];   // characters that may start a match
+    int nullable;               // matches the empty string
+    int *scratch;               // thread lists of the VM
+    unsigned generation;
+};
+
+typedef struct mcregex_inst_t mcregex_inst;
+typedef struct mcregex_t mcregex;
+
+// Returns NULL and sets *error if the pattern cannot be compiled.
+mcregex *mcregex_compile(const char *pattern, const char **error);
+void mcregex_free(mcregex *re);
+
+// Compiles the alternation of several patterns, where the first pattern
+// that matches wins like in a list of grammar rules.
+mcregex *mcregex_compile_set(const char **patterns, int count, const char **error);
+
+int mcregex_in_set(const mcregex *re, int set, int ch);
+int mcregex_is_word(int ch);
+
+// Matches at the start of s. prev is the character before s, or -1 at
+// the start of a line. Returns the length of the match or -1.
+long mcregex_match(mcregex *re, const char *s, size_t n, int prev);
+
+// Like mcregex_match(), sets *which to the pattern of a set that matched.
+long mcregex_match_set(mcregex *re, const char *s, size_t n, int prev, int *which);
+
+// Follows the control flow from the positions in pcs, in priority order.
+// Word boundaries are decided by prev_word and next_word, or pass if
+// next_word is -1. Writes the positions of RE_SET and RE_MATCH to out in
+// priority order, each once, and returns their number. out must have
+// room for re->count positions.
+int mcregex_closure(mcregex *re, const int *pcs, int n, int prev_word, int next_word, int *out);
+
+// Returns 1 if some line has a position where both patterns match, 0 if
+// there is none and -1 if the search was given up. Lines never contain
+// \n.
+int mcregex_overlap(const mcregex *a, const mcregex *b);
+
+#endif // !defined(__MCREGEX_H__)
@@ -0,0 +1,387 @@
+/**********************************************************************
+ * MCODE HTML Renderer
+ *
+ * Renders MCODE source as HTML the way the Pygments HtmlFormatter does
+ * with the MCODE lexer: the same document structure, CSS classes and
+ * escaping, so stylesheets written by pygmentize -S keep working.
+ *********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcodelex.h"
+#include "mchtml.h"
+
+#define BUFFER_SIZE     (1 << 16)
+
+// fallback of the Pygments lexer for unmatched characters
+#define FALLBACK_CLASS  "s"
+
+static const char *doc_header =
+    "<!DOCTYPE html PUBLIC \"-//W3C//DTD HTML 4.01//EN\"\n"
+    "   \"http://www.w3.org/TR/html4/strict.dtd\">\n"
+    "<!--\n"
+    "generated by Pygments <https://pygments.org/>\n"
+    "Copyright 2006-2025 by the Pygments team.\n"
+    "Licensed under the BSD license, see LICENSE for details.\n"
+    "-->\n"
+    "<html>\n"
+    "<head>\n"
+    "  <title>";
+
+static const char *doc_style =
+    "</title>\n"
+    "  <meta http-equiv=\"content-type\" content=\"text/html; charset=utf-8\">\n"
+    "  <style type=\"text/css\">\n"
+    "/*\n"
+    "generated by Pygments <https://pygments.org/>\n"
+    "Copyright 2006-2025 by the Pygments team.\n"
+    "Licensed under the BSD license, see LICENSE for details.\n"
+    "*/\n";
+
+static const char *doc_body =
+    "\n"
+    "\n"
+    "  </style>\n"
+    "</head>\n"
+    "<body>\n"
+    "<h2>";
+
+static const char *doc_footer =
+    "</body>\n"
+    "</html>\n";
+
+// pygmentize -f html -S mcodemonokai -a body
+static const char *monokai_styledefs =
+    "pre { line-height: 125%; }\n"
+    "td.linenos .normal { color: inherit; background-color: transparent; padding-left: 5px; padding-right: 5px; }\n"
+    "span.linenos { color: inherit; background-color: transparent; padding-left: 5px; padding-right: 5px; }\n"
+    "td.linenos .special { color: #000000; background-color: #ffffc0; padding-left: 5px; padding-right: 5px; }\n"
+    "span.linenos.special { color: #000000; background-color: #ffffc0; padding-left: 5px; padding-right: 5px; }\n"
+    "body .hll { background-color: #49483E }\n"
+    "body { background: #272822; }\n"
+    "body .c { color: #A89880 } /* Comment */\n"
+    "body .k { color: #F92672 } /* Keyword */\n"
+    "body .ch { color: #A89880 } /* Comment.Hashbang */\n"
+    "body .cm { color: #A89880 } /* Comment.Multiline */\n"
+    "body .cp { color: #808080 } /* Comment.Preproc */\n"
+    "body .cpf { color: #A89880 } /* Comment.PreprocFile */\n"
+    "body .c1 { color: #A89880 } /* Comment.Single */\n"
+    "body .cs { color: #A89880 } /* Comment.Special */\n"
+    "body .gr { color: #888; font-style: italic } /* Generic.Error */\n"
+    "body .kc { color: #F92672 } /* Keyword.Constant */\n"
+    "body .kd { color: #F92672 } /* Keyword.Declaration */\n"
+    "body .kn { color: #F92672 } /* Keyword.Namespace */\n"
+    "body .kp { color: #FD971F } /* Keyword.Pseudo */\n"
+    "body .kr { color: #F92672 } /* Keyword.Reserved */\n"
+    "body .kt { color: #F92672 } /* Keyword.Type */\n"
+    "body .s { color: #E6DB74 } /* Literal.String */\n"
+    "body .nb { color: #F92672; font-style: italic } /* Name.Builtin */\n"
+    "body .nl { color: #A6E22E } /* Name.Label */\n"
+    "body .mb { color: #8060D0 } /* Literal.Number.Bin */\n"
+    "body .mh { color: #A080F0 } /* Literal.Number.Hex */\n"
+    "body .mi { color: #A080F0 } /* Literal.Number.Integer */\n"
+    "body .sa { color: #E6DB74 } /* Literal.String.Affix */\n"
+    "body .sb { color: #E6DB74 } /* Literal.String.Backtick */\n"
+    "body .sc { color: #E6DB74 } /* Literal.String.Char */\n"
+    "body .dl { color: #E6DB74 } /* Literal.String.Delimiter */\n"
+    "body .sd { color: #E6DB74 } /* Literal.String.Doc */\n"
+    "body .s2 { color: #E6DB74 } /* Literal.String.Double */\n"
+    "body .se { color: #E6DB74 } /* Literal.String.Escape */\n"
+    "body .sh { color: #E6DB74 } /* Literal.String.Heredoc */\n"
+    "body .si { color: #E6DB74 } /* Literal.String.Interpol */\n"
+    "body .sx { color: #E6DB74 } /* Literal.String.Other */\n"
+    "body .sr { color: #E6DB74 } /* Literal.String.Regex */\n"
+    "body .s1 { color: #E6DB74 } /* Literal.String.Single */\n"
+    "body .ss { color: #E6DB74 } /* Literal.String.Symbol */\n"
+    "body .bp { color: #F92672; font-style: italic } /* Name.Builtin.Pseudo */\n"
+    "body .il { color: #A080F0 } /* Literal.Number.Integer.Long */";
+
+struct line_state_t {
+    mchtml_buffer *out;
+    const char *line;
+    size_t pos;             // first character not rendered yet
+    const char *open;       // class of the open <span>, NULL if none
+};
+
+typedef struct line_state_t line_state;
+
+void mchtml_buffer_init(mchtml_buffer *out, mchtml_write write, void *user)
+{
+    out->data = NULL;
+    out->len = 0;
+    out->size = 0;
+    out->write = write;
+    out->user = user;
+    out->failed = 0;
+}
+
+void mchtml_buffer_flush(mchtml_buffer *out)
+{
+    if (out->write && out->len) {
+        out->write(out->user, out->data, out->len);
+        out->len = 0;
+    }
+}
+
+void mchtml_buffer_free(mchtml_buffer *out)
+{
+    free(out->data);
+    mchtml_buffer_init(out, out->write, out->user);
+}
+
+static int reserve(mchtml_buffer *out, size_t n)
+{
+    if (out->len + n <= out->size) {
+        return 1;
+    }
+    mchtml_buffer_flush(out);
+    if (out->len + n > out->size) {
+        size_t size = out->size ? out->size : BUFFER_SIZE;
+        while (size < out->len + n) {
+            size *= 2;
+        }
+        char *data = realloc(out->data, size);
+        if (!data) {
+            out->failed = 1;
+            return 0;
+        }
+        out->data = data;
+        out->size = size;
+    }
+    return 1;
+}
+
+static void put(mchtml_buffer *out, const char *s, size_t len)
+{
+    if (reserve(out, len)) {
+        memcpy(out->data + out->len, s, len);
+        out->len += len;
+    }
+}
+
+static void put_str(mchtml_buffer *out, const char *s)
+{
+    put(out, s, strlen(s));
+}
+
+static void put_escaped(mchtml_buffer *out, const char *s, size_t len)
+{
+    // worst case &quot; for every character
+    if (!reserve(out, 6*len)) {
+        return;
+    }
+    char *p = out->data + out->len;
+    for (size_t i = 0; i < len; i++) {
+        switch (s[i]) {
+            case '&':  memcpy(p, "&amp;", 5);  p += 5; break;
+            case '<':  memcpy(p, "&lt;", 4);   p += 4; break;
+            case '>':  memcpy(p, "&gt;", 4);   p += 4; break;
+            case '"':  memcpy(p, "&quot;", 6); p += 6; break;
+            case '\'': memcpy(p, "&#39;", 5);  p += 5; break;
+            default:   *p++ = s[i];            break;
+        }
+    }
+    out->len = p - out->data;
+}
+
+// Runs of the same class share one <span>.
+static void put_run(line_state *st, const char *cls, size_t end)
+{
+    if (end <= st->pos) {
+        return;
+    }
+    if (st->open != cls && (!st->open || strcmp(st->open, cls) != 0)) {
+        if (st->open) {
+            put_str(st->out, "</span>");
+        }
+        put_str(st->out, "<span class=\"");
+        put_str(st->out, cls);
+        put_str(st->out, "\">");
+        st->open = cls;
+    }
+    put_escaped(st->out, st->line + st->pos, end - st->pos);
+    st->pos = end;
+}
+
+static void put_span(void *user, const mclex_span *span)
+{
+    line_state *st = (line_state *) user;
+    put_run(st, FALLBACK_CLASS, span->offset);
+    put_run(st, mclex_style_classes[span->style], span->offset + span->length);
+}
+
+void mchtml_line(mchtml_buffer *out, const char *line, size_t len)
+{
+    line_state st = { out, line, 0, NULL };
+    mclex_line(line, len, 0, put_span, &st);
+    put_run(&st, FALLBACK_CLASS, len);
+    if (st.open) {
+        put_str(out, "</span>");
+    }
+    put(out, "\n", 1);
+}
+
+void mchtml_lines(mchtml_buffer *out, const char *text, size_t len)
+{
+    const char *p = text;
+    const char *end = text + len;
+    while (p < end) {
+        const char *q = p;
+        while (q < end && *q != '\n' && *q != '\r') {
+            q++;
+        }
+        mchtml_line(out, p, q - p);
+        if (q < end - 1 && q[0] == '\r' && q[1] == '\n') {
+            q++;
+        }
+        p = q + 1;
+    }
+}
+
+void mchtml_trim(const char **text, size_t *len)
+{
+    const char *p = *text;
+    const char *end = *text + *len;
+    if (end - p >= 3 && memcmp(p, "\xEF\xBB\xBF", 3) == 0) {
+        p += 3;
+    }
+    while (p < end && (*p == '\n' || *p == '\r')) {
+        p++;
+    }
+    while (end > p && (end[-1] == '\n' || end[-1] == '\r')) {
+        end--;
+    }
+    *text = p;
+    *len = end - p;
+}
+
+void mchtml_begin(mchtml_buffer *out, const mchtml_options *options)
+{
+    const char *title = options->title ? options->title : "";
+    if (options->full) {
+        put_str(out, doc_header);
+        put_str(out, title);
+        put_str(out, doc_style);
+        put_str(out, options->styledefs ? options->styledefs : monokai_styledefs);
+        put_str(out, doc_body);
+        put_str(out, title);
+        put_str(out, "</h2>\n\n");
+    }
+    put_str(out, "<div class=\"");
+    put_str(out, options->cssclass ? options->cssclass : "highlight");
+    put_str(out, "\"><pre><span></span>");
+}
+
+void mchtml_end(mchtml_buffer *out, const mchtml_options *options)
+{
+    put_str(out, "</pre></div>\n");
+    if (options->full) {
+        put_str(out, doc_footer);
+    }
+}
+
+void mchtml_stream_init(mchtml_stream *st, mchtml_buffer *out)
+{
+    mclex_setup();
+    st->out = out;
+    st->line = NULL;
+    st->line_len = 0;
+    st->line_size = 0;
+    st->empty_lines = 0;
+    st->started = 0;
+    st->cr = 0;
+    st->fed = 0;
+}
+
+// Empty lines are held back until a line with content follows, so
+// empty lines at the start and at the end are dropped.
+static void stream_line(mchtml_stream *st, const char *line, size_t len)
+{
+    if (len == 0) {
+        st->empty_lines += st->started;
+        return;
+    }
+    for (; st->empty_lines; st->empty_lines--) {
+        put(st->out, "\n", 1);
+    }
+    st->started = 1;
+    mchtml_line(st->out, line, len);
+}
+
+static int append_partial(mchtml_stream *st, const char *data, size_t len)
+{
+    if (st->line_len + len > st->line_size) {
+        size_t size = st->line_size ? st->line_size : 256;
+        while (size < st->line_len + len) {
+            size *= 2;
+        }
+        char *line = realloc(st->line, size);
+        if (!line) {
+            return -1;
+        }
+        st->line = line;
+        st->line_size = size;
+    }
+    memcpy(st->line + st->line_len, data, len);
+    st->line_len += len;
+    return 0;
+}
+
+int mchtml_stream_feed(mchtml_stream *st, const char *data, size_t len)
+{
+    const char *p = data;
+    const char *end = data + len;
+
+    if (!st->fed && len >= 3 && memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+        p += 3;
+    }
+    st->fed |= len > 0;
+    if (st->cr && p < end) {
+        p += *p == '\n';
+        st->cr = 0;
+    }
+    while (p < end) {
+        const char *q = p;
+        while (q < end && *q != '\n' && *q != '\r') {
+            q++;
+        }
+        if (q == end) {
+            return append_partial(st, p, end - p);
+        }
+        if (st->line_len) {
+            if (append_partial(st, p, q - p)) {
+                return -1;
+            }
+            stream_line(st, st->line, st->line_len);
+            st->line_len = 0;
+        } else {
+            stream_line(st, p, q - p);
+        }
+        if (*q == '\r') {
+            if (q + 1 == end) {
+                st->cr = 1;
+            } else if (q[1] == '\n') {
+                q++;
+            }
+        }
+        p = q + 1;
+    }
+    return st->out->failed ? -1 : 0;
+}
+
+int mchtml_stream_finish(mchtml_stream *st)
+{
+    if (st->line_len) {
+        stream_line(st, st->line, st->line_len);
+    }
+    if (!st->started) {
+        // Pygments renders empty input as one empty line
+        put(st->out, "\n", 1);
+    }
+    free(st->line);
+    st->line = NULL;
+    st->line_len = 0;
+    st->line_size = 0;
+    return st->out->failed ? -1 : 0;
+}
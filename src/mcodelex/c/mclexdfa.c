@@ -0,0 +1,232 @@
+/**********************************************************************
+ * MCODE Tokenizer, table-driven
+ *
+ * Runs the automata that mcodeiro -d compiles from the grammar, see
+ * mclexdfa.h. The tables are in mclexdfatab.c.
+ *********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcodelex.h"
+#include "mclexdfa.h"
+
+// Failed scans whose tail after the last accept is no longer than this
+// are not remembered; they cost at most this much per position anyway.
+#define MEMO_MIN_TAIL   32
+#define MEMO_MIN_SIZE   1024
+
+// Pairs of state and position from which no rule can accept any more.
+// A scan that reaches one stops, so the tail of every failed scan is
+// walked at most twice more and a line of unclosed parentheses is lexed
+// in linear time, not in quadratic (T. Reps, "Maximal-munch"
+// tokenization in linear time, 1998).
+struct memo_t {
+    unsigned long long *keys;   // position << 16 | state, 0 if empty
+    size_t size;
+    size_t count;
+};
+
+typedef struct memo_t memo;
+
+// MCLEX ids of the rules' context and style names
+static unsigned char rule_context[MCLEX_DFA_MAX_RULES];
+static unsigned char rule_styles[MCLEX_DFA_MAX_RULES][MCLEX_DFA_MAX_GROUPS];
+// MCLEX ids of the contexts the lexers stand for, from the rules pushing them
+static unsigned char lexer_context[MCLEX_CTX_COUNT];
+
+static int is_word(int ch)
+{
+    return (ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'Z') ||
+           (ch >= 'a' && ch <= 'z') || ch == '_' || ch >= 0x80;
+}
+
+static int find_name(const char **names, int count, const char *name)
+{
+    for (int i = 0; i < count; i++) {
+        if (strcmp(names[i], name) == 0) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+void mclex_dfa_setup(void)
+{
+    const mclex_dfa *t = &mclex_dfa_tables;
+    for (int i = 0; i < t->rule_count; i++) {
+        const mclex_dfa_rule *r = &t->rules[i];
+        rule_context[i] = find_name(mclex_context_names, MCLEX_CTX_COUNT, r->context);
+        for (int k = 0; k < r->group_count; k++) {
+            rule_styles[i][k] = find_name(mclex_style_names, MCLEX_STYLE_COUNT, r->styles[k]);
+        }
+        if (r->push > 0 && r->push < MCLEX_CTX_COUNT) {
+            lexer_context[(int) r->push] = rule_context[i];
+        }
+    }
+}
+
+static unsigned long long memo_key(unsigned state, size_t pos)
+{
+    return ((unsigned long long) pos << 16) | state;
+}
+
+static size_t memo_slot(const memo *m, unsigned long long key)
+{
+    size_t i = (size_t) ((key * 0x9E3779B97F4A7C15ULL) >> 32) & (m->size - 1);
+    while (m->keys[i] && m->keys[i] != key) {
+        i = (i + 1) & (m->size - 1);
+    }
+    return i;
+}
+
+static int memo_find(const memo *m, unsigned state, size_t pos)
+{
+    return m->count && m->keys[memo_slot(m, memo_key(state, pos))] != 0;
+}
+
+// Returns 0 if the pair was added, -1 if it was known or memory ran
+// out; without memory only the linear time bound is lost.
+static int memo_add(memo *m, unsigned state, size_t pos)
+{
+    unsigned long long key = memo_key(state, pos);
+    if (2 * (m->count + 1) > m->size) {
+        memo grown;
+        grown.size = m->size ? 2 * m->size : MEMO_MIN_SIZE;
+        grown.count = m->count;
+        grown.keys = calloc(grown.size, sizeof(unsigned long long));
+        if (!grown.keys) {
+            return -1;
+        }
+        for (size_t i = 0; i < m->size; i++) {
+            if (m->keys[i]) {
+                grown.keys[memo_slot(&grown, m->keys[i])] = m->keys[i];
+            }
+        }
+        free(m->keys);
+        *m = grown;
+    }
+    size_t i = memo_slot(m, key);
+    if (m->keys[i]) {
+        return -1;
+    }
+    m->keys[i] = key;
+    m->count++;
+    return 0;
+}
+
+// Where a group that starts at pos ends: the last position where the
+// automaton of the group accepts.
+static size_t group_end(const mclex_dfa *t, int split, const unsigned char *s, size_t pos, size_t end, size_t len)
+{
+    unsigned state = t->split_start[2 * split + (pos > 0 && is_word(s[pos - 1]))];
+    size_t last = pos;
+    for (size_t i = pos; state; i++) {
+        if (t->accept[2 * state + (i < len && is_word(s[i]))]) {
+            last = i;
+        }
+        if (i == end) {
+            break;
+        }
+        state = t->next[state * t->class_count + t->byte_class[s[i]]];
+    }
+    return last;
+}
+
+static void emit_span(size_t offset, size_t length, int style, int ctx, mclex_emit emit, void *user)
+{
+    mclex_span span;
+    if (length) {
+        span.offset = offset;
+        span.length = length;
+        span.style = style;
+        span.context = ctx;
+        emit(user, &span);
+    }
+}
+
+// Shared by mclex_dfa_line() and mclex_dfa_profile_line() like the lexer
+// loop in mcodelex.c. The time of a scan includes remembering its tail.
+static inline void lex_line(const char *line, size_t len, size_t base, mclex_emit emit, void *user,
+    mclex_profile *prof)
+{
+    const mclex_dfa *t = &mclex_dfa_tables;
+    const unsigned char *s = (const unsigned char *) line;
+    const unsigned short *dispatch = t->dispatch;
+    memo failed = { 0, 0, 0 };
+    int current = MCLEX_CTX_MAIN;
+    size_t pos = 0;
+
+    if (prof) {
+        prof->lines++;
+    }
+    while (pos < len) {
+        unsigned long long clock = prof ? mclex_clock() : 0;
+        unsigned start = dispatch[(pos > 0 && is_word(s[pos - 1])) * 256 + s[pos]];
+        unsigned state = start;
+        int rule = -1;
+        size_t end = pos;
+        size_t reached = pos;
+        for (size_t i = pos + 1; state && !memo_find(&failed, state, i); i++) {
+            int accept = t->accept[2 * state + (i < len && is_word(s[i]))];
+            reached = i;
+            if (accept) {
+                rule = accept - 1;
+                end = i;
+            }
+            if (i == len) {
+                break;
+            }
+            state = t->next[state * t->class_count + t->byte_class[s[i]]];
+        }
+        if (reached - end > MEMO_MIN_TAIL) {
+            // walk the scan again and remember the pairs after the last accept
+            state = start;
+            for (size_t i = pos + 1; i <= reached; i++) {
+                if (i > end && memo_add(&failed, state, i) != 0) {
+                    break;
+                }
+                if (i < len) {
+                    state = t->next[state * t->class_count + t->byte_class[s[i]]];
+                }
+            }
+        }
+        if (prof) {
+            int ctx = rule < 0 ? MCLEX_PROFILE_FALLBACK : rule_context[rule];
+            mclex_profile_entry *e = &prof->entries[current][ctx];
+            e->attempts++;
+            e->matches++;
+            e->nanoseconds += mclex_clock() - clock;
+        }
+        if (rule < 0) {
+            pos++;  // fallback rule
+            continue;
+        }
+
+        const mclex_dfa_rule *r = &t->rules[rule];
+        size_t split = pos;
+        for (int k = 0; k + 1 < r->group_count; k++) {
+            size_t group = group_end(t, r->splits[k], s, split, end, len);
+            emit_span(base + split, group - split, rule_styles[rule][k], rule_context[rule], emit, user);
+            split = group;
+        }
+        emit_span(base + split, end - split, rule_styles[rule][r->group_count - 1], rule_context[rule], emit, user);
+        if (r->push >= 0) {
+            dispatch = t->dispatch + r->push * 2 * 256;
+            current = lexer_context[(int) r->push];
+        }
+        pos = end;
+    }
+    free(failed.keys);
+}
+
+void mclex_dfa_line(const char *line, size_t len, size_t base, mclex_emit emit, void *user)
+{
+    lex_line(line, len, base, emit, user, 0);
+}
+
+void mclex_dfa_profile_line(const char *line, size_t len, size_t base, mclex_emit emit, void *user,
+    mclex_profile *prof)
+{
+    lex_line(line, len, base, emit, user, prof);
+}
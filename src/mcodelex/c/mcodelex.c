@@ -0,0 +1,718 @@
+/**********************************************************************
+ * MCODE Tokenizer
+ *
+ * Tokenizes MCODE source text in a single pass. The patterns below are
+ * hand-compiled from the grammar that mcodeiro writes, mnemonics are
+ * looked up in the instruction table inst[].
+ *********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mcinstr.h"
+#include "mcop.h"
+#include "mcodelex.h"
+#include "mclexdfa.h"
+
+#define INSTRUCTION_COUNT   (MCLEX_CTX_INSTRUCTION_SPECIAL2 - MCLEX_CTX_INSTRUCTION_NONE + 1)
+#define MAX_SPANS           2
+
+const char *mclex_style_names[MCLEX_STYLE_COUNT] = {
+    "comment",
+    "annotation",
+    "error",
+    "directive",
+    "label",
+    "mnemonic",
+    "operand",
+    "string",
+    "decimal",
+    "hexadecimal",
+    "code"
+};
+
+// CSS classes of the Pygments token types (pygmentsScope in mcodeiro.c)
+const char *mclex_style_classes[MCLEX_STYLE_COUNT] = {
+    "c",    // Comment
+    "cp",   // Comment.Preproc
+    "gr",   // Generic.Error
+    "nb",   // Name.Builtin
+    "nl",   // Name.Label
+    "k",    // Keyword
+    "kp",   // Keyword.Pseudo
+    "s",    // String
+    "mi",   // Number.Integer
+    "mh",   // Number.Hex
+    "mb"    // Number.Bin
+};
+
+// TextMate scopes of the styles (textmateScope in mcodeiro.c)
+const char *mclex_style_scopes[MCLEX_STYLE_COUNT] = {
+    "comment",
+    "comment.block.preprocessor",
+    "message.error",
+    "keyword.other",
+    "variable.other",
+    "keyword",
+    "variable.language",
+    "string",
+    "constant.numeric.decimal",
+    "constant.numeric.hexadecimal",
+    "constant.numeric.code"
+};
+
+const char *mclex_context_names[MCLEX_CTX_COUNT] = {
+    "main",
+    "comment",
+    "annotation",
+    "data",
+    "string",
+    "dec_number",
+    "hex_number",
+    "address",
+    "code",
+    "local_label",
+    "global_label",
+    "simple_directive",
+    "string_directive",
+    "number_directive",
+    "address_directive",
+    "symbol_directive",
+    "code_literal",
+    "instruction_none",
+    "instruction_number",
+    "instruction_address",
+    "instruction_register",
+    "instruction_class2",
+    "instruction_class3",
+    "instruction_special1",
+    "instruction_special2",
+    "tef",
+    "register",
+    "positive_displacement",
+    "negative_displacement"
+};
+
+// operand types per instruction context, same as in mcodeiro.c
+static const char *instruction_operands[INSTRUCTION_COUNT] = {
+    (const char []) { MCODE_OP_NONE1, MCODE_OP_NONE2, MCODE_OP_NONE3, 0 },
+    (const char []) { MCODE_OP_0_TO_7, MCODE_OP_0_TO_13_DEC, MCODE_OP_1_TO_31_DEC, MCODE_OP_0_TO_64_DEC, 0 },
+    (const char []) { MCODE_OP_ADDRESS1, MCODE_OP_ADDRESS2, MCODE_OP_ADDRESS3, MCODE_OP_ADDRESS4, 0 },
+    (const char []) { MCODE_OP_0_TO_F_HEX, 0 },
+    (const char []) { MCODE_OP_TEF1, MCODE_OP_TEF2, 0 },
+    (const char []) { MCODE_OP_DISPLACEMENT, 0 },
+    (const char []) { MCODE_OP_000_TO_FFF_HEX, MCODE_OP_000_TO_3FF_HEX, 0 },
+    (const char []) { MCODE_OP_UNKNOWN, 0 }
+};
+
+// context includes, terminated by MCLEX_CTX_MAIN
+static const unsigned char main_includes[] = {
+    MCLEX_CTX_COMMENT,
+    MCLEX_CTX_ANNOTATION,
+    MCLEX_CTX_DATA,
+    MCLEX_CTX_SIMPLE_DIRECTIVE,
+    MCLEX_CTX_STRING_DIRECTIVE,
+    MCLEX_CTX_NUMBER_DIRECTIVE,
+    MCLEX_CTX_ADDRESS_DIRECTIVE,
+    MCLEX_CTX_SYMBOL_DIRECTIVE,
+    MCLEX_CTX_CODE_LITERAL,
+    MCLEX_CTX_INSTRUCTION_NONE,
+    MCLEX_CTX_INSTRUCTION_NUMBER,
+    MCLEX_CTX_INSTRUCTION_ADDRESS,
+    MCLEX_CTX_INSTRUCTION_REGISTER,
+    MCLEX_CTX_INSTRUCTION_CLASS2,
+    MCLEX_CTX_INSTRUCTION_CLASS3,
+    MCLEX_CTX_INSTRUCTION_SPECIAL1,
+    MCLEX_CTX_INSTRUCTION_SPECIAL2,
+    MCLEX_CTX_LOCAL_LABEL,
+    MCLEX_CTX_GLOBAL_LABEL,
+    MCLEX_CTX_MAIN
+};
+
+static const unsigned char *push_includes[MCLEX_CTX_COUNT] = {
+    [MCLEX_CTX_SIMPLE_DIRECTIVE] = (const unsigned char []) {
+        MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_STRING_DIRECTIVE] = (const unsigned char []) {
+        MCLEX_CTX_STRING, MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_NUMBER_DIRECTIVE] = (const unsigned char []) {
+        MCLEX_CTX_DEC_NUMBER, MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_ADDRESS_DIRECTIVE] = (const unsigned char []) {
+        MCLEX_CTX_ADDRESS, MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_SYMBOL_DIRECTIVE] = (const unsigned char []) {
+        MCLEX_CTX_LOCAL_LABEL, MCLEX_CTX_GLOBAL_LABEL, MCLEX_CTX_ADDRESS,
+        MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_CODE_LITERAL] = (const unsigned char []) {
+        MCLEX_CTX_CODE, MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_INSTRUCTION_NONE] = (const unsigned char []) {
+        MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_INSTRUCTION_NUMBER] = (const unsigned char []) {
+        MCLEX_CTX_DEC_NUMBER, MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_INSTRUCTION_ADDRESS] = (const unsigned char []) {
+        MCLEX_CTX_ADDRESS, MCLEX_CTX_LOCAL_LABEL, MCLEX_CTX_GLOBAL_LABEL,
+        MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_INSTRUCTION_REGISTER] = (const unsigned char []) {
+        MCLEX_CTX_REGISTER, MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_INSTRUCTION_CLASS2] = (const unsigned char []) {
+        MCLEX_CTX_TEF, MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_INSTRUCTION_CLASS3] = (const unsigned char []) {
+        MCLEX_CTX_POS_DISPLACEMENT, MCLEX_CTX_NEG_DISPLACEMENT,
+        MCLEX_CTX_LOCAL_LABEL, MCLEX_CTX_GLOBAL_LABEL, MCLEX_CTX_ADDRESS,
+        MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_INSTRUCTION_SPECIAL1] = (const unsigned char []) {
+        MCLEX_CTX_HEX_NUMBER, MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN },
+    [MCLEX_CTX_INSTRUCTION_SPECIAL2] = (const unsigned char []) {
+        MCLEX_CTX_CODE, MCLEX_CTX_LOCAL_LABEL, MCLEX_CTX_GLOBAL_LABEL,
+        MCLEX_CTX_COMMENT, MCLEX_CTX_MAIN }
+};
+
+// mnemonics per instruction context, bucketed by their first character
+// and sorted longest first like the alternations mcodeiro prints
+static short mnemonic_order[INSTRUCTION_COUNT][IHT_SIZE];
+static short mnemonic_bucket[INSTRUCTION_COUNT][257];
+static unsigned char mnemonic_length[IHT_SIZE];
+
+// characters that may start a match, per pattern and per context with
+// includes (union over the included patterns)
+static unsigned char starts[MCLEX_CTX_COUNT][256];
+static unsigned char dispatch[MCLEX_CTX_COUNT][256];
+
+static int ready = 0;
+
+static int is_digit(int ch)
+{
+    return ch >= '0' && ch <= '9';
+}
+
+static int is_hex(int ch)
+{
+    return is_digit(ch) || (ch >= 'A' && ch <= 'F');
+}
+
+static int is_space(int ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\f' || ch == '\v';
+}
+
+// word characters as seen by \b; non-ASCII bytes count as letters
+static int is_word(int ch)
+{
+    return (ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'Z') ||
+           (ch >= 'a' && ch <= 'z') || ch == '_' || ch >= 0x80;
+}
+
+static int is_register_letter(int ch)
+{
+    return ch && strchr("TZYXLMNOPQabcde", ch) != 0;
+}
+
+static int compare_mnemonics(const void *a, const void *b)
+{
+    const char *s1 = inst[*(const short *) a].name;
+    const char *s2 = inst[*(const short *) b].name;
+    int len1 = strlen(s1);
+    int len2 = strlen(s2);
+    if (len1 == len2) {
+        return strcmp(s1, s2);
+    } else {
+        return len2-len1;
+    }
+}
+
+static void setup_instruction(int n)
+{
+    short sorted[IHT_SIZE];
+    mnemonic_bitset selected;
+    int count = 0;
+    mnemonic_select(&selected, instruction_operands[n], SET_ALL);
+    for (int i = mnemonic_bitset_next(&selected, -1); i >= 0; i = mnemonic_bitset_next(&selected, i)) {
+        sorted[count++] = i;
+    }
+    qsort(sorted, count, sizeof(short), compare_mnemonics);
+
+    // stable counting sort by first character
+    short *bucket = mnemonic_bucket[n];
+    memset(bucket, 0, sizeof(mnemonic_bucket[n]));
+    for (int i = 0; i < count; i++) {
+        bucket[(unsigned char) inst[sorted[i]].name[0] + 1]++;
+    }
+    for (int ch = 0; ch < 256; ch++) {
+        bucket[ch + 1] += bucket[ch];
+        starts[MCLEX_CTX_INSTRUCTION_NONE + n][ch] = bucket[ch + 1] > bucket[ch];
+    }
+    short fill[256];
+    memcpy(fill, bucket, sizeof(fill));
+    for (int i = 0; i < count; i++) {
+        mnemonic_order[n][fill[(unsigned char) inst[sorted[i]].name[0]]++] = sorted[i];
+    }
+}
+
+static void setup_starts(int ctx, const char *chars)
+{
+    while (*chars) {
+        starts[ctx][(unsigned char) *chars++] = 1;
+    }
+}
+
+static void setup_dispatch(int ctx, const unsigned char *includes)
+{
+    while (*includes) {
+        for (int ch = 0; ch < 256; ch++) {
+            dispatch[ctx][ch] |= starts[*includes][ch];
+        }
+        includes++;
+    }
+}
+
+void mclex_setup(void)
+{
+    if (ready) {
+        return;
+    }
+    for (int i = 0; i < IHT_SIZE; i++) {
+        mnemonic_length[i] = strlen(inst[i].name);
+    }
+    for (int n = 0; n < INSTRUCTION_COUNT; n++) {
+        setup_instruction(n);
+    }
+    setup_starts(MCLEX_CTX_COMMENT, ";");
+    setup_starts(MCLEX_CTX_ANNOTATION, "*");
+    setup_starts(MCLEX_CTX_DATA, "0123456789ABCDEF");
+    setup_starts(MCLEX_CTX_STRING, "\"");
+    setup_starts(MCLEX_CTX_DEC_NUMBER, "0123456789");
+    setup_starts(MCLEX_CTX_HEX_NUMBER, "0123456789ABCDEF");
+    setup_starts(MCLEX_CTX_ADDRESS, "0123456789ABCDEF");
+    setup_starts(MCLEX_CTX_CODE, "0123");
+    setup_starts(MCLEX_CTX_LOCAL_LABEL, "(");
+    setup_starts(MCLEX_CTX_GLOBAL_LABEL, "[");
+    setup_starts(MCLEX_CTX_SIMPLE_DIRECTIVE, ".");
+    setup_starts(MCLEX_CTX_STRING_DIRECTIVE, ".");
+    setup_starts(MCLEX_CTX_NUMBER_DIRECTIVE, ".");
+    setup_starts(MCLEX_CTX_ADDRESS_DIRECTIVE, ".");
+    setup_starts(MCLEX_CTX_SYMBOL_DIRECTIVE, ".");
+    setup_starts(MCLEX_CTX_CODE_LITERAL, "#");
+    setup_starts(MCLEX_CTX_TEF, "P[QT^-XWMSA@R");
+    setup_starts(MCLEX_CTX_REGISTER, "0123456789ABCDEF");
+    setup_starts(MCLEX_CTX_POS_DISPLACEMENT, "+");
+    setup_starts(MCLEX_CTX_NEG_DISPLACEMENT, "-");
+    setup_dispatch(MCLEX_CTX_MAIN, main_includes);
+    for (int ctx = 0; ctx < MCLEX_CTX_COUNT; ctx++) {
+        if (push_includes[ctx]) {
+            setup_dispatch(ctx, push_includes[ctx]);
+        }
+    }
+    mclex_dfa_setup();
+    ready = 1;
+}
+
+static size_t match_keyword(const char *s, size_t n, const char **keywords)
+{
+    while (*keywords) {
+        size_t len = strlen(*keywords);
+        if (len <= n && memcmp(s, *keywords, len) == 0) {
+            return len;
+        }
+        keywords++;
+    }
+    return 0;
+}
+
+static size_t match_directive(const char *s, size_t n, const char **keywords)
+{
+    size_t len = match_keyword(s + 1, n - 1, keywords);
+    return len ? len + 1 : 0;
+}
+
+static size_t match_mnemonic(int ctx, const char *s, size_t n)
+{
+    int k = ctx - MCLEX_CTX_INSTRUCTION_NONE;
+    unsigned char ch = *s;
+    for (int j = mnemonic_bucket[k][ch]; j < mnemonic_bucket[k][ch + 1]; j++) {
+        int i = mnemonic_order[k][j];
+        size_t len = mnemonic_length[i];
+        if (len <= n && memcmp(s, inst[i].name, len) == 0) {
+            return len;
+        }
+    }
+    return 0;
+}
+
+// [0-9A-F]{count}\b, or [0-9A-F]+\b if count is 0
+static size_t match_hex_digits(const char *s, size_t n, size_t count)
+{
+    size_t i = 0;
+    while ((!count || i < count) && i < n && is_hex(s[i])) {
+        i++;
+    }
+    if (i == 0 || (count && i < count) || (i < n && is_word((unsigned char) s[i]))) {
+        return 0;
+    }
+    return i;
+}
+
+static size_t match_label(const char *s, size_t n, char close)
+{
+    const char *end = memchr(s + 1, close, n - 1);
+    return (end && end > s + 1) ? (size_t) (end - s) + 1 : 0;
+}
+
+static size_t match_data(const char *s, size_t n, size_t *split)
+{
+    size_t i = 0;
+    while (i < 4 && i < n && is_hex(s[i])) {
+        i++;
+    }
+    if (i < 4 || i >= n || (s[i] != ' ' && s[i] != '\t')) {
+        return 0;
+    }
+    while (i < n && (s[i] == ' ' || s[i] == '\t')) {
+        i++;
+    }
+    *split = i;
+    for (int words = 0; words < 3; words++) {
+        if (i + 3 > n || s[i] < '0' || s[i] > '3' || !is_hex(s[i + 1]) || !is_hex(s[i + 2])) {
+            break;
+        }
+        i += 3;
+    }
+    return i > *split ? i : 0;
+}
+
+static size_t match_tef(const char *s, size_t n)
+{
+    static const char *alternatives[] = {
+        "XS", "X", "WPT", "W", "MS", "M", "S&X", "S", "ALL", "@R", "R<", "P-Q", 0
+    };
+    if (strchr("P[QT^-", *s)) {
+        return 1;
+    }
+    return match_keyword(s, n, alternatives);
+}
+
+static size_t match_register(const char *s, size_t n)
+{
+    size_t i;
+    if (is_digit(s[0])) {
+        i = (n > 1 && is_digit(s[1])) ? 2 : 1;
+    } else if (is_hex(s[0])) {
+        i = 1;
+    } else {
+        return 0;
+    }
+    if (i + 2 < n && s[i] == '(' && is_register_letter(s[i + 1]) && s[i + 2] == ')') {
+        i += 3;
+    }
+    if (i + 1 < n && s[i] == '/' && is_register_letter(s[i + 1])) {
+        i += 2;
+    }
+    return i;
+}
+
+static size_t match_displacement(const char *s, size_t n, char sign, char max)
+{
+    if (n < 2 || s[0] != sign || !is_digit(s[1])) {
+        return 0;
+    }
+    if (n > 2 && is_digit(s[2]) && ((s[1] >= '1' && s[1] <= '5') || (s[1] == '6' && s[2] <= max))) {
+        return 3;
+    }
+    return (sign == '-' && s[1] == '0') ? 0 : 2;
+}
+
+static size_t span(mclex_span *spans, int *count, size_t offset, size_t length, int style, int ctx)
+{
+    spans[*count].offset = offset;
+    spans[*count].length = length;
+    spans[*count].style = style;
+    spans[*count].context = ctx;
+    (*count)++;
+    return length;
+}
+
+// Tries the pattern of one context at s. Returns the match length and
+// fills in the spans; if the context pushes, *push is set to it.
+static size_t match_context(int ctx, const char *s, size_t n, size_t pos,
+    mclex_span *spans, int *count, int *push)
+{
+    static const char *simple[] = { "HP", "JDA", "ZENCODE", 0 };
+    static const char *string[] = { "TITLE", "TEXT", "NAME", "MESSL", 0 };
+    static const char *number[] = { "BSS", 0 };
+    static const char *address[] = { "FILLTO", "ORG", 0 };
+    static const char *symbol[] = { "EQU", 0 };
+    size_t len = 0;
+    size_t split = 0;
+
+    switch (ctx) {
+        case MCLEX_CTX_COMMENT:
+            return span(spans, count, pos, n, MCLEX_STYLE_COMMENT, ctx);
+        case MCLEX_CTX_ANNOTATION:
+            if (n >= 9 && memcmp(s, "*** ERROR", 9) == 0) {
+                return span(spans, count, pos, n, MCLEX_STYLE_ERROR, ctx);
+            }
+            return span(spans, count, pos, n, MCLEX_STYLE_ANNOTATION, ctx);
+        case MCLEX_CTX_DATA:
+            len = match_data(s, n, &split);
+            if (len) {
+                span(spans, count, pos, split, MCLEX_STYLE_HEXADECIMAL, ctx);
+                span(spans, count, pos + split, len - split, MCLEX_STYLE_CODE, ctx);
+            }
+            return len;
+        case MCLEX_CTX_STRING: {
+            const char *end = memchr(s + 1, '"', n - 1);
+            if (end) {
+                return span(spans, count, pos, end - s + 1, MCLEX_STYLE_STRING, ctx);
+            }
+            return 0;
+        }
+        case MCLEX_CTX_DEC_NUMBER:
+            while (len < n && is_digit(s[len])) {
+                len++;
+            }
+            if (len < n && is_word((unsigned char) s[len])) {
+                return 0;
+            }
+            return span(spans, count, pos, len, MCLEX_STYLE_DECIMAL, ctx);
+        case MCLEX_CTX_HEX_NUMBER:
+            len = match_hex_digits(s, n, 0);
+            return len ? span(spans, count, pos, len, MCLEX_STYLE_HEXADECIMAL, ctx) : 0;
+        case MCLEX_CTX_ADDRESS:
+            len = match_hex_digits(s, n, 4);
+            return len ? span(spans, count, pos, len, MCLEX_STYLE_HEXADECIMAL, ctx) : 0;
+        case MCLEX_CTX_CODE:
+            len = (*s <= '3') ? match_hex_digits(s, n, 3) : 0;
+            return len ? span(spans, count, pos, len, MCLEX_STYLE_CODE, ctx) : 0;
+        case MCLEX_CTX_LOCAL_LABEL:
+            len = match_label(s, n, ')');
+            return len ? span(spans, count, pos, len, MCLEX_STYLE_LABEL, ctx) : 0;
+        case MCLEX_CTX_GLOBAL_LABEL:
+            len = match_label(s, n, ']');
+            return len ? span(spans, count, pos, len, MCLEX_STYLE_LABEL, ctx) : 0;
+        case MCLEX_CTX_SIMPLE_DIRECTIVE:
+            len = match_directive(s, n, simple);
+            break;
+        case MCLEX_CTX_STRING_DIRECTIVE:
+            len = match_directive(s, n, string);
+            break;
+        case MCLEX_CTX_NUMBER_DIRECTIVE:
+            len = match_directive(s, n, number);
+            break;
+        case MCLEX_CTX_ADDRESS_DIRECTIVE:
+            len = match_directive(s, n, address);
+            break;
+        case MCLEX_CTX_SYMBOL_DIRECTIVE:
+            len = match_directive(s, n, symbol);
+            break;
+        case MCLEX_CTX_CODE_LITERAL:
+            len = 1;
+            break;
+        case MCLEX_CTX_INSTRUCTION_NONE:
+        case MCLEX_CTX_INSTRUCTION_NUMBER:
+        case MCLEX_CTX_INSTRUCTION_ADDRESS:
+        case MCLEX_CTX_INSTRUCTION_REGISTER:
+        case MCLEX_CTX_INSTRUCTION_CLASS2:
+        case MCLEX_CTX_INSTRUCTION_CLASS3:
+        case MCLEX_CTX_INSTRUCTION_SPECIAL1:
+        case MCLEX_CTX_INSTRUCTION_SPECIAL2:
+            len = match_mnemonic(ctx, s, n);
+            return len ? (*push = ctx, span(spans, count, pos, len, MCLEX_STYLE_MNEMONIC, ctx)) : 0;
+        case MCLEX_CTX_TEF:
+            len = match_tef(s, n);
+            return len ? span(spans, count, pos, len, MCLEX_STYLE_OPERAND, ctx) : 0;
+        case MCLEX_CTX_REGISTER:
+            len = match_register(s, n);
+            return len ? span(spans, count, pos, len, MCLEX_STYLE_OPERAND, ctx) : 0;
+        case MCLEX_CTX_POS_DISPLACEMENT:
+            len = match_displacement(s, n, '+', '3');
+            return len ? span(spans, count, pos, len, MCLEX_STYLE_OPERAND, ctx) : 0;
+        case MCLEX_CTX_NEG_DISPLACEMENT:
+            len = match_displacement(s, n, '-', '4');
+            return len ? span(spans, count, pos, len, MCLEX_STYLE_OPERAND, ctx) : 0;
+        default:
+            return 0;
+    }
+
+    // directives and code literals
+    if (len) {
+        *push = ctx;
+        span(spans, count, pos, len, MCLEX_STYLE_DIRECTIVE, ctx);
+    }
+    return len;
+}
+
+unsigned long long mclex_clock(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Shared by mclex_line() and mclex_profile_line(); inlined into both, so
+// without a profile the counters cost nothing. An attempt is one include
+// whose first character fits, the time is the time of its match.
+static inline void lex_line(const char *line, size_t len, size_t base, mclex_emit emit, void *user,
+    mclex_profile *prof)
+{
+    const unsigned char *includes = main_includes;
+    const unsigned char *first = dispatch[MCLEX_CTX_MAIN];
+    int current = MCLEX_CTX_MAIN;
+    size_t pos = 0;
+
+    if (prof) {
+        prof->lines++;
+    }
+    while (pos < len) {
+        mclex_span spans[MAX_SPANS];
+        int count = 0;
+        int push = MCLEX_CTX_MAIN;
+        size_t matched = 0;
+        if (first[(unsigned char) line[pos]]) {
+            for (const unsigned char *inc = includes; *inc && !matched; inc++) {
+                if (starts[*inc][(unsigned char) line[pos]]) {
+                    unsigned long long start = prof ? mclex_clock() : 0;
+                    matched = match_context(*inc, line + pos, len - pos, pos, spans, &count, &push);
+                    if (prof) {
+                        mclex_profile_entry *e = &prof->entries[current][*inc];
+                        e->attempts++;
+                        e->matches += matched != 0;
+                        e->nanoseconds += mclex_clock() - start;
+                    }
+                }
+            }
+        }
+        if (matched) {
+            for (int i = 0; i < count; i++) {
+                spans[i].offset += base;
+                emit(user, &spans[i]);
+            }
+            pos += matched;
+            if (push != MCLEX_CTX_MAIN) {
+                includes = push_includes[push];
+                first = dispatch[push];
+                current = push;
+            }
+        } else {
+            if (prof) {
+                prof->entries[current][MCLEX_PROFILE_FALLBACK].attempts++;
+                prof->entries[current][MCLEX_PROFILE_FALLBACK].matches++;
+            }
+            pos++;  // fallback rule
+        }
+    }
+}
+
+void mclex_line(const char *line, size_t len, size_t base, mclex_emit emit, void *user)
+{
+    lex_line(line, len, base, emit, user, 0);
+}
+
+void mclex_profile_line(const char *line, size_t len, size_t base, mclex_emit emit, void *user,
+    mclex_profile *prof)
+{
+    lex_line(line, len, base, emit, user, prof);
+}
+
+// Only the two lexers of this library can be profiled, any other one
+// runs without a profile.
+static void lex_lines(mclex_lexer lexer, mclex_profile *prof, const char *text, size_t len, size_t base,
+    mclex_emit emit, void *user)
+{
+    const char *p = text;
+    const char *end = text + len;
+    while (p < end) {
+        const char *nl = memchr(p, '\n', end - p);
+        const char *eol = nl ? nl : end;
+        size_t n = eol - p;
+        if (n > 0 && p[n - 1] == '\r') {
+            n--;
+        }
+        if (prof && lexer == mclex_line) {
+            mclex_profile_line(p, n, base + (p - text), emit, user, prof);
+        } else if (prof && lexer == mclex_dfa_line) {
+            mclex_dfa_profile_line(p, n, base + (p - text), emit, user, prof);
+        } else {
+            lexer(p, n, base + (p - text), emit, user);
+        }
+        p = nl ? nl + 1 : end;
+    }
+}
+
+void mclex_buffer(const char *text, size_t len, size_t base, mclex_emit emit, void *user)
+{
+    lex_lines(mclex_line, 0, text, len, base, emit, user);
+}
+
+void mclex_stream_init(mclex_stream *st, mclex_emit emit, void *user)
+{
+    mclex_setup();
+    st->emit = emit;
+    st->user = user;
+    st->lexer = mclex_line;
+    st->profile = 0;
+    st->offset = 0;
+    st->pending = 0;
+    st->pending_len = 0;
+    st->pending_size = 0;
+}
+
+static int append_pending(mclex_stream *st, const char *data, size_t len)
+{
+    if (st->pending_len + len > st->pending_size) {
+        size_t size = st->pending_size ? st->pending_size : 256;
+        while (size < st->pending_len + len) {
+            size *= 2;
+        }
+        char *pending = realloc(st->pending, size);
+        if (!pending) {
+            return -1;
+        }
+        st->pending = pending;
+        st->pending_size = size;
+    }
+    memcpy(st->pending + st->pending_len, data, len);
+    st->pending_len += len;
+    return 0;
+}
+
+int mclex_stream_feed(mclex_stream *st, const char *data, size_t len)
+{
+    size_t start = 0;
+    size_t last = len;
+
+    if (st->pending_len) {
+        // complete the partial line from the previous feed
+        const char *nl = memchr(data, '\n', len);
+        if (!nl) {
+            return append_pending(st, data, len);
+        }
+        start = nl - data + 1;
+        if (append_pending(st, data, start)) {
+            return -1;
+        }
+        lex_lines(st->lexer, st->profile, st->pending, st->pending_len, st->offset, st->emit, st->user);
+        st->offset += st->pending_len;
+        st->pending_len = 0;
+    }
+
+    // lex all complete lines in place, keep the rest for the next feed
+    while (last > start && data[last - 1] != '\n') {
+        last--;
+    }
+    if (last > start) {
+        lex_lines(st->lexer, st->profile, data + start, last - start, st->offset, st->emit, st->user);
+        st->offset += last - start;
+    }
+    return (last < len) ? append_pending(st, data + last, len - last) : 0;
+}
+
+int mclex_stream_finish(mclex_stream *st)
+{
+    if (st->pending_len) {
+        lex_lines(st->lexer, st->profile, st->pending, st->pending_len, st->offset, st->emit, st->user);
+        st->offset += st->pending_len;
+        st->pending_len = 0;
+    }
+    free(st->pending);
+    st->pending = 0;
+    st->pending_size = 0;
+    return 0;
+}
@@ -0,0 +1,77 @@
+#if !defined(__MCHTML_H__)
+#define __MCHTML_H__
+
+#include <stddef.h>
+
+// HTML renderer on top of the tokenizer.
+//
+// The output is the same as that of the Pygments HtmlFormatter with the
+// MCODE lexer in grammars/mcodeLexer.py: one <span> per run of equally
+// styled characters, Pygments CSS class names, and characters that no
+// pattern matches rendered as String. Like Pygments, line breaks are
+// normalized to \n, and leading and trailing empty lines are dropped.
+
+struct mchtml_options_t {
+    const char *cssclass;   // class of the enclosing <div>
+    const char *title;      // title of a full document
+    const char *styledefs;  // style definitions of a full document, NULL for MCODE Monokai
+    int full;               // write a complete HTML document
+};
+
+typedef struct mchtml_options_t mchtml_options;
+
+typedef void (*mchtml_write)(void *user, const char *data, size_t len);
+
+// Output buffer. With a write function the buffer is flushed whenever
+// it runs full, without one it grows.
+struct mchtml_buffer_t {
+    char *data;
+    size_t len;
+    size_t size;
+    mchtml_write write;
+    void *user;
+    int failed;             // set if the buffer could not grow
+};
+
+typedef struct mchtml_buffer_t mchtml_buffer;
+
+struct mchtml_stream_t {
+    mchtml_buffer *out;
+    char *line;             // partial line carried over between feeds
+    size_t line_len;
+    size_t line_size;
+    size_t empty_lines;     // empty lines not written yet
+    int started;            // set after the first line with content
+    int cr;                 // last character fed was \r
+    int fed;                // set after the first non-empty feed
+};
+
+typedef struct mchtml_stream_t mchtml_stream;
+
+void mchtml_buffer_init(mchtml_buffer *out, mchtml_write write, void *user);
+void mchtml_buffer_flush(mchtml_buffer *out);
+void mchtml_buffer_free(mchtml_buffer *out);
+
+// Document parts before and after the lines.
+void mchtml_begin(mchtml_buffer *out, const mchtml_options *options);
+void mchtml_end(mchtml_buffer *out, const mchtml_options *options);
+
+// Renders one line without its line terminator, followed by \n.
+void mchtml_line(mchtml_buffer *out, const char *line, size_t len);
+
+// Renders all lines of a buffer. Lines end with \n, \r\n or \r, the
+// last line may have no terminator. No lines are dropped.
+void mchtml_lines(mchtml_buffer *out, const char *text, size_t len);
+
+// Narrows a complete input to the lines that are rendered: drops a
+// UTF-8 byte order mark and leading and trailing line breaks. If the
+// result is empty, a single empty line is rendered.
+void mchtml_trim(const char **text, size_t *len);
+
+// Streaming interface: feed arbitrary chunks of the input, then finish.
+// The caller writes mchtml_begin() before and mchtml_end() after.
+void mchtml_stream_init(mchtml_stream *st, mchtml_buffer *out);
+int mchtml_stream_feed(mchtml_stream *st, const char *data, size_t len);
+int mchtml_stream_finish(mchtml_stream *st);
+
+#endif // !defined(__MCHTML_H__)
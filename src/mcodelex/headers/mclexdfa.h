@@ -0,0 +1,66 @@
+#if !defined(__MCLEXDFA_H__)
+#define __MCLEXDFA_H__
+
+#include <stddef.h>
+
+#include "mcodelex.h"
+
+// Table-driven MCODE tokenizer.
+//
+// The tables in mclexdfatab.c are generated by mcodeiro -d from the
+// same grammar model that it prints for Iro, so grammar changes reach
+// this lexer without porting. Every lexer context (main and the
+// contexts pushed until the end of the line) is one deterministic
+// automaton over byte classes. At each position the first byte selects
+// the start from a 256-entry dispatch table, then the automaton runs
+// until it dies and the last accepting state names the rule. Each byte
+// is looked at a bounded number of times, there is no backtracking.
+//
+// Spans are reported like mclex_line(), with the context and styles of
+// the grammar rule that matched.
+
+#define MCLEX_DFA_MAX_GROUPS    2
+#define MCLEX_DFA_MAX_RULES     254
+
+struct mclex_dfa_rule_t {
+    const char *context;                        // context of the pattern
+    signed char push;                           // lexer to switch to, or -1
+    unsigned char group_count;
+    const char *styles[MCLEX_DFA_MAX_GROUPS];   // one per group
+    short splits[MCLEX_DFA_MAX_GROUPS - 1];     // automata ending the groups but the last
+};
+
+typedef struct mclex_dfa_rule_t mclex_dfa_rule;
+
+// State 0 is dead. Whether a state accepts depends on whether the next
+// character is a word character, the start of a lexer on whether the
+// previous one is.
+struct mclex_dfa_t {
+    int state_count;
+    int class_count;
+    int lexer_count;                    // lexer 0 is main
+    int rule_count;
+    const unsigned char *byte_class;    // [256]
+    const unsigned short *next;         // [state * class_count + class]
+    const unsigned char *accept;        // [state * 2 + next_word], rule + 1
+    const unsigned short *dispatch;     // [(lexer * 2 + prev_word) * 256 + byte]
+    const unsigned short *split_start;  // [split * 2 + prev_word]
+    const mclex_dfa_rule *rules;
+};
+
+typedef struct mclex_dfa_t mclex_dfa;
+
+extern const mclex_dfa mclex_dfa_tables;
+
+// Maps the context and style names of the rules to MCLEX ids. Called by
+// mclex_setup().
+void mclex_dfa_setup(void);
+
+// Same as mclex_line() with the generated tables.
+void mclex_dfa_line(const char *line, size_t len, size_t base, mclex_emit emit, void *user);
+
+// Same as mclex_dfa_line(), adds its work to the counters in prof.
+void mclex_dfa_profile_line(const char *line, size_t len, size_t base, mclex_emit emit, void *user,
+    mclex_profile *prof);
+
+#endif // !defined(__MCLEXDFA_H__)
@@ -0,0 +1,148 @@
+#if !defined(__MCODELEX_H__)
+#define __MCODELEX_H__
+
+#include <stddef.h>
+
+// Single-pass MCODE tokenizer.
+//
+// The tokenizer implements the grammar written by mcodeiro without any
+// regular expressions. Contexts and styles have the same names as the
+// CTX_* and STYLE_* identifiers in mcodeiro.c. Like TextMate, the lexer
+// works line by line: every pushed context ends at the end of the line,
+// so lexer state never crosses a newline.
+//
+// The lexer only reports styled spans. Characters that fall through to
+// the grammar's fallback rule are not reported.
+
+// styles, same order as style_definitions[] in mcodeiro.c
+#define MCLEX_STYLE_COMMENT         0
+#define MCLEX_STYLE_ANNOTATION      1
+#define MCLEX_STYLE_ERROR           2
+#define MCLEX_STYLE_DIRECTIVE       3
+#define MCLEX_STYLE_LABEL           4
+#define MCLEX_STYLE_MNEMONIC        5
+#define MCLEX_STYLE_OPERAND         6
+#define MCLEX_STYLE_STRING          7
+#define MCLEX_STYLE_DECIMAL         8
+#define MCLEX_STYLE_HEXADECIMAL     9
+#define MCLEX_STYLE_CODE            10
+#define MCLEX_STYLE_COUNT           11
+
+// contexts, same order as the CTX_* identifiers in mcodeiro.c
+#define MCLEX_CTX_MAIN                  0
+#define MCLEX_CTX_COMMENT               1
+#define MCLEX_CTX_ANNOTATION            2
+#define MCLEX_CTX_DATA                  3
+#define MCLEX_CTX_STRING                4
+#define MCLEX_CTX_DEC_NUMBER            5
+#define MCLEX_CTX_HEX_NUMBER            6
+#define MCLEX_CTX_ADDRESS               7
+#define MCLEX_CTX_CODE                  8
+#define MCLEX_CTX_LOCAL_LABEL           9
+#define MCLEX_CTX_GLOBAL_LABEL          10
+#define MCLEX_CTX_SIMPLE_DIRECTIVE      11
+#define MCLEX_CTX_STRING_DIRECTIVE      12
+#define MCLEX_CTX_NUMBER_DIRECTIVE      13
+#define MCLEX_CTX_ADDRESS_DIRECTIVE     14
+#define MCLEX_CTX_SYMBOL_DIRECTIVE      15
+#define MCLEX_CTX_CODE_LITERAL          16
+#define MCLEX_CTX_INSTRUCTION_NONE      17
+#define MCLEX_CTX_INSTRUCTION_NUMBER    18
+#define MCLEX_CTX_INSTRUCTION_ADDRESS   19
+#define MCLEX_CTX_INSTRUCTION_REGISTER  20
+#define MCLEX_CTX_INSTRUCTION_CLASS2    21
+#define MCLEX_CTX_INSTRUCTION_CLASS3    22
+#define MCLEX_CTX_INSTRUCTION_SPECIAL1  23
+#define MCLEX_CTX_INSTRUCTION_SPECIAL2  24
+#define MCLEX_CTX_TEF                   25
+#define MCLEX_CTX_REGISTER              26
+#define MCLEX_CTX_POS_DISPLACEMENT      27
+#define MCLEX_CTX_NEG_DISPLACEMENT      28
+#define MCLEX_CTX_COUNT                 29
+
+struct mclex_span_t {
+    size_t offset;          // byte offset from the start of the input
+    size_t length;          // length in bytes
+    unsigned char style;    // MCLEX_STYLE_*
+    unsigned char context;  // MCLEX_CTX_* of the pattern that matched
+};
+
+typedef struct mclex_span_t mclex_span;
+
+typedef void (*mclex_emit)(void *user, const mclex_span *span);
+
+// Instrumentation counters, filled by mclex_profile_line() and
+// mclex_dfa_profile_line() and indexed by the lexer context (main or
+// the context pushed until the end of the line) and the context of the
+// pattern; MCLEX_PROFILE_FALLBACK counts the characters that fell
+// through to the fallback rule. Context names are stable between
+// grammar versions, so profiles of different versions can be compared.
+//
+// mclex_line() tries the includes of a context one by one: an attempt
+// is one include whose first character fits. The generated lexer tries
+// all patterns of a context in one scan: every scan is one attempt,
+// counted for the pattern that won or for the fallback rule.
+#define MCLEX_PROFILE_FALLBACK  MCLEX_CTX_COUNT
+
+struct mclex_profile_entry_t {
+    unsigned long long attempts;
+    unsigned long long matches;         // characters for the fallback rule
+    unsigned long long nanoseconds;     // time spent matching
+};
+
+typedef struct mclex_profile_entry_t mclex_profile_entry;
+
+struct mclex_profile_t {
+    mclex_profile_entry entries[MCLEX_CTX_COUNT][MCLEX_CTX_COUNT + 1];
+    unsigned long long lines;
+};
+
+typedef struct mclex_profile_t mclex_profile;
+
+// Lexes one line, mclex_line() or mclex_dfa_line().
+typedef void (*mclex_lexer)(const char *line, size_t len, size_t base, mclex_emit emit, void *user);
+
+struct mclex_stream_t {
+    mclex_emit emit;
+    void *user;
+    mclex_lexer lexer;      // mclex_line unless changed after init
+    mclex_profile *profile; // counters to fill, 0 unless changed after init
+    size_t offset;          // input offset of the pending partial line
+    char *pending;          // partial line carried over between feeds
+    size_t pending_len;
+    size_t pending_size;
+};
+
+typedef struct mclex_stream_t mclex_stream;
+
+extern const char *mclex_style_names[MCLEX_STYLE_COUNT];
+extern const char *mclex_style_classes[MCLEX_STYLE_COUNT];
+extern const char *mclex_style_scopes[MCLEX_STYLE_COUNT];
+extern const char *mclex_context_names[MCLEX_CTX_COUNT];
+
+// Builds the mnemonic lookup tables from inst[]. Called implicitly by
+// mclex_stream_init(); call it once before lexing from several threads.
+void mclex_setup(void);
+
+// Lexes one line without its line terminator. Spans are reported with
+// offsets relative to the given base offset.
+void mclex_line(const char *line, size_t len, size_t base, mclex_emit emit, void *user);
+
+// Same as mclex_line(), adds its work to the counters in prof.
+void mclex_profile_line(const char *line, size_t len, size_t base, mclex_emit emit, void *user,
+    mclex_profile *prof);
+
+// Wall clock of the profiler in nanoseconds.
+unsigned long long mclex_clock(void);
+
+// Lexes a complete buffer that may contain any number of lines.
+void mclex_buffer(const char *text, size_t len, size_t base, mclex_emit emit, void *user);
+
+// Streaming interface: feed arbitrary chunks, then finish. Returns 0 on
+// success and -1 if a partial line could not be buffered. With a
+// profile, mclex_line and mclex_dfa_line run their profiled versions.
+void mclex_stream_init(mclex_stream *st, mclex_emit emit, void *user);
+int mclex_stream_feed(mclex_stream *st, const char *data, size_t len);
+int mclex_stream_finish(mclex_stream *st);
+
+#endif // !defined(__MCODELEX_H__)
@@ -0,0 +1,433 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcinstr.h"
+#include "mccheck.h"
+#include "mcodelex.h"
+#include "mcdoc.h"
+
+#define DOC_CLEAN   ((size_t) -1)  // dirty_first without changes
+
+struct token_sink_t {
+    doc_line *line;
+    int utf16;
+    size_t size;
+    size_t last;                // start of the previous token
+    int failed;
+};
+
+typedef struct token_sink_t token_sink;
+
+static size_t utf16_length(const char *s, size_t n)
+{
+    size_t units = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned char ch = s[i];
+        if ((ch & 0xC0) != 0x80) {
+            units += ch >= 0xF0 ? 2 : 1;
+        }
+    }
+    return units;
+}
+
+static void add_token(void *user, const mclex_span *span)
+{
+    token_sink *sink = (token_sink *) user;
+    doc_line *l = sink->line;
+    size_t start = span->offset;
+    size_t length = span->length;
+    if (sink->failed) {
+        return;
+    }
+    if (span->style == MCLEX_STYLE_ERROR && l->error_start < 0) {
+        l->error_start = (int) span->offset;
+        l->error_length = (int) span->length;
+    }
+    if (!l->ascii && sink->utf16) {
+        length = utf16_length(l->text + start, length);
+        start = utf16_length(l->text, start);
+    }
+    if ((l->token_count + 1) * DOC_TOKEN_SIZE > sink->size) {
+        size_t size = sink->size ? 2 * sink->size : 8 * DOC_TOKEN_SIZE;
+        unsigned *tokens = realloc(l->tokens, size * sizeof(unsigned));
+        if (!tokens) {
+            sink->failed = 1;
+            return;
+        }
+        l->tokens = tokens;
+        sink->size = size;
+    }
+    unsigned *t = l->tokens + l->token_count * DOC_TOKEN_SIZE;
+    t[0] = 0;
+    t[1] = (unsigned) (start - (l->token_count ? sink->last : 0));
+    t[2] = (unsigned) length;
+    t[3] = span->style;
+    t[4] = 0;
+    sink->last = start;
+    l->token_count++;
+}
+
+// Checks the statement the way mcodeasm reads the line and keeps the
+// set directive, the instruction word, the first problem and the
+// labels.
+static void check_statement(doc_line *l)
+{
+    inst_check result;
+    inst_check_line(l->text, l->len, &result);
+    l->set = (unsigned char) result.set;
+    l->word_sets = result.inst >= 0 ? inst[result.inst].set : 0;
+    l->word_start = result.word_start;
+    l->word_length = result.word_length;
+    l->check = result.code;
+    l->check_start = result.start;
+    l->check_length = result.length;
+    l->label_start = result.label_start;
+    l->label_length = result.label_length;
+    l->target_start = result.target_start;
+    l->target_length = result.target_length;
+    l->label_name = -1;
+    l->target_name = -1;
+}
+
+static int analyze_line(doc_line *l, int utf16)
+{
+    token_sink sink = { l, utf16, 0, 0, 0 };
+    l->ascii = 1;
+    for (unsigned i = 0; i < l->len; i++) {
+        if ((unsigned char) l->text[i] >= 0x80) {
+            l->ascii = 0;
+            break;
+        }
+    }
+    l->error_start = -1;
+    l->error_length = 0;
+    mclex_line(l->text, l->len, 0, add_token, &sink);
+    if (sink.failed) {
+        return -1;
+    }
+    check_statement(l);
+    return 0;
+}
+
+static void free_line(doc_line *l)
+{
+    free(l->text);
+    free(l->tokens);
+}
+
+// Sets the text of a new line to a, b and c. Without c, b ended at a
+// line break and loses the \r of a \r\n.
+static int set_line_text(doc_line *l, const char *a, size_t alen, const char *b, size_t blen,
+    const char *c, size_t clen)
+{
+    if (!c && blen > 0 && b[blen - 1] == '\r') {
+        blen--;
+    }
+    size_t len = alen + blen + clen;
+    l->text = malloc(len + 1);
+    if (!l->text) {
+        return -1;
+    }
+    memcpy(l->text, a, alen);
+    memcpy(l->text + alen, b, blen);
+    if (clen) {
+        memcpy(l->text + alen + blen, c, clen);
+    }
+    l->text[len] = '\0';
+    l->len = (unsigned) len;
+    return 0;
+}
+
+document *doc_open(const char *uri, const char *text, size_t len, int utf16)
+{
+    document *doc = calloc(1, sizeof(document));
+    if (!doc) {
+        return NULL;
+    }
+    doc->uri = malloc(strlen(uri) + 1);
+    doc->lines = calloc(1, sizeof(doc_line));
+    if (!doc->uri || !doc->lines) {
+        doc_free(doc);
+        return NULL;
+    }
+    strcpy(doc->uri, uri);
+    doc->count = 1;
+    doc->size = 1;
+    doc->utf16 = utf16;
+    if (set_line_text(&doc->lines[0], "", 0, "", 0, NULL, 0) || analyze_line(&doc->lines[0], utf16) ||
+        doc_set_text(doc, text, len)) {
+        doc_free(doc);
+        return NULL;
+    }
+    return doc;
+}
+
+void doc_free(document *doc)
+{
+    for (size_t i = 0; i < doc->count; i++) {
+        free_line(&doc->lines[i]);
+    }
+    free(doc->lines);
+    free(doc->uri);
+    free(doc->tokens.data);
+    free(doc->diagnostics);
+    free(doc);
+}
+
+int doc_set_text(document *doc, const char *text, size_t len)
+{
+    doc_line *last = &doc->lines[doc->count - 1];
+    return doc_replace(doc, 0, 0, doc->count - 1, last->len, text, len);
+}
+
+int doc_replace(document *doc, size_t line, size_t column, size_t end_line, size_t end_column,
+    const char *text, size_t len)
+{
+    if (line >= doc->count) {
+        line = doc->count - 1;
+        column = doc->lines[line].len;
+    }
+    if (end_line >= doc->count) {
+        end_line = doc->count - 1;
+        end_column = doc->lines[end_line].len;
+    }
+    if (end_line < line || (end_line == line && end_column < column)) {
+        end_line = line;
+        end_column = column;
+    }
+    doc_line *first = &doc->lines[line];
+    doc_line *last = &doc->lines[end_line];
+    if (column > first->len) {
+        column = first->len;
+    }
+    if (end_column > last->len) {
+        end_column = last->len;
+    }
+
+    size_t breaks = 0;
+    for (const char *p = text; (p = memchr(p, '\n', text + len - p)); p++) {
+        breaks++;
+    }
+    size_t count = doc->count - (end_line - line) + breaks;
+    if (count > doc->size) {
+        size_t size = 2 * doc->size;
+        while (size < count) {
+            size *= 2;
+        }
+        doc_line *lines = realloc(doc->lines, size * sizeof(doc_line));
+        if (!lines) {
+            return -1;
+        }
+        doc->lines = lines;
+        doc->size = size;
+        first = &doc->lines[line];
+        last = &doc->lines[end_line];
+    }
+
+    // the lines written after the first one, the last gets the suffix
+    doc_line *added = breaks ? calloc(breaks, sizeof(doc_line)) : NULL;
+    if (breaks && !added) {
+        return -1;
+    }
+    const char *suffix = last->text + end_column;
+    size_t suffix_len = last->len - end_column;
+    const char *p = text;
+    const char *nl = memchr(p, '\n', len);
+    for (size_t i = 0; i < breaks; i++) {
+        const char *start = nl + 1;
+        const char *next = memchr(start, '\n', text + len - start);
+        const char *eol = next ? next : text + len;
+        int failed = i + 1 < breaks ?
+            set_line_text(&added[i], "", 0, start, eol - start, NULL, 0) :
+            set_line_text(&added[i], "", 0, start, eol - start, suffix, suffix_len);
+        if (failed || analyze_line(&added[i], doc->utf16)) {
+            for (size_t j = 0; j <= i; j++) {
+                free_line(&added[j]);
+            }
+            free(added);
+            return -1;
+        }
+        nl = next;
+    }
+
+    // the first line keeps its prefix and gets the suffix if nothing
+    // was added after it
+    doc_line head = { 0 };
+    const char *eol = breaks ? memchr(p, '\n', len) : text + len;
+    if (set_line_text(&head, first->text, column, p, eol - p, breaks ? NULL : suffix, breaks ? 0 : suffix_len) ||
+        analyze_line(&head, doc->utf16)) {
+        free_line(&head);
+        for (size_t j = 0; j < breaks; j++) {
+            free_line(&added[j]);
+        }
+        free(added);
+        return -1;
+    }
+
+    for (size_t i = line; i <= end_line; i++) {
+        doc->token_count -= doc->lines[i].token_count;
+        free_line(&doc->lines[i]);
+    }
+    memmove(&doc->lines[line + 1 + breaks], &doc->lines[end_line + 1],
+        (doc->count - end_line - 1) * sizeof(doc_line));
+    doc->lines[line] = head;
+    if (breaks) {
+        memcpy(&doc->lines[line + 1], added, breaks * sizeof(doc_line));
+    }
+    for (size_t i = line; i <= line + breaks; i++) {
+        doc->token_count += doc->lines[i].token_count;
+    }
+    doc->count = count;
+    free(added);
+
+    // lines after the written ones are unchanged, counted from the end
+    if (line < doc->dirty_first) {
+        doc->dirty_first = line;
+    }
+    if (count - (line + breaks + 1) < doc->clean_tail) {
+        doc->clean_tail = count - (line + breaks + 1);
+    }
+    return 0;
+}
+
+size_t doc_byte_column(const document *doc, size_t line, size_t character)
+{
+    if (line >= doc->count) {
+        return 0;
+    }
+    const doc_line *l = &doc->lines[line];
+    if (l->ascii || !doc->utf16) {
+        return character < l->len ? character : l->len;
+    }
+    size_t units = 0;
+    size_t i = 0;
+    while (i < l->len && units < character) {
+        unsigned char ch = l->text[i++];
+        units += ch >= 0xF0 ? 2 : 1;
+        while (i < l->len && ((unsigned char) l->text[i] & 0xC0) == 0x80) {
+            i++;
+        }
+    }
+    return i;
+}
+
+size_t doc_char_column(const document *doc, size_t line, size_t byte)
+{
+    if (line >= doc->count) {
+        return 0;
+    }
+    const doc_line *l = &doc->lines[line];
+    if (byte > l->len) {
+        byte = l->len;
+    }
+    return l->ascii || !doc->utf16 ? byte : utf16_length(l->text, byte);
+}
+
+static int reserve_tokens(doc_tokens *t, size_t len)
+{
+    if (len > t->size) {
+        unsigned *data = realloc(t->data, len * sizeof(unsigned));
+        if (!data) {
+            return -1;
+        }
+        t->data = data;
+        t->size = len;
+    }
+    return 0;
+}
+
+// Encodes the tokens of lines first up to end, the first one relative
+// to the last token on previous_line.
+static void encode_lines(document *doc, size_t first, size_t end, size_t previous_line)
+{
+    doc_tokens *t = &doc->tokens;
+    t->len = 0;
+    for (size_t i = first; i < end; i++) {
+        const doc_line *l = &doc->lines[i];
+        if (l->token_count) {
+            memcpy(t->data + t->len, l->tokens, l->token_count * DOC_TOKEN_SIZE * sizeof(unsigned));
+            t->data[t->len] = (unsigned) (i - previous_line);
+            t->len += l->token_count * DOC_TOKEN_SIZE;
+            previous_line = i;
+        }
+    }
+}
+
+static void next_result(document *doc)
+{
+    doc->result_id++;
+    doc->result_len = doc->token_count * DOC_TOKEN_SIZE;
+    doc->dirty_first = DOC_CLEAN;
+    doc->clean_tail = DOC_CLEAN;
+}
+
+int doc_full_tokens(document *doc)
+{
+    if (reserve_tokens(&doc->tokens, doc->token_count * DOC_TOKEN_SIZE)) {
+        return -1;
+    }
+    encode_lines(doc, 0, doc->count, 0);
+    next_result(doc);
+    return 0;
+}
+
+int doc_delta_tokens(document *doc, size_t *start, size_t *delete_count)
+{
+    size_t first = doc->dirty_first;
+    size_t end = doc->count - doc->clean_tail;
+    size_t previous_line = first;
+    size_t prefix = 0;
+    size_t middle = 0;
+    size_t suffix = 0;
+    if (first == DOC_CLEAN) {
+        doc->tokens.len = 0;
+        *start = 0;
+        *delete_count = 0;
+        next_result(doc);
+        return 0;
+    }
+    // the first token after the change is relative to the last one in it
+    while (end < doc->count && !doc->lines[end].token_count) {
+        end++;
+    }
+    if (end < doc->count) {
+        end++;
+    }
+    while (previous_line > 0 && !doc->lines[previous_line - 1].token_count) {
+        previous_line--;
+    }
+    previous_line = previous_line > 0 ? previous_line - 1 : 0;
+    for (size_t i = first; i < end; i++) {
+        middle += doc->lines[i].token_count;
+    }
+    // count the shorter side, the other one is what remains
+    if (first < doc->count - end) {
+        for (size_t i = 0; i < first; i++) {
+            prefix += doc->lines[i].token_count;
+        }
+        suffix = doc->token_count - prefix - middle;
+    } else {
+        for (size_t i = end; i < doc->count; i++) {
+            suffix += doc->lines[i].token_count;
+        }
+        prefix = doc->token_count - suffix - middle;
+    }
+    if (reserve_tokens(&doc->tokens, middle * DOC_TOKEN_SIZE)) {
+        return -1;
+    }
+    encode_lines(doc, first, end, previous_line);
+    *start = prefix * DOC_TOKEN_SIZE;
+    *delete_count = doc->result_len - (prefix + suffix) * DOC_TOKEN_SIZE;
+    next_result(doc);
+    return 0;
+}
+
+int doc_set_at(const document *doc, size_t line, int set)
+{
+    for (size_t i = 0; i < line && i < doc->count; i++) {
+        if (doc->lines[i].set) {
+            set = doc->lines[i].set;
+        }
+    }
+    return set;
+}
@@ -0,0 +1,106 @@
+#if !defined(__MCDOC_H__)
+#define __MCDOC_H__
+
+#include <stddef.h>
+
+// Open document of the language server.
+//
+// The text is kept as an array of lines without their line ends (\n or
+// \r\n). Every line caches its semantic tokens and what the diagnostics
+// need from it; both depend on the line alone, because lexer state
+// never crosses a line end. An edit replaces a range of lines and lexes
+// only the lines it wrote. The document remembers which lines changed
+// since the last semantic tokens result, so a delta encodes just those;
+// apart from moving the line array, a keystroke costs the same in a
+// document of any size.
+//
+// Columns are counted in characters of the negotiated position
+// encoding: bytes for UTF-8, code units for UTF-16. Lines without bytes
+// above 0x7F use byte columns in both.
+
+#define DOC_TOKEN_SIZE  5       // numbers per token in semantic token data
+
+struct doc_line_t {
+    char *text;
+    unsigned len;               // in bytes
+    unsigned *tokens;           // DOC_TOKEN_SIZE per token, the first one
+    unsigned token_count;       // relative to the start of the line
+    unsigned char ascii;        // no byte above 0x7F
+    unsigned char set;          // SET_* selected by a directive, or 0
+    unsigned char word_sets;    // sets with the instruction word, 0 if unknown
+    int word_start;             // instruction word in bytes, -1 if none
+    int word_length;
+    int check;                  // CHECK_* of the statement
+    int check_start;            // its text in bytes
+    int check_length;
+    int label_start;            // label defined by the line in bytes,
+    int label_length;           // with brackets, -1 if none
+    int target_start;           // label of the operand, -1 if none
+    int target_length;
+    int label_name;             // both in the label index of the server,
+    int target_name;            // -1 until it interns them
+    int error_start;            // *** ERROR annotation in bytes, -1 if none
+    int error_length;
+};
+
+typedef struct doc_line_t doc_line;
+
+struct doc_tokens_t {
+    unsigned *data;
+    size_t len;
+    size_t size;
+};
+
+typedef struct doc_tokens_t doc_tokens;
+
+struct document_t {
+    char *uri;
+    long long version;
+    int utf16;                  // columns in UTF-16 code units
+    doc_line *lines;            // at least one
+    size_t count;
+    size_t size;
+    size_t token_count;         // of all lines
+    doc_tokens tokens;          // encoded by the last doc_*_tokens()
+    long long result_id;        // of the last result, 0 before the first
+    size_t result_len;          // numbers in the last result
+    size_t dirty_first;         // lines changed since the last result are
+    size_t clean_tail;          // dirty_first up to count - clean_tail
+    char *diagnostics;          // last published, as JSON
+    size_t diagnostics_len;
+    int label_file;             // in the label index of the server
+};
+
+typedef struct document_t document;
+
+// Returns the document or NULL if memory ran out.
+document *doc_open(const char *uri, const char *text, size_t len, int utf16);
+void doc_free(document *doc);
+
+// Replaces the text between two positions given as line and byte
+// column, or all of it with a NULL start. Positions beyond the end are
+// clamped. Returns 0 or -1 if memory ran out, in which case the
+// document is left unchanged.
+int doc_replace(document *doc, size_t line, size_t column, size_t end_line, size_t end_column,
+    const char *text, size_t len);
+int doc_set_text(document *doc, const char *text, size_t len);
+
+// Conversion between character and byte columns of one line.
+size_t doc_byte_column(const document *doc, size_t line, size_t character);
+size_t doc_char_column(const document *doc, size_t line, size_t byte);
+
+// Encodes the semantic tokens of all lines in tokens as the next
+// result. Returns 0 or -1 if memory ran out.
+int doc_full_tokens(document *doc);
+
+// Encodes the change since the last result as one edit of it: the
+// numbers from start on, delete_count of them, are replaced by tokens.
+// Only the changed lines and the first line with tokens after them are
+// encoded. Returns 0 or -1 if memory ran out.
+int doc_delta_tokens(document *doc, size_t *start, size_t *delete_count);
+
+// Instruction set in effect at the start of the line, starting with
+// set in the first.
+int doc_set_at(const document *doc, size_t line, int set);
+
+#endif // !defined(__MCDOC_H__)
@@ -0,0 +1,421 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcjson.h"
+
+#define MAX_DEPTH   256
+
+struct parser_t {
+    char *p;
+    char *end;
+    json_doc *doc;
+    int depth;
+};
+
+typedef struct parser_t parser;
+
+static json_value *parse_value(parser *ps);
+
+static void skip_space(parser *ps)
+{
+    while (ps->p < ps->end && (*ps->p == ' ' || *ps->p == '\t' || *ps->p == '\r' || *ps->p == '\n')) {
+        ps->p++;
+    }
+}
+
+static json_value *new_value(parser *ps, int type)
+{
+    json_value *v = &ps->doc->values[ps->doc->count++];
+    memset(v, 0, sizeof(*v));
+    v->type = type;
+    return v;
+}
+
+static int hex_digits(const char *s, unsigned *value)
+{
+    *value = 0;
+    for (int i = 0; i < 4; i++) {
+        char ch = s[i];
+        int d = ch >= '0' && ch <= '9' ? ch - '0' :
+                ch >= 'a' && ch <= 'f' ? ch - 'a' + 10 :
+                ch >= 'A' && ch <= 'F' ? ch - 'A' + 10 : -1;
+        if (d < 0) {
+            return -1;
+        }
+        *value = *value << 4 | d;
+    }
+    return 0;
+}
+
+static char *put_utf8(char *out, unsigned cp)
+{
+    if (cp < 0x80) {
+        *out++ = (char) cp;
+    } else if (cp < 0x800) {
+        *out++ = (char) (0xC0 | cp >> 6);
+        *out++ = (char) (0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        *out++ = (char) (0xE0 | cp >> 12);
+        *out++ = (char) (0x80 | (cp >> 6 & 0x3F));
+        *out++ = (char) (0x80 | (cp & 0x3F));
+    } else {
+        *out++ = (char) (0xF0 | cp >> 18);
+        *out++ = (char) (0x80 | (cp >> 12 & 0x3F));
+        *out++ = (char) (0x80 | (cp >> 6 & 0x3F));
+        *out++ = (char) (0x80 | (cp & 0x3F));
+    }
+    return out;
+}
+
+// Unescapes the string at p in place. An escape never gets longer than
+// its UTF-8 encoding, so the output never overtakes the input.
+static char *parse_string(parser *ps, size_t *length)
+{
+    char *start = ++ps->p;
+    char *out = start;
+    while (ps->p < ps->end && *ps->p != '"') {
+        char ch = *ps->p++;
+        if ((unsigned char) ch < 0x20) {
+            return NULL;
+        }
+        if (ch != '\\') {
+            *out++ = ch;
+            continue;
+        }
+        if (ps->p == ps->end) {
+            return NULL;
+        }
+        ch = *ps->p++;
+        switch (ch) {
+            case '"':
+            case '\\':
+            case '/':
+                *out++ = ch;
+                break;
+            case 'b':
+                *out++ = '\b';
+                break;
+            case 'f':
+                *out++ = '\f';
+                break;
+            case 'n':
+                *out++ = '\n';
+                break;
+            case 'r':
+                *out++ = '\r';
+                break;
+            case 't':
+                *out++ = '\t';
+                break;
+            case 'u': {
+                unsigned cp;
+                unsigned low;
+                if (ps->end - ps->p < 4 || hex_digits(ps->p, &cp)) {
+                    return NULL;
+                }
+                ps->p += 4;
+                if (cp >= 0xD800 && cp < 0xDC00 && ps->end - ps->p >= 6 && ps->p[0] == '\\' && ps->p[1] == 'u' &&
+                    hex_digits(ps->p + 2, &low) == 0 && low >= 0xDC00 && low < 0xE000) {
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    ps->p += 6;
+                }
+                out = put_utf8(out, cp);
+                break;
+            }
+            default:
+                return NULL;
+        }
+    }
+    if (ps->p == ps->end) {
+        return NULL;
+    }
+    ps->p++;
+    *out = '\0';
+    *length = out - start;
+    return start;
+}
+
+static json_value *parse_container(parser *ps, int type)
+{
+    char close = type == JSON_ARRAY ? ']' : '}';
+    json_value *v = new_value(ps, type);
+    json_value **last = &v->child;
+    if (++ps->depth > MAX_DEPTH) {
+        return NULL;
+    }
+    ps->p++;
+    skip_space(ps);
+    if (ps->p < ps->end && *ps->p == close) {
+        ps->p++;
+        ps->depth--;
+        return v;
+    }
+    for (;;) {
+        const char *key = NULL;
+        size_t length;
+        if (type == JSON_OBJECT) {
+            skip_space(ps);
+            if (ps->p == ps->end || *ps->p != '"' || !(key = parse_string(ps, &length))) {
+                return NULL;
+            }
+            skip_space(ps);
+            if (ps->p == ps->end || *ps->p++ != ':') {
+                return NULL;
+            }
+        }
+        json_value *item = parse_value(ps);
+        if (!item) {
+            return NULL;
+        }
+        item->key = key;
+        *last = item;
+        last = &item->next;
+        skip_space(ps);
+        if (ps->p == ps->end) {
+            return NULL;
+        }
+        char ch = *ps->p++;
+        if (ch == close) {
+            break;
+        } else if (ch != ',') {
+            return NULL;
+        }
+    }
+    ps->depth--;
+    return v;
+}
+
+static int parse_literal(parser *ps, const char *word)
+{
+    size_t n = strlen(word);
+    if ((size_t) (ps->end - ps->p) < n || memcmp(ps->p, word, n) != 0) {
+        return -1;
+    }
+    ps->p += n;
+    return 0;
+}
+
+static json_value *parse_value(parser *ps)
+{
+    json_value *v;
+    skip_space(ps);
+    if (ps->p == ps->end) {
+        return NULL;
+    }
+    switch (*ps->p) {
+        case '{':
+            return parse_container(ps, JSON_OBJECT);
+        case '[':
+            return parse_container(ps, JSON_ARRAY);
+        case '"':
+            v = new_value(ps, JSON_STRING);
+            v->string = parse_string(ps, &v->length);
+            return v->string ? v : NULL;
+        case 't':
+            return parse_literal(ps, "true") ? NULL : new_value(ps, JSON_TRUE);
+        case 'f':
+            return parse_literal(ps, "false") ? NULL : new_value(ps, JSON_FALSE);
+        case 'n':
+            return parse_literal(ps, "null") ? NULL : new_value(ps, JSON_NULL);
+        default: {
+            // the text is followed by a writable byte, so strtod() stops
+            char *end;
+            char saved = *ps->end;
+            *ps->end = '\0';
+            double number = strtod(ps->p, &end);
+            *ps->end = saved;
+            if (end == ps->p || !(*ps->p == '-' || (*ps->p >= '0' && *ps->p <= '9'))) {
+                return NULL;
+            }
+            ps->p = end;
+            v = new_value(ps, JSON_NUMBER);
+            v->number = number;
+            return v;
+        }
+    }
+}
+
+json_value *json_parse(json_doc *doc, char *text, size_t len)
+{
+    // every value but the root follows a '[', ',' or ':'
+    size_t count = 1;
+    for (size_t i = 0; i < len; i++) {
+        count += text[i] == '[' || text[i] == ',' || text[i] == ':';
+    }
+    doc->values = malloc(count * sizeof(json_value));
+    doc->count = 0;
+    doc->size = count;
+    if (!doc->values) {
+        return NULL;
+    }
+    parser ps = { text, text + len, doc, 0 };
+    json_value *root = parse_value(&ps);
+    skip_space(&ps);
+    return ps.p == ps.end ? root : NULL;
+}
+
+void json_doc_free(json_doc *doc)
+{
+    free(doc->values);
+    memset(doc, 0, sizeof(*doc));
+}
+
+const json_value *json_get(const json_value *value, const char *key)
+{
+    if (!value || value->type != JSON_OBJECT) {
+        return NULL;
+    }
+    for (const json_value *v = value->child; v; v = v->next) {
+        if (strcmp(v->key, key) == 0) {
+            return v;
+        }
+    }
+    return NULL;
+}
+
+const char *json_string(const json_value *value)
+{
+    return value && value->type == JSON_STRING ? value->string : NULL;
+}
+
+long long json_int(const json_value *value, long long missing)
+{
+    return value && value->type == JSON_NUMBER ? (long long) value->number : missing;
+}
+
+void json_buffer_init(json_buffer *b)
+{
+    memset(b, 0, sizeof(*b));
+}
+
+void json_buffer_free(json_buffer *b)
+{
+    free(b->data);
+    memset(b, 0, sizeof(*b));
+}
+
+int json_reserve(json_buffer *b, size_t n)
+{
+    if (b->failed) {
+        return -1;
+    }
+    if (b->len + n > b->size) {
+        size_t size = b->size ? 2 * b->size : 4096;
+        while (size < b->len + n) {
+            size *= 2;
+        }
+        char *data = realloc(b->data, size);
+        if (!data) {
+            b->failed = 1;
+            return -1;
+        }
+        b->data = data;
+        b->size = size;
+    }
+    return 0;
+}
+
+void json_put_raw(json_buffer *b, const char *s)
+{
+    size_t n = strlen(s);
+    if (json_reserve(b, n) == 0) {
+        memcpy(b->data + b->len, s, n);
+        b->len += n;
+    }
+}
+
+void json_put_string(json_buffer *b, const char *s, size_t len)
+{
+    static const char hex[] = "0123456789abcdef";
+    if (json_reserve(b, 6 * len + 2)) {
+        return;
+    }
+    char *out = b->data + b->len;
+    *out++ = '"';
+    for (size_t i = 0; i < len; i++) {
+        unsigned char ch = s[i];
+        if (ch == '"' || ch == '\\') {
+            *out++ = '\\';
+            *out++ = ch;
+        } else if (ch == '\n') {
+            *out++ = '\\';
+            *out++ = 'n';
+        } else if (ch < 0x20) {
+            memcpy(out, "\\u00", 4);
+            out[4] = hex[ch >> 4];
+            out[5] = hex[ch & 0xF];
+            out += 6;
+        } else {
+            *out++ = ch;
+        }
+    }
+    *out++ = '"';
+    b->len = out - b->data;
+}
+
+void json_put_int(json_buffer *b, long long value)
+{
+    char tmp[24];
+    int i = 0;
+    unsigned long long n = value < 0 ? 0ULL - (unsigned long long) value : (unsigned long long) value;
+    if (json_reserve(b, 21)) {
+        return;
+    }
+    do {
+        tmp[i++] = '0' + n % 10;
+        n /= 10;
+    } while (n);
+    if (value < 0) {
+        b->data[b->len++] = '-';
+    }
+    while (i) {
+        b->data[b->len++] = tmp[--i];
+    }
+}
+
+void json_put_value(json_buffer *b, const json_value *value)
+{
+    char tmp[32];
+    if (!value) {
+        json_put_raw(b, "null");
+        return;
+    }
+    switch (value->type) {
+        case JSON_FALSE:
+            json_put_raw(b, "false");
+            break;
+        case JSON_TRUE:
+            json_put_raw(b, "true");
+            break;
+        case JSON_NUMBER:
+            if (value->number == (double) (long long) value->number) {
+                json_put_int(b, (long long) value->number);
+            } else {
+                snprintf(tmp, sizeof(tmp), "%.17g", value->number);
+                json_put_raw(b, tmp);
+            }
+            break;
+        case JSON_STRING:
+            json_put_string(b, value->string, value->length);
+            break;
+        case JSON_ARRAY:
+        case JSON_OBJECT:
+            json_put_raw(b, value->type == JSON_ARRAY ? "[" : "{");
+            for (const json_value *v = value->child; v; v = v->next) {
+                if (v != value->child) {
+                    json_put_raw(b, ",");
+                }
+                if (v->key) {
+                    json_put_string(b, v->key, strlen(v->key));
+                    json_put_raw(b, ":");
+                }
+                json_put_value(b, v);
+            }
+            json_put_raw(b, value->type == JSON_ARRAY ? "]" : "}");
+            break;
+        default:
+            json_put_raw(b, "null");
+            break;
+    }
+}
@@ -0,0 +1,76 @@
+#if !defined(__MCJSON_H__)
+#define __MCJSON_H__
+
+#include <stddef.h>
+
+// Minimal JSON for the JSON-RPC messages of the language server.
+//
+// json_parse() parses a message in place: strings are unescaped into
+// the message buffer and terminated there, the values are allocated in
+// one block sized by a scan of the message. The values live as long as
+// the message buffer and the json_doc.
+
+#define JSON_NULL       0
+#define JSON_FALSE      1
+#define JSON_TRUE       2
+#define JSON_NUMBER     3
+#define JSON_STRING     4
+#define JSON_ARRAY      5
+#define JSON_OBJECT     6
+
+struct json_value_t {
+    int type;                       // JSON_*
+    const char *key;                // member name, NULL outside objects
+    const char *string;             // JSON_STRING, NUL-terminated
+    size_t length;                  // of string in bytes
+    double number;                  // JSON_NUMBER
+    struct json_value_t *child;     // first element or member
+    struct json_value_t *next;      // next element or member
+};
+
+typedef struct json_value_t json_value;
+
+struct json_doc_t {
+    json_value *values;
+    size_t count;
+    size_t size;
+};
+
+typedef struct json_doc_t json_doc;
+
+// Parses len bytes of text, which must be followed by one writable
+// byte. Returns the root value or NULL if the text is not valid JSON or
+// memory ran out. Free with json_doc_free() in both cases.
+json_value *json_parse(json_doc *doc, char *text, size_t len);
+void json_doc_free(json_doc *doc);
+
+// Member of an object, NULL if value is NULL, not an object or has no
+// such member.
+const json_value *json_get(const json_value *value, const char *key);
+
+// Accessors that accept NULL and values of the wrong type.
+const char *json_string(const json_value *value);
+long long json_int(const json_value *value, long long missing);
+
+// Output buffer. Functions do nothing once memory ran out, failed is
+// then set.
+struct json_buffer_t {
+    char *data;
+    size_t len;
+    size_t size;
+    int failed;
+};
+
+typedef struct json_buffer_t json_buffer;
+
+void json_buffer_init(json_buffer *b);
+void json_buffer_free(json_buffer *b);
+int json_reserve(json_buffer *b, size_t n);
+void json_put_raw(json_buffer *b, const char *s);
+void json_put_string(json_buffer *b, const char *s, size_t len);
+void json_put_int(json_buffer *b, long long value);
+
+// Writes value as JSON, e.g. to echo the id of a request.
+void json_put_value(json_buffer *b, const json_value *value);
+
+#endif // !defined(__MCJSON_H__)
@@ -0,0 +1,1202 @@
+/**********************************************************************
+ * MCODE Language Server
+ *
+ * Serves MCODE sources to editors over the Language Server Protocol,
+ * JSON-RPC messages on stdin and stdout:
+ *
+ *     mcodelsp [-D file] [-i index] [-s hp|jda|zencode] [-t]
+ *
+ * Semantic tokens (full and delta) use the styles of mcodeiro as token
+ * types, so they map to the same scopes as the generated grammars (see
+ * mcodelsp -t). Hover shows the opcode words, the operand range and
+ * the instruction sets of a mnemonic, completion lists the mnemonics of
+ * the instruction set in effect from a prefix tree. Diagnostics are the
+ * *** ERROR annotations and the mnemonics and operands mcodeasm would
+ * reject, see mccheck.h.
+ *
+ * Go to definition and find references work across the files of the
+ * workspace: the .src files in its folders are indexed at start, see
+ * mclabel.h, and every open document replaces the labels of its file
+ * when it changes. A file that is not open is read again when it is
+ * closed or the client reports a change of it. Labels that are not
+ * defined, or defined twice, are diagnostics too. With -i, the index
+ * is saved after the start and at exit and loaded at the next start,
+ * which then reads only the files whose size or modification time
+ * changed; files that are gone drop out.
+ *
+ * Documents are synchronized incrementally and kept as lines with their
+ * tokens, see mcdoc.h: an edit lexes only the lines it wrote. Options:
+ *
+ *     -D file  use the instruction database written by mcinstrgen db
+ *     -i index load the label index from a file and save it
+ *     -s set   initial instruction set (default hp), also taken from
+ *              the initialization option "set"
+ *     -t       print the semanticTokenScopes of the token types
+ *********************************************************************/
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+#include "mcinstr.h"
+#include "mccheck.h"
+#include "mclabel.h"
+#include "mcdb.h"
+#include "mcodelex.h"
+#include "mcjson.h"
+#include "mcdoc.h"
+#include "mctrie.h"
+
+#define MAX_HEADER_SIZE     1024
+#define MAX_DOCUMENTS       256
+#define MAX_COMPLETIONS     500
+#define MAX_DIAGNOSTICS     1000
+#define MAX_FOLDER_DEPTH    16
+
+// JSON-RPC and LSP error codes
+#define PARSE_ERROR             -32700
+#define INVALID_REQUEST         -32600
+#define METHOD_NOT_FOUND        -32601
+#define INVALID_PARAMS          -32602
+#define SERVER_NOT_INITIALIZED  -32002
+
+// LSP constants
+#define SEVERITY_ERROR          1
+#define COMPLETION_KEYWORD      14
+#define SYNC_INCREMENTAL        2
+#define FILE_DELETED            3
+
+struct server_t {
+    mcdb db;
+    mnemonic_trie trie;
+    document *documents[MAX_DOCUMENTS];
+    int document_count;
+    int initialized;
+    int shutdown;
+    int utf16;
+    int set;                    // instruction set at the start of a document
+    json_buffer out;
+    json_buffer diagnostics;    // of the document being published
+    label_index labels;         // of the workspace and the open documents
+    const char *index_path;     // where the label index is saved
+    unsigned char *scanned;     // the files of the loaded index found at start
+    int scan_count;
+    label_site *sites;          // of the document being indexed
+    int site_size;
+    unsigned long resolution;   // of labels at the last diagnostics
+};
+
+typedef struct server_t server;
+
+static const struct {
+    const char *name;
+    int set;
+} set_names[] = {
+    { "hp", SET_HP },
+    { "jda", SET_JDA },
+    { "zencode", SET_ZENCODE }
+};
+
+static int parse_set(const char *name)
+{
+    for (size_t i = 0; name && i < sizeof(set_names) / sizeof(set_names[0]); i++) {
+        if (strcmp(name, set_names[i].name) == 0) {
+            return set_names[i].set;
+        }
+    }
+    return 0;
+}
+
+/*------------------------------- messages ---------------------------------*/
+
+// Reads the body of the next message, NULL at the end of the input. The
+// body is followed by one spare byte for json_parse().
+static char *read_message(size_t *len)
+{
+    char line[MAX_HEADER_SIZE];
+    long long length = -1;
+    for (;;) {
+        if (!fgets(line, sizeof(line), stdin)) {
+            return NULL;
+        }
+        if (strcmp(line, "\r\n") == 0 || strcmp(line, "\n") == 0) {
+            if (length >= 0) {
+                break;
+            }
+        } else if (strncmp(line, "Content-Length:", 15) == 0) {
+            length = strtoll(line + 15, NULL, 10);
+        }
+    }
+    char *body = malloc((size_t) length + 1);
+    if (!body) {
+        return NULL;
+    }
+    if (fread(body, 1, (size_t) length, stdin) != (size_t) length) {
+        free(body);
+        return NULL;
+    }
+    body[length] = '\0';
+    *len = (size_t) length;
+    return body;
+}
+
+static void send_message(server *sv)
+{
+    json_buffer *out = &sv->out;
+    if (!out->failed) {
+        fprintf(stdout, "Content-Length: %lu\r\n\r\n", (unsigned long) out->len);
+        fwrite(out->data, 1, out->len, stdout);
+        fflush(stdout);
+    }
+    out->len = 0;
+    out->failed = 0;
+}
+
+static void begin_response(server *sv, const json_value *id)
+{
+    sv->out.len = 0;
+    json_put_raw(&sv->out, "{\"jsonrpc\":\"2.0\",\"id\":");
+    json_put_value(&sv->out, id);
+    json_put_raw(&sv->out, ",\"result\":");
+}
+
+static void end_response(server *sv)
+{
+    json_put_raw(&sv->out, "}");
+    send_message(sv);
+}
+
+static void send_result(server *sv, const json_value *id, const char *result)
+{
+    begin_response(sv, id);
+    json_put_raw(&sv->out, result);
+    end_response(sv);
+}
+
+static void send_error(server *sv, const json_value *id, int code, const char *message)
+{
+    sv->out.len = 0;
+    json_put_raw(&sv->out, "{\"jsonrpc\":\"2.0\",\"id\":");
+    json_put_value(&sv->out, id);
+    json_put_raw(&sv->out, ",\"error\":{\"code\":");
+    json_put_int(&sv->out, code);
+    json_put_raw(&sv->out, ",\"message\":");
+    json_put_string(&sv->out, message, strlen(message));
+    json_put_raw(&sv->out, "}}");
+    send_message(sv);
+}
+
+static void put_position(json_buffer *b, size_t line, size_t character)
+{
+    json_put_raw(b, "{\"line\":");
+    json_put_int(b, (long long) line);
+    json_put_raw(b, ",\"character\":");
+    json_put_int(b, (long long) character);
+    json_put_raw(b, "}");
+}
+
+// Range of bytes [start, end) of one line.
+static void put_range(json_buffer *b, const document *doc, size_t line, size_t start, size_t end)
+{
+    json_put_raw(b, "{\"start\":");
+    put_position(b, line, doc_char_column(doc, line, start));
+    json_put_raw(b, ",\"end\":");
+    put_position(b, line, doc_char_column(doc, line, end));
+    json_put_raw(b, "}");
+}
+
+/*------------------------------- documents --------------------------------*/
+
+static document *find_document(server *sv, const json_value *params)
+{
+    const char *uri = json_string(json_get(json_get(params, "textDocument"), "uri"));
+    for (int i = 0; uri && i < sv->document_count; i++) {
+        if (strcmp(sv->documents[i]->uri, uri) == 0) {
+            return sv->documents[i];
+        }
+    }
+    return NULL;
+}
+
+static void close_document(server *sv, document *doc)
+{
+    for (int i = 0; i < sv->document_count; i++) {
+        if (sv->documents[i] == doc) {
+            sv->documents[i] = sv->documents[--sv->document_count];
+            break;
+        }
+    }
+    doc_free(doc);
+}
+
+static void put_diagnostic(json_buffer *b, const document *doc, size_t line, size_t start, size_t end,
+    const char *message, size_t len)
+{
+    json_put_raw(b, "{\"range\":");
+    put_range(b, doc, line, start, end);
+    json_put_raw(b, ",\"severity\":");
+    json_put_int(b, SEVERITY_ERROR);
+    json_put_raw(b, ",\"source\":\"mcodelsp\",\"message\":");
+    json_put_string(b, message, len);
+    json_put_raw(b, "}");
+}
+
+// Sends the diagnostics of all lines if they changed since the last
+// time. They are gathered from the line caches; only the instruction
+// set in effect is followed across lines, and labels are looked up in
+// the label index.
+static void publish_diagnostics(server *sv, document *doc, const char *uri)
+{
+    json_buffer *d = &sv->diagnostics;
+    json_buffer *b = &sv->out;
+    char message[128];
+    int set = sv->set;
+    int count = 0;
+    d->len = 0;
+    json_put_raw(d, "[");
+    for (size_t i = 0; doc && i < doc->count && count < MAX_DIAGNOSTICS; i++) {
+        const doc_line *l = &doc->lines[i];
+        if (l->set) {
+            set = l->set;
+        }
+        if (l->error_start >= 0) {
+            const char *text = l->text + l->error_start + 9;
+            const char *end = l->text + l->error_start + l->error_length;
+            while (text < end && (*text == ' ' || *text == ':')) {
+                text++;
+            }
+            json_put_raw(d, count++ ? "," : "");
+            if (text == end) {
+                put_diagnostic(d, doc, i, l->error_start, end - l->text, "error", 5);
+            } else {
+                put_diagnostic(d, doc, i, l->error_start, end - l->text, text, end - text);
+            }
+        } else if (l->word_sets && !(l->word_sets & set)) {
+            int n = l->word_length < 64 ? l->word_length : 64;
+            snprintf(message, sizeof(message), "%.*s is not in the current instruction set", n,
+                l->text + l->word_start);
+            json_put_raw(d, count++ ? "," : "");
+            put_diagnostic(d, doc, i, l->word_start, l->word_start + l->word_length, message, strlen(message));
+        } else if (l->check) {
+            inst_check result = { .code = l->check, .start = l->check_start, .length = l->check_length };
+            int n = inst_check_format(&result, l->text, l->len, message, sizeof(message));
+            json_put_raw(d, count++ ? "," : "");
+            put_diagnostic(d, doc, i, l->check_start, l->check_start + l->check_length, message, n);
+        }
+        if (l->target_name >= 0 && sv->labels.names[l->target_name].definitions == 0) {
+            snprintf(message, sizeof(message), "undefined label %.64s", sv->labels.names[l->target_name].name);
+            json_put_raw(d, count++ ? "," : "");
+            put_diagnostic(d, doc, i, l->target_start, l->target_start + l->target_length, message, strlen(message));
+        }
+        if (l->label_name >= 0 && sv->labels.names[l->label_name].definitions > 1) {
+            snprintf(message, sizeof(message), "label %.64s is defined more than once",
+                sv->labels.names[l->label_name].name);
+            json_put_raw(d, count++ ? "," : "");
+            put_diagnostic(d, doc, i, l->label_start, l->label_start + l->label_length, message, strlen(message));
+        }
+    }
+    json_put_raw(d, "]");
+    if (d->failed) {
+        d->failed = 0;
+        return;
+    }
+    if (doc) {
+        if (doc->diagnostics && doc->diagnostics_len == d->len && memcmp(doc->diagnostics, d->data, d->len) == 0) {
+            return;
+        }
+        char *copy = malloc(d->len);
+        if (copy) {
+            memcpy(copy, d->data, d->len);
+        }
+        free(doc->diagnostics);
+        doc->diagnostics = copy;
+        doc->diagnostics_len = copy ? d->len : 0;
+    }
+
+    b->len = 0;
+    json_put_raw(b, "{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/publishDiagnostics\",\"params\":{\"uri\":");
+    json_put_string(b, uri, strlen(uri));
+    if (doc) {
+        json_put_raw(b, ",\"version\":");
+        json_put_int(b, doc->version);
+    }
+    json_put_raw(b, ",\"diagnostics\":");
+    if (json_reserve(b, d->len + 2) == 0) {
+        memcpy(b->data + b->len, d->data, d->len);
+        b->len += d->len;
+    }
+    json_put_raw(b, "}}");
+    send_message(sv);
+}
+
+/*--------------------------------- labels ---------------------------------*/
+
+static int hex_value(char ch)
+{
+    if (ch >= '0' && ch <= '9') {
+        return ch - '0';
+    } else if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + 10;
+    } else if (ch >= 'a' && ch <= 'f') {
+        return ch - 'a' + 10;
+    }
+    return -1;
+}
+
+// Path of a file URI, NULL if it is none or memory ran out. The path
+// must be freed.
+static char *uri_to_path(const char *uri)
+{
+    if (strncmp(uri, "file://", 7) != 0) {
+        return NULL;
+    }
+    const char *s = uri + 7;
+    char *path = malloc(strlen(s) + 1);
+    char *p = path;
+    if (!path) {
+        return NULL;
+    }
+#if defined(_WIN32)
+    // file:///C:/dir
+    if (s[0] == '/' && ((s[1] && s[2] == ':') || strncmp(s + 2, "%3A", 3) == 0 || strncmp(s + 2, "%3a", 3) == 0)) {
+        s++;
+    }
+#endif
+    while (*s) {
+        if (s[0] == '%' && hex_value(s[1]) >= 0 && hex_value(s[2]) >= 0) {
+            *p++ = (char) (hex_value(s[1]) << 4 | hex_value(s[2]));
+            s += 3;
+        } else {
+            *p++ = *s++;
+        }
+    }
+    *p = '\0';
+    return path;
+}
+
+// File URI of a path, encoded like editors do. It must be freed.
+static char *path_to_uri(const char *path)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    char *uri = malloc(3 * strlen(path) + 9);
+    char *p = uri;
+    if (!uri) {
+        return NULL;
+    }
+    p += sprintf(p, "file://");
+#if defined(_WIN32)
+    *p++ = '/';
+#endif
+    for (const unsigned char *s = (const unsigned char *) path; *s; s++) {
+        unsigned char ch = *s == '\\' ? '/' : *s;
+        if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') ||
+            ch == '/' || ch == '-' || ch == '.' || ch == '_' || ch == '~') {
+            *p++ = ch;
+        } else {
+            *p++ = '%';
+            *p++ = hex[ch >> 4];
+            *p++ = hex[ch & 0xF];
+        }
+    }
+    *p = '\0';
+    return uri;
+}
+
+static int is_source(const char *name)
+{
+    size_t len = strlen(name);
+    return len > 4 && (strcmp(name + len - 4, ".src") == 0 || strcmp(name + len - 4, ".SRC") == 0);
+}
+
+static document *find_label_file(server *sv, int file)
+{
+    for (int i = 0; i < sv->document_count; i++) {
+        if (sv->documents[i]->label_file == file) {
+            return sv->documents[i];
+        }
+    }
+    return NULL;
+}
+
+// Reads the labels of a file that is not open into the index, unless
+// they were read from it as it is.
+static void index_file(server *sv, const char *uri, const char *path)
+{
+    int file = label_index_file(&sv->labels, uri);
+    if (file < 0 || find_label_file(sv, file)) {
+        return;
+    }
+    if (file < sv->scan_count) {
+        sv->scanned[file] = 1;
+    }
+    label_stamp stamp;
+    int stamped = label_index_stamp(path, &stamp) == 0;
+    if (stamped && label_index_current(&sv->labels, file, &stamp)) {
+        return;
+    }
+    FILE *f = fopen(path, "rb");
+    char *text = NULL;
+    long len = -1;
+    if (f && fseek(f, 0, SEEK_END) == 0 && (len = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0) {
+        text = malloc(len + 1);
+        if (text && fread(text, 1, len, f) != (size_t) len) {
+            len = -1;
+        }
+    }
+    if (f) {
+        fclose(f);
+    }
+    // a file that cannot be read has no labels
+    if (text && len >= 0 ? label_index_scan(&sv->labels, file, text, len) :
+        label_index_set_sites(&sv->labels, file, NULL, 0)) {
+        fprintf(stderr, "mcodelsp: out of memory\n");
+        stamped = 0;
+    }
+    if (!stamped || !text || len < 0) {
+        stamp.size = 0;
+        stamp.time = -1;
+    }
+    sv->labels.files[file].stamp = stamp;
+    free(text);
+}
+
+static void save_labels(server *sv)
+{
+    if (sv->index_path && label_index_save(&sv->labels, sv->index_path)) {
+        perror(sv->index_path);
+    }
+}
+
+static void index_path(server *sv, const char *path)
+{
+    char *uri = path_to_uri(path);
+    if (uri) {
+        index_file(sv, uri, path);
+        free(uri);
+    }
+}
+
+// Indexes the source files in a folder and the folders in it.
+static void index_folder(server *sv, const char *folder, int depth)
+{
+    size_t len = strlen(folder);
+    char *path;
+#if defined(_WIN32)
+    struct _finddata_t entry;
+    char *pattern = malloc(len + 3);
+    intptr_t find;
+    if (!pattern) {
+        return;
+    }
+    sprintf(pattern, "%s\\*", folder);
+    find = _findfirst(pattern, &entry);
+    free(pattern);
+    if (find == -1) {
+        return;
+    }
+    do {
+        const char *name = entry.name;
+        int is_folder = (entry.attrib & _A_SUBDIR) != 0;
+#else
+    DIR *dir = opendir(folder);
+    struct dirent *entry;
+    if (!dir) {
+        return;
+    }
+    while ((entry = readdir(dir)) != NULL) {
+        const char *name = entry->d_name;
+        struct stat st;
+        int is_folder;
+#endif
+        if (name[0] == '.') {
+            continue;
+        }
+        path = malloc(len + strlen(name) + 2);
+        if (!path) {
+            break;
+        }
+        sprintf(path, "%s/%s", folder, name);
+#if !defined(_WIN32)
+        is_folder = stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+#endif
+        if (is_folder && depth < MAX_FOLDER_DEPTH) {
+            index_folder(sv, path, depth + 1);
+        } else if (!is_folder && is_source(name)) {
+            index_path(sv, path);
+        }
+        free(path);
+#if defined(_WIN32)
+    } while (_findnext(find, &entry) == 0);
+    _findclose(find);
+#else
+    }
+    closedir(dir);
+#endif
+}
+
+// Replaces the labels of the document's file by those of its lines.
+// The lines keep the names they interned, so only new lines are
+// looked up.
+static void index_document(server *sv, document *doc)
+{
+    int count = 0;
+    for (size_t i = 0; i < doc->count; i++) {
+        doc_line *l = &doc->lines[i];
+        if (l->label_start < 0 && l->target_start < 0) {
+            continue;
+        }
+        if (count + 2 > sv->site_size) {
+            int size = sv->site_size ? 2 * sv->site_size : 1024;
+            label_site *sites = realloc(sv->sites, size * sizeof(label_site));
+            if (!sites) {
+                fprintf(stderr, "mcodelsp: out of memory\n");
+                return;
+            }
+            sv->sites = sites;
+            sv->site_size = size;
+        }
+        if (l->label_start >= 0 && l->label_name < 0) {
+            l->label_name = label_index_intern(&sv->labels, doc->label_file, l->text + l->label_start,
+                l->label_length);
+        }
+        if (l->label_name >= 0) {
+            label_site site = { l->label_name, LABEL_DEFINITION, (int) i, l->label_start, l->label_length };
+            sv->sites[count++] = site;
+        }
+        if (l->target_start >= 0 && l->target_name < 0) {
+            l->target_name = label_index_intern(&sv->labels, doc->label_file, l->text + l->target_start,
+                l->target_length);
+        }
+        if (l->target_name >= 0) {
+            label_site site = { l->target_name, LABEL_REFERENCE, (int) i, l->target_start, l->target_length };
+            sv->sites[count++] = site;
+        }
+    }
+    if (label_index_set_sites(&sv->labels, doc->label_file, sv->sites, count)) {
+        fprintf(stderr, "mcodelsp: out of memory\n");
+    }
+}
+
+// Publishes the diagnostics of a changed document, or of all documents
+// if a label got or lost its definition.
+static void publish_labels(server *sv, document *doc)
+{
+    if (sv->labels.resolution == sv->resolution) {
+        if (doc) {
+            publish_diagnostics(sv, doc, doc->uri);
+        }
+        return;
+    }
+    sv->resolution = sv->labels.resolution;
+    for (int i = 0; i < sv->document_count; i++) {
+        publish_diagnostics(sv, sv->documents[i], sv->documents[i]->uri);
+    }
+}
+
+static void did_open(server *sv, const json_value *params)
+{
+    const json_value *item = json_get(params, "textDocument");
+    const char *uri = json_string(json_get(item, "uri"));
+    const json_value *text = json_get(item, "text");
+    if (!uri || !json_string(text)) {
+        return;
+    }
+    document *doc = find_document(sv, params);
+    if (doc) {
+        close_document(sv, doc);
+    }
+    if (sv->document_count == MAX_DOCUMENTS) {
+        fprintf(stderr, "mcodelsp: too many open documents\n");
+        return;
+    }
+    doc = doc_open(uri, text->string, text->length, sv->utf16);
+    if (!doc) {
+        fprintf(stderr, "mcodelsp: out of memory\n");
+        return;
+    }
+    doc->version = json_int(json_get(item, "version"), 0);
+    doc->label_file = label_index_file(&sv->labels, uri);
+    if (doc->label_file < 0) {
+        fprintf(stderr, "mcodelsp: out of memory\n");
+        doc_free(doc);
+        return;
+    }
+    // the sites are no longer those of the file on disk
+    sv->labels.files[doc->label_file].stamp.time = -1;
+    sv->documents[sv->document_count++] = doc;
+    index_document(sv, doc);
+    publish_labels(sv, doc);
+}
+
+static void did_change(server *sv, const json_value *params)
+{
+    document *doc = find_document(sv, params);
+    if (!doc) {
+        return;
+    }
+    const json_value *changes = json_get(params, "contentChanges");
+    for (const json_value *c = changes ? changes->child : NULL; c; c = c->next) {
+        const json_value *range = json_get(c, "range");
+        const json_value *text = json_get(c, "text");
+        int failed;
+        if (!json_string(text)) {
+            continue;
+        }
+        if (range) {
+            const json_value *start = json_get(range, "start");
+            const json_value *end = json_get(range, "end");
+            size_t line = (size_t) json_int(json_get(start, "line"), 0);
+            size_t end_line = (size_t) json_int(json_get(end, "line"), 0);
+            size_t column = doc_byte_column(doc, line, (size_t) json_int(json_get(start, "character"), 0));
+            size_t end_column = doc_byte_column(doc, end_line, (size_t) json_int(json_get(end, "character"), 0));
+            failed = doc_replace(doc, line, column, end_line, end_column, text->string, text->length);
+        } else {
+            failed = doc_set_text(doc, text->string, text->length);
+        }
+        if (failed) {
+            fprintf(stderr, "mcodelsp: out of memory\n");
+        }
+    }
+    doc->version = json_int(json_get(json_get(params, "textDocument"), "version"), doc->version);
+    index_document(sv, doc);
+    publish_labels(sv, doc);
+}
+
+static void did_close(server *sv, const json_value *params)
+{
+    document *doc = find_document(sv, params);
+    if (doc) {
+        const char *uri = json_string(json_get(json_get(params, "textDocument"), "uri"));
+        char *path = uri_to_path(uri);
+        int file = doc->label_file;
+        publish_diagnostics(sv, NULL, uri);
+        close_document(sv, doc);
+        // the file on disk counts again
+        if (path) {
+            index_file(sv, uri, path);
+        } else {
+            label_index_set_sites(&sv->labels, file, NULL, 0);
+        }
+        free(path);
+        publish_labels(sv, NULL);
+    }
+}
+
+// Indexes the files the client reports as changed, unless they are open.
+static void did_change_watched_files(server *sv, const json_value *params)
+{
+    const json_value *changes = json_get(params, "changes");
+    for (const json_value *c = changes ? changes->child : NULL; c; c = c->next) {
+        const char *uri = json_string(json_get(c, "uri"));
+        char *path = uri ? uri_to_path(uri) : NULL;
+        int file = uri ? label_index_find_file(&sv->labels, uri) : -1;
+        if (!path || (file >= 0 && find_label_file(sv, file))) {
+            free(path);
+            continue;
+        }
+        if (json_int(json_get(c, "type"), 0) == FILE_DELETED) {
+            if (file >= 0) {
+                label_index_set_sites(&sv->labels, file, NULL, 0);
+            }
+        } else if (is_source(path)) {
+            index_file(sv, uri, path);
+        }
+        free(path);
+    }
+    publish_labels(sv, NULL);
+}
+
+/*----------------------------- semantic tokens ----------------------------*/
+
+static void put_tokens(json_buffer *b, const unsigned *data, size_t len)
+{
+    // at most 10 digits and a comma per number
+    if (json_reserve(b, 11 * len + 2)) {
+        return;
+    }
+    b->data[b->len++] = '[';
+    for (size_t i = 0; i < len; i++) {
+        if (i) {
+            b->data[b->len++] = ',';
+        }
+        char tmp[10];
+        int n = 0;
+        unsigned v = data[i];
+        do {
+            tmp[n++] = '0' + v % 10;
+            v /= 10;
+        } while (v);
+        while (n) {
+            b->data[b->len++] = tmp[--n];
+        }
+    }
+    b->data[b->len++] = ']';
+}
+
+static void semantic_tokens(server *sv, const json_value *id, const json_value *params, int delta)
+{
+    document *doc = find_document(sv, params);
+    size_t start;
+    size_t delete_count;
+    if (!doc) {
+        send_error(sv, id, INVALID_PARAMS, "unknown document");
+        return;
+    }
+    // a delta is relative to the last result, else the client gets all
+    const char *previous = json_string(json_get(params, "previousResultId"));
+    delta = delta && previous && doc->result_id && strtoll(previous, NULL, 10) == doc->result_id;
+    if (delta ? doc_delta_tokens(doc, &start, &delete_count) : doc_full_tokens(doc)) {
+        send_error(sv, id, INVALID_REQUEST, "out of memory");
+        return;
+    }
+    begin_response(sv, id);
+    json_put_raw(&sv->out, "{\"resultId\":\"");
+    json_put_int(&sv->out, doc->result_id);
+    if (!delta) {
+        json_put_raw(&sv->out, "\",\"data\":");
+        put_tokens(&sv->out, doc->tokens.data, doc->tokens.len);
+    } else if (delete_count || doc->tokens.len) {
+        json_put_raw(&sv->out, "\",\"edits\":[{\"start\":");
+        json_put_int(&sv->out, (long long) start);
+        json_put_raw(&sv->out, ",\"deleteCount\":");
+        json_put_int(&sv->out, (long long) delete_count);
+        json_put_raw(&sv->out, ",\"data\":");
+        put_tokens(&sv->out, doc->tokens.data, doc->tokens.len);
+        json_put_raw(&sv->out, "}]");
+    } else {
+        json_put_raw(&sv->out, "\",\"edits\":[]");
+    }
+    json_put_raw(&sv->out, "}");
+    end_response(sv);
+}
+
+/*--------------------------- hover and completion -------------------------*/
+
+// Finds the token at a character column, returns its style or -1 and
+// its start and end in characters.
+static int find_token(const doc_line *l, size_t character, size_t *start, size_t *end)
+{
+    size_t pos = 0;
+    for (unsigned i = 0; i < l->token_count; i++) {
+        const unsigned *t = l->tokens + i * DOC_TOKEN_SIZE;
+        pos += t[1];
+        if (character >= pos && character < pos + t[2]) {
+            *start = pos;
+            *end = pos + t[2];
+            return (int) t[3];
+        }
+    }
+    return -1;
+}
+
+static void put_sets(json_buffer *b, int sets)
+{
+    static const char *names[] = { "HP", "JDA", "ZENCODE" };
+    int n = 0;
+    for (int i = 0; i < 3; i++) {
+        if (sets & (1 << i)) {
+            json_put_raw(b, n++ ? ", " : "");
+            json_put_raw(b, names[i]);
+        }
+    }
+}
+
+static void hover(server *sv, const json_value *id, const json_value *params)
+{
+    document *doc = find_document(sv, params);
+    const json_value *position = json_get(params, "position");
+    size_t line = (size_t) json_int(json_get(position, "line"), 0);
+    size_t start;
+    size_t end;
+    if (!doc || line >= doc->count ||
+        find_token(&doc->lines[line], (size_t) json_int(json_get(position, "character"), 0), &start, &end) !=
+        MCLEX_STYLE_MNEMONIC) {
+        send_result(sv, id, "null");
+        return;
+    }
+    const doc_line *l = &doc->lines[line];
+    size_t from = doc_byte_column(doc, line, start);
+    size_t to = doc_byte_column(doc, line, end);
+    char name[INAME_SIZE + 1];
+    if (to - from > INAME_SIZE) {
+        send_result(sv, id, "null");
+        return;
+    }
+    memcpy(name, l->text + from, to - from);
+    name[to - from] = '\0';
+    int record = mcdb_find(&sv->db, name, SET_ALL);
+    if (record < 0) {
+        send_result(sv, id, "null");
+        return;
+    }
+
+    const mcdb_inst *in = mcdb_get(&sv->db, record);
+    const mcdb_type *type = mcdb_find_type(&sv->db, in->typ);
+    char text[256];
+    json_buffer b;
+    json_buffer_init(&b);
+    snprintf(text, sizeof(text), "**%s** operand %c: %s\n\ntyte1 0x%3.3X, tyte2 0x%3.3X, tyte3 0x%3.3X\n\nsets: ",
+        name, in->typ, type ? mcdb_string(&sv->db, type->operand) : "", in->tyte[0], in->tyte[1], in->tyte[2]);
+    json_put_raw(&b, text);
+    put_sets(&b, in->set);
+
+    begin_response(sv, id);
+    json_put_raw(&sv->out, "{\"contents\":{\"kind\":\"markdown\",\"value\":");
+    json_put_string(&sv->out, b.data, b.len);
+    json_put_raw(&sv->out, "},\"range\":{\"start\":");
+    put_position(&sv->out, line, start);
+    json_put_raw(&sv->out, ",\"end\":");
+    put_position(&sv->out, line, end);
+    json_put_raw(&sv->out, "}}");
+    end_response(sv);
+    json_buffer_free(&b);
+}
+
+struct completion_t {
+    server *sv;
+    int count;
+};
+
+typedef struct completion_t completion;
+
+static void put_completion(void *user, int record)
+{
+    completion *c = (completion *) user;
+    json_buffer *b = &c->sv->out;
+    const mcdb_inst *in = mcdb_get(&c->sv->db, record);
+    const mcdb_type *type = mcdb_find_type(&c->sv->db, in->typ);
+    const char *name = mcdb_string(&c->sv->db, in->name);
+    const char *operand = type ? mcdb_string(&c->sv->db, type->operand) : "";
+    json_put_raw(b, c->count++ ? ",{\"label\":" : "{\"label\":");
+    json_put_string(b, name, strlen(name));
+    json_put_raw(b, ",\"kind\":");
+    json_put_int(b, COMPLETION_KEYWORD);
+    json_put_raw(b, ",\"detail\":");
+    json_put_string(b, operand, strlen(operand));
+    json_put_raw(b, "}");
+}
+
+// Completes the word in front of the cursor with the mnemonics of the
+// instruction set in effect at the line.
+static void complete(server *sv, const json_value *id, const json_value *params)
+{
+    document *doc = find_document(sv, params);
+    const json_value *position = json_get(params, "position");
+    size_t line = (size_t) json_int(json_get(position, "line"), 0);
+    if (!doc || line >= doc->count) {
+        send_result(sv, id, "null");
+        return;
+    }
+    const doc_line *l = &doc->lines[line];
+    size_t end = doc_byte_column(doc, line, (size_t) json_int(json_get(position, "character"), 0));
+    size_t start = end;
+    while (start > 0 && l->text[start - 1] != ' ' && l->text[start - 1] != '\t') {
+        start--;
+    }
+    completion c = { sv, 0 };
+    begin_response(sv, id);
+    json_put_raw(&sv->out, "{\"isIncomplete\":false,\"items\":[");
+    if (!memchr(l->text + start, '(', end - start) && !memchr(l->text + start, '[', end - start) &&
+        !memchr(l->text + start, ';', end - start) && !memchr(l->text + start, '"', end - start) &&
+        (start == end || (l->text[start] != '.' && l->text[start] != '*'))) {
+        trie_complete(&sv->trie, &sv->db, l->text + start, end - start, doc_set_at(doc, line, sv->set),
+            MAX_COMPLETIONS, put_completion, &c);
+    }
+    json_put_raw(&sv->out, "]}");
+    end_response(sv);
+}
+
+/*------------------------ definitions and references ------------------------*/
+
+// Name of the label at the position of a request, -1 if there is none.
+static int label_at(server *sv, const json_value *params)
+{
+    document *doc = find_document(sv, params);
+    const json_value *position = json_get(params, "position");
+    size_t line = (size_t) json_int(json_get(position, "line"), 0);
+    if (!doc || line >= doc->count) {
+        return -1;
+    }
+    const doc_line *l = &doc->lines[line];
+    int column = (int) doc_byte_column(doc, line, (size_t) json_int(json_get(position, "character"), 0));
+    if (l->label_start >= 0 && column >= l->label_start && column < l->label_start + l->label_length) {
+        return l->label_name;
+    }
+    if (l->target_start >= 0 && column >= l->target_start && column < l->target_start + l->target_length) {
+        return l->target_name;
+    }
+    return -1;
+}
+
+struct locations_t {
+    server *sv;
+    int count;
+};
+
+typedef struct locations_t locations;
+
+// Columns of files that are not open are bytes.
+static void put_location(void *user, int file, const label_site *site)
+{
+    locations *c = (locations *) user;
+    json_buffer *b = &c->sv->out;
+    const char *uri = c->sv->labels.files[file].path;
+    const document *doc = find_label_file(c->sv, file);
+    json_put_raw(b, c->count++ ? ",{\"uri\":" : "{\"uri\":");
+    json_put_string(b, uri, strlen(uri));
+    json_put_raw(b, ",\"range\":");
+    if (doc && (size_t) site->line < doc->count) {
+        put_range(b, doc, site->line, site->start, site->start + site->length);
+    } else {
+        json_put_raw(b, "{\"start\":");
+        put_position(b, site->line, site->start);
+        json_put_raw(b, ",\"end\":");
+        put_position(b, site->line, site->start + site->length);
+        json_put_raw(b, "}");
+    }
+    json_put_raw(b, "}");
+}
+
+// Lists the definitions or the references of the label at a position.
+static void find_labels(server *sv, const json_value *id, const json_value *params, int references)
+{
+    int name = label_at(sv, params);
+    int kind = LABEL_DEFINITION;
+    if (references) {
+        const json_value *declaration = json_get(json_get(params, "context"), "includeDeclaration");
+        kind = declaration && declaration->type == JSON_TRUE ? -1 : LABEL_REFERENCE;
+    }
+    if (name < 0) {
+        send_result(sv, id, "null");
+        return;
+    }
+    locations c = { sv, 0 };
+    begin_response(sv, id);
+    json_put_raw(&sv->out, "[");
+    label_index_sites(&sv->labels, name, kind, put_location, &c);
+    json_put_raw(&sv->out, "]");
+    end_response(sv);
+}
+
+/*-------------------------------- lifecycle -------------------------------*/
+
+static void initialize(server *sv, const json_value *id, const json_value *params)
+{
+    const json_value *general = json_get(json_get(params, "capabilities"), "general");
+    const json_value *encodings = json_get(general, "positionEncodings");
+    int set = parse_set(json_string(json_get(json_get(params, "initializationOptions"), "set")));
+    sv->utf16 = 1;
+    for (const json_value *e = encodings && encodings->type == JSON_ARRAY ? encodings->child : NULL; e; e = e->next) {
+        if (json_string(e) && strcmp(e->string, "utf-8") == 0) {
+            sv->utf16 = 0;
+        }
+    }
+    if (set) {
+        sv->set = set;
+    }
+    sv->initialized = 1;
+
+    // the labels of the workspace, of the saved index for the files that
+    // did not change
+    if (sv->index_path) {
+        if (label_index_load(&sv->labels, sv->index_path) && errno != ENOENT && errno != EINVAL) {
+            perror(sv->index_path);
+        }
+        sv->scanned = calloc(sv->labels.file_count + 1, 1);
+        sv->scan_count = sv->scanned ? sv->labels.file_count : 0;
+    }
+    const json_value *folders = json_get(params, "workspaceFolders");
+    const char *root = json_string(json_get(params, "rootUri"));
+    for (const json_value *f = folders && folders->type == JSON_ARRAY ? folders->child : NULL; f; f = f->next) {
+        const char *uri = json_string(json_get(f, "uri"));
+        char *path = uri ? uri_to_path(uri) : NULL;
+        if (path) {
+            index_folder(sv, path, 0);
+            free(path);
+        }
+        root = NULL;
+    }
+    char *path = root ? uri_to_path(root) : NULL;
+    if (path) {
+        index_folder(sv, path, 0);
+        free(path);
+    }
+    for (int i = 0; i < sv->scan_count; i++) {
+        if (!sv->scanned[i] && label_index_set_sites(&sv->labels, i, NULL, 0) == 0) {
+            sv->labels.files[i].stamp.time = -1;
+        }
+    }
+    free(sv->scanned);
+    sv->scanned = NULL;
+    sv->scan_count = 0;
+    save_labels(sv);
+    sv->resolution = sv->labels.resolution;
+
+    json_buffer *b = &sv->out;
+    begin_response(sv, id);
+    json_put_raw(b, "{\"capabilities\":{\"positionEncoding\":");
+    json_put_raw(b, sv->utf16 ? "\"utf-16\"" : "\"utf-8\"");
+    json_put_raw(b, ",\"textDocumentSync\":{\"openClose\":true,\"change\":");
+    json_put_int(b, SYNC_INCREMENTAL);
+    json_put_raw(b, "},\"semanticTokensProvider\":{\"legend\":{\"tokenTypes\":[");
+    for (int i = 0; i < MCLEX_STYLE_COUNT; i++) {
+        json_put_raw(b, i ? "," : "");
+        json_put_string(b, mclex_style_names[i], strlen(mclex_style_names[i]));
+    }
+    json_put_raw(b, "],\"tokenModifiers\":[]},\"full\":{\"delta\":true}},\"hoverProvider\":true,"
+        "\"completionProvider\":{},\"definitionProvider\":true,\"referencesProvider\":true},"
+        "\"serverInfo\":{\"name\":\"mcodelsp\"}}");
+    end_response(sv);
+}
+
+// Handles one message. Returns 1 after exit.
+static int handle_message(server *sv, const json_value *msg)
+{
+    const char *method = json_string(json_get(msg, "method"));
+    const json_value *id = json_get(msg, "id");
+    const json_value *params = json_get(msg, "params");
+    if (!method) {
+        // a response to a request of the server, none are sent
+        return 0;
+    }
+    if (strcmp(method, "exit") == 0) {
+        return 1;
+    }
+    if (!sv->initialized && strcmp(method, "initialize") != 0) {
+        if (id) {
+            send_error(sv, id, SERVER_NOT_INITIALIZED, "server not initialized");
+        }
+        return 0;
+    }
+    if (strcmp(method, "initialize") == 0) {
+        initialize(sv, id, params);
+    } else if (strcmp(method, "shutdown") == 0) {
+        sv->shutdown = 1;
+        send_result(sv, id, "null");
+    } else if (strcmp(method, "textDocument/didOpen") == 0) {
+        did_open(sv, params);
+    } else if (strcmp(method, "textDocument/didChange") == 0) {
+        did_change(sv, params);
+    } else if (strcmp(method, "textDocument/didClose") == 0) {
+        did_close(sv, params);
+    } else if (strcmp(method, "textDocument/semanticTokens/full") == 0) {
+        semantic_tokens(sv, id, params, 0);
+    } else if (strcmp(method, "textDocument/semanticTokens/full/delta") == 0) {
+        semantic_tokens(sv, id, params, 1);
+    } else if (strcmp(method, "textDocument/hover") == 0) {
+        hover(sv, id, params);
+    } else if (strcmp(method, "textDocument/completion") == 0) {
+        complete(sv, id, params);
+    } else if (strcmp(method, "textDocument/definition") == 0) {
+        find_labels(sv, id, params, 0);
+    } else if (strcmp(method, "textDocument/references") == 0) {
+        find_labels(sv, id, params, 1);
+    } else if (strcmp(method, "workspace/didChangeWatchedFiles") == 0) {
+        did_change_watched_files(sv, params);
+    } else if (id) {
+        send_error(sv, id, METHOD_NOT_FOUND, "method not found");
+    }
+    return 0;
+}
+
+static void print_scopes(void)
+{
+    printf("{\n    \"semanticTokenScopes\": [\n        {\n            \"language\": \"hp41mcode\",\n"
+           "            \"scopes\": {\n");
+    for (int i = 0; i < MCLEX_STYLE_COUNT; i++) {
+        printf("                \"%s\": [\"%s\"]%s\n", mclex_style_names[i], mclex_style_scopes[i],
+            i + 1 < MCLEX_STYLE_COUNT ? "," : "");
+    }
+    printf("            }\n        }\n    ]\n}\n");
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodelsp [-D file] [-i index] [-s hp|jda|zencode] [-t]\n");
+    fprintf(stderr, "  -D  use this instruction database instead of " MCDB_FILE_NAME "\n");
+    fprintf(stderr, "  -i  load the label index from a file and save it\n");
+    fprintf(stderr, "  -s  initial instruction set (default hp)\n");
+    fprintf(stderr, "  -t  print the semanticTokenScopes of the token types and exit\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static server sv;
+    const char *db_path = NULL;
+    sv.set = SET_HP;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0) {
+            print_scopes();
+            return 0;
+        } else if (strcmp(argv[i], "-D") == 0 && i + 1 < argc) {
+            db_path = argv[++i];
+        } else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) {
+            sv.index_path = argv[++i];
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc && parse_set(argv[i + 1])) {
+            sv.set = parse_set(argv[++i]);
+        } else {
+            usage();
+            return 2;
+        }
+    }
+#if defined(_WIN32)
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+    if (mcdb_load(&sv.db, db_path, argv[0]) != 0) {
+        perror(db_path ? db_path : MCDB_FILE_NAME);
+        return 1;
+    }
+    mclex_setup();
+    json_buffer_init(&sv.out);
+    json_buffer_init(&sv.diagnostics);
+    label_index_init(&sv.labels);
+    if (trie_build(&sv.trie, &sv.db)) {
+        fprintf(stderr, "mcodelsp: out of memory\n");
+        return 1;
+    }
+
+    int done = 0;
+    while (!done) {
+        size_t len;
+        char *body = read_message(&len);
+        if (!body) {
+            break;
+        }
+        json_doc doc;
+        json_value *msg = json_parse(&doc, body, len);
+        if (!msg) {
+            send_error(&sv, NULL, PARSE_ERROR, "parse error");
+        } else if (msg->type != JSON_OBJECT) {
+            send_error(&sv, NULL, INVALID_REQUEST, "invalid request");
+        } else {
+            done = handle_message(&sv, msg);
+        }
+        json_doc_free(&doc);
+        free(body);
+    }
+
+    while (sv.document_count) {
+        close_document(&sv, sv.documents[0]);
+    }
+    if (sv.initialized) {
+        save_labels(&sv);
+    }
+    trie_free(&sv.trie);
+    label_index_free(&sv.labels);
+    free(sv.sites);
+    json_buffer_free(&sv.out);
+    json_buffer_free(&sv.diagnostics);
+    mcdb_close(&sv.db);
+    return done && sv.shutdown ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "mctrie.h"
+
+static int add_node(mnemonic_trie *t, char ch)
+{
+    if (t->count == t->size) {
+        int size = t->size ? 2 * t->size : 1024;
+        trie_node *nodes = realloc(t->nodes, size * sizeof(trie_node));
+        if (!nodes) {
+            return -1;
+        }
+        t->nodes = nodes;
+        t->size = size;
+    }
+    trie_node *n = &t->nodes[t->count];
+    n->child = -1;
+    n->next = -1;
+    n->record = -1;
+    n->ch = ch;
+    n->sets = 0;
+    return t->count++;
+}
+
+// Child of node with the character ch. The names are inserted in
+// strcmp() order, so a new child always goes to the end of the list.
+static int child_node(mnemonic_trie *t, int node, char ch)
+{
+    int last = -1;
+    for (int c = t->nodes[node].child; c >= 0; c = t->nodes[c].next) {
+        if (t->nodes[c].ch == ch) {
+            return c;
+        }
+        last = c;
+    }
+    int c = add_node(t, ch);
+    if (c < 0) {
+        return -1;
+    }
+    if (last < 0) {
+        t->nodes[node].child = c;
+    } else {
+        t->nodes[last].next = c;
+    }
+    return c;
+}
+
+int trie_build(mnemonic_trie *t, const mcdb *db)
+{
+    const uint16_t *items = mcdb_items(db, &db->header->names);
+    memset(t, 0, sizeof(*t));
+    if (add_node(t, '\0') < 0) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < db->header->names.count; i++) {
+        const mcdb_inst *in = mcdb_get(db, items[i]);
+        const char *name = mcdb_string(db, in->name);
+        int node = 0;
+        t->nodes[0].sets |= in->set;
+        for (const char *p = name; *p; p++) {
+            node = child_node(t, node, *p);
+            if (node < 0) {
+                trie_free(t);
+                return -1;
+            }
+            t->nodes[node].sets |= in->set;
+        }
+        t->nodes[node].record = items[i];
+    }
+    return 0;
+}
+
+void trie_free(mnemonic_trie *t)
+{
+    free(t->nodes);
+    memset(t, 0, sizeof(*t));
+}
+
+static int walk(const mnemonic_trie *t, const mcdb *db, int node, int sets, int max, trie_found found, void *user)
+{
+    int count = 0;
+    const trie_node *n = &t->nodes[node];
+    if (n->record >= 0 && (mcdb_get(db, n->record)->set & sets)) {
+        found(user, n->record);
+        count++;
+    }
+    for (int c = n->child; c >= 0 && count < max; c = t->nodes[c].next) {
+        if (t->nodes[c].sets & sets) {
+            count += walk(t, db, c, sets, max - count, found, user);
+        }
+    }
+    return count;
+}
+
+int trie_complete(const mnemonic_trie *t, const mcdb *db, const char *prefix, size_t len, int sets, int max,
+    trie_found found, void *user)
+{
+    int node = 0;
+    for (size_t i = 0; i < len && node >= 0; i++) {
+        int c = t->nodes[node].child;
+        while (c >= 0 && t->nodes[c].ch != prefix[i]) {
+            c = t->nodes[c].next;
+        }
+        node = c;
+    }
+    if (node < 0 || !(t->nodes[node].sets & sets) || max <= 0) {
+        return 0;
+    }
+    return walk(t, db, node, sets, max, found, user);
+}
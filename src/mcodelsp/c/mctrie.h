@@ -0,0 +1,45 @@
+#if !defined(__MCTRIE_H__)
+#define __MCTRIE_H__
+
+#include <stddef.h>
+
+#include "mcdb.h"
+
+// Prefix tree of the mnemonics for completion.
+//
+// A node stands for one character; its children are linked in
+// ascending order, so a depth-first walk lists the mnemonics in name
+// order. Every node has the union of the instruction sets below it, so
+// mnemonics of other sets cost nothing to skip.
+
+struct trie_node_t {
+    int child;                  // first child or -1
+    int next;                   // next sibling or -1
+    int record;                 // mcdb record of the mnemonic ending here or -1
+    char ch;
+    unsigned char sets;         // SET_* of all mnemonics below
+};
+
+typedef struct trie_node_t trie_node;
+
+struct mnemonic_trie_t {
+    trie_node *nodes;           // nodes[0] is the root
+    int count;
+    int size;
+};
+
+typedef struct mnemonic_trie_t mnemonic_trie;
+
+typedef void (*trie_found)(void *user, int record);
+
+// Builds the tree of all mnemonics in db. Returns 0 or -1 if memory ran
+// out.
+int trie_build(mnemonic_trie *t, const mcdb *db);
+void trie_free(mnemonic_trie *t);
+
+// Reports the records of up to max mnemonics in one of sets that start
+// with prefix, in name order. Returns their number.
+int trie_complete(const mnemonic_trie *t, const mcdb *db, const char *prefix, size_t len, int sets, int max,
+    trie_found found, void *user);
+
+#endif // !defined(__MCTRIE_H__)
@@ -0,0 +1,248 @@
+/**********************************************************************
+ * MCODE Tokenizer CLI
+ *
+ * Tokenizes MCODE source files and prints one span per line:
+ *
+ *     offset length style [context]
+ *
+ * Offsets are byte offsets from the start of each file. Input is read
+ * in large chunks and fed to the streaming tokenizer, so files of any
+ * size are processed in constant memory.
+ *
+ * With -p or -f, the lexer counts match attempts, matches and time per
+ * grammar context and writes them as JSON or as folded stacks for flame
+ * graphs, in the format of bench/lexprofile.py for the Pygments lexer.
+ *********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mcodelex.h"
+#include "mclexdfa.h"
+
+#define CHUNK_SIZE  (1 << 16)
+#define OUT_SIZE    (1 << 16)
+
+struct output_t {
+    char buf[OUT_SIZE];
+    size_t len;
+    int contexts;
+    unsigned long counts[MCLEX_STYLE_COUNT];
+};
+
+typedef struct output_t output;
+
+static void flush_output(output *out)
+{
+    fwrite(out->buf, 1, out->len, stdout);
+    out->len = 0;
+}
+
+static void put_string(output *out, const char *s)
+{
+    while (*s) {
+        out->buf[out->len++] = *s++;
+    }
+}
+
+static void put_number(output *out, size_t num)
+{
+    char tmp[24];
+    int i = 0;
+    do {
+        tmp[i++] = '0' + num % 10;
+        num /= 10;
+    } while (num);
+    while (i) {
+        out->buf[out->len++] = tmp[--i];
+    }
+}
+
+static void print_span(void *user, const mclex_span *span)
+{
+    output *out = (output *) user;
+    if (out->len > OUT_SIZE - 128) {
+        flush_output(out);
+    }
+    put_number(out, span->offset);
+    out->buf[out->len++] = ' ';
+    put_number(out, span->length);
+    out->buf[out->len++] = ' ';
+    put_string(out, mclex_style_names[span->style]);
+    if (out->contexts) {
+        out->buf[out->len++] = ' ';
+        put_string(out, mclex_context_names[span->context]);
+    }
+    out->buf[out->len++] = '\n';
+}
+
+static void count_span(void *user, const mclex_span *span)
+{
+    output *out = (output *) user;
+    out->counts[span->style]++;
+}
+
+static int tokenize_file(FILE *file, mclex_lexer lexer, mclex_profile *prof, mclex_emit emit, output *out)
+{
+    static char chunk[CHUNK_SIZE];
+    mclex_stream st;
+    size_t len;
+    int rc = 0;
+
+    mclex_stream_init(&st, emit, out);
+    st.lexer = lexer;
+    st.profile = prof;
+    while (rc == 0 && (len = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        rc = mclex_stream_feed(&st, chunk, len);
+    }
+    mclex_stream_finish(&st);
+    if (ferror(file)) {
+        rc = -1;
+    }
+    return rc;
+}
+
+static void print_summary(output *out)
+{
+    for (int i = 0; i < MCLEX_STYLE_COUNT; i++) {
+        printf("%-12s %lu\n", mclex_style_names[i], out->counts[i]);
+    }
+}
+
+static const char *profile_name(int ctx)
+{
+    return ctx == MCLEX_PROFILE_FALLBACK ? "<fallback>" : mclex_context_names[ctx];
+}
+
+// Totals per pattern context over all lexer contexts.
+static void print_profile_json(FILE *f, const mclex_profile *prof, const char *lexer)
+{
+    const char *sep = "";
+    fprintf(f, "{\n  \"lexer\": \"%s\",\n  \"lines\": %llu,\n", lexer, prof->lines);
+    fprintf(f, "  \"contexts\": {");
+    for (int ctx = 0; ctx <= MCLEX_PROFILE_FALLBACK; ctx++) {
+        mclex_profile_entry sum = { 0, 0, 0 };
+        for (int current = 0; current < MCLEX_CTX_COUNT; current++) {
+            sum.attempts += prof->entries[current][ctx].attempts;
+            sum.matches += prof->entries[current][ctx].matches;
+            sum.nanoseconds += prof->entries[current][ctx].nanoseconds;
+        }
+        if (sum.attempts || ctx == MCLEX_PROFILE_FALLBACK) {
+            fprintf(f, "%s\n    \"%s\": {\"attempts\": %llu, \"matches\": %llu, \"nanoseconds\": %llu}",
+                sep, profile_name(ctx), sum.attempts, sum.matches, sum.nanoseconds);
+            sep = ",";
+        }
+        if (ctx == MCLEX_PROFILE_FALLBACK) {
+            fprintf(f, "\n  },\n  \"fallback_characters\": %llu\n}\n", sum.matches);
+        }
+    }
+}
+
+// One stack per lexer context and pattern context, weighted by time.
+static void print_profile_folded(FILE *f, const mclex_profile *prof)
+{
+    for (int current = 0; current < MCLEX_CTX_COUNT; current++) {
+        for (int ctx = 0; ctx <= MCLEX_PROFILE_FALLBACK; ctx++) {
+            const mclex_profile_entry *e = &prof->entries[current][ctx];
+            if (!e->nanoseconds) {
+                continue;
+            }
+            if (current != MCLEX_CTX_MAIN) {
+                fprintf(f, "main;");
+            }
+            fprintf(f, "%s;%s %llu\n", mclex_context_names[current], profile_name(ctx), e->nanoseconds);
+        }
+    }
+}
+
+static int write_profile(const char *path, const mclex_profile *prof, const char *lexer, int folded)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+    if (folded) {
+        print_profile_folded(f, prof);
+    } else {
+        print_profile_json(f, prof, lexer);
+    }
+    if (fclose(f) != 0) {
+        perror(path);
+        return -1;
+    }
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: mcodetok [-c] [-d] [-s] [-p file] [-f file] [file ...]\n");
+    fprintf(stderr, "  -c       print the context of each span\n");
+    fprintf(stderr, "  -d       use the lexer generated by mcodeiro -d\n");
+    fprintf(stderr, "  -s       print span counts per style instead of spans\n");
+    fprintf(stderr, "  -p file  write match attempts, matches and time per context as JSON\n");
+    fprintf(stderr, "  -f file  write the time per context as folded stacks for flame graphs\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static output out;
+    static mclex_profile profile;
+    const char *json = 0;
+    const char *folded = 0;
+    mclex_profile *prof;
+    mclex_emit emit = print_span;
+    mclex_lexer lexer = mclex_line;
+    int summary = 0;
+    int rc = 0;
+    int i;
+
+    for (i = 1; i < argc && argv[i][0] == '-' && argv[i][1]; i++) {
+        if (strcmp(argv[i], "-c") == 0) {
+            out.contexts = 1;
+        } else if (strcmp(argv[i], "-d") == 0) {
+            lexer = mclex_dfa_line;
+        } else if (strcmp(argv[i], "-s") == 0) {
+            summary = 1;
+            emit = count_span;
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            json = argv[++i];
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            folded = argv[++i];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+
+    prof = (json || folded) ? &profile : 0;
+    if (i == argc) {
+        rc = tokenize_file(stdin, lexer, prof, emit, &out);
+    }
+    for (; i < argc; i++) {
+        FILE *file = fopen(argv[i], "rb");
+        if (!file) {
+            perror(argv[i]);
+            rc = -1;
+            continue;
+        }
+        if (tokenize_file(file, lexer, prof, emit, &out)) {
+            fprintf(stderr, "%s: read error\n", argv[i]);
+            rc = -1;
+        }
+        fclose(file);
+    }
+
+    flush_output(&out);
+    if (summary) {
+        print_summary(&out);
+    }
+    if (json && write_profile(json, &profile, lexer == mclex_line ? "mcodetok" : "mcodetok-dfa", 0)) {
+        rc = -1;
+    }
+    if (folded && write_profile(folded, &profile, 0, 1)) {
+        rc = -1;
+    }
+    return rc ? 1 : 0;
+}